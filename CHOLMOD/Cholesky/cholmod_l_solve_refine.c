@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// CHOLMOD/Cholesky/cholmod_l_solve_refine: int64_t version of solve_refine
+//------------------------------------------------------------------------------
+
+// CHOLMOD/Cholesky Module.  Copyright (C) 2005-2023, Timothy A. Davis
+// All Rights Reserved.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+#define CHOLMOD_INT64
+#include "cholmod_solve_refine.c"
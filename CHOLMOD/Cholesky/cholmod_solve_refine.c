@@ -0,0 +1,258 @@
+//------------------------------------------------------------------------------
+// CHOLMOD/Cholesky/cholmod_solve_refine: solve Ax=b with iterative refinement
+//------------------------------------------------------------------------------
+
+// CHOLMOD/Cholesky Module.  Copyright (C) 2005-2023, Timothy A. Davis
+// All Rights Reserved.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+// Solves Ax=b (or AA'x=b if A is unsymmetric) using a factorization L of A
+// (or AA'), followed by iterative refinement with residuals computed from A
+// itself.  The main use is mixed precision: L is a single precision factor of
+// a double precision matrix A.  The factorization then takes half the memory
+// and runs the BLAS at roughly twice the speed, and the refinement recovers
+// the accuracy of a double precision solve if A is not too ill-conditioned.
+// To obtain a single precision factor of a double matrix A:
+//
+//      As = cholmod_copy_sparse (A, &Common) ;
+//      cholmod_sparse_xtype (As->xtype + CHOLMOD_SINGLE, As, &Common) ;
+//      L = cholmod_analyze (As, &Common) ;
+//      cholmod_factorize (As, L, &Common) ;
+//      cholmod_free_sparse (&As, &Common) ;
+//      X = cholmod_solve_refine (L, A, B, &Common) ;
+//
+// Each step solves L*L'*d = r in the precision of L (r is converted to the
+// dtype of L first), updates x = x + d, and then computes the residual
+// r = b - A*x in the precision of A with cholmod_sdmult.  The iteration stops
+// when the componentwise backward error norm(r)/(norm(A)*norm(x)+norm(b)) is
+// at most the machine epsilon of A, when the residual fails to decrease by at
+// least a factor of two, or after Common->refine_max steps.  If the last
+// step increased the residual, its update is discarded and the previous x is
+// returned.  The # of refinement steps kept is returned in
+// Common->refine_steps (zero if the first solve was accurate enough).
+//
+// L must be a factorization of A itself: if beta was used in
+// cholmod_factorize_p, the refinement converges to the solution of Ax=b, not
+// (A+beta*I)x=b.  A and B must have the same xtype and dtype; L may have any
+// xtype and dtype.  X is returned with the same xtype and dtype as A and B.
+//
+// Requires the MatrixOps Module (for cholmod_sdmult and cholmod_norm_*).
+
+#include "cholmod_internal.h"
+#include <float.h>
+
+#ifndef NCHOLESKY
+#ifndef NMATRIXOPS
+
+//------------------------------------------------------------------------------
+// solve_refine_residual: R = B - A*X or R = B - A*(A'*X)
+//------------------------------------------------------------------------------
+
+static int solve_refine_residual
+(
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_dense *X,
+    cholmod_dense *T,   // workspace of size ncol-by-nrhs if A is unsymmetric
+    cholmod_dense *R,   // output
+    cholmod_common *Common
+)
+{
+    double minus_one [2] = {-1,0}, one [2] = {1,0}, zero [2] = {0,0} ;
+    CHOLMOD(copy_dense2) (B, R, Common) ;
+    if (A->stype == 0)
+    {
+        // R = R - A*(A'*X)
+        CHOLMOD(sdmult) (A, 1, one, zero, X, T, Common) ;
+        CHOLMOD(sdmult) (A, 0, minus_one, one, T, R, Common) ;
+    }
+    else
+    {
+        // R = R - A*X
+        CHOLMOD(sdmult) (A, 0, minus_one, one, X, R, Common) ;
+    }
+    return (Common->status == CHOLMOD_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// solve_refine_add: X = X + D
+//------------------------------------------------------------------------------
+
+#define SOLVE_REFINE_ADD(type)                                              \
+{                                                                           \
+    type *Xx = (type *) X->x, *Dx = (type *) D->x ;                         \
+    for (size_t k = 0 ; k < nx ; k++)                                       \
+    {                                                                       \
+        Xx [k] += Dx [k] ;                                                  \
+    }                                                                       \
+    if (X->xtype == CHOLMOD_ZOMPLEX)                                        \
+    {                                                                       \
+        type *Xz = (type *) X->z, *Dz = (type *) D->z ;                     \
+        for (size_t k = 0 ; k < nx ; k++)                                   \
+        {                                                                   \
+            Xz [k] += Dz [k] ;                                              \
+        }                                                                   \
+    }                                                                       \
+}
+
+static void solve_refine_add
+(
+    cholmod_dense *X,
+    cholmod_dense *D    // same size, xtype, dtype, and leading dim as X
+)
+{
+    size_t nx = X->nrow * X->ncol * ((X->xtype == CHOLMOD_COMPLEX) ? 2 : 1) ;
+    if (X->dtype == CHOLMOD_DOUBLE)
+    {
+        SOLVE_REFINE_ADD (double) ;
+    }
+    else
+    {
+        SOLVE_REFINE_ADD (float) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// cholmod_solve_refine
+//------------------------------------------------------------------------------
+
+cholmod_dense *CHOLMOD(solve_refine)    // returns the solution X
+(
+    // input:
+    cholmod_factor *L,  // factorization of A (any dtype)
+    cholmod_sparse *A,  // matrix to use for the residual
+    cholmod_dense *B,   // right-hand-side, same xtype and dtype as A
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (L, NULL) ;
+    RETURN_IF_NULL (A, NULL) ;
+    RETURN_IF_NULL (B, NULL) ;
+    RETURN_IF_XTYPE_INVALID (L, CHOLMOD_REAL, CHOLMOD_ZOMPLEX, NULL) ;
+    RETURN_IF_XTYPE_INVALID (A, CHOLMOD_REAL, CHOLMOD_ZOMPLEX, NULL) ;
+    RETURN_IF_XTYPE_INVALID (B, CHOLMOD_REAL, CHOLMOD_ZOMPLEX, NULL) ;
+    Common->refine_steps = 0 ;
+    if (A->xtype != B->xtype || A->dtype != B->dtype)
+    {
+        ERROR (CHOLMOD_INVALID, "A and B must have the same xtype and dtype") ;
+        return (NULL) ;
+    }
+    size_t n = L->n ;
+    if (A->nrow != n || B->nrow != n || (A->stype != 0 && A->ncol != n))
+    {
+        ERROR (CHOLMOD_INVALID, "dimensions of L, A, and B do not match") ;
+        return (NULL) ;
+    }
+    Common->status = CHOLMOD_OK ;
+
+    //--------------------------------------------------------------------------
+    // allocate the result and workspace
+    //--------------------------------------------------------------------------
+
+    size_t nrhs = B->ncol ;
+    int xdtype = A->xtype + A->dtype ;
+    cholmod_dense *X = CHOLMOD(zeros) (n, nrhs, xdtype, Common) ;
+    cholmod_dense *R = CHOLMOD(copy_dense) (B, Common) ;
+    cholmod_dense *Xold = CHOLMOD(zeros) (n, nrhs, xdtype, Common) ;
+    cholmod_dense *T = NULL, *D = NULL, *Y = NULL, *E = NULL ;
+    if (A->stype == 0)
+    {
+        T = CHOLMOD(zeros) (A->ncol, nrhs, xdtype, Common) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // solve and refine
+    //--------------------------------------------------------------------------
+
+    double eps = (A->dtype == CHOLMOD_DOUBLE) ? DBL_EPSILON : FLT_EPSILON ;
+    double anorm = CHOLMOD(norm_sparse) (A, 0, Common) ;
+    if (A->stype == 0)
+    {
+        // norm (A*A') <= norm (A,inf) * norm (A,1)
+        anorm *= CHOLMOD(norm_sparse) (A, 1, Common) ;
+    }
+    double bnorm = CHOLMOD(norm_dense) (B, 0, Common) ;
+    double rnorm_old = 0 ;
+
+    for (int iter = 0 ; Common->status == CHOLMOD_OK ; iter++)
+    {
+
+        //----------------------------------------------------------------------
+        // D = A\R, using the factorization in the precision of L
+        //----------------------------------------------------------------------
+
+        if (L->dtype != R->dtype)
+        {
+            CHOLMOD(dense_xtype) (R->xtype + L->dtype, R, Common) ;
+        }
+        CHOLMOD(solve2) (CHOLMOD_A, L, R, NULL, &D, NULL, &Y, &E, Common) ;
+        if (Common->status < CHOLMOD_OK) break ;
+        CHOLMOD(dense_xtype) (xdtype, D, Common) ;
+        if (Common->status < CHOLMOD_OK) break ;
+        if (R->dtype != A->dtype)
+        {
+            CHOLMOD(dense_xtype) (xdtype, R, Common) ;
+            if (Common->status < CHOLMOD_OK) break ;
+        }
+
+        //----------------------------------------------------------------------
+        // X = X + D and R = B - A*X, keeping the prior X in Xold
+        //----------------------------------------------------------------------
+
+        if (iter > 0)
+        {
+            CHOLMOD(copy_dense2) (X, Xold, Common) ;
+        }
+        solve_refine_add (X, D) ;
+        if (!solve_refine_residual (A, B, X, T, R, Common)) break ;
+        Common->refine_steps = iter ;
+
+        //----------------------------------------------------------------------
+        // check for convergence
+        //----------------------------------------------------------------------
+
+        double rnorm = CHOLMOD(norm_dense) (R, 0, Common) ;
+        double xnorm = CHOLMOD(norm_dense) (X, 0, Common) ;
+        double denom = anorm * xnorm + bnorm ;
+        if (iter > 0 && !(rnorm <= rnorm_old))
+        {
+            // the last step made the residual worse: discard it
+            CHOLMOD(copy_dense2) (Xold, X, Common) ;
+            Common->refine_steps = iter - 1 ;
+            break ;
+        }
+        if (rnorm <= eps * denom || isnan (rnorm) || iter >= Common->refine_max
+            || (iter > 0 && rnorm > rnorm_old / 2))
+        {
+            break ;
+        }
+        rnorm_old = rnorm ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    CHOLMOD(free_dense) (&R, Common) ;
+    CHOLMOD(free_dense) (&Xold, Common) ;
+    CHOLMOD(free_dense) (&T, Common) ;
+    CHOLMOD(free_dense) (&D, Common) ;
+    CHOLMOD(free_dense) (&Y, Common) ;
+    CHOLMOD(free_dense) (&E, Common) ;
+    if (Common->status < CHOLMOD_OK)
+    {
+        CHOLMOD(free_dense) (&X, Common) ;
+    }
+    return (X) ;
+}
+
+#endif
+#endif
@@ -246,13 +246,13 @@
 // version control
 //------------------------------------------------------------------------------
 
-#define CHOLMOD_DATE "May 5, 2025"
-#define CHOLMOD_MAIN_VERSION   5
-#define CHOLMOD_SUB_VERSION    3
-#define CHOLMOD_SUBSUB_VERSION 3
+#define CHOLMOD_DATE "Oct 18, 2026"
+#define CHOLMOD_MAIN_VERSION   6
+#define CHOLMOD_SUB_VERSION    0
+#define CHOLMOD_SUBSUB_VERSION 0
 
 #define CHOLMOD_VER_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define CHOLMOD_VERSION CHOLMOD_VER_CODE(5,3)
+#define CHOLMOD_VERSION CHOLMOD_VER_CODE(6,0)
 #define CHOLMOD_HAS_VERSION_FUNCTION
 
 #ifdef __cplusplus
@@ -307,10 +307,10 @@ int cholmod_l_version (int version [3]) ;
 
 #include "SuiteSparse_config.h"
 
-#define CHOLMOD__VERSION SUITESPARSE__VERCODE(5,3,3)
+#define CHOLMOD__VERSION SUITESPARSE__VERCODE(6,0,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,10,2))
-#error "CHOLMOD 5.3.3 requires SuiteSparse_config 7.10.2 or later"
+#error "CHOLMOD 6.0.0 requires SuiteSparse_config 7.10.2 or later"
 #endif
 
 //------------------------------------------------------------------------------
@@ -992,6 +992,34 @@ typedef struct cholmod_common_struct
     int nthreads_max ; // max # of OpenMP threads to use in CHOLMOD.
         // Defaults to SUITESPARSE_OPENMP_MAX_THREADS.
 
+    double tree_split ; // controls the tree-parallel supernodal factorization.
+        // If zero or less (the default), the supernodes are factorized in
+        // postorder, and only the BLAS and some small loops within each
+        // supernode are parallel.  If positive, cholmod_super_numeric splits
+        // the supernodal etree into independent subtrees whose estimated
+        // flop count is at most fl/(tree_split*nthreads), where fl is the
+        // flop count of the whole factorization, and factorizes these
+        // subtrees in parallel (one OpenMP task per subtree, each with its own
+        // workspace).  The remaining supernodes near the root are factorized
+        // afterwards.  A value of 4 to 8 is a good choice.  The factor L is
+        // identical to the factor computed by the sequential method.  Ignored
+        // if the GPU is used.
+
+    int level_solve ;   // controls the parallel supernodal triangular solve.
+        // If FALSE (the default), cholmod_super_lsolve and
+        // cholmod_super_ltsolve traverse the supernodes in order, and only
+        // the BLAS are parallel.  If TRUE, the supernodes are scheduled by
+        // their level in the supernodal etree, and all supernodes in the same
+        // level are solved in parallel (each thread with its own gather
+        // buffer).  The schedule costs O(nnz(L->s)) time to construct for
+        // each solve, and pays off when the supernodes are small and many
+        // solves are done with the same factor, or when nrhs is large.
+
+    int refine_max ;    // max # of iterative refinement steps taken by
+        // cholmod_solve_refine (default 10).  Zero means no refinement.
+    int refine_steps ;  // output: # of refinement steps taken by the last
+        // call to cholmod_solve_refine.
+
     #ifdef BLAS_DUMP
     FILE *blas_dump ;  // only used if CHOLMOD is compiled with -DBLAS_DUMP
     #endif
@@ -2861,6 +2889,27 @@ cholmod_sparse *cholmod_spsolve             // returns the sparse solution X
 cholmod_sparse *cholmod_l_spsolve (int, cholmod_factor *, cholmod_sparse *,
     cholmod_common *) ;
 
+//------------------------------------------------------------------------------
+// cholmod_solve_refine:  solve Ax=b with iterative refinement
+//------------------------------------------------------------------------------
+
+// L may be a single precision factor of the double precision matrix A; the
+// refinement uses residuals computed in the precision of A.  Requires the
+// MatrixOps Module.
+
+#ifndef NMATRIXOPS
+cholmod_dense *cholmod_solve_refine     // returns the solution X
+(
+    // input:
+    cholmod_factor *L,  // factorization of A (any dtype)
+    cholmod_sparse *A,  // matrix to use for the residual
+    cholmod_dense *B,   // right-hand-side, same xtype and dtype as A
+    cholmod_common *Common
+) ;
+cholmod_dense *cholmod_l_solve_refine (cholmod_factor *, cholmod_sparse *,
+    cholmod_dense *, cholmod_common *) ;
+#endif
+
 //------------------------------------------------------------------------------
 // cholmod_etree: find the elimination tree of A or A'*A
 //------------------------------------------------------------------------------
@@ -194,6 +194,7 @@ cholmod_src = {
     '../Cholesky/cholmod_l_rowfac', ...
     '../Cholesky/cholmod_l_solve', ...
     '../Cholesky/cholmod_l_spsolve', ...
+    '../Cholesky/cholmod_l_solve_refine', ...
     '../MatrixOps/cholmod_l_drop', ...
     '../MatrixOps/cholmod_l_horzcat', ...
     '../MatrixOps/cholmod_l_norm', ...
@@ -44,6 +44,11 @@
 //      Allocates temporary space of size L->maxcsize * sizeof(double)
 //      (twice that for the complex/zomplex case).
 //
+// If Common->tree_split is positive, independent subtrees of the supernodal
+// etree are factorized in parallel, and each thread is given its own copy of
+// the Map, RelativeMap, and C workspace.  If that workspace cannot be
+// allocated, the supernodes are factorized in postorder instead.
+//
 // If L is supernodal symbolic on input, it is converted to a supernodal numeric
 // factor on output, with an xtype of real if A is real, or complex if A is
 // complex or zomplex.  If L is supernodal numeric on input, its xtype must
@@ -55,6 +60,31 @@
 #ifndef NGPL
 #ifndef NSUPERNODAL
 
+//------------------------------------------------------------------------------
+// subtree tasks for the tree-parallel factorization
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    double work ;       // estimated flop count of the subtree
+    Int first ;         // the subtree consists of supernodes first to root
+    Int root ;
+    Int nescape ;       // # of supernodes in Escape [first...], or EMPTY if
+                        // the subtree could not be factorized
+} super_task ;
+
+typedef struct
+{
+    Int ntasks ;        // # of subtrees to factorize in parallel
+    int nthreads ;      // # of threads to use
+    super_task *Task ;  // size ntasks, sorted by decreasing work
+    Int *Stask ;        // size nsuper; Stask [s] = t if supernode s is in
+                        // Task [t], or EMPTY if s is in no subtree
+    Int *Escape ;       // size nsuper
+    Int *Iwork ;        // size 2*n*nthreads: Map and RelativeMap per thread
+    cholmod_dense *C ;  // maxcsize-by-nthreads: C workspace per thread
+} super_tree ;
+
 //------------------------------------------------------------------------------
 // GPU templates: double and double complex cases only
 //------------------------------------------------------------------------------
@@ -89,6 +119,260 @@
 #define ZOMPLEX
 #include "t_cholmod_super_numeric_worker.c"
 
+//------------------------------------------------------------------------------
+// super_tree_free: free the workspace for the tree-parallel factorization
+//------------------------------------------------------------------------------
+
+static void super_tree_free
+(
+    super_tree *Tree,
+    Int nsuper,
+    Int n,
+    cholmod_common *Common
+)
+{
+    CHOLMOD(free) (Tree->ntasks, sizeof (super_task), Tree->Task, Common) ;
+    CHOLMOD(free) (nsuper, sizeof (Int), Tree->Stask, Common) ;
+    CHOLMOD(free) (nsuper, sizeof (Int), Tree->Escape, Common) ;
+    CHOLMOD(free) (2*((size_t) n) * Tree->nthreads, sizeof (Int), Tree->Iwork,
+        Common) ;
+    CHOLMOD(free_dense) (&(Tree->C), Common) ;
+    Tree->Task = NULL ;
+    Tree->Stask = NULL ;
+    Tree->Escape = NULL ;
+    Tree->Iwork = NULL ;
+}
+
+//------------------------------------------------------------------------------
+// super_tree_taskcomp: for sorting the tasks by decreasing work with qsort
+//------------------------------------------------------------------------------
+
+static int super_tree_taskcomp (const void *p, const void *q)
+{
+    const super_task *a = (const super_task *) p ;
+    const super_task *b = (const super_task *) q ;
+    if (a->work > b->work) return (-1) ;
+    if (a->work < b->work) return ( 1) ;
+    return ((a->root < b->root) ? -1 : 1) ;
+}
+
+//------------------------------------------------------------------------------
+// super_tree_init: find the subtrees to factorize in parallel
+//------------------------------------------------------------------------------
+
+// Splits the supernodal etree into independent subtrees for the tree-parallel
+// factorization.  The work of each supernode is estimated as the flop count of
+// its own columns, and a subtree becomes a task if its total work is at most
+// fl/(Common->tree_split*nthreads), where fl is the work of the whole tree,
+// and if the work of the subtree rooted at its parent exceeds that limit.
+// The supernodes of each subtree must be contiguous, which holds if the
+// supernodes are in postorder.  SuperMap must already be computed.
+//
+// Returns TRUE if the tree-parallel factorization is to be used, in which
+// case the workspace is allocated and must be freed with super_tree_free.
+// Returns FALSE if Common->tree_split is not positive, if fewer than two
+// subtrees are found, if the subtrees are not contiguous, or if out of memory.
+// Running out of memory is not an error; the supernodes are then simply
+// factorized in postorder.
+
+static int super_tree_init
+(
+    super_tree *Tree,
+    cholmod_factor *L,
+    Int *SuperMap,
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the tree-parallel factorization is requested
+    //--------------------------------------------------------------------------
+
+    memset (Tree, 0, sizeof (super_tree)) ;
+    Int nsuper = L->nsuper ;
+    Int n = L->n ;
+    if (!(Common->tree_split > 0) || nsuper < 2 ||
+        (Common->useGPU == 1 && L->useGPU))
+    {
+        return (FALSE) ;
+    }
+
+    Int *Super = L->super ;
+    Int *Lpi = L->pi ;
+    Int *Ls = L->s ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace, without reporting an error if out of memory
+    //--------------------------------------------------------------------------
+
+    int save_try_catch = Common->try_catch ;
+    Common->try_catch = TRUE ;
+    double *W = CHOLMOD(malloc) (nsuper, sizeof (double), Common) ;
+    Tree->Stask = CHOLMOD(malloc) (nsuper, sizeof (Int), Common) ;
+    Tree->Escape = CHOLMOD(malloc) (nsuper, sizeof (Int), Common) ;
+    int ok = (Common->status == CHOLMOD_OK) ;
+
+    //--------------------------------------------------------------------------
+    // find the work in each subtree
+    //--------------------------------------------------------------------------
+
+    double fl = 0 ;
+    if (ok)
+    {
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            W [s] = 0 ;
+        }
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            // flop count of columns k1:k2-1 of L: sum of (nsrow-j)^2
+            double c = (double) (Super [s+1] - Super [s]) ;
+            double r = (double) (Lpi [s+1] - Lpi [s]) ;
+            W [s] += c * r * (r - c + 1) + c * (c - 1) * (2*c - 1) / 6 ;
+            Int nscol = Super [s+1] - Super [s] ;
+            if (Lpi [s+1] - Lpi [s] > nscol)
+            {
+                // add the work of subtree s to its parent
+                Int sparent = SuperMap [Ls [Lpi [s] + nscol]] ;
+                ASSERT (sparent > s && sparent < nsuper) ;
+                W [sparent] += W [s] ;
+            }
+            else
+            {
+                fl += W [s] ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find the subtrees
+    //--------------------------------------------------------------------------
+
+    // Stask [s] is the subtree containing s.  The subtrees are first numbered
+    // by decreasing root, and the first supernode of each subtree is found.
+
+    Int ntasks = 0 ;
+    int nthreads = cholmod_nthreads (fl, Common) ;
+    double limit = fl / (Common->tree_split * nthreads) ;
+    if (ok)
+    {
+        for (Int s = nsuper-1 ; s >= 0 ; s--)
+        {
+            Int nscol = Super [s+1] - Super [s] ;
+            Int sparent = (Lpi [s+1] - Lpi [s] > nscol) ?
+                SuperMap [Ls [Lpi [s] + nscol]] : EMPTY ;
+            if (sparent != EMPTY && Tree->Stask [sparent] != EMPTY)
+            {
+                // s is in the same subtree as its parent
+                Tree->Stask [s] = Tree->Stask [sparent] ;
+            }
+            else if (W [s] <= limit)
+            {
+                // s is the root of a new subtree
+                Tree->Stask [s] = ntasks++ ;
+            }
+            else
+            {
+                // s is factorized after all the subtrees
+                Tree->Stask [s] = EMPTY ;
+            }
+        }
+        ok = (ntasks >= 2) ;
+    }
+
+    if (ok)
+    {
+        Tree->Task = CHOLMOD(malloc) (ntasks, sizeof (super_task), Common) ;
+        ok = (Common->status == CHOLMOD_OK) ;
+    }
+
+    if (ok)
+    {
+        Tree->ntasks = ntasks ;
+        super_task *Task = Tree->Task ;
+        for (Int t = 0 ; t < ntasks ; t++)
+        {
+            Task [t].nescape = 0 ;
+        }
+        for (Int s = nsuper-1 ; s >= 0 ; s--)
+        {
+            Int t = Tree->Stask [s] ;
+            if (t == EMPTY) continue ;
+            if (Task [t].nescape == 0)
+            {
+                // s is the root of subtree t
+                Task [t].root = s ;
+                Task [t].work = W [s] ;
+            }
+            Task [t].first = s ;
+            Task [t].nescape++ ;
+        }
+
+        // each subtree must consist of supernodes first to root
+        for (Int t = 0 ; ok && t < ntasks ; t++)
+        {
+            ok = (Task [t].nescape == Task [t].root - Task [t].first + 1) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the subtrees by decreasing work
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        super_task *Task = Tree->Task ;
+        qsort (Task, ntasks, sizeof (super_task), super_tree_taskcomp) ;
+        for (Int t = 0 ; t < ntasks ; t++)
+        {
+            Task [t].nescape = 0 ;
+            for (Int s = Task [t].first ; s <= Task [t].root ; s++)
+            {
+                Tree->Stask [s] = t ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the Map, RelativeMap, and C workspace for each thread
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        nthreads = (int) MIN (nthreads, ntasks) ;
+        Tree->nthreads = nthreads ;
+        size_t iworksize = CHOLMOD(mult_size_t) (2*((size_t) n), nthreads, &ok);
+        if (ok)
+        {
+            Tree->Iwork = CHOLMOD(malloc) (iworksize, sizeof (Int), Common) ;
+            Tree->C = CHOLMOD(allocate_dense) (L->maxcsize, nthreads,
+                L->maxcsize, L->xtype + L->dtype, Common) ;
+            ok = (Common->status == CHOLMOD_OK) ;
+        }
+        if (ok)
+        {
+            for (size_t i = 0 ; i < iworksize ; i++)
+            {
+                Tree->Iwork [i] = EMPTY ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free the work estimates and return result
+    //--------------------------------------------------------------------------
+
+    CHOLMOD(free) (nsuper, sizeof (double), W, Common) ;
+    if (!ok)
+    {
+        super_tree_free (Tree, nsuper, n, Common) ;
+        memset (Tree, 0, sizeof (super_tree)) ;
+    }
+    Common->try_catch = save_try_catch ;
+    Common->status = CHOLMOD_OK ;
+    return (ok) ;
+}
+
 //------------------------------------------------------------------------------
 // cholmod_super_numeric
 //------------------------------------------------------------------------------
@@ -284,6 +568,17 @@ int CHOLMOD(super_numeric)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // find the subtrees to factorize in parallel, if requested
+    //--------------------------------------------------------------------------
+
+    super_tree Tree_struct ;
+    super_tree *Tree = NULL ;
+    if (super_tree_init (&Tree_struct, L, SuperMap, Common))
+    {
+        Tree = &Tree_struct ;
+    }
+
     //--------------------------------------------------------------------------
     // supernodal numerical factorization, using template routine
     //--------------------------------------------------------------------------
@@ -295,29 +590,35 @@ int CHOLMOD(super_numeric)
     switch ((A->xtype + A->dtype) % 8)
     {
         case CHOLMOD_REAL    + CHOLMOD_SINGLE:
-            ok = rs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Common) ;
+            ok = rs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Tree,
+                Common) ;
             break ;
 
         case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
-            ok = cs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Common) ;
+            ok = cs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Tree,
+                Common) ;
             break ;
 
         case CHOLMOD_ZOMPLEX + CHOLMOD_SINGLE:
             // A is zomplex, but L is complex
-            ok = zs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Common) ;
+            ok = zs_cholmod_super_numeric_worker (A, F, s_beta, L, C, Tree,
+                Common) ;
             break ;
 
         case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
-            ok = rd_cholmod_super_numeric_worker (A, F, beta, L, C, Common) ;
+            ok = rd_cholmod_super_numeric_worker (A, F, beta, L, C, Tree,
+                Common) ;
             break ;
 
         case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
-            ok = cd_cholmod_super_numeric_worker (A, F, beta, L, C, Common) ;
+            ok = cd_cholmod_super_numeric_worker (A, F, beta, L, C, Tree,
+                Common) ;
             break ;
 
         case CHOLMOD_ZOMPLEX + CHOLMOD_DOUBLE:
             // A is zomplex, but L is complex
-            ok = zd_cholmod_super_numeric_worker (A, F, beta, L, C, Common) ;
+            ok = zd_cholmod_super_numeric_worker (A, F, beta, L, C, Tree,
+                Common) ;
             break ;
     }
 
@@ -331,6 +632,10 @@ int CHOLMOD(super_numeric)
     ASSERT (check_flag (Common)) ;
     ASSERT (CHOLMOD(dump_work) (TRUE, TRUE, 0, 0, Common)) ;
     CHOLMOD(free_dense) (&C, Common) ;
+    if (Tree != NULL)
+    {
+        super_tree_free (Tree, nsuper, n, Common) ;
+    }
     return (ok) ;
 }
 
@@ -20,6 +20,29 @@
 #ifndef NGPL
 #ifndef NSUPERNODAL
 
+//------------------------------------------------------------------------------
+// level schedule for the parallel supernodal solve
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    Int nlevels ;       // # of levels in the supernodal etree
+    int nthreads ;      // max # of threads to use
+    Int nsuper ;        // # of supernodes
+    Int ndep ;          // # of entries in the dependency lists
+    Int *Levelp ;       // size nlevels+1
+    Int *Leveli ;       // size nsuper; supernodes in level h are in
+                        // Leveli [Levelp [h] ... Levelp [h+1]-1]
+    Int *Depp ;         // size nsuper+1, or NULL for the backsolve
+    Int *Depi ;         // size 3*ndep; the updates to supernode s are the
+                        // triplets (d,p1,p2) in Depi [3*Depp [s] ...], where
+                        // Ls [p1...p2-1] are the rows of d that lie in s
+    cholmod_dense *W ;  // esize-by-nthreads workspace, or NULL if nthreads
+                        // is 1 and the caller's workspace E is used instead
+    void *Ework ;       // W->x or E->x
+    size_t esize ;      // size of the workspace for each thread
+} super_levels ;
+
 //------------------------------------------------------------------------------
 // t_cholmod_super_solve
 //------------------------------------------------------------------------------
@@ -37,6 +60,248 @@
 #define COMPLEX
 #include "t_cholmod_super_solve_worker.c"
 
+//------------------------------------------------------------------------------
+// super_levels_free: free the level schedule
+//------------------------------------------------------------------------------
+
+static void super_levels_free
+(
+    super_levels *Levels,
+    cholmod_common *Common
+)
+{
+    Int nsuper = Levels->nsuper ;
+    CHOLMOD(free) (nsuper+1, sizeof (Int), Levels->Levelp, Common) ;
+    CHOLMOD(free) (nsuper, sizeof (Int), Levels->Leveli, Common) ;
+    CHOLMOD(free) (nsuper+1, sizeof (Int), Levels->Depp, Common) ;
+    CHOLMOD(free) (3*((size_t) Levels->ndep), sizeof (Int), Levels->Depi,
+        Common) ;
+    CHOLMOD(free_dense) (&(Levels->W), Common) ;
+    memset (Levels, 0, sizeof (super_levels)) ;
+}
+
+//------------------------------------------------------------------------------
+// super_levels_init: construct the level schedule for the supernodal solve
+//------------------------------------------------------------------------------
+
+// Supernode s is placed in level h, where h is the height of s in the
+// supernodal etree (leaves are in level 0).  A supernode depends only on its
+// descendants in the forward solve, and only on its ancestors in the
+// backsolve, so all the supernodes in a single level can be solved in
+// parallel.  For the forward solve (deps TRUE), the dependency lists are also
+// constructed, in increasing order of the descendant d, so that the updates
+// to each supernode are applied in the same order as the sequential solve.
+//
+// Returns TRUE if the schedule is constructed, in which case it must be freed
+// with super_levels_free.  Returns FALSE if the level solve is not requested or
+// if out of memory; in that case no error is reported and the sequential
+// method is used instead.
+
+static int super_levels_init
+(
+    super_levels *Levels,
+    cholmod_factor *L,
+    cholmod_dense *X,
+    cholmod_dense *E,
+    int deps,               // if TRUE, construct the dependency lists
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the level solve is requested
+    //--------------------------------------------------------------------------
+
+    memset (Levels, 0, sizeof (super_levels)) ;
+    Int nsuper = L->nsuper ;
+    Int n = L->n ;
+    if (!(Common->level_solve) || nsuper < 2)
+    {
+        return (FALSE) ;
+    }
+
+    Int *Super = L->super ;
+    Int *Lpi = L->pi ;
+    Int *Lpx = L->px ;
+    Int *Ls = L->s ;
+    Int nrhs = X->ncol ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace, without reporting an error if out of memory
+    //--------------------------------------------------------------------------
+
+    int save_try_catch = Common->try_catch ;
+    Common->try_catch = TRUE ;
+    Levels->nsuper = nsuper ;
+    Int *SuperMap = CHOLMOD(malloc) (n, sizeof (Int), Common) ;
+    Int *Level = CHOLMOD(malloc) (nsuper, sizeof (Int), Common) ;
+    Levels->Levelp = CHOLMOD(malloc) (nsuper+1, sizeof (Int), Common) ;
+    Levels->Leveli = CHOLMOD(malloc) (nsuper, sizeof (Int), Common) ;
+    if (deps)
+    {
+        Levels->Depp = CHOLMOD(malloc) (nsuper+1, sizeof (Int), Common) ;
+    }
+    int ok = (Common->status == CHOLMOD_OK) ;
+
+    //--------------------------------------------------------------------------
+    // find the level of each supernode
+    //--------------------------------------------------------------------------
+
+    Int nlevels = 0 ;
+    if (ok)
+    {
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            for (Int k = Super [s] ; k < Super [s+1] ; k++)
+            {
+                SuperMap [k] = s ;
+            }
+            Level [s] = 0 ;
+        }
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            Int nscol = Super [s+1] - Super [s] ;
+            if (Lpi [s+1] - Lpi [s] > nscol)
+            {
+                Int sparent = SuperMap [Ls [Lpi [s] + nscol]] ;
+                ASSERT (sparent > s && sparent < nsuper) ;
+                Level [sparent] = MAX (Level [sparent], Level [s] + 1) ;
+            }
+            nlevels = MAX (nlevels, Level [s] + 1) ;
+        }
+
+        // Levelp [h] = start of level h
+        Int *Levelp = Levels->Levelp ;
+        for (Int h = 0 ; h <= nlevels ; h++)
+        {
+            Levelp [h] = 0 ;
+        }
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            Levelp [Level [s] + 1]++ ;
+        }
+        for (Int h = 0 ; h < nlevels ; h++)
+        {
+            Levelp [h+1] += Levelp [h] ;
+        }
+
+        // place the supernodes in each level, in increasing order
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            Levels->Leveli [Levelp [Level [s]]++] = s ;
+        }
+        for (Int h = nlevels ; h > 0 ; h--)
+        {
+            Levelp [h] = Levelp [h-1] ;
+        }
+        Levelp [0] = 0 ;
+        Levels->nlevels = nlevels ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the dependency lists for the forward solve
+    //--------------------------------------------------------------------------
+
+    if (ok && deps)
+    {
+        // count the updates to each supernode
+        Int *Depp = Levels->Depp ;
+        for (Int s = 0 ; s <= nsuper ; s++)
+        {
+            Depp [s] = 0 ;
+        }
+        for (Int d = 0 ; d < nsuper ; d++)
+        {
+            Int slast = EMPTY ;
+            for (Int p = Lpi [d] + Super [d+1] - Super [d] ; p < Lpi [d+1] ;
+                p++)
+            {
+                Int s = SuperMap [Ls [p]] ;
+                if (s != slast)
+                {
+                    Depp [s+1]++ ;
+                    slast = s ;
+                }
+            }
+        }
+        for (Int s = 0 ; s < nsuper ; s++)
+        {
+            Depp [s+1] += Depp [s] ;
+        }
+        Levels->ndep = Depp [nsuper] ;
+        Levels->Depi = CHOLMOD(malloc) (3*((size_t) Levels->ndep),
+            sizeof (Int), Common) ;
+        ok = (Common->status == CHOLMOD_OK) ;
+        if (ok)
+        {
+            // Level [s] is the next free slot in the list for supernode s
+            for (Int s = 0 ; s < nsuper ; s++)
+            {
+                Level [s] = Depp [s] ;
+            }
+            Int *Depi = Levels->Depi ;
+            for (Int d = 0 ; d < nsuper ; d++)
+            {
+                Int pend = Lpi [d+1] ;
+                Int p = Lpi [d] + Super [d+1] - Super [d] ;
+                while (p < pend)
+                {
+                    // rows Ls [p1...p2-1] of d all lie in supernode s
+                    Int s = SuperMap [Ls [p]] ;
+                    Int p1 = p ;
+                    while (p < pend && SuperMap [Ls [p]] == s)
+                    {
+                        p++ ;
+                    }
+                    Int q = Level [s]++ ;
+                    Depi [3*q  ] = d ;
+                    Depi [3*q+1] = p1 ;
+                    Depi [3*q+2] = p ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get the gather workspace for each thread
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        double work = ((double) Lpx [nsuper]) * nrhs ;
+        int nthreads = cholmod_nthreads (work, Common) ;
+        nthreads = (int) MIN (nthreads, nsuper) ;
+        Levels->esize = MAX (1, nrhs * L->maxesize) ;
+        Levels->nthreads = nthreads ;
+        if (nthreads > 1)
+        {
+            Levels->W = CHOLMOD(allocate_dense) (Levels->esize, nthreads,
+                Levels->esize, L->xtype + L->dtype, Common) ;
+            ok = (Common->status == CHOLMOD_OK) ;
+            Levels->Ework = ok ? Levels->W->x : NULL ;
+        }
+        else
+        {
+            // use the workspace E provided by the caller
+            Levels->Ework = E->x ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    CHOLMOD(free) (n, sizeof (Int), SuperMap, Common) ;
+    CHOLMOD(free) (nsuper, sizeof (Int), Level, Common) ;
+    if (!ok)
+    {
+        super_levels_free (Levels, Common) ;
+    }
+    Common->try_catch = save_try_catch ;
+    Common->status = CHOLMOD_OK ;
+    return (ok) ;
+}
+
 //------------------------------------------------------------------------------
 // cholmod_super_lsolve: solve x=L\b
 //------------------------------------------------------------------------------
@@ -47,6 +312,9 @@
 //
 // The contents of the workspace E are undefined on both input and output.
 //
+// If Common->level_solve is TRUE, the supernodes are solved in parallel, one
+// level of the supernodal etree at a time (see super_levels_init).
+//
 // workspace: none
 
 int CHOLMOD(super_lsolve)   // TRUE if OK, FALSE if BLAS overflow occured
@@ -111,23 +379,51 @@ int CHOLMOD(super_lsolve)   // TRUE if OK, FALSE if BLAS overflow occured
     // solve Lx=b using template routine
     //--------------------------------------------------------------------------
 
-    switch ((L->xtype + L->dtype) % 8)
+    super_levels Levels ;
+    if (super_levels_init (&Levels, L, X, E, TRUE, Common))
     {
-        case CHOLMOD_REAL    + CHOLMOD_SINGLE:
-            rs_cholmod_super_lsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
-            cs_cholmod_super_lsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
-            rd_cholmod_super_lsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
-            cd_cholmod_super_lsolve_worker (L, X, E, Common) ;
-            break ;
+        // parallel solve, by levels of the supernodal etree
+        switch ((L->xtype + L->dtype) % 8)
+        {
+            case CHOLMOD_REAL    + CHOLMOD_SINGLE:
+                rs_cholmod_super_lsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
+                cs_cholmod_super_lsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
+                rd_cholmod_super_lsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
+                cd_cholmod_super_lsolve_levels (L, &Levels, X, Common) ;
+                break ;
+        }
+        super_levels_free (&Levels, Common) ;
+    }
+    else
+    {
+        // sequential solve, one supernode at a time
+        switch ((L->xtype + L->dtype) % 8)
+        {
+            case CHOLMOD_REAL    + CHOLMOD_SINGLE:
+                rs_cholmod_super_lsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
+                cs_cholmod_super_lsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
+                rd_cholmod_super_lsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
+                cd_cholmod_super_lsolve_worker (L, X, E, Common) ;
+                break ;
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -148,6 +444,9 @@ int CHOLMOD(super_lsolve)   // TRUE if OK, FALSE if BLAS overflow occured
 //
 // The contents of the workspace E are undefined on both input and output.
 //
+// If Common->level_solve is TRUE, the supernodes are solved in parallel, one
+// level of the supernodal etree at a time (see super_levels_init).
+//
 // workspace: none
 
 int CHOLMOD(super_ltsolve)  // TRUE if OK, FALSE if BLAS overflow occured
@@ -212,23 +511,51 @@ int CHOLMOD(super_ltsolve)  // TRUE if OK, FALSE if BLAS overflow occured
     // solve Lx=b using template routine
     //--------------------------------------------------------------------------
 
-    switch ((L->xtype + L->dtype) % 8)
+    super_levels Levels ;
+    if (super_levels_init (&Levels, L, X, E, FALSE, Common))
     {
-        case CHOLMOD_REAL    + CHOLMOD_SINGLE:
-            rs_cholmod_super_ltsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
-            cs_cholmod_super_ltsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
-            rd_cholmod_super_ltsolve_worker (L, X, E, Common) ;
-            break ;
-
-        case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
-            cd_cholmod_super_ltsolve_worker (L, X, E, Common) ;
-            break ;
+        // parallel solve, by levels of the supernodal etree
+        switch ((L->xtype + L->dtype) % 8)
+        {
+            case CHOLMOD_REAL    + CHOLMOD_SINGLE:
+                rs_cholmod_super_ltsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
+                cs_cholmod_super_ltsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
+                rd_cholmod_super_ltsolve_levels (L, &Levels, X, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
+                cd_cholmod_super_ltsolve_levels (L, &Levels, X, Common) ;
+                break ;
+        }
+        super_levels_free (&Levels, Common) ;
+    }
+    else
+    {
+        // sequential solve, one supernode at a time
+        switch ((L->xtype + L->dtype) % 8)
+        {
+            case CHOLMOD_REAL    + CHOLMOD_SINGLE:
+                rs_cholmod_super_ltsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_SINGLE:
+                cs_cholmod_super_ltsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_REAL    + CHOLMOD_DOUBLE:
+                rd_cholmod_super_ltsolve_worker (L, X, E, Common) ;
+                break ;
+
+            case CHOLMOD_COMPLEX + CHOLMOD_DOUBLE:
+                cd_cholmod_super_ltsolve_worker (L, X, E, Common) ;
+                break ;
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -123,12 +123,753 @@
 
 #endif
 
+//------------------------------------------------------------------------------
+// t_cholmod_super_numeric_assemble: assemble A or A*F into supernode s
+//------------------------------------------------------------------------------
+
+// Clears supernode s (if clear is TRUE), constructs its scattered Map, and
+// copies the lower triangular part of A (or A*F) into it, adding beta to the
+// diagonal.  If par is FALSE, no OpenMP parallelism is used; this is the case
+// when the supernode is factorized inside a parallel subtree task.
+
+static void TEMPLATE (cholmod_super_numeric_assemble)
+(
+    // input:
+    cholmod_sparse *A,  // matrix to factorize
+    cholmod_sparse *F,  // F = A' or A(:,f)'
+    Real beta [2],      // beta*I is added to diagonal of matrix to factorize
+    Int s,              // supernode to assemble
+    bool clear,         // if TRUE, clear the supernode first
+    bool par,           // if TRUE, use OpenMP within the supernode
+    // input/output:
+    cholmod_factor *L,  // factorization
+    // workspace:
+    Int *Map,           // size n
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    Int *Super = L->super ;
+    Int *Ls = L->s ;
+    Int *Lpi = L->pi ;
+    Int *Lpx = L->px ;
+    Real *Lx = L->x ;
+
+    Int stype = A->stype ;
+    Int *Ap = A->p ;
+    Int *Ai = A->i ;
+    Real *Ax = A->x ;
+    Real *Az = A->z ;
+    Int *Anz = A->nz ;
+    Int Apacked = A->packed ;
+
+    Int *Fp = NULL, *Fi = NULL, *Fnz = NULL ;
+    Real *Fx = NULL, *Fz = NULL ;
+    Int Fpacked = TRUE ;
+    if (stype == 0)
+    {
+        Fp = F->p ;
+        Fi = F->i ;
+        Fx = F->x ;
+        Fz = F->z ;
+        Fnz = F->nz ;
+        Fpacked = F->packed ;
+    }
+
+    Int k1 = Super [s] ;            // s contains columns k1 to k2-1 of L
+    Int k2 = Super [s+1] ;
+    Int nscol = k2 - k1 ;           // # of columns in all of s
+    Int psi = Lpi [s] ;             // pointer to first row of s in Ls
+    Int psx = Lpx [s] ;             // pointer to first row of s in Lx
+    Int nsrow = Lpi [s+1] - psi ;   // # of rows in all of s
+
+    //--------------------------------------------------------------------------
+    // zero the supernode s
+    //--------------------------------------------------------------------------
+
+    ASSERT ((size_t) (psx + nsrow*nscol) <= L->xsize) ;
+
+    if (clear)
+    {
+        Int pend = psx + nsrow * nscol ;        // s is nsrow-by-nscol
+
+        #ifdef _OPENMP
+        double work = (double) (pend - psx) * L_ENTRY ;
+        int nthreads = (par) ? cholmod_nthreads (work, Common) : 1 ;
+        #endif
+
+        Int p ;
+        #pragma omp parallel for num_threads(nthreads)   \
+            schedule (static) if ( pend - psx > 1024 )
+        for (p = psx ; p < pend ; p++)
+        {
+            L_CLEAR (Lx,p) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the scattered Map for supernode s
+    //--------------------------------------------------------------------------
+
+    // If row i is the kth row in s, then Map [i] = k.  Similarly, if
+    // column j is the kth column in s, then  Map [j] = k.
+
+    #ifdef _OPENMP
+    int nthreads = (par) ? cholmod_nthreads ((double) nsrow, Common) : 1 ;
+    #endif
+
+    Int k ;
+    #pragma omp parallel for num_threads(nthreads)  \
+        if ( nsrow > 128 )
+    for (k = 0 ; k < nsrow ; k++)
+    {
+        PRINT1 (("  "ID" map "ID"\n", Ls [psi+k], k)) ;
+        Map [Ls [psi + k]] = k ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy matrix into supernode s (lower triangular part only)
+    //--------------------------------------------------------------------------
+
+    #ifdef _OPENMP
+    double work ;
+    if (stype != 0)
+    {
+        Int pfirst = Ap [k1] ;
+        Int plast = (Apacked) ? (Ap [k2]) : (pfirst + Anz [k2-1]) ;
+        work = (double) (plast - pfirst) ;
+    }
+    else
+    {
+        Int pfirst = Fp [k1] ;
+        Int plast  = (Fpacked) ? (Fp [k2]) : (pfirst + Fnz [k2-1]) ;
+        work = (double) (plast - pfirst) ;
+    }
+    nthreads = (par) ? cholmod_nthreads (work, Common) : 1 ;
+    #endif
+
+    #pragma omp parallel for num_threads(nthreads) \
+        if ( k2-k1 > 64 )
+    for (k = k1 ; k < k2 ; k++)
+    {
+        if (stype != 0)
+        {
+
+            //------------------------------------------------------------------
+            // copy the kth column of A into the supernode
+            //------------------------------------------------------------------
+
+            Int p = Ap [k] ;
+            Int pend = (Apacked) ? (Ap [k+1]) : (p + Anz [k]) ;
+            for ( ; p < pend ; p++)
+            {
+                // row i of L is located in row Map [i] of s
+                Int i = Ai [p] ;
+                if (i >= k)
+                {
+                    // If the test is false, the numeric factorization of A is
+                    // undefined.  The test does not detect all invalid
+                    // entries, only some of them (when debugging is enabled,
+                    // and Map is cleared after each step, then all entries not
+                    // in the pattern of L are detected).
+                    Int imap = Map [i] ;
+                    if (imap >= 0 && imap < nsrow)
+                    {
+                        // Lx [Map [i] + pk] = Ax [p]
+                        L_ASSIGN (Lx,(imap+(psx+(k-k1)*nsrow)), Ax,Az,p) ;
+                    }
+                }
+            }
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // copy the kth column of A*F into the supernode
+            //------------------------------------------------------------------
+
+            Real fjk [2] ;
+            Int pf = Fp [k] ;
+            Int pfend = (Fpacked) ? (Fp [k+1]) : (pf + Fnz [k]) ;
+            for ( ; pf < pfend ; pf++)
+            {
+                Int j = Fi [pf] ;
+
+                // fjk = Fx [pf]
+                L_ASSIGN (fjk,0, Fx,Fz,pf) ;
+
+                Int p = Ap [j] ;
+                Int pend = (Apacked) ? (Ap [j+1]) : (p + Anz [j]) ;
+                for ( ; p < pend ; p++)
+                {
+                    Int i = Ai [p] ;
+                    if (i >= k)
+                    {
+                        // See the discussion of imap above.
+                        Int imap = Map [i] ;
+                        if (imap >= 0 && imap < nsrow)
+                        {
+                            // Lx [Map [i] + pk] += Ax [p] * fjk
+                            L_MULTADD (Lx,(imap+(psx+(k-k1)*nsrow)),
+                                       Ax,Az,p, fjk) ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // add beta to the diagonal of the supernode, if nonzero
+    if (beta [0] != 0.0)
+    {
+        // note that only the real part of beta is used
+        Int pk = psx ;
+        for (Int k = k1 ; k < k2 ; k++)
+        {
+            // Lx [pk] += beta [0]
+            L_ASSEMBLE (Lx,pk, beta) ;
+            pk += nsrow + 1 ;       // advance to the next diagonal entry
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_numeric_update: update supernode s with descendant d
+//------------------------------------------------------------------------------
+
+// Computes the update matrix C from rows Ls [pdi1 ... pdend-1] of the
+// descendant supernode d, and subtracts it from supernode s, using the CPU
+// BLAS.  Map holds the scattered Map of s.  If par is FALSE, no OpenMP
+// parallelism is used in the assembly.  *blas_ok is set to FALSE if integer
+// overflow occurs in the BLAS.
+
+static void TEMPLATE (cholmod_super_numeric_update)
+(
+    // input:
+    Int ndrow1,         // # of rows of d in the columns of s
+    Int ndrow2,         // # of rows of d in the rows of s
+    Int ndrow,          // leading dimension of d
+    Int ndcol,          // # of columns of d
+    Int pdi1,           // first row of d affecting s, in Ls
+    Int pdx1,           // first row of d affecting s, in Lx
+    Int psx,            // first entry of s in Lx
+    Int nsrow,          // leading dimension of s
+    Int *Map,           // scattered Map of s
+    bool par,           // if TRUE, use OpenMP for the assembly
+    // input/output:
+    cholmod_factor *L,  // factorization
+    int *blas_ok,       // set to FALSE if integer overflow in the BLAS
+    // workspace:
+    Real *C,            // size L->maxcsize
+    Int *RelativeMap,   // size n
+    cholmod_common *Common
+)
+{
+    Real one [2], zero [2] ;
+    #ifdef BLAS_TIMER
+    double tstart, blas_time ;
+    #endif
+    Int *Ls = L->s ;
+    Real *Lx = L->x ;
+
+    one [0] =  1.0 ;    // ALPHA for *syrk, *herk, and *gemm
+    one [1] =  0. ;
+    zero [0] = 0. ;     // BETA for *syrk, *herk, and *gemm
+    zero [1] = 0. ;
+
+    // compute leading ndrow1-by-ndrow1 lower triangular block of C,
+    // C1 = L1*L1'
+
+    Int ndrow3 = ndrow2 - ndrow1 ;  // number of rows of C2
+    ASSERT (ndrow3 >= 0) ;
+
+    #ifdef BLAS_TIMER
+    Common->CHOLMOD_CPU_SYRK_CALLS++ ;
+    tstart = SUITESPARSE_TIME ;
+    #endif
+
+    #if (defined (DOUBLE) && defined (REAL))
+    SUITESPARSE_BLAS_dsyrk ("L", "N",
+        ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
+        one,                        // ALPHA:  1
+        Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
+        zero,                       // BETA:   0
+        C, ndrow2,                  // C, LDC: C1
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && defined (REAL))
+    SUITESPARSE_BLAS_ssyrk ("L", "N",
+        ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
+        one,                        // ALPHA:  1
+        Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
+        zero,                       // BETA:   0
+        C, ndrow2,                  // C, LDC: C1
+        (*blas_ok)) ;
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    SUITESPARSE_BLAS_zherk ("L", "N",
+        ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
+        one,                        // ALPHA:  1
+        Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
+        zero,                       // BETA:   0
+        C, ndrow2,                  // C, LDC: C1
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    SUITESPARSE_BLAS_cherk ("L", "N",
+        ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
+        one,                        // ALPHA:  1
+        Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
+        zero,                       // BETA:   0
+        C, ndrow2,                  // C, LDC: C1
+        (*blas_ok)) ;
+    #endif
+
+    #ifdef BLAS_TIMER
+    blas_time = SUITESPARSE_TIME - tstart ;
+    Common->CHOLMOD_CPU_SYRK_TIME += blas_time ;
+    BLAS_DUMP_TO_FILE (0,           // dsyrk ("L", "N", ...)
+        ndrow1, ndcol, 0,           // N, K, 0
+        ndrow,  ndrow2, 0) ;        // LDA, LDC, 0
+    #endif
+
+    // compute remaining (ndrow2-ndrow1)-by-ndrow1 block of C,
+    // C2 = L2*L1'
+    if (ndrow3 > 0)
+    {
+
+        #ifdef BLAS_TIMER
+        Common->CHOLMOD_CPU_GEMM_CALLS++ ;
+        tstart = SUITESPARSE_TIME ;
+        #endif
+
+        #if (defined (DOUBLE) && defined (REAL))
+        SUITESPARSE_BLAS_dgemm ("N", "C",
+            ndrow3, ndrow1, ndcol,          // M, N, K
+            one,                            // ALPHA:  1
+            Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
+            ndrow,                          // ndrow
+            Lx + L_ENTRY*pdx1,              // B, LDB: L1
+            ndrow,                          // ndrow
+            zero,                           // BETA:   0
+            C + L_ENTRY*ndrow1,             // C, LDC: C2
+            ndrow2,
+            (*blas_ok)) ;
+
+        #elif (defined (SINGLE) && defined (REAL))
+        SUITESPARSE_BLAS_sgemm ("N", "C",
+            ndrow3, ndrow1, ndcol,          // M, N, K
+            one,                            // ALPHA:  1
+            Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
+            ndrow,                          // ndrow
+            Lx + L_ENTRY*pdx1,              // B, LDB: L1
+            ndrow,                          // ndrow
+            zero,                           // BETA:   0
+            C + L_ENTRY*ndrow1,             // C, LDC: C2
+            ndrow2,
+            (*blas_ok)) ;
+
+        #elif (defined (DOUBLE) && !defined (REAL))
+        SUITESPARSE_BLAS_zgemm ("N", "C",
+            ndrow3, ndrow1, ndcol,          // M, N, K
+            one,                            // ALPHA:  1
+            Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
+            ndrow,                          // ndrow
+            Lx + L_ENTRY*pdx1,              // B, LDB: L1, ndrow
+            ndrow,
+            zero,                           // BETA:   0
+            C + L_ENTRY*ndrow1,             // C, LDC: C2
+            ndrow2,
+            (*blas_ok)) ;
+
+        #elif (defined (SINGLE) && !defined (REAL))
+        SUITESPARSE_BLAS_cgemm ("N", "C",
+            ndrow3, ndrow1, ndcol,          // M, N, K
+            one,                            // ALPHA:  1
+            Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
+            ndrow,                          // ndrow
+            Lx + L_ENTRY*pdx1,              // B, LDB: L1, ndrow
+            ndrow,
+            zero,                           // BETA:   0
+            C + L_ENTRY*ndrow1,             // C, LDC: C2
+            ndrow2,
+            (*blas_ok)) ;
+        #endif
+
+        #ifdef BLAS_TIMER
+        blas_time = SUITESPARSE_TIME - tstart ;
+        Common->CHOLMOD_CPU_GEMM_TIME += blas_time ;
+        BLAS_DUMP_TO_FILE (4,           // dgemm ("N", "C", ...)
+            ndrow3, ndrow1, ndcol,      // M, N, K
+            ndrow,  ndrow,  ndrow2) ;   // LDA, LDB, LDC
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    // construct relative map to assemble d into s
+    //--------------------------------------------------------------------------
+
+    DEBUG (CHOLMOD(dump_real) ("C", C, L->dtype,
+        ndrow2, ndrow1, TRUE, L_ENTRY, Common)) ;
+
+    #ifdef _OPENMP
+    int nthreads = (par) ? cholmod_nthreads ((double) ndrow2, Common) : 1 ;
+    #endif
+
+    Int i ;
+    #pragma omp parallel for num_threads(nthreads)   \
+        if ( ndrow2 > 64 )
+    for (i = 0 ; i < ndrow2 ; i++)
+    {
+        RelativeMap [i] = Map [Ls [pdi1 + i]] ;
+        ASSERT (RelativeMap [i] >= 0 && RelativeMap [i] < nsrow) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble C into supernode s using the relative map
+    //--------------------------------------------------------------------------
+
+    #ifdef _OPENMP
+    double work = (double) ndcol * (double) ndrow2 * L_ENTRY ;
+    nthreads = (par) ? cholmod_nthreads (work, Common) : 1 ;
+    #endif
+
+    Int j ;
+    #pragma omp parallel for num_threads(nthreads) \
+        if (ndrow1 > 64 )
+    for (j = 0 ; j < ndrow1 ; j++)              // cols k1:k2-1
+    {
+        ASSERT (RelativeMap [j] == Map [Ls [pdi1 + j]]) ;
+        Int px = psx + RelativeMap [j] * nsrow ;
+        for (Int i = j ; i < ndrow2 ; i++)          // rows k1:n-1
+        {
+            ASSERT (RelativeMap [i] == Map [Ls [pdi1 + i]]) ;
+            ASSERT (RelativeMap [i] >= j && RelativeMap[i] < nsrow);
+            // Lx [px + RelativeMap [i]] -= C [i + pj]
+            Int q = px + RelativeMap [i] ;
+            L_ASSEMBLESUB (Lx,q, C, i+ndrow2*j) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_numeric_potrf: factorize the diagonal block of a supernode
+//------------------------------------------------------------------------------
+
+// Factorizes the leading nscol2-by-nscol2 diagonal block of the supernode
+// held in Lx [psx ...] with leading dimension nsrow, on the CPU.  Returns the
+// LAPACK info: zero if successful, or k > 0 if the kth diagonal entry is not
+// positive.  info is also 1 if integer overflow occurs in the BLAS.
+
+static Int TEMPLATE (cholmod_super_numeric_potrf)
+(
+    Int nscol2,         // size of the block to factorize
+    Int nsrow,          // leading dimension of the supernode
+    Int psx,            // first entry of the supernode in Lx
+    Real *Lx,           // numerical values of L
+    int *blas_ok,       // set to FALSE if integer overflow in the BLAS
+    cholmod_common *Common
+)
+{
+    Int info = 0 ;
+    #ifdef BLAS_TIMER
+    double tstart, blas_time ;
+    Common->CHOLMOD_CPU_POTRF_CALLS++ ;
+    tstart = SUITESPARSE_TIME ;
+    #endif
+
+    #if (defined (DOUBLE) && defined (REAL))
+    SUITESPARSE_LAPACK_dpotrf ("L",
+        nscol2,                     // N: nscol2
+        Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
+        info,                       // INFO
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && defined (REAL))
+    SUITESPARSE_LAPACK_spotrf ("L",
+        nscol2,                     // N: nscol2
+        Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
+        info,                       // INFO
+        (*blas_ok)) ;
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    SUITESPARSE_LAPACK_zpotrf ("L",
+        nscol2,                     // N: nscol2
+        Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
+        info,                       // INFO
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    SUITESPARSE_LAPACK_cpotrf ("L",
+        nscol2,                     // N: nscol2
+        Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
+        info,                       // INFO
+        (*blas_ok)) ;
+    #endif
+
+    #ifdef BLAS_TIMER
+    blas_time = SUITESPARSE_TIME - tstart ;
+    Common->CHOLMOD_CPU_POTRF_TIME += blas_time ;
+    BLAS_DUMP_TO_FILE (8,           // dpotrf ("L", ... )
+        nscol2, 0, 0,               // N, 0, 0
+        nsrow,  0, 0) ;             // LDA, 0, 0
+    #endif
+
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_numeric_trsm: compute the subdiagonal block of a supernode
+//------------------------------------------------------------------------------
+
+// Solves L2*L1' = S2 on the CPU, where L1 is the leading nscol2-by-nscol2
+// diagonal block of the supernode, and S2 is the nsrow2-by-nscol2 block below
+// it.  S2 is overwritten with L2.
+
+static void TEMPLATE (cholmod_super_numeric_trsm)
+(
+    Int nsrow2,         // # of rows of S2
+    Int nscol2,         // # of columns of S2
+    Int nsrow,          // leading dimension of the supernode
+    Int psx,            // first entry of the supernode in Lx
+    Real *Lx,           // numerical values of L
+    int *blas_ok,       // set to FALSE if integer overflow in the BLAS
+    cholmod_common *Common
+)
+{
+    Real one [2] ;
+    one [0] =  1.0 ;    // ALPHA for *trsm
+    one [1] =  0. ;
+
+    #ifdef BLAS_TIMER
+    double tstart, blas_time ;
+    Common->CHOLMOD_CPU_TRSM_CALLS++ ;
+    tstart = SUITESPARSE_TIME ;
+    #endif
+
+    #if (defined (DOUBLE) && defined (REAL))
+    SUITESPARSE_BLAS_dtrsm ("R", "L", "C", "N",
+        nsrow2, nscol2,                 // M, N
+        one,                            // ALPHA: 1
+        Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
+        Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
+        nsrow,
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && defined (REAL))
+    SUITESPARSE_BLAS_strsm ("R", "L", "C", "N",
+        nsrow2, nscol2,                 // M, N
+        one,                            // ALPHA: 1
+        Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
+        Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
+        nsrow,
+        (*blas_ok)) ;
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    SUITESPARSE_BLAS_ztrsm ("R", "L", "C", "N",
+        nsrow2, nscol2,                 // M, N
+        one,                            // ALPHA: 1
+        Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
+        Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
+        nsrow,
+        (*blas_ok)) ;
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    SUITESPARSE_BLAS_ctrsm ("R", "L", "C", "N",
+        nsrow2, nscol2,                 // M, N
+        one,                            // ALPHA: 1
+        Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
+        Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
+        nsrow,
+        (*blas_ok)) ;
+    #endif
+
+    #ifdef BLAS_TIMER
+    blas_time = SUITESPARSE_TIME - tstart ;
+    Common->CHOLMOD_CPU_TRSM_TIME += blas_time ;
+    BLAS_DUMP_TO_FILE (12,          // dtrsm ("R", "L", "C", "N"...)
+        nsrow2, nscol2, 0,          // M, N
+        nsrow,  nsrow,  0) ;        // LDA, LDB
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_numeric_subtree: factorize one subtree of supernodes
+//------------------------------------------------------------------------------
+
+// Factorizes supernodes first to root, which form a complete subtree of the
+// supernodal etree (supernode root and all of its descendants).  This is one
+// task of the tree-parallel factorization; several subtrees are factorized at
+// the same time by different threads.  Each task uses its own Map,
+// RelativeMap, and C workspace.  The Head, Next, and Lpos entries of the
+// supernodes in the subtree are not accessed by any other task.
+//
+// A supernode d of the subtree that must next update an ancestor outside the
+// subtree cannot be placed in the link list of that ancestor, since other
+// tasks may be modifying the same list.  Instead, d is appended to the Escape
+// list, and the caller places it in the link list once all tasks are done,
+// in the same order as the sequential factorization would.
+//
+// Returns the number of supernodes in the Escape list, or EMPTY if the
+// matrix is not positive definite or integer overflow occurs in the BLAS.
+// In that case the caller discards the results and factorizes the matrix
+// sequentially.
+
+static Int TEMPLATE (cholmod_super_numeric_subtree)
+(
+    // input:
+    cholmod_sparse *A,  // matrix to factorize
+    cholmod_sparse *F,  // F = A' or A(:,f)'
+    Real beta [2],      // beta*I is added to diagonal of matrix to factorize
+    Int first,          // first supernode of the subtree
+    Int root,           // root of the subtree
+    // input/output:
+    cholmod_factor *L,  // factorization
+    // output:
+    Int *Escape,        // size root-first+1
+    // workspace:
+    Int *Map,           // size n
+    Int *RelativeMap,   // size n
+    Real *C,            // size L->maxcsize
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    Int *Super = L->super ;
+    Int *Ls = L->s ;
+    Int *Lpi = L->pi ;
+    Int *Lpx = L->px ;
+    Real *Lx = L->x ;
+    Int n = L->n ;
+    Int nsuper = L->nsuper ;
+
+    Int *Iwork = Common->Iwork ;
+    Int *SuperMap = Iwork ;                                 // size n
+    Int *Next = Iwork + 2*((size_t) n) ;                    // size nsuper
+    Int *Lpos = Iwork + 2*((size_t) n) + nsuper ;           // size nsuper
+    Int *Head = Common->Head ;                              // size nsuper
+
+    int blas_ok = TRUE ;
+    Int nescape = 0 ;
+
+    //--------------------------------------------------------------------------
+    // factorize each supernode of the subtree, in postorder
+    //--------------------------------------------------------------------------
+
+    for (Int s = first ; s <= root ; s++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the size of supernode s and assemble A into it
+        //----------------------------------------------------------------------
+
+        Int k1 = Super [s] ;
+        Int nscol = Super [s+1] - k1 ;
+        Int psi = Lpi [s] ;
+        Int psx = Lpx [s] ;
+        Int nsrow = Lpi [s+1] - psi ;
+
+        TEMPLATE (cholmod_super_numeric_assemble) (A, F, beta, s, TRUE, FALSE,
+            L, Map, Common) ;
+
+        //----------------------------------------------------------------------
+        // update supernode s with each pending descendant d
+        //----------------------------------------------------------------------
+
+        Int dnext ;
+        for (Int d = Head [s] ; d != EMPTY ; d = dnext)
+        {
+            Int ndcol = Super [d+1] - Super [d] ;
+            Int pdi = Lpi [d] ;
+            Int pdend = Lpi [d+1] ;
+            Int ndrow = pdend - pdi ;
+            Int pdi1 = pdi + Lpos [d] ;
+            Int pdx1 = Lpx [d] + Lpos [d] ;
+            Int pdi2 ;
+            for (pdi2 = pdi1 ; pdi2 < pdend && Ls [pdi2] < k1 + nscol ; pdi2++);
+            TEMPLATE (cholmod_super_numeric_update) (pdi2 - pdi1, pdend - pdi1,
+                ndrow, ndcol, pdi1, pdx1, psx, nsrow, Map, FALSE, L, &blas_ok,
+                C, RelativeMap, Common) ;
+
+            // prepare this supernode d for its next ancestor
+            dnext = Next [d] ;
+            Lpos [d] = pdi2 - pdi ;
+            if (Lpos [d] < ndrow)
+            {
+                Int dancestor = SuperMap [Ls [pdi2]] ;
+                ASSERT (dancestor > s && dancestor < nsuper) ;
+                if (dancestor <= root)
+                {
+                    Next [d] = Head [dancestor] ;
+                    Head [dancestor] = d ;
+                }
+                else
+                {
+                    Escape [nescape++] = d ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // factorize supernode s
+        //----------------------------------------------------------------------
+
+        Int info = TEMPLATE (cholmod_super_numeric_potrf) (nscol, nsrow, psx,
+            Lx, &blas_ok, Common) ;
+        if (info != 0 || !blas_ok)
+        {
+            // not positive definite, or integer overflow in the BLAS
+            return (EMPTY) ;
+        }
+
+        Int nsrow2 = nsrow - nscol ;
+        if (nsrow2 > 0)
+        {
+            TEMPLATE (cholmod_super_numeric_trsm) (nsrow2, nscol, nsrow, psx,
+                Lx, &blas_ok, Common) ;
+            if (!blas_ok)
+            {
+                return (EMPTY) ;
+            }
+
+            // place s in the link list of its parent
+            Lpos [s] = nscol ;
+            Int sparent = SuperMap [Ls [psi + nscol]] ;
+            ASSERT (sparent > s && sparent < nsuper) ;
+            if (sparent <= root)
+            {
+                Next [s] = Head [sparent] ;
+                Head [sparent] = s ;
+            }
+            else
+            {
+                Escape [nescape++] = s ;
+            }
+        }
+
+        Head [s] = EMPTY ;  // link list for supernode s no longer needed
+    }
+
+    return (nescape) ;
+}
+
 //------------------------------------------------------------------------------
 // t_cholmod_super_numeric
 //------------------------------------------------------------------------------
 
 // This function returns FALSE only if integer overflow occurs in the BLAS.
 // It returns TRUE otherwise whether or not the matrix is positive definite.
+//
+// If Tree is not NULL, the subtrees it describes are first factorized in
+// parallel, and the remaining supernodes are then factorized in postorder.
 
 static int TEMPLATE (cholmod_super_numeric_worker)
 (
@@ -140,6 +881,7 @@ static int TEMPLATE (cholmod_super_numeric_worker)
     cholmod_factor *L,  // factorization
     // workspace:
     cholmod_dense *Cwork,       // size (L->maxcsize)-by-1
+    super_tree *Tree,           // subtrees to factorize in parallel, or NULL
     cholmod_common *Common
 )
 {
@@ -148,19 +890,13 @@ static int TEMPLATE (cholmod_super_numeric_worker)
     // check inputs
     //--------------------------------------------------------------------------
 
-    Real one [2], zero [2] ;
-    #ifdef BLAS_TIMER
-    double tstart, blas_time ;
-    #endif
-    Real *Lx, *Ax, *Fx, *Az, *Fz, *C ;
+    Real *Lx, *C ;
     Int *Super, *Head, *Ls, *Lpi, *Lpx, *Map, *SuperMap, *RelativeMap, *Next,
-        *Lpos, *Fp, *Fi, *Fnz, *Ap, *Ai, *Anz, *Iwork, *Next_save, *Lpos_save,
-        *Previous;
+        *Lpos, *Iwork, *Next_save, *Lpos_save, *Previous;
     Int nsuper, n, s, k1, k2, nscol, psi, psx, psend, nsrow,
-        pj, d, kd1, kd2, info, ndcol, ndrow, pdi, pdx, pdend, pdi1, pdi2,
-        ndrow1, ndrow2, dancestor, sparent, dnext, nsrow2, ndrow3,
-        stype, Apacked, Fpacked, repeat_supernode, nscol2, ss,
-        tail, nscol_new = 0;
+        d, kd1, kd2, info, ndcol, ndrow, pdi, pdx, pdend, pdi2,
+        ndrow1, ndrow2, dancestor, sparent, dnext, nsrow2,
+        repeat_supernode, nscol2, ss, tail, nscol_new = 0;
     info = 0 ;
 
     ASSERT (L->dtype == A->dtype) ;
@@ -196,11 +932,6 @@ static int TEMPLATE (cholmod_super_numeric_worker)
 
     C = Cwork->x ;      // workspace of size L->maxcsize
 
-    one [0] =  1.0 ;    // ALPHA for *syrk, *herk, *gemm, and *trsm
-    one [1] =  0. ;
-    zero [0] = 0. ;     // BETA for *syrk, *herk, and *gemm
-    zero [1] = 0. ;
-
     // Iwork must be of size 2n + 5*nsuper, allocated in the caller,
     // cholmod_super_numeric.  The memory cannot be allocated here because the
     // cholmod_super_numeric initializes SuperMap, and cholmod_allocate_work
@@ -241,6 +972,11 @@ static int TEMPLATE (cholmod_super_numeric_worker)
         useGPU = 0;
     }
     // fprintf (stderr, "local useGPU %d\n", useGPU) ;
+    if (useGPU)
+    {
+        // the GPU does not use the tree-parallel factorization
+        Tree = NULL ;
+    }
     #endif
 
     #ifdef BLAS_TIMER
@@ -265,36 +1001,7 @@ static int TEMPLATE (cholmod_super_numeric_worker)
     Common->CHOLMOD_ASSEMBLE_TIME2  = 0 ;
     #endif
 
-    stype = A->stype ;
-
-    if (stype != 0)
-    {
-        // F not accessed
-        Fp = NULL ;
-        Fi = NULL ;
-        Fx = NULL ;
-        Fz = NULL ;
-        Fnz = NULL ;
-        Fpacked = TRUE ;
-    }
-    else
-    {
-        ASSERT (F != NULL) ;
-        ASSERT (L->dtype == F->dtype) ;
-        Fp = F->p ;
-        Fi = F->i ;
-        Fx = F->x ;
-        Fz = F->z ;
-        Fnz = F->nz ;
-        Fpacked = F->packed ;
-    }
-
-    Ap = A->p ;
-    Ai = A->i ;
-    Ax = A->x ;
-    Az = A->z ;
-    Anz = A->nz ;
-    Apacked = A->packed ;
+    ASSERT (IMPLIES (A->stype == 0, F != NULL && L->dtype == F->dtype)) ;
 
     // clear the Map so that changes in the pattern of A can be detected
 
@@ -328,6 +1035,48 @@ static int TEMPLATE (cholmod_super_numeric_worker)
     }
     #endif
 
+    //--------------------------------------------------------------------------
+    // factorize independent subtrees in parallel
+    //--------------------------------------------------------------------------
+
+    if (Tree != NULL)
+    {
+        super_task *Task = Tree->Task ;
+        Int ntasks = Tree->ntasks ;
+        int tree_ok = TRUE ;
+
+        // The tasks are sorted by decreasing work, so that the largest
+        // subtrees are started first.
+        Int t ;
+        #pragma omp parallel for num_threads(Tree->nthreads) \
+            schedule (dynamic, 1) reduction (&&:tree_ok)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            // get the workspace for this thread
+            size_t tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+            Int *TMap = Tree->Iwork + 2*((size_t) n) * tid ;
+            Real *TC = ((Real *) Tree->C->x) + L_ENTRY * L->maxcsize * tid ;
+            Int first = Task [t].first ;
+            Task [t].nescape = TEMPLATE (cholmod_super_numeric_subtree) (A, F,
+                beta, first, Task [t].root, L, Tree->Escape + first, TMap,
+                TMap + n, TC, Common) ;
+            tree_ok = tree_ok && (Task [t].nescape >= 0) ;
+        }
+
+        if (!tree_ok)
+        {
+            // A subtree is not positive definite, or integer overflow
+            // occurred in the BLAS.  Discard the parallel results and
+            // factorize the whole matrix in postorder, which finds the first
+            // failing supernode and sets L->minor and Common->status.
+            for (s = 0 ; s < nsuper ; s++)
+            {
+                Head [s] = EMPTY ;
+            }
+            Tree = NULL ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // supernodal numerical factorization
     //--------------------------------------------------------------------------
@@ -335,6 +1084,30 @@ static int TEMPLATE (cholmod_super_numeric_worker)
     for (s = 0 ; s < nsuper ; s++)
     {
 
+        //----------------------------------------------------------------------
+        // skip supernodes already factorized by the subtree tasks
+        //----------------------------------------------------------------------
+
+        if (Tree != NULL && Tree->Stask [s] != EMPTY)
+        {
+            super_task *Task = Tree->Task + Tree->Stask [s] ;
+            if (s == Task->root)
+            {
+                // The subtree rooted at s is done.  Place its escaping
+                // supernodes in the link lists of their next ancestors.
+                Int *Escape = Tree->Escape + Task->first ;
+                for (Int e = 0 ; e < Task->nescape ; e++)
+                {
+                    d = Escape [e] ;
+                    dancestor = SuperMap [Ls [Lpi [d] + Lpos [d]]] ;
+                    ASSERT (dancestor > s && dancestor < nsuper) ;
+                    Next [d] = Head [dancestor] ;
+                    Head [dancestor] = d ;
+                }
+            }
+            continue ;
+        }
+
         //----------------------------------------------------------------------
         // get the size of supernode s
         //----------------------------------------------------------------------
@@ -352,51 +1125,16 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                  ""ID" psx "ID"\n", s, k1, k2, nsrow, nscol, psi, psend, psx)) ;
 
         //----------------------------------------------------------------------
-        // zero the supernode s
+        // zero the supernode s and copy the matrix into it
         //----------------------------------------------------------------------
 
-        ASSERT ((size_t) (psx + nsrow*nscol) <= L->xsize) ;
-
+        // If the GPU is used, all supernodes have already been cleared.
+        bool clear = true ;
         #if defined ( CHOLMOD_HAS_CUDA ) && defined ( CHOLMOD_INT64 ) && defined (DOUBLE)
-        if ( !useGPU )
-        #endif
-        {
-            // Case of no GPU, zero individual supernodes
-            Int pend = psx + nsrow * nscol ;        // s is nsrow-by-nscol
-
-            #ifdef _OPENMP
-            double work = (double) (pend - psx) * L_ENTRY ;
-            int nthreads = cholmod_nthreads (work, Common) ;
-            #endif
-
-            Int p ;
-            #pragma omp parallel for num_threads(nthreads)   \
-                schedule (static) if ( pend - psx > 1024 )
-            for (p = psx ; p < pend ; p++)
-            {
-                L_CLEAR (Lx,p) ;
-            }
-        }
-
-        //----------------------------------------------------------------------
-        // construct the scattered Map for supernode s
-        //----------------------------------------------------------------------
-
-        // If row i is the kth row in s, then Map [i] = k.  Similarly, if
-        // column j is the kth column in s, then  Map [j] = k.
-
-        #ifdef _OPENMP
-        int nthreads = cholmod_nthreads ((double) nsrow, Common) ;
+        clear = !useGPU ;
         #endif
-
-        Int k ;
-        #pragma omp parallel for num_threads(nthreads)  \
-            if ( nsrow > 128 )
-        for (k = 0 ; k < nsrow ; k++)
-        {
-            PRINT1 (("  "ID" map "ID"\n", Ls [psi+k], k)) ;
-            Map [Ls [psi + k]] = k ;
-        }
+        TEMPLATE (cholmod_super_numeric_assemble) (A, F, beta, s, clear, TRUE,
+            L, Map, Common) ;
 
         //----------------------------------------------------------------------
         // when using GPU, reorder supernodes by levels.
@@ -412,113 +1150,6 @@ static int TEMPLATE (cholmod_super_numeric_worker)
         }
         #endif
 
-        //----------------------------------------------------------------------
-        // copy matrix into supernode s (lower triangular part only)
-        //----------------------------------------------------------------------
-
-        Int pk = psx ;
-
-        #ifdef _OPENMP
-        double work ;
-        if (stype != 0)
-        {
-            Int pfirst = Ap [k1] ;
-            Int plast = (Apacked) ? (Ap [k2]) : (pfirst + Anz [k2-1]) ;
-            work = (double) (plast - pfirst) ;
-        }
-        else
-        {
-            Int pfirst = Fp [k1] ;
-            Int plast  = (Fpacked) ? (Fp [k2]) : (pfirst + Fnz [k2-1]) ;
-            work = (double) (plast - pfirst) ;
-        }
-        nthreads = cholmod_nthreads (work, Common) ;
-        #endif
-
-        #pragma omp parallel for num_threads(nthreads) \
-            if ( k2-k1 > 64 )
-        for (k = k1 ; k < k2 ; k++)
-        {
-            if (stype != 0)
-            {
-
-                //--------------------------------------------------------------
-                // copy the kth column of A into the supernode
-                //--------------------------------------------------------------
-
-                Int p = Ap [k] ;
-                Int pend = (Apacked) ? (Ap [k+1]) : (p + Anz [k]) ;
-                for ( ; p < pend ; p++)
-                {
-                    // row i of L is located in row Map [i] of s
-                    Int i = Ai [p] ;
-                    if (i >= k)
-                    {
-                        // If the test is false, the numeric factorization of A
-                        // is undefined.  The test does not detect all invalid
-                        // entries, only some of them (when debugging is
-                        // enabled, and Map is cleared after each step, then
-                        // all entries not in the pattern of L are detected).
-                        Int imap = Map [i] ;
-                        if (imap >= 0 && imap < nsrow)
-                        {
-                            // Lx [Map [i] + pk] = Ax [p]
-                            L_ASSIGN (Lx,(imap+(psx+(k-k1)*nsrow)), Ax,Az,p) ;
-                        }
-                    }
-                }
-            }
-            else
-            {
-
-                //--------------------------------------------------------------
-                // copy the kth column of A*F into the supernode
-                //--------------------------------------------------------------
-
-                Real fjk [2] ;
-                Int pf = Fp [k] ;
-                Int pfend = (Fpacked) ? (Fp [k+1]) : (pf + Fnz [k]) ;
-                for ( ; pf < pfend ; pf++)
-                {
-                    Int j = Fi [pf] ;
-
-                    // fjk = Fx [pf]
-                    L_ASSIGN (fjk,0, Fx,Fz,pf) ;
-
-                    Int p = Ap [j] ;
-                    Int pend = (Apacked) ? (Ap [j+1]) : (p + Anz [j]) ;
-                    for ( ; p < pend ; p++)
-                    {
-                        Int i = Ai [p] ;
-                        if (i >= k)
-                        {
-                            // See the discussion of imap above.
-                            Int imap = Map [i] ;
-                            if (imap >= 0 && imap < nsrow)
-                            {
-                                // Lx [Map [i] + pk] += Ax [p] * fjk
-                                L_MULTADD (Lx,(imap+(psx+(k-k1)*nsrow)),
-                                           Ax,Az,p, fjk) ;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        // add beta to the diagonal of the supernode, if nonzero
-        if (beta [0] != 0.0)
-        {
-            // note that only the real part of beta is used
-            Int pk = psx ;
-            for (Int k = k1 ; k < k2 ; k++)
-            {
-                // Lx [pk] += beta [0]
-                L_ASSEMBLE (Lx,pk, beta) ;
-                pk += nsrow + 1 ;       // advance to the next diagonal entry
-            }
-        }
-
         PRINT1 (("Supernode with just A: repeat: "ID"\n", repeat_supernode)) ;
         DEBUG (CHOLMOD(dump_super) (s, Super, Lpi, Ls, Lpx, Lx, L->dtype,
             L_ENTRY, Common)) ;
@@ -723,12 +1354,6 @@ static int TEMPLATE (cholmod_super_numeric_worker)
             // maxcsize is the largest size of C for all pairs (d,s)
             ASSERT (ndrow2 * ndrow1 <= ((Int) L->maxcsize)) ;
 
-            // compute leading ndrow1-by-ndrow1 lower triangular block of C,
-            // C1 = L1*L1'
-
-            ndrow3 = ndrow2 - ndrow1 ;  // number of rows of C2
-            ASSERT (ndrow3 >= 0) ;
-
             #if defined ( CHOLMOD_HAS_CUDA ) && defined ( CHOLMOD_INT64 ) && defined (DOUBLE)
             if ( useGPU )
             {
@@ -759,176 +1384,9 @@ static int TEMPLATE (cholmod_super_numeric_worker)
             #endif
             {
                 // GPU not installed, or not used
-
-                #ifdef BLAS_TIMER
-                Common->CHOLMOD_CPU_SYRK_CALLS++ ;
-                tstart = SUITESPARSE_TIME ;
-                #endif
-
-                #if (defined (DOUBLE) && defined (REAL))
-                SUITESPARSE_BLAS_dsyrk ("L", "N",
-                    ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
-                    one,                        // ALPHA:  1
-                    Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
-                    zero,                       // BETA:   0
-                    C, ndrow2,                  // C, LDC: C1
-                    Common->blas_ok) ;
-
-                #elif (defined (SINGLE) && defined (REAL))
-                SUITESPARSE_BLAS_ssyrk ("L", "N",
-                    ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
-                    one,                        // ALPHA:  1
-                    Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
-                    zero,                       // BETA:   0
-                    C, ndrow2,                  // C, LDC: C1
-                    Common->blas_ok) ;
-
-                #elif (defined (DOUBLE) && !defined (REAL))
-                SUITESPARSE_BLAS_zherk ("L", "N",
-                    ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
-                    one,                        // ALPHA:  1
-                    Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
-                    zero,                       // BETA:   0
-                    C, ndrow2,                  // C, LDC: C1
-                    Common->blas_ok) ;
-
-                #elif (defined (SINGLE) && !defined (REAL))
-                SUITESPARSE_BLAS_cherk ("L", "N",
-                    ndrow1, ndcol,              // N, K: L1 is ndrow1-by-ndcol
-                    one,                        // ALPHA:  1
-                    Lx + L_ENTRY*pdx1, ndrow,   // A, LDA: L1, ndrow
-                    zero,                       // BETA:   0
-                    C, ndrow2,                  // C, LDC: C1
-                    Common->blas_ok) ;
-                #endif
-
-                #ifdef BLAS_TIMER
-                blas_time = SUITESPARSE_TIME - tstart ;
-                Common->CHOLMOD_CPU_SYRK_TIME += blas_time ;
-                BLAS_DUMP_TO_FILE (0,           // dsyrk ("L", "N", ...)
-                    ndrow1, ndcol, 0,           // N, K, 0
-                    ndrow,  ndrow2, 0) ;        // LDA, LDC, 0
-                #endif
-
-                // compute remaining (ndrow2-ndrow1)-by-ndrow1 block of C,
-                // C2 = L2*L1'
-                if (ndrow3 > 0)
-                {
-
-                    #ifdef BLAS_TIMER
-                    Common->CHOLMOD_CPU_GEMM_CALLS++ ;
-                    tstart = SUITESPARSE_TIME ;
-                    #endif
-
-                    #if (defined (DOUBLE) && defined (REAL))
-                    SUITESPARSE_BLAS_dgemm ("N", "C",
-                        ndrow3, ndrow1, ndcol,          // M, N, K
-                        one,                            // ALPHA:  1
-                        Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
-                        ndrow,                          // ndrow
-                        Lx + L_ENTRY*pdx1,              // B, LDB: L1
-                        ndrow,                          // ndrow
-                        zero,                           // BETA:   0
-                        C + L_ENTRY*ndrow1,             // C, LDC: C2
-                        ndrow2,
-                        Common->blas_ok) ;
-
-                    #elif (defined (SINGLE) && defined (REAL))
-                    SUITESPARSE_BLAS_sgemm ("N", "C",
-                        ndrow3, ndrow1, ndcol,          // M, N, K
-                        one,                            // ALPHA:  1
-                        Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
-                        ndrow,                          // ndrow
-                        Lx + L_ENTRY*pdx1,              // B, LDB: L1
-                        ndrow,                          // ndrow
-                        zero,                           // BETA:   0
-                        C + L_ENTRY*ndrow1,             // C, LDC: C2
-                        ndrow2,
-                        Common->blas_ok) ;
-
-                    #elif (defined (DOUBLE) && !defined (REAL))
-                    SUITESPARSE_BLAS_zgemm ("N", "C",
-                        ndrow3, ndrow1, ndcol,          // M, N, K
-                        one,                            // ALPHA:  1
-                        Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
-                        ndrow,                          // ndrow
-                        Lx + L_ENTRY*pdx1,              // B, LDB: L1, ndrow
-                        ndrow,
-                        zero,                           // BETA:   0
-                        C + L_ENTRY*ndrow1,             // C, LDC: C2
-                        ndrow2,
-                        Common->blas_ok) ;
-
-                    #elif (defined (SINGLE) && !defined (REAL))
-                    SUITESPARSE_BLAS_cgemm ("N", "C",
-                        ndrow3, ndrow1, ndcol,          // M, N, K
-                        one,                            // ALPHA:  1
-                        Lx + L_ENTRY*(pdx1 + ndrow1),   // A, LDA: L2
-                        ndrow,                          // ndrow
-                        Lx + L_ENTRY*pdx1,              // B, LDB: L1, ndrow
-                        ndrow,
-                        zero,                           // BETA:   0
-                        C + L_ENTRY*ndrow1,             // C, LDC: C2
-                        ndrow2,
-                        Common->blas_ok) ;
-                    #endif
-
-                    #ifdef BLAS_TIMER
-                    blas_time = SUITESPARSE_TIME - tstart ;
-                    Common->CHOLMOD_CPU_GEMM_TIME += blas_time ;
-                    BLAS_DUMP_TO_FILE (4,           // dgemm ("N", "C", ...)
-                        ndrow3, ndrow1, ndcol,      // M, N, K
-                        ndrow,  ndrow,  ndrow2) ;   // LDA, LDB, LDC
-                    #endif
-                }
-
-                //--------------------------------------------------------------
-                // construct relative map to assemble d into s
-                //--------------------------------------------------------------
-
-                DEBUG (CHOLMOD(dump_real) ("C", C, L->dtype,
-                    ndrow2, ndrow1, TRUE, L_ENTRY, Common)) ;
-
-                #ifdef _OPENMP
-                int nthreads = cholmod_nthreads ((double) ndrow2, Common) ;
-                #endif
-
-                Int i ;
-                #pragma omp parallel for num_threads(nthreads)   \
-                    if ( ndrow2 > 64 )
-                for (i = 0 ; i < ndrow2 ; i++)
-                {
-                    RelativeMap [i] = Map [Ls [pdi1 + i]] ;
-                    ASSERT (RelativeMap [i] >= 0 && RelativeMap [i] < nsrow) ;
-                }
-
-                //--------------------------------------------------------------
-                // assemble C into supernode s using the relative map
-                //--------------------------------------------------------------
-
-                #ifdef _OPENMP
-                double work = (double) ndcol * (double) ndrow2 * L_ENTRY ;
-                nthreads = cholmod_nthreads (work, Common) ;
-                #endif
-
-                Int j ;
-                #pragma omp parallel for num_threads(nthreads) \
-                    if (ndrow1 > 64 )
-                for (j = 0 ; j < ndrow1 ; j++)              // cols k1:k2-1
-                {
-                    ASSERT (RelativeMap [j] == Map [Ls [pdi1 + j]]) ;
-                    ASSERT (RelativeMap [j] >= 0 && RelativeMap [j] < nscol) ;
-                    Int px = psx + RelativeMap [j] * nsrow ;
-                    for (Int i = j ; i < ndrow2 ; i++)          // rows k1:n-1
-                    {
-                        ASSERT (RelativeMap [i] == Map [Ls [pdi1 + i]]) ;
-                        ASSERT (RelativeMap [i] >= j && RelativeMap[i] < nsrow);
-                        // Lx [px + RelativeMap [i]] -= C [i + pj]
-                        Int q = px + RelativeMap [i] ;
-                        L_ASSEMBLESUB (Lx,q, C, i+ndrow2*j) ;
-                    }
-                }
-
+                TEMPLATE (cholmod_super_numeric_update) (ndrow1, ndrow2, ndrow,
+                    ndcol, pdi1, pdx1, psx, nsrow, Map, TRUE, L,
+                    &(Common->blas_ok), C, RelativeMap, Common) ;
             }
 
             #if defined ( CHOLMOD_HAS_CUDA ) && defined ( CHOLMOD_INT64 ) && defined (DOUBLE)
@@ -1014,47 +1472,8 @@ static int TEMPLATE (cholmod_super_numeric_worker)
             #if defined ( CHOLMOD_HAS_CUDA ) && defined ( CHOLMOD_INT64 ) && defined (DOUBLE)
             supernodeUsedGPU = 0;
             #endif
-            #ifdef BLAS_TIMER
-            Common->CHOLMOD_CPU_POTRF_CALLS++ ;
-            tstart = SUITESPARSE_TIME ;
-            #endif
-
-            #if (defined (DOUBLE) && defined (REAL))
-            SUITESPARSE_LAPACK_dpotrf ("L",
-                nscol2,                     // N: nscol2
-                Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
-                info,                       // INFO
-                Common->blas_ok) ;
-
-            #elif (defined (SINGLE) && defined (REAL))
-            SUITESPARSE_LAPACK_spotrf ("L",
-                nscol2,                     // N: nscol2
-                Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
-                info,                       // INFO
-                Common->blas_ok) ;
-
-            #elif (defined (DOUBLE) && !defined (REAL))
-            SUITESPARSE_LAPACK_zpotrf ("L",
-                nscol2,                     // N: nscol2
-                Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
-                info,                       // INFO
-                Common->blas_ok) ;
-
-            #elif (defined (SINGLE) && !defined (REAL))
-            SUITESPARSE_LAPACK_cpotrf ("L",
-                nscol2,                     // N: nscol2
-                Lx + L_ENTRY*psx, nsrow,    // A, LDA: S1, nsrow
-                info,                       // INFO
-                Common->blas_ok) ;
-            #endif
-
-            #ifdef BLAS_TIMER
-            blas_time = SUITESPARSE_TIME - tstart ;
-            Common->CHOLMOD_CPU_POTRF_TIME += blas_time ;
-            BLAS_DUMP_TO_FILE (8,           // dpotrf ("L", ... )
-                nscol2, 0, 0,               // N, 0, 0
-                nsrow,  0, 0) ;             // LDA, 0, 0
-            #endif
+            info = TEMPLATE (cholmod_super_numeric_potrf) (nscol2, nsrow, psx,
+                Lx, &(Common->blas_ok), Common) ;
         }
 
         //----------------------------------------------------------------------
@@ -1166,55 +1585,8 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                         (nsrow2, nscol2, nsrow, psx, Lx, Common, gpu_p))
                 #endif
             {
-                #ifdef BLAS_TIMER
-                Common->CHOLMOD_CPU_TRSM_CALLS++ ;
-                tstart = SUITESPARSE_TIME ;
-                #endif
-
-                #if (defined (DOUBLE) && defined (REAL))
-                SUITESPARSE_BLAS_dtrsm ("R", "L", "C", "N",
-                    nsrow2, nscol2,                 // M, N
-                    one,                            // ALPHA: 1
-                    Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
-                    Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
-                    nsrow,
-                    Common->blas_ok) ;
-
-                #elif (defined (SINGLE) && defined (REAL))
-                SUITESPARSE_BLAS_strsm ("R", "L", "C", "N",
-                    nsrow2, nscol2,                 // M, N
-                    one,                            // ALPHA: 1
-                    Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
-                    Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
-                    nsrow,
-                    Common->blas_ok) ;
-
-                #elif (defined (DOUBLE) && !defined (REAL))
-                SUITESPARSE_BLAS_ztrsm ("R", "L", "C", "N",
-                    nsrow2, nscol2,                 // M, N
-                    one,                            // ALPHA: 1
-                    Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
-                    Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
-                    nsrow,
-                    Common->blas_ok) ;
-
-                #elif (defined (SINGLE) && !defined (REAL))
-                SUITESPARSE_BLAS_ctrsm ("R", "L", "C", "N",
-                    nsrow2, nscol2,                 // M, N
-                    one,                            // ALPHA: 1
-                    Lx + L_ENTRY*psx, nsrow,        // A, LDA: L1, nsrow
-                    Lx + L_ENTRY*(psx + nscol2),    // B, LDB, L2, nsrow
-                    nsrow,
-                    Common->blas_ok) ;
-                #endif
-
-                #ifdef BLAS_TIMER
-                blas_time = SUITESPARSE_TIME - tstart ;
-                Common->CHOLMOD_CPU_TRSM_TIME += blas_time ;
-                BLAS_DUMP_TO_FILE (12,          // dtrsm ("R", "L", "C", "N"...)
-                    nsrow2, nscol2, 0,          // M, N
-                    nsrow,  nsrow,  0) ;        // LDA, LDB
-                #endif
+                TEMPLATE (cholmod_super_numeric_trsm) (nsrow2, nscol2, nsrow,
+                    psx, Lx, &(Common->blas_ok), Common) ;
             }
 
             CHECK_FOR_BLAS_INTEGER_OVERFLOW ;
@@ -579,6 +579,577 @@ static void TEMPLATE (cholmod_super_ltsolve_worker)
     }
 }
 
+//------------------------------------------------------------------------------
+// t_cholmod_super_solve_lupdate: E = E - L2*x1
+//------------------------------------------------------------------------------
+
+static void TEMPLATE (cholmod_super_solve_lupdate)
+(
+    Int nr,             // L2 is nr-by-ndcol, E is nr-by-nrhs
+    Int ndcol,
+    Int nrhs,
+    Real *L2,           // part of a supernode, with leading dimension ndrow
+    Int ndrow,
+    Real *X1,           // x1, with leading dimension d
+    Int d,
+    Real *Ex,           // E, with leading dimension nr
+    int *ok             // set to FALSE if integer overflow in the BLAS
+)
+{
+    Real minus_one [2], one [2] ;
+    minus_one [0] = -1.0 ;
+    minus_one [1] = 0 ;
+    one [0] = 1.0 ;
+    one [1] = 0 ;
+
+    #if (defined (DOUBLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dgemv ("N",
+            nr, ndcol,                  // M, N:    L2 is nr-by-ndcol
+            minus_one,                  // ALPHA:   -1
+            L2, ndrow,                  // A, LDA:  L2
+            X1, 1,                      // X, INCX: x1
+            one,                        // BETA:    1
+            Ex, 1,                      // Y, INCY: E
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dgemm ("N", "N",
+            nr, nrhs, ndcol,            // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, ndrow,                  // A, LDA: L2
+            X1, d,                      // B, LDB: x1
+            one,                        // BETA:   1
+            Ex, nr,                     // C, LDC: E
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_sgemv ("N",
+            nr, ndcol,                  // M, N:    L2 is nr-by-ndcol
+            minus_one,                  // ALPHA:   -1
+            L2, ndrow,                  // A, LDA:  L2
+            X1, 1,                      // X, INCX: x1
+            one,                        // BETA:    1
+            Ex, 1,                      // Y, INCY: E
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_sgemm ("N", "N",
+            nr, nrhs, ndcol,            // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, ndrow,                  // A, LDA: L2
+            X1, d,                      // B, LDB: x1
+            one,                        // BETA:   1
+            Ex, nr,                     // C, LDC: E
+            (*ok)) ;
+    }
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_zgemv ("N",
+            nr, ndcol,                  // M, N:    L2 is nr-by-ndcol
+            minus_one,                  // ALPHA:   -1
+            L2, ndrow,                  // A, LDA:  L2
+            X1, 1,                      // X, INCX: x1
+            one,                        // BETA:    1
+            Ex, 1,                      // Y, INCY: E
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_zgemm ("N", "N",
+            nr, nrhs, ndcol,            // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, ndrow,                  // A, LDA: L2
+            X1, d,                      // B, LDB: x1
+            one,                        // BETA:   1
+            Ex, nr,                     // C, LDC: E
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_cgemv ("N",
+            nr, ndcol,                  // M, N:    L2 is nr-by-ndcol
+            minus_one,                  // ALPHA:   -1
+            L2, ndrow,                  // A, LDA:  L2
+            X1, 1,                      // X, INCX: x1
+            one,                        // BETA:    1
+            Ex, 1,                      // Y, INCY: E
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_cgemm ("N", "N",
+            nr, nrhs, ndcol,            // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, ndrow,                  // A, LDA: L2
+            X1, d,                      // B, LDB: x1
+            one,                        // BETA:   1
+            Ex, nr,                     // C, LDC: E
+            (*ok)) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_solve_ltupdate: x1 = x1 - L2'*E
+//------------------------------------------------------------------------------
+
+static void TEMPLATE (cholmod_super_solve_ltupdate)
+(
+    Int nsrow2,         // L2 is nsrow2-by-nscol, E is nsrow2-by-nrhs
+    Int nscol,
+    Int nrhs,
+    Real *L2,           // lower part of a supernode, leading dimension nsrow
+    Int nsrow,
+    Real *Ex,           // E, with leading dimension nsrow2
+    Real *X1,           // x1, with leading dimension d
+    Int d,
+    int *ok             // set to FALSE if integer overflow in the BLAS
+)
+{
+    Real minus_one [2], one [2] ;
+    minus_one [0] = -1.0 ;
+    minus_one [1] = 0 ;
+    one [0] = 1.0 ;
+    one [1] = 0 ;
+
+    #if (defined (DOUBLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dgemv ("C",
+            nsrow2, nscol,              // M, N: L2 is nsrow2-by-nscol
+            minus_one,                  // ALPHA:   -1
+            L2, nsrow,                  // A, LDA:  L2
+            Ex, 1,                      // X, INCX: Ex
+            one,                        // BETA:    1
+            X1, 1,                      // Y, INCY: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dgemm ("C", "N",
+            nscol, nrhs, nsrow2,        // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, nsrow,                  // A, LDA: L2
+            Ex, nsrow2,                 // B, LDB: E
+            one,                        // BETA:   1
+            X1, d,                      // C, LDC: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_sgemv ("C",
+            nsrow2, nscol,              // M, N: L2 is nsrow2-by-nscol
+            minus_one,                  // ALPHA:   -1
+            L2, nsrow,                  // A, LDA:  L2
+            Ex, 1,                      // X, INCX: Ex
+            one,                        // BETA:    1
+            X1, 1,                      // Y, INCY: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_sgemm ("C", "N",
+            nscol, nrhs, nsrow2,        // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, nsrow,                  // A, LDA: L2
+            Ex, nsrow2,                 // B, LDB: E
+            one,                        // BETA:   1
+            X1, d,                      // C, LDC: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_zgemv ("C",
+            nsrow2, nscol,              // M, N: L2 is nsrow2-by-nscol
+            minus_one,                  // ALPHA:   -1
+            L2, nsrow,                  // A, LDA:  L2
+            Ex, 1,                      // X, INCX: Ex
+            one,                        // BETA:    1
+            X1, 1,                      // Y, INCY: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_zgemm ("C", "N",
+            nscol, nrhs, nsrow2,        // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, nsrow,                  // A, LDA: L2
+            Ex, nsrow2,                 // B, LDB: E
+            one,                        // BETA:   1
+            X1, d,                      // C, LDC: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_cgemv ("C",
+            nsrow2, nscol,              // M, N: L2 is nsrow2-by-nscol
+            minus_one,                  // ALPHA:   -1
+            L2, nsrow,                  // A, LDA:  L2
+            Ex, 1,                      // X, INCX: Ex
+            one,                        // BETA:    1
+            X1, 1,                      // Y, INCY: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_cgemm ("C", "N",
+            nscol, nrhs, nsrow2,        // M, N, K
+            minus_one,                  // ALPHA:  -1
+            L2, nsrow,                  // A, LDA: L2
+            Ex, nsrow2,                 // B, LDB: E
+            one,                        // BETA:   1
+            X1, d,                      // C, LDC: x1
+            (*ok)) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_solve_diag: solve L1*x1=b1 or L1'*x1=b1 for one supernode
+//------------------------------------------------------------------------------
+
+static void TEMPLATE (cholmod_super_solve_diag)
+(
+    char *trans,        // "N": solve L1*x1=b1, "C": solve L1'*x1=b1
+    Int nscol,          // L1 is nscol-by-nscol
+    Int nrhs,           // x1 is nscol-by-nrhs
+    Real *L1,           // diagonal block of the supernode
+    Int nsrow,          // leading dimension of L1
+    Real *X1,           // x1, with leading dimension d
+    Int d,
+    int *ok             // set to FALSE if integer overflow in the BLAS
+)
+{
+    Real one [2] ;
+    one [0] = 1.0 ;
+    one [1] = 0 ;
+
+    #if (defined (DOUBLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dtrsv ("L", trans, "N",
+            nscol,                      // N:       L1 is nscol-by-nscol
+            L1, nsrow,                  // A, LDA:  L1
+            X1, 1,                      // X, INCX: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dtrsm ("L", "L", trans, "N",
+            nscol, nrhs,                // M, N: x1 is nscol-by-nrhs
+            one,                        // ALPHA:  1
+            L1, nsrow,                  // A, LDA: L1
+            X1, d,                      // B, LDB: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_strsv ("L", trans, "N",
+            nscol,                      // N:       L1 is nscol-by-nscol
+            L1, nsrow,                  // A, LDA:  L1
+            X1, 1,                      // X, INCX: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_strsm ("L", "L", trans, "N",
+            nscol, nrhs,                // M, N: x1 is nscol-by-nrhs
+            one,                        // ALPHA:  1
+            L1, nsrow,                  // A, LDA: L1
+            X1, d,                      // B, LDB: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (DOUBLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_ztrsv ("L", trans, "N",
+            nscol,                      // N:       L1 is nscol-by-nscol
+            L1, nsrow,                  // A, LDA:  L1
+            X1, 1,                      // X, INCX: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_ztrsm ("L", "L", trans, "N",
+            nscol, nrhs,                // M, N: x1 is nscol-by-nrhs
+            one,                        // ALPHA:  1
+            L1, nsrow,                  // A, LDA: L1
+            X1, d,                      // B, LDB: x1
+            (*ok)) ;
+    }
+
+    #elif (defined (SINGLE) && !defined (REAL))
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_ctrsv ("L", trans, "N",
+            nscol,                      // N:       L1 is nscol-by-nscol
+            L1, nsrow,                  // A, LDA:  L1
+            X1, 1,                      // X, INCX: x1
+            (*ok)) ;
+    }
+    else
+    {
+        SUITESPARSE_BLAS_ctrsm ("L", "L", trans, "N",
+            nscol, nrhs,                // M, N: x1 is nscol-by-nrhs
+            one,                        // ALPHA:  1
+            L1, nsrow,                  // A, LDA: L1
+            X1, d,                      // B, LDB: x1
+            (*ok)) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_lsolve_levels: solve x = L\b, by levels of the etree
+//------------------------------------------------------------------------------
+
+// Each supernode s pulls the updates from all of its descendants d (the
+// dependency list of s), and then solves with its own diagonal block.  Only
+// the rows of s are modified, so all supernodes in the same level of the
+// supernodal etree can be solved in parallel.  The descendants of s are all in
+// lower levels, and are thus already solved.  Each thread gathers the rows of
+// x into its own part of the workspace E.
+
+static void TEMPLATE (cholmod_super_lsolve_levels)
+(
+    // input:
+    cholmod_factor *L,  // factor to use for the forward solve
+    super_levels *Levels,   // level schedule
+    // input/output:
+    cholmod_dense *X,   // b on input, solution to Lx=b on output
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    Real *Lx = L->x ;
+    Real *Xx = X->x ;
+    Int *Lpi = L->pi ;
+    Int *Lpx = L->px ;
+    Int *Ls = L->s ;
+    Int *Super = L->super ;
+    Int nrhs = X->ncol ;
+    Int d = X->d ;
+    Int *Levelp = Levels->Levelp ;
+    Int *Leveli = Levels->Leveli ;
+    Int *Depp = Levels->Depp ;
+    Int *Depi = Levels->Depi ;
+    size_t esize = Levels->esize ;
+
+    //--------------------------------------------------------------------------
+    // solve Lx=b, one level at a time, starting at the leaves
+    //--------------------------------------------------------------------------
+
+    for (Int h = 0 ; h < Levels->nlevels ; h++)
+    {
+        double work = 0 ;
+        for (Int k = Levelp [h] ; k < Levelp [h+1] ; k++)
+        {
+            Int s = Leveli [k] ;
+            work += (double) (Lpx [s+1] - Lpx [s]) * nrhs ;
+        }
+        int nthreads = cholmod_nthreads (work, Common) ;
+        nthreads = MIN (nthreads, Levels->nthreads) ;
+
+        int level_ok = TRUE ;
+        Int k ;
+        #pragma omp parallel for num_threads(nthreads) schedule (dynamic, 1) \
+            reduction (&&:level_ok)
+        for (k = Levelp [h] ; k < Levelp [h+1] ; k++)
+        {
+            size_t tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+            Real *Ex = ((Real *) Levels->Ework) + ENTRY_SIZE * esize * tid ;
+            int ok = TRUE ;
+            Int s = Leveli [k] ;
+
+            //------------------------------------------------------------------
+            // x1 = x1 - L (k1:k2-1, kd1:kd2-1) * x (kd1:kd2-1) for each d
+            //------------------------------------------------------------------
+
+            for (Int q = Depp [s] ; q < Depp [s+1] ; q++)
+            {
+                // rows Ls [p1 ... p2-1] of descendant d are in supernode s
+                Int dd = Depi [3*q] ;
+                Int p1 = Depi [3*q+1] ;
+                Int p2 = Depi [3*q+2] ;
+                Int nr = p2 - p1 ;
+                Int kd1 = Super [dd] ;
+                Int ndcol = Super [dd+1] - kd1 ;
+                Int ndrow = Lpi [dd+1] - Lpi [dd] ;
+                ASSERT ((size_t) (nr * nrhs) <= esize) ;
+
+                // gather X into E
+                for (Int ii = 0 ; ii < nr ; ii++)
+                {
+                    Int i = Ls [p1 + ii] ;
+                    for (Int j = 0 ; j < nrhs ; j++)
+                    {
+                        // Ex [ii + j*nr] = Xx [i + j*d]
+                        ASSIGN (Ex,-,ii+j*nr, Xx,-,i+j*d) ;
+                    }
+                }
+
+                // E = E - L2*x1, where L2 is rows p1:p2-1 of d
+                TEMPLATE (cholmod_super_solve_lupdate) (nr, ndcol, nrhs,
+                    Lx + ENTRY_SIZE*(Lpx [dd] + (p1 - Lpi [dd])), ndrow,
+                    Xx + ENTRY_SIZE*kd1, d, Ex, &ok) ;
+
+                // scatter E back into X
+                for (Int ii = 0 ; ii < nr ; ii++)
+                {
+                    Int i = Ls [p1 + ii] ;
+                    for (Int j = 0 ; j < nrhs ; j++)
+                    {
+                        // Xx [i + j*d] = Ex [ii + j*nr]
+                        ASSIGN (Xx,-,i+j*d, Ex,-,ii+j*nr) ;
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // solve L1*x1
+            //------------------------------------------------------------------
+
+            Int k1 = Super [s] ;
+            Int nscol = Super [s+1] - k1 ;
+            Int nsrow = Lpi [s+1] - Lpi [s] ;
+            TEMPLATE (cholmod_super_solve_diag) ("N", nscol, nrhs,
+                Lx + ENTRY_SIZE*Lpx [s], nsrow, Xx + ENTRY_SIZE*k1, d, &ok) ;
+            level_ok = level_ok && ok ;
+        }
+
+        if (!level_ok)
+        {
+            Common->blas_ok = FALSE ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// t_cholmod_super_ltsolve_levels: solve x = L'\b, by levels of the etree
+//------------------------------------------------------------------------------
+
+// The backsolve for supernode s reads only the rows of x of its ancestors, and
+// modifies only its own rows, so all supernodes in the same level of the
+// supernodal etree can be solved in parallel, starting at the root.  Each
+// thread gathers the rows of x into its own part of the workspace E.
+
+static void TEMPLATE (cholmod_super_ltsolve_levels)
+(
+    // input:
+    cholmod_factor *L,  // factor to use for the backsolve
+    super_levels *Levels,   // level schedule
+    // input/output:
+    cholmod_dense *X,   // b on input, solution to L'x=b on output
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    Real *Lx = L->x ;
+    Real *Xx = X->x ;
+    Int *Lpi = L->pi ;
+    Int *Lpx = L->px ;
+    Int *Ls = L->s ;
+    Int *Super = L->super ;
+    Int nrhs = X->ncol ;
+    Int d = X->d ;
+    Int *Levelp = Levels->Levelp ;
+    Int *Leveli = Levels->Leveli ;
+    size_t esize = Levels->esize ;
+
+    //--------------------------------------------------------------------------
+    // solve L'x=b, one level at a time, starting at the root(s)
+    //--------------------------------------------------------------------------
+
+    for (Int h = Levels->nlevels - 1 ; h >= 0 ; h--)
+    {
+        double work = 0 ;
+        for (Int k = Levelp [h] ; k < Levelp [h+1] ; k++)
+        {
+            Int s = Leveli [k] ;
+            work += (double) (Lpx [s+1] - Lpx [s]) * nrhs ;
+        }
+        int nthreads = cholmod_nthreads (work, Common) ;
+        nthreads = MIN (nthreads, Levels->nthreads) ;
+
+        int level_ok = TRUE ;
+        Int k ;
+        #pragma omp parallel for num_threads(nthreads) schedule (dynamic, 1) \
+            reduction (&&:level_ok)
+        for (k = Levelp [h] ; k < Levelp [h+1] ; k++)
+        {
+            size_t tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+            Real *Ex = ((Real *) Levels->Ework) + ENTRY_SIZE * esize * tid ;
+            int ok = TRUE ;
+            Int s = Leveli [k] ;
+            Int k1 = Super [s] ;
+            Int nscol = Super [s+1] - k1 ;
+            Int psi = Lpi [s] ;
+            Int psx = Lpx [s] ;
+            Int nsrow = Lpi [s+1] - psi ;
+            Int nsrow2 = nsrow - nscol ;
+            Int ps2 = psi + nscol ;
+            ASSERT ((size_t) (nsrow2 * nrhs) <= esize) ;
+
+            if (nsrow2 > 0)
+            {
+                // gather X into E
+                for (Int ii = 0 ; ii < nsrow2 ; ii++)
+                {
+                    Int i = Ls [ps2 + ii] ;
+                    for (Int j = 0 ; j < nrhs ; j++)
+                    {
+                        // Ex [ii + j*nsrow2] = Xx [i + j*d]
+                        ASSIGN (Ex,-,ii+j*nsrow2, Xx,-,i+j*d) ;
+                    }
+                }
+
+                // x1 = x1 - L2'*E
+                TEMPLATE (cholmod_super_solve_ltupdate) (nsrow2, nscol, nrhs,
+                    Lx + ENTRY_SIZE*(psx + nscol), nsrow, Ex,
+                    Xx + ENTRY_SIZE*k1, d, &ok) ;
+            }
+
+            // solve L1'*x1
+            TEMPLATE (cholmod_super_solve_diag) ("C", nscol, nrhs,
+                Lx + ENTRY_SIZE*psx, nsrow, Xx + ENTRY_SIZE*k1, d, &ok) ;
+            level_ok = level_ok && ok ;
+        }
+
+        if (!level_ok)
+        {
+            Common->blas_ok = FALSE ;
+        }
+    }
+}
+
 #undef PATTERN
 #undef REAL
 #undef COMPLEX
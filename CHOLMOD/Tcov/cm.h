@@ -162,6 +162,7 @@ void huge (void) ;
 void camdtest (cholmod_sparse *A) ;
 void basic1 (cholmod_common *) ;
 void overflow_tests (cholmod_common *cm) ;
+void tree_split_test (cholmod_common *cm) ;
 void sparse_dump (cholmod_sparse *A, char *filename, cholmod_common *cm) ;
 void factor_dump (cholmod_factor *L, char *L_filename, char *P_filename,
     cholmod_common *cm) ;
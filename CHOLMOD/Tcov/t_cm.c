@@ -1207,6 +1207,13 @@ int main (int argc, char **argv)
     overflow_tests (cm) ;
     printf ("overflow tests OK\n") ;
 
+    //--------------------------------------------------------------------------
+    // tree-parallel supernodal factorization
+    //--------------------------------------------------------------------------
+
+    tree_split_test (cm) ;
+    printf ("tree_split test OK\n") ;
+
     //--------------------------------------------------------------------------
     // read in a triplet matrix
     //--------------------------------------------------------------------------
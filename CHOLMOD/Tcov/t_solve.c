@@ -27,6 +27,36 @@ Int co_types [NFTYPES] = { 0, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1 } ;
 EXTERN int cholmod_dump, cholmod_l_dump ;
 #endif
 
+//------------------------------------------------------------------------------
+// refine_rnorm: norm (B-A*X) or norm (B-A*A'*X), as used by solve_refine
+//------------------------------------------------------------------------------
+
+static double refine_rnorm (cholmod_sparse *A, cholmod_dense *X,
+    cholmod_dense *B)
+{
+    double minus_one [2] = {-1,0}, one [2] = {1,0}, zero [2] = {0,0} ;
+    double rnorm = -1 ;
+    cholmod_dense *R = CHOLMOD(copy_dense) (B, cm) ;
+    cholmod_dense *T = NULL ;
+    if (A->stype == 0)
+    {
+        T = CHOLMOD(zeros) (A->ncol, X->ncol, X->xtype + X->dtype, cm) ;
+        CHOLMOD(sdmult) (A, 1, one, zero, X, T, cm) ;
+        CHOLMOD(sdmult) (A, 0, minus_one, one, T, R, cm) ;
+    }
+    else
+    {
+        CHOLMOD(sdmult) (A, 0, minus_one, one, X, R, cm) ;
+    }
+    if (cm->status == CHOLMOD_OK)
+    {
+        rnorm = CHOLMOD(norm_dense) (R, 0, cm) ;
+    }
+    CHOLMOD(free_dense) (&R, cm) ;
+    CHOLMOD(free_dense) (&T, cm) ;
+    return (rnorm) ;
+}
+
 //------------------------------------------------------------------------------
 // test_solver
 //------------------------------------------------------------------------------
@@ -68,6 +98,22 @@ double test_solver (cholmod_sparse *A)
         MAXERR (maxerr, err, 1) ;
         printf ("test_solver err: %6.2e\n", err) ;
 
+        // supernodal, with subtrees factorized in parallel
+        printf ("test_solver: supernodal, tree-parallel\n") ;
+        cm->tree_split = 4 ;
+        err = solve (A) ;
+        cm->tree_split = 0 ;
+        MAXERR (maxerr, err, 1) ;
+        printf ("test_solver err: %6.2e\n", err) ;
+
+        // supernodal, with the triangular solves scheduled by level
+        printf ("test_solver: supernodal, level solve\n") ;
+        cm->level_solve = TRUE ;
+        err = solve (A) ;
+        cm->level_solve = FALSE ;
+        MAXERR (maxerr, err, 1) ;
+        printf ("test_solver err: %6.2e\n", err) ;
+
         // supernodal, without final resymbol
         printf ("test_solver: supernodal, without final resymbol\n") ;
         cm->final_resymbol = FALSE ;
@@ -435,6 +481,54 @@ double solve (cholmod_sparse *A)
 
     cm->prefer_zomplex = FALSE ;
 
+    //--------------------------------------------------------------------------
+    // solve with iterative refinement
+    //--------------------------------------------------------------------------
+
+    if (B != NULL && B->xtype == xtype)
+    {
+        X = CHOLMOD(solve_refine) (L, A, B, cm) ;
+        r = resid (A, X, B) ;
+        MAXERR (maxerr, r, 1) ;
+        CHOLMOD(free_dense) (&X, cm) ;
+
+        #ifdef DOUBLE
+        // mixed precision: single precision factor of the double matrix A
+        cholmod_sparse *Asingle = CHOLMOD(copy_sparse) (A, cm) ;
+        CHOLMOD(sparse_xtype) (xtype + CHOLMOD_SINGLE, Asingle, cm) ;
+        cholmod_factor *Lsingle = CHOLMOD(analyze) (Asingle, cm) ;
+        CHOLMOD(factorize) (Asingle, Lsingle, cm) ;
+        X = CHOLMOD(solve_refine) (Lsingle, A, B, cm) ;
+        r = resid (A, X, B) ;
+        if (cm->print > 1)
+        {
+            printf ("mixed precision resid: %g steps: %d\n", r,
+                cm->refine_steps) ;
+        }
+        if (Lsingle != NULL && Lsingle->minor == (size_t) n &&
+            CHOLMOD(rcond) (Lsingle, cm) > 1e-3)
+        {
+            // refinement converges if A is not too ill-conditioned
+            MAXERR (maxerr, r, 1) ;
+        }
+        // refinement never returns a larger residual than no refinement
+        int save_refine = cm->refine_max ;
+        cm->refine_max = 0 ;
+        cholmod_dense *X0 = CHOLMOD(solve_refine) (Lsingle, A, B, cm) ;
+        cm->refine_max = save_refine ;
+        if (X != NULL && X0 != NULL)
+        {
+            double r1 = refine_rnorm (A, X, B) ;
+            double r0 = refine_rnorm (A, X0, B) ;
+            OK (r1 < 0 || r0 < 0 || r1 <= r0) ;
+        }
+        CHOLMOD(free_dense) (&X0, cm) ;
+        CHOLMOD(free_dense) (&X, cm) ;
+        CHOLMOD(free_factor) (&Lsingle, cm) ;
+        CHOLMOD(free_sparse) (&Asingle, cm) ;
+        #endif
+    }
+
     //--------------------------------------------------------------------------
     // sparse solve to compute inv(A)
     //--------------------------------------------------------------------------
@@ -1593,3 +1687,113 @@ cm->print = sav ;
     return (maxerr) ;
 }
 
+
+//------------------------------------------------------------------------------
+// tree_split_test
+//------------------------------------------------------------------------------
+
+// The tree-parallel supernodal factorization (Common->tree_split > 0) must
+// give the same L and x as the sequential factorization, bit for bit.  The
+// matrix is block diagonal with nblocks dense blocks, plus a dense last row
+// and column.  With the natural ordering, each block is a subtree of the
+// supernodal elimination tree, each with about 1/nblocks of the work, so the
+// tree is split into many subtrees and factorized in parallel.
+
+void tree_split_test (cholmod_common *cm)
+{
+    Int nblocks = 24, bsize = 6 ;
+    Int n = nblocks * bsize + 1 ;
+    Int nzmax = nblocks * (bsize * (bsize + 1)) / 2 + n ;
+
+    // save the settings
+    int save1 = cm->supernodal ;
+    int save2 = cm->nmethods ;
+    int save3 = cm->method [0].ordering ;
+    int save4 = cm->postorder ;
+    int save5 = cm->nthreads_max ;
+    double save6 = cm->chunk ;
+    double save7 = cm->tree_split ;
+
+    cm->supernodal = CHOLMOD_SUPERNODAL ;
+    cm->nmethods = 1 ;
+    cm->method [0].ordering = CHOLMOD_NATURAL ;
+    cm->postorder = TRUE ;
+    cm->nthreads_max = 4 ;
+    cm->chunk = 1 ;
+
+    // construct the lower triangular part of the matrix
+    cholmod_triplet *T = CHOLMOD(allocate_triplet) (n, n, nzmax, -1,
+        CHOLMOD_REAL + DTYPE, cm) ;
+    OKP (T) ;
+    Int *Ti = T->i ;
+    Int *Tj = T->j ;
+    Real *Tx = T->x ;
+    Int nz = 0 ;
+    for (Int b = 0 ; b < nblocks ; b++)
+    {
+        for (Int j = b * bsize ; j < (b+1) * bsize ; j++)
+        {
+            for (Int i = j ; i < (b+1) * bsize ; i++)
+            {
+                Ti [nz] = i ;
+                Tj [nz] = j ;
+                Tx [nz] = (i == j) ? (4 * bsize) : (-1 - (Real) (i+j) / n) ;
+                nz++ ;
+            }
+            Ti [nz] = n-1 ;
+            Tj [nz] = j ;
+            Tx [nz] = -1 ;
+            nz++ ;
+        }
+    }
+    Ti [nz] = n-1 ;
+    Tj [nz] = n-1 ;
+    Tx [nz] = 2 * n ;
+    nz++ ;
+    T->nnz = nz ;
+    cholmod_sparse *A = CHOLMOD(triplet_to_sparse) (T, 0, cm) ;
+    OKP (A) ;
+    cholmod_dense *B = CHOLMOD(ones) (n, 1, CHOLMOD_REAL + DTYPE, cm) ;
+    OKP (B) ;
+
+    // factorize and solve, sequentially and then tree-parallel
+    cholmod_factor *L [2] ;
+    cholmod_dense *X [2] ;
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        cm->tree_split = (k == 0) ? 0 : 4 ;
+        L [k] = CHOLMOD(analyze) (A, cm) ;
+        OKP (L [k]) ;
+        OK (CHOLMOD(factorize) (A, L [k], cm)) ;
+        OK (L [k]->is_super && L [k]->nsuper > 2) ;
+        X [k] = CHOLMOD(solve) (CHOLMOD_A, L [k], B, cm) ;
+        OKP (X [k]) ;
+    }
+
+    // the results must be identical
+    OK (L [0]->xsize == L [1]->xsize) ;
+    OK (memcmp (L [0]->x, L [1]->x, L [0]->xsize * sizeof (Real)) == 0) ;
+    OK (memcmp (X [0]->x, X [1]->x, n * sizeof (Real)) == 0) ;
+    double r = resid (A, X [1], B) ;
+    OK (r < ((DTYPE == CHOLMOD_SINGLE) ? 1e-4 : 1e-12)) ;
+
+    // free everything
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        CHOLMOD(free_factor) (&(L [k]), cm) ;
+        CHOLMOD(free_dense) (&(X [k]), cm) ;
+    }
+    CHOLMOD(free_dense) (&B, cm) ;
+    CHOLMOD(free_sparse) (&A, cm) ;
+    CHOLMOD(free_triplet) (&T, cm) ;
+
+    // restore the settings
+    cm->supernodal = save1 ;
+    cm->nmethods = save2 ;
+    cm->method [0].ordering = save3 ;
+    cm->postorder = save4 ;
+    cm->nthreads_max = save5 ;
+    cm->chunk = save6 ;
+    cm->tree_split = save7 ;
+    progress (0, '.') ;
+}
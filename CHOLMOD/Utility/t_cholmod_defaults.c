@@ -41,6 +41,10 @@ int CHOLMOD(defaults) (cholmod_common *Common)
 
     Common->supernodal = CHOLMOD_AUTO ; // select supernodal automatically
     Common->supernodal_switch = 40 ;    // how to select super vs simpicial
+    Common->tree_split = 0 ;            // factorize supernodes in postorder
+    Common->level_solve = FALSE ;       // solve supernodes in order
+    Common->refine_max = 10 ;           // max # of refinement steps
+    Common->refine_steps = 0 ;
 
     Common->prefer_zomplex = FALSE ;    // use complex, not zomplex
     Common->prefer_upper = TRUE ;       // sym case: use upper not lower
@@ -39,8 +39,8 @@
 #endif
 
 #include "cholmod.h"
-#if !defined (CHOLMOD__VERSION) || CHOLMOD__VERSION < SUITESPARSE__VERCODE(5,3,3)
-#error "This library requires CHOLMOD 5.3.3 or later"
+#if !defined (CHOLMOD__VERSION) || CHOLMOD__VERSION < SUITESPARSE__VERCODE(6,0,0)
+#error "This library requires CHOLMOD 6.0.0 or later"
 #endif
 
 #include "colamd.h"
@@ -69,8 +69,8 @@
 #endif
 
 #include "klu.h"
-#if !defined (KLU__VERSION) || KLU__VERSION < SUITESPARSE__VERCODE(2,3,5)
-#error "This library requires KLU 2.3.5 or later"
+#if !defined (KLU__VERSION) || KLU__VERSION < SUITESPARSE__VERCODE(3,0,0)
+#error "This library requires KLU 3.0.0 or later"
 #endif
 
 #include "ldl.h"
@@ -94,8 +94,8 @@
 #endif
 
 #include "umfpack.h"
-#if !defined (UMFPACK__VERSION) || UMFPACK__VERSION < SUITESPARSE__VERCODE(6,3,5)
-#error "This library requires UMFPACK 6.3.5 or later"
+#if !defined (UMFPACK__VERSION) || UMFPACK__VERSION < SUITESPARSE__VERCODE(6,4,0)
+#error "This library requires UMFPACK 6.4.0 or later"
 #endif
 
 // SuiteSparse include files for C++:
@@ -48,6 +48,8 @@
 
 // special case semirings:
 
+#define GB_SEMIRING_HAS_ISA_VARIANTS 1
+
 // monoid properties:
 #define GB_Z_TYPE int32_t
 #define GB_DECLARE_IDENTITY(z) int32_t z = INT32_MAX
@@ -76,6 +78,32 @@
 
 #include "mxm/include/GB_mxm_shared_definitions.h"
 
+//------------------------------------------------------------------------------
+// dot2, dot3, and saxpy3 methods compiled for AVX512F and AVX2
+//------------------------------------------------------------------------------
+
+// These methods are compiled three times: for the baseline architecture, and
+// for x86_64 with AVX512F and with AVX2.  The variant is selected at run time,
+// from the ISA chosen once by GrB_init (see GB_Global_cpu_isa_get).
+
+#include "mxm/include/GB_AxB_saxpy3_template.h"
+
+#if GB_COMPILER_SUPPORTS_AVX512F && !GB_DISABLE
+    #define GB_TARGET_ISA GB_TARGET_AVX512F
+    #define GB_ISA(f) f ## _avx512f
+    #include "mxm/factory/GB_AxB_isa_template.c"
+    #undef  GB_TARGET_ISA
+    #undef  GB_ISA
+#endif
+
+#if GB_COMPILER_SUPPORTS_AVX2 && !GB_DISABLE
+    #define GB_TARGET_ISA GB_TARGET_AVX2
+    #define GB_ISA(f) f ## _avx2
+    #include "mxm/factory/GB_AxB_isa_template.c"
+    #undef  GB_TARGET_ISA
+    #undef  GB_ISA
+#endif
+
 //------------------------------------------------------------------------------
 // GB_Adot2B: C=A'*B, C<M>=A'*B, or C<!M>=A'*B: dot product method, C is bitmap
 //------------------------------------------------------------------------------
@@ -95,6 +123,22 @@ GrB_Info GB (_Adot2B__min_plus_int32)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+    switch (GB_Global_cpu_isa_get ( ))
+    {
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        case GB_CPU_ISA_AVX512F :
+            return (GB_Adot2B_avx512f (C, M, Mask_comp, Mask_struct,
+                A_not_transposed, A, A_slice, B, B_slice, nthreads, naslice,
+                nbslice)) ;
+        #endif
+        #if GB_COMPILER_SUPPORTS_AVX2
+        case GB_CPU_ISA_AVX2 :
+            return (GB_Adot2B_avx2 (C, M, Mask_comp, Mask_struct,
+                A_not_transposed, A, A_slice, B, B_slice, nthreads, naslice,
+                nbslice)) ;
+        #endif
+        default: ;
+    }
     #include "mxm/template/GB_AxB_dot2_meta.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -118,6 +162,20 @@ GrB_Info GB (_Adot3B__min_plus_int32)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+    switch (GB_Global_cpu_isa_get ( ))
+    {
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        case GB_CPU_ISA_AVX512F :
+            return (GB_Adot3B_avx512f (C, M, Mask_struct, A, B,
+                TaskList, ntasks, nthreads)) ;
+        #endif
+        #if GB_COMPILER_SUPPORTS_AVX2
+        case GB_CPU_ISA_AVX2 :
+            return (GB_Adot3B_avx2 (C, M, Mask_struct, A, B,
+                TaskList, ntasks, nthreads)) ;
+        #endif
+        default: ;
+    }
     #include "mxm/template/GB_AxB_dot3_meta.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -327,6 +385,22 @@ GrB_Info GB (_Asaxpy3B__min_plus_int32)
         GB_Werk Werk
     )
     {
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                return (GB_Asaxpy3B_M_avx512f (C, M, Mask_struct,
+                    M_in_place, A, B, SaxpyTasks, ntasks, nfine, nthreads,
+                    do_sort, Werk)) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                return (GB_Asaxpy3B_M_avx2 (C, M, Mask_struct,
+                    M_in_place, A, B, SaxpyTasks, ntasks, nfine, nthreads,
+                    do_sort, Werk)) ;
+            #endif
+            default: ;
+        }
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         double chunk = GB_Context_chunk ( ) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
@@ -377,6 +451,20 @@ GrB_Info GB (_Asaxpy3B__min_plus_int32)
         GB_Werk Werk
     )
     {
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                return (GB_Asaxpy3B_noM_avx512f (C, A, B, SaxpyTasks,
+                    ntasks, nfine, nthreads, do_sort, Werk)) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                return (GB_Asaxpy3B_noM_avx2 (C, A, B, SaxpyTasks,
+                    ntasks, nfine, nthreads, do_sort, Werk)) ;
+            #endif
+            default: ;
+        }
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         double chunk = GB_Context_chunk ( ) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
@@ -429,6 +517,22 @@ GrB_Info GB (_Asaxpy3B__min_plus_int32)
         GB_Werk Werk
     )
     {
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                return (GB_Asaxpy3B_notM_avx512f (C, M, Mask_struct,
+                    M_in_place, A, B, SaxpyTasks, ntasks, nfine, nthreads,
+                    do_sort, Werk)) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                return (GB_Asaxpy3B_notM_avx2 (C, M, Mask_struct,
+                    M_in_place, A, B, SaxpyTasks, ntasks, nfine, nthreads,
+                    do_sort, Werk)) ;
+            #endif
+            default: ;
+        }
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         double chunk = GB_Context_chunk ( ) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
@@ -35,7 +35,9 @@
 #define GB_IS_ANY_MONOID 1
 #define GB_MONOID_IS_TERMINAL 1
 
-// panel size
+// panel size, and AVX2/AVX512F variants of the panel method
+
+#define GB_RED_HAS_AVX_IMPLEMENTATION 0
 
 // disable this operator and use the generic case if these conditions hold
 #if (defined(GxB_NO_ANY) || defined(GxB_NO_FP32) || defined(GxB_NO_ANY_FP32))
@@ -71,6 +73,23 @@ GrB_Info GB (_red__any_fp32)
     }
     else
     {
+        #if GB_RED_HAS_AVX_IMPLEMENTATION
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                GB_red_panel_avx512f (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                GB_red_panel_avx2 (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            default: ;
+        }
+        #endif
+        // any architecture
         #include "reduce/template/GB_reduce_panel.c"
     }
     (*result) = z ;
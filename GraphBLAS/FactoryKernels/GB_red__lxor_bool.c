@@ -33,8 +33,9 @@
 #define GB_DECLARE_IDENTITY(z) bool z = false
 #define GB_DECLARE_IDENTITY_CONST(z) const bool z = false
 
-// panel size
+// panel size, and AVX2/AVX512F variants of the panel method
 #define GB_PANEL 8
+#define GB_RED_HAS_AVX_IMPLEMENTATION 0
 
 // disable this operator and use the generic case if these conditions hold
 #if (defined(GxB_NO_LXOR) || defined(GxB_NO_BOOL) || defined(GxB_NO_LXOR_BOOL))
@@ -70,6 +71,23 @@ GrB_Info GB (_red__lxor_bool)
     }
     else
     {
+        #if GB_RED_HAS_AVX_IMPLEMENTATION
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                GB_red_panel_avx512f (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                GB_red_panel_avx2 (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            default: ;
+        }
+        #endif
+        // any architecture
         #include "reduce/template/GB_reduce_panel.c"
     }
     (*result) = z ;
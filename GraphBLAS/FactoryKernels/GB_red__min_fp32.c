@@ -33,8 +33,9 @@
 #define GB_DECLARE_IDENTITY(z) float z = INFINITY
 #define GB_DECLARE_IDENTITY_CONST(z) const float z = INFINITY
 
-// panel size
+// panel size, and AVX2/AVX512F variants of the panel method
 #define GB_PANEL 16
+#define GB_RED_HAS_AVX_IMPLEMENTATION 1
 
 // disable this operator and use the generic case if these conditions hold
 #if (defined(GxB_NO_MIN) || defined(GxB_NO_FP32) || defined(GxB_NO_MIN_FP32))
@@ -45,6 +46,50 @@
 
 #include "monoid/include/GB_monoid_shared_definitions.h"
 
+//------------------------------------------------------------------------------
+// panel reduction compiled for AVX512F and AVX2
+//------------------------------------------------------------------------------
+
+// The panel method is compiled three times: for the baseline architecture,
+// and for x86_64 with AVX512F and with AVX2.  The variant is selected at run
+// time, from the ISA chosen once by GrB_init (see GB_Global_cpu_isa_get).
+
+#if GB_COMPILER_SUPPORTS_AVX512F && !GB_DISABLE
+
+    GB_TARGET_AVX512F static void GB_red_panel_avx512f
+    (
+        GB_Z_TYPE *result,
+        const GrB_Matrix A,
+        GB_Z_TYPE *restrict W,
+        int ntasks,
+        int nthreads
+    )
+    {
+        GB_Z_TYPE z = (*result) ;
+        #include "reduce/template/GB_reduce_panel.c"
+        (*result) = z ;
+    }
+
+#endif
+
+#if GB_COMPILER_SUPPORTS_AVX2 && !GB_DISABLE
+
+    GB_TARGET_AVX2 static void GB_red_panel_avx2
+    (
+        GB_Z_TYPE *result,
+        const GrB_Matrix A,
+        GB_Z_TYPE *restrict W,
+        int ntasks,
+        int nthreads
+    )
+    {
+        GB_Z_TYPE z = (*result) ;
+        #include "reduce/template/GB_reduce_panel.c"
+        (*result) = z ;
+    }
+
+#endif
+
 //------------------------------------------------------------------------------
 // reduce to a non-iso matrix to scalar, for monoids only
 //------------------------------------------------------------------------------
@@ -70,6 +115,23 @@ GrB_Info GB (_red__min_fp32)
     }
     else
     {
+        #if GB_RED_HAS_AVX_IMPLEMENTATION
+        switch (GB_Global_cpu_isa_get ( ))
+        {
+            #if GB_COMPILER_SUPPORTS_AVX512F
+            case GB_CPU_ISA_AVX512F :
+                GB_red_panel_avx512f (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            #if GB_COMPILER_SUPPORTS_AVX2
+            case GB_CPU_ISA_AVX2 :
+                GB_red_panel_avx2 (result, A, W, ntasks, nthreads) ;
+                return (GrB_SUCCESS) ;
+            #endif
+            default: ;
+        }
+        #endif
+        // any architecture
         #include "reduce/template/GB_reduce_panel.c"
     }
     (*result) = z ;
@@ -51,6 +51,46 @@
 
 #include "omp/include/GB_kernel_shared_definitions.h"
 
+//------------------------------------------------------------------------------
+// apply a unary operator, compiled for AVX512F and AVX2
+//------------------------------------------------------------------------------
+
+// The apply method is compiled three times: for the baseline architecture,
+// and for x86_64 with AVX512F and with AVX2.  The variant is selected at run
+// time, from the ISA chosen once by GrB_init (see GB_Global_cpu_isa_get).
+
+#if GB_COMPILER_SUPPORTS_AVX512F && !GB_DISABLE
+
+    GB_TARGET_AVX512F static void GB_uop_apply_avx512f
+    (
+        GB_void *Cx_out,
+        const GB_void *Ax_in,
+        const int8_t *restrict Ab,
+        int64_t anz,
+        int nthreads
+    )
+    {
+        #include "apply/factory/GB_apply_unop_template.c"
+    }
+
+#endif
+
+#if GB_COMPILER_SUPPORTS_AVX2 && !GB_DISABLE
+
+    GB_TARGET_AVX2 static void GB_uop_apply_avx2
+    (
+        GB_void *Cx_out,
+        const GB_void *Ax_in,
+        const int8_t *restrict Ab,
+        int64_t anz,
+        int nthreads
+    )
+    {
+        #include "apply/factory/GB_apply_unop_template.c"
+    }
+
+#endif
+
 //------------------------------------------------------------------------------
 // Cx = op (cast (Ax)): apply a unary operator
 //------------------------------------------------------------------------------
@@ -67,6 +107,20 @@ GrB_Info GB (_uop_apply__abs_fp32_fp32)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+    switch (GB_Global_cpu_isa_get ( ))
+    {
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        case GB_CPU_ISA_AVX512F :
+            GB_uop_apply_avx512f (Cx_out, Ax_in, Ab, anz, nthreads) ;
+            return (GrB_SUCCESS) ;
+        #endif
+        #if GB_COMPILER_SUPPORTS_AVX2
+        case GB_CPU_ISA_AVX2 :
+            GB_uop_apply_avx2 (Cx_out, Ax_in, Ab, anz, nthreads) ;
+            return (GrB_SUCCESS) ;
+        #endif
+        default: ;
+    }
     #include "apply/factory/GB_apply_unop_template.c"
     return (GrB_SUCCESS) ;
     #endif
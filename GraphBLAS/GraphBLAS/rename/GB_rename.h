@@ -391,6 +391,8 @@
 #define GB_Global_cpu_features_avx2 GM_Global_cpu_features_avx2
 #define GB_Global_cpu_features_avx512f GM_Global_cpu_features_avx512f
 #define GB_Global_cpu_features_query GM_Global_cpu_features_query
+#define GB_Global_cpu_isa_get GM_Global_cpu_isa_get
+#define GB_Global_cpu_isa_set GM_Global_cpu_isa_set
 #define GB_Global_flush_get GM_Global_flush_get
 #define GB_Global_flush_set GM_Global_flush_set
 #define GB_Global_free_function_get GM_Global_free_function_get
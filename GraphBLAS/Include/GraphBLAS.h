@@ -517,6 +517,14 @@ typedef struct GB_Scalar_opaque *GxB_Scalar ;       // use GrB_Scalar
 // GxB_IMPORT:  GxB_FAST_IMPORT (faster, for trusted input data) or
 //      GxB_SECURE_IMPORT (slower, for untrusted input data), for the
 //      GxB*_pack* methods.
+//
+// GxB_BUILD_SORTED: if true, GxB_Matrix_build_Vector,
+//      GxB_Matrix_build_Scalar_Vector, GxB_Vector_build_Vector, and
+//      GxB_Vector_build_Scalar_Vector can assume the tuples are already sorted
+//      with no duplicates: by row and then column if the matrix is held by
+//      row, or by column and then row if held by column.  The tuples are not
+//      checked, so the result is undefined if this is not true.  By default,
+//      the build checks if the tuples are sorted, and exploits this if so.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field for global options.  They are defined with the same integer
@@ -540,6 +548,7 @@ typedef enum    // GrB_Desc_Field ;
     GxB_ROWINDEX_LIST = 7094,       // how GrB_Vector I is intrepretted
     GxB_COLINDEX_LIST = 7095,       // how GrB_Vector J is intrepretted
     GxB_VALUE_LIST = 7096,          // how GrB_Vector X is intrepretted
+    GxB_BUILD_SORTED = 7097,        // tuples for GrB_build are sorted
 }
 GrB_Desc_Field ;
 
@@ -1506,9 +1515,22 @@ typedef enum    // GxB_Option_Field ;
     GxB_PRINTF = 7020,               // printf function diagnostic output
     GxB_FLUSH = 7021,                // flush function diagnostic output
     GxB_MEMORY_POOL = 7022,          // no longer used
+    GxB_MEMORY_POOL_LIMIT = 7065,    // max # of bytes in CPU memory pool
+    GxB_MEMORY_POOL_BYTES = 7066,    // # of bytes held in CPU memory pool
+    GxB_MEMORY_POOL_HITS = 7067,     // # of allocations from the pool
+    GxB_MEMORY_POOL_MISSES = 7068,   // # of pool allocations that used malloc
     GxB_PRINT_1BASED = 7023,         // print matrices as 0-based or 1-based
     GxB_INCLUDE_READONLY_STATISTICS = 7077, // include readonly memory in
                                      // memory usage statistics
+    GxB_PENDING_THRESHOLD = 7064,    // max # of pending tuples searched by
+                                     // GrB_*_extractElement (int64 value)
+    GxB_AxB_TUNING = 7069,           // method selection for C<M>=A*B
+                                     // (a GxB_AxB_Tuning value)
+    GxB_AxB_DOT_RATIO = 7072,        // cost of dot3 work relative to saxpy3
+    GxB_AxB_LAST_METHOD = 7073,      // method used by the last C=A*B
+    GxB_AxB_LAST_COST = 7074,        // predicted cost of the last C<M>=A*B
+    GxB_AxB_PROFILE_SAVE = 7075,     // save the AxB tuning profile to a file
+    GxB_AxB_PROFILE_LOAD = 7101,     // load the AxB tuning profile from a file
 
     GxB_JIT_C_COMPILER_NAME = 7024,  // CPU JIT C compiler name
     GxB_JIT_C_COMPILER_FLAGS = 7025, // CPU JIT C compiler flags
@@ -1520,6 +1542,8 @@ typedef enum    // GxB_Option_Field ;
     GxB_JIT_C_CMAKE_LIBS = 7031,     // CPU JIT C libraries when using cmake
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
+    GxB_JIT_ARCHIVE_EXPORT = 7062,   // CPU JIT: export kernels to an archive
+    GxB_JIT_ARCHIVE_IMPORT = 7063,   // CPU JIT: import kernels from an archive
 
     GxB_JIT_CUDA_PREFACE = 7100,     // CUDA JIT C++ preface
 
@@ -1536,6 +1560,15 @@ typedef enum    // GxB_JIT_Control ;
 }
 GxB_JIT_Control ;
 
+// for GxB_AxB_TUNING:
+typedef enum    // GxB_AxB_Tuning ;
+{
+    GxB_AxB_TUNING_OFF = 0,     // fixed heuristics select the method (default)
+    GxB_AxB_TUNING_ON = 1,      // cost model selects dot3 or saxpy3 for C<M>
+    GxB_AxB_TUNING_TRAIN = 2,   // also time both methods to tune the model
+}
+GxB_AxB_Tuning ;
+
 // the default hyper_switch parameter
 GB_GLOBAL const double GxB_HYPER_DEFAULT ;
 
@@ -4230,6 +4263,44 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+//==============================================================================
+// GxB_mxm_reduce_Scalar, GxB_mxm_select: fused matrix multiplication
+//==============================================================================
+
+// GxB_mxm_reduce_Scalar computes s = accum (s, reduce (monoid, T)) where
+// T<Mask>=A*B, and GxB_mxm_select computes C<Mask> = accum (C, select (op, T,
+// y)) where T<Mask>=A*B.  The results are the same as GrB_mxm followed by
+// GrB_reduce or GrB_select, but the product T is computed in chunks, each of
+// which is reduced or selected before the next one is computed, so that T is
+// never held in its entirety.  For GxB_mxm_select, the Mask is used both for
+// T<Mask>=A*B and for C<Mask>=accum(C,...).  The descriptor controls the Mask,
+// the transpose of A and B, and the method used for A*B, as for GrB_mxm.
+
+GrB_Info GxB_mxm_reduce_Scalar      // s = accum (s, reduce (T<Mask>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for results
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce T
+    const GrB_Matrix Mask,          // optional mask for T, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
+GrB_Info GxB_mxm_select             // C<Mask> = accum (C, select (A*B))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C and T
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp op,      // operator to select entries of T
+    const GrB_Scalar y,             // scalar y for the select operator
+    const GrB_Descriptor desc       // descriptor for C, Mask, A, and B
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
@@ -5660,6 +5731,47 @@ GrB_Info GrB_Matrix_kronecker_Semiring  // C<M> = accum (C, kron(A,B))
     (C, Mask, accum, op, A, B, desc)
 #endif
 
+// GxB_Matrix_kronecker_stream computes C = kron(A,B), or kron(A',B) etc as
+// determined by the descriptor, and passes it to a user-provided tile_function
+// one tile at a time, so that C is never held in memory all at once.  Each
+// tile holds a contiguous range of columns of C (if the Mask is held by
+// column, or if there is no Mask and matrices are held by column by default),
+// or a contiguous range of rows, and the tiles are passed to the
+// tile_function in order.  Tiles with no entries are skipped.  If the Mask is
+// present, only the entries of C permitted by the Mask (with GrB_COMP and
+// GrB_STRUCTURE from the descriptor) are kept in each tile.  If the select_op
+// is present, only the entries of C that satisfy select_op (C(i,j), i, j, y)
+// are kept, as in GrB_select.
+
+// The tile_function is passed the Tile, and the offsets of its first row and
+// column in C, so that the entry Tile(i,j) is C(i+row_offset, j+col_offset).
+// The Tile is owned by GraphBLAS and is freed when the tile_function returns;
+// it must not be modified or freed by the tile_function, but it may be
+// copied with GrB_Matrix_dup.  If the tile_function returns anything other
+// than GrB_SUCCESS, no more tiles are computed and GxB_Matrix_kronecker_stream
+// returns that value.
+
+typedef GrB_Info (*GxB_kronecker_function)
+(
+    const GrB_Matrix Tile,          // a tile of C
+    uint64_t row_offset,            // C (row_offset,col_offset) is the
+    uint64_t col_offset,            // first entry of the Tile
+    void *arg                       // the arg passed to the stream method
+) ;
+
+GrB_Info GxB_Matrix_kronecker_stream    // stream C<M>=kron(A,B) in tiles
+(
+    GxB_kronecker_function tile_function,   // called for each tile of C
+    void *arg,                      // passed to the tile_function
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp op,          // defines '*' for C=kron(A,B)
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar y,             // scalar y for the select_op
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
 //==============================================================================
 // GrB_*_resize:  change the size of a matrix or vector
 //==============================================================================
@@ -6253,6 +6365,70 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+// GxB_Matrix_deserialize_stream is identical to GxB_Matrix_deserialize, except
+// that the blob is read in order from a stream by the read_function, instead
+// of being held in memory.  The read_function reads up to size bytes into the
+// buffer and returns the number of bytes read, or zero if the stream has ended
+// or an error occurred (like fread or read).  The blob is never held in memory
+// all at once; its compressed blocks are read in batches and decompressed in
+// parallel directly into the output matrix.  Any blob created by
+// GrB_Matrix_serialize, GxB_Matrix_serialize, GrB_Vector_serialize, or
+// GxB_Vector_serialize may be read this way.
+
+typedef size_t (*GxB_read_function) (void *buffer, size_t size, void *stream) ;
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    GxB_read_function read_function,    // reads the next bytes of the blob
+    void *stream,       // passed to the read_function
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_mmap_save writes a matrix to a file, uncompressed, with each of
+// its arrays aligned to a page boundary.  GxB_Matrix_mmap maps the file into
+// memory, read-only, and loads it into the matrix A in O(1) time with no copy.
+// The arrays of A are read-only (see GxB_IS_READONLY), so A can be used as an
+// input but not modified.  The map is owned by the user application: A must
+// be freed before the map is released by GxB_munmap.  The file is not
+// portable between systems with a different byte order.
+
+GrB_Info GxB_Matrix_mmap_save   // write a matrix to a file for GxB_Matrix_mmap
+(
+    const char *filename,       // file to write
+    GrB_Matrix A,               // matrix to write
+    const GrB_Descriptor desc   // currently unused
+) ;
+
+GrB_Info GxB_Matrix_mmap        // load a read-only matrix from a mapped file
+(
+    // input/output:
+    GrB_Matrix A,               // matrix to load; any prior content is freed
+    // output:
+    void **map,                 // the memory-mapped file
+    uint64_t *map_size,         // size of the map
+    // input:
+    GrB_Type type,              // type of A.  Required if the file holds a
+                                // matrix of user-defined type.  May be NULL
+                                // if the file holds a built-in type; otherwise
+                                // must match the type of the matrix in the
+                                // file.
+    const char *filename,       // file written by GxB_Matrix_mmap_save
+    const GrB_Descriptor desc   // for GxB_IMPORT (fast or secure)
+) ;
+
+GrB_Info GxB_munmap             // release a file mapped by GxB_Matrix_mmap
+(
+    void *map,                  // the memory-mapped file
+    uint64_t map_size           // size of the map
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
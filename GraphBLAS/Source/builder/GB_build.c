@@ -94,6 +94,12 @@
 // time taken by this function is just O(nvals*log(nvals)), regardless of what
 // format C is returned in.
 
+// If known_sorted is true, the caller asserts that the tuples are sorted, with
+// no duplicates: by row and then by column if C is held by row, or by column
+// and then by row if C is held by column.  The tuples are then trusted and
+// not checked (except that the indices must be in range).  This is set by the
+// GxB_BUILD_SORTED descriptor, for the GxB_*_build_*Vector methods.
+
 // The input arrays I, J, and X are not modified.
 
 #define GB_FREE_ALL GrB_Matrix_free (&T) ;
@@ -112,6 +118,7 @@ GrB_Info GB_build               // build matrix
     const bool X_iso,           // if true the C is iso and X has size 1 entry
     bool I_is_32,               // if true, I is 32-bit; else 64-bit
     bool J_is_32,               // if true, J is 32-bit; else 64-bit
+    const bool known_sorted,    // if true, tuples are sorted with no dupl.
     GB_Werk Werk
 )
 {
@@ -290,8 +297,8 @@ GrB_Info GB_build               // build matrix
         &J_work_size,
         &no_X_work,     // X_work_handle, not used here
         &X_work_size,
-        false,          // known_sorted: not yet known
-        false,          // known_no_duplicates: not yet known
+        known_sorted,   // known_sorted: if asserted by the caller
+        known_sorted,   // known_no_duplicates: if asserted by the caller
         0,              // I_work, J_work, and X_work not used here
         is_matrix,      // true if T is a GrB_Matrix
         C->is_csc ? I : J,  // size nvals
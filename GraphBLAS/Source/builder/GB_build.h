@@ -24,6 +24,7 @@ GrB_Info GB_build               // build matrix
     const bool X_iso,           // if true the C is iso and X has size 1 entry
     bool I_is_32,               // if true, I is 32-bit; else 64-bit
     bool J_is_32,               // if true, J is 32-bit; else 64-bit
+    const bool known_sorted,    // if true, tuples are sorted with no dupl.
     GB_Werk Werk
 ) ;
 
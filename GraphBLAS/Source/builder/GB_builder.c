@@ -28,7 +28,11 @@
 // STEP 1: copy user input.  O(e/p) read/write per thread, or skipped.
 
 // STEP 2: sort the tuples.  Time: O((e log e)/p), read/write, or skipped if
-//         the tuples are already sorted.
+//         the tuples are already sorted.  If the tuples are already sorted
+//         by vector but not within each vector, each vector is sorted on its
+//         own instead.  Any parts of the input that are already sorted skip
+//         the leaf sorts of the parallel mergesort, which then only merges
+//         them.
 
 // STEP 3: count vectors and duplicates.  O(e/p) reads, per thread, if no
 //         duplicates, or skipped if already done.  O(e/p) read/writes
@@ -48,6 +52,12 @@
 // I_work is transplanted into T->i.  Step 5 does O(e/p) read/writes per thread
 // to copy Sx into T->x.
 
+// If the caller asserts that the tuples are sorted with no duplicates (with
+// the GxB_BUILD_SORTED descriptor, which sets both known_sorted and
+// known_no_duplicates on input when I_work is NULL), Step 1 only copies and
+// checks the indices for being in range, and the tuples are trusted to be
+// sorted.  Results are undefined if they are not, as with GxB_FAST_IMPORT.
+
 // For GrB_Vector_build: as GrB_Matrix_build, Step 1 does O(e/p) read/writes
 // per thread.  The input is always a vector, so vdim == 1 always holds.  Step
 // 2 is skipped if the indices are already sorted, and Step 3 does no work at
@@ -287,6 +297,10 @@ GrB_Info GB_builder                 // build a matrix from tuples
     // no duplicates present.
     bool tnvec_and_tnz_slice_computed = false ;
 
+    // this becomes true if the (I_input,J_input) tuples are sorted by vector
+    // but not within each vector, so that each vector can be sorted on its own
+    bool sort_each_vector = false ;
+
     //--------------------------------------------------------------------------
     // STEP 1: copy user input and check if valid
     //--------------------------------------------------------------------------
@@ -373,8 +387,12 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // create the tuples to sort, and check for any invalid indices
         //----------------------------------------------------------------------
 
+        // if the caller asserts the tuples are sorted with no duplicates,
+        // they are trusted and not checked
+        bool trusted = known_sorted && known_no_duplicates ;
         known_sorted = true ;
         bool no_duplicates_found = true ;
+        bool vectors_sorted = true ;
 
         if (nvals == 0)
         { 
@@ -396,7 +414,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
             int tid ;
             #pragma omp parallel for num_threads(nthreads) schedule(static) \
-                reduction(&&:known_sorted) reduction(&&:no_duplicates_found)
+                reduction(&&:known_sorted) reduction(&&:no_duplicates_found) \
+                reduction(&&:vectors_sorted)
             for (tid = 0 ; tid < nthreads ; tid++)
             {
                 kbad [tid] = -1 ;
@@ -421,13 +440,20 @@ GrB_Info GB_builder                 // build a matrix from tuples
                         break ;
                     }
 
-                    // check if the tuples are already sorted
-                    known_sorted = known_sorted &&
-                        ((jlast < j) || (jlast == j && ilast <= i)) ;
+                    if (!trusted)
+                    { 
+                        // check if the tuples are already sorted
+                        known_sorted = known_sorted &&
+                            ((jlast < j) || (jlast == j && ilast <= i)) ;
+
+                        // check if this entry is a duplicate of the one
+                        // before it
+                        no_duplicates_found = no_duplicates_found &&
+                            (!(jlast == j && ilast == i)) ;
 
-                    // check if this entry is a duplicate of the one before it
-                    no_duplicates_found = no_duplicates_found &&
-                        (!(jlast == j && ilast == i)) ;
+                        // check if the tuples are sorted by vector
+                        vectors_sorted = vectors_sorted && (jlast <= j) ;
+                    }
 
                     // copy the tuple into I_work.  J_work is done later.
                     // Iwork [k] = i
@@ -475,11 +501,34 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // valid, Otherwise, they can only be computed after sorting.
             tnvec_and_tnz_slice_computed = known_sorted && no_duplicates_found ;
 
+            //------------------------------------------------------------------
+            // determine if each vector can be sorted on its own
+            //------------------------------------------------------------------
+
+            // If the tuples are sorted by vector but not within each vector,
+            // then J_input is already in its final order.  Each vector is
+            // sorted on its own in Step 2, which takes O(e log d) time
+            // instead of O(e log e), where d is the largest vector length.
+            // With one thread per slice, a task sorts all vectors that start
+            // in its slice, so this is only done if the tuples have enough
+            // vectors to balance the work across the threads.  Otherwise, the
+            // parallel mergesort is used.
+
+            if (vdim > 1 && !known_sorted && vectors_sorted)
+            {
+                int64_t tnvec = 0 ;
+                for (int tid = 0 ; tid < nthreads ; tid++)
+                { 
+                    tnvec += tnvec_slice [tid] ;
+                }
+                sort_each_vector = (nthreads == 1 || tnvec >= 64 * nthreads) ;
+            }
+
             //------------------------------------------------------------------
             // allocate J_work, if needed
             //------------------------------------------------------------------
 
-            if (vdim > 1 && !known_sorted)
+            if (vdim > 1 && !known_sorted && !sort_each_vector)
             { 
                 // copy J_input into J_work, so the tuples can be sorted.
                 // J_work can be smaller than J_input, so GB_cast_int is used.
@@ -512,7 +561,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
                 // J_work is a shallow copy of J_input.  The pointer is not
                 // copied into (*J_work_handle), so it will not be freed.
                 // J_input is not modified since J_work is not modified in
-                // this case.  J_is_32 is unchanged.
+                // this case (the tuples are already sorted, or only sorted
+                // within each vector).  J_is_32 is unchanged.
                 J_work = (void *) J_input ;
             }
 
@@ -552,12 +602,16 @@ GrB_Info GB_builder                 // build a matrix from tuples
                         break ;
                     }
 
-                    // check if the tuples are already sorted
-                    known_sorted = known_sorted && (ilast <= i) ;
+                    if (!trusted)
+                    { 
+                        // check if the tuples are already sorted
+                        known_sorted = known_sorted && (ilast <= i) ;
 
-                    // check if this entry is a duplicate of the one before it
-                    no_duplicates_found = no_duplicates_found &&
-                        (!(ilast == i)) ;
+                        // check if this entry is a duplicate of the one
+                        // before it
+                        no_duplicates_found = no_duplicates_found &&
+                            (!(ilast == i)) ;
+                    }
 
                     // copy the tuple into the work arrays to be sorted
                     // I_work [k] = i ;
@@ -649,7 +703,63 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // sort all the tuples
         //----------------------------------------------------------------------
 
-        if (vdim > 1)
+        if (sort_each_vector)
+        {
+
+            //------------------------------------------------------------------
+            // sort the (i,k) tuples in each vector j
+            //------------------------------------------------------------------
+
+            // J_work is J_input, which is already sorted.  Each vector is
+            // sorted by the task of the slice in which it starts.
+
+            if (do_burble)
+            { 
+                GBURBLE ("(sort each vector) ") ;
+            }
+
+            int tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t kstart = tstart_slice [tid] ;
+                int64_t kend   = tstart_slice [tid+1] ;
+                int64_t k = kstart ;
+                if (k > 0 && k < kend)
+                {
+                    // skip the vector that starts in a prior slice
+                    int64_t jprior = GB_IGET (J_work, k-1) ;
+                    while (k < kend && GB_IGET (J_work, k) == jprior)
+                    { 
+                        k++ ;
+                    }
+                }
+                while (k < kend)
+                {
+                    // find the vector j that starts at tuple k
+                    int64_t j = GB_IGET (J_work, k) ;
+                    int64_t kvend = k + 1 ;
+                    while (kvend < nvals && GB_IGET (J_work, kvend) == j)
+                    { 
+                        kvend++ ;
+                    }
+                    // sort the tuples in I_work [k:kvend-1]
+                    if (S_iso)
+                    { 
+                        // K_work is NULL; only sort (i)
+                        GB_qsort_1 (GB_IADDR (I_work, k), I_is_32, kvend - k) ;
+                    }
+                    else
+                    { 
+                        GB_qsort_2 (GB_IADDR (I_work, k), I_is_32,
+                            GB_IADDR (K_work, k), K_is_32, kvend - k) ;
+                    }
+                    k = kvend ;
+                }
+            }
+
+        }
+        else if (vdim > 1)
         {
 
             //------------------------------------------------------------------
@@ -29,7 +29,8 @@ GrB_Info function_name          /* build a matrix from tuples */              \
     GB_RETURN_IF_NULL (C) ;            /* check now so C->type can be done */ \
     GB_BURBLE_START (GB_STR(function_name)) ;                                 \
     info = GB_build (C, I, J, X, nvals, dup, xtype, /* is_matrix: */ true,    \
-        /* X iso: */ false, /* I,J is 32: */ false, false, Werk) ;            \
+        /* X iso: */ false, /* I,J is 32: */ false, false,                    \
+        /* known_sorted: */ false, Werk) ;                                    \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
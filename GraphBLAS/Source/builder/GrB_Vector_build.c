@@ -30,7 +30,7 @@ GrB_Info function_name          /* build a vector from tuples */              \
     ASSERT (GB_VECTOR_OK (w)) ;                                               \
     info = GB_build ((GrB_Matrix) w, I, NULL, X, nvals, dup, xtype,           \
         /* is_matrix: */ false, /* X_iso: */ false,                           \
-        /* I,J is 32: */ false, false, Werk) ;                                \
+        /* I,J is 32: */ false, false, /* known_sorted: */ false, Werk) ;     \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
@@ -48,7 +48,7 @@ GrB_Info GxB_Matrix_build_Scalar
 
     info = GB_build (C, I, J, scalar->x, nvals, GxB_IGNORE_DUP, scalar->type,
         /* is_matrix: */ true, /* X_iso: */ true,
-        /* I,J is 32: */ false, false, Werk) ;
+        /* I,J is 32: */ false, false, /* known_sorted: */ false, Werk) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -79,12 +79,16 @@ GrB_Info GxB_Matrix_build_Scalar_Vector // build a matrix from (I,J,s) tuples
     bool I_is_32 = (I_type == GrB_UINT32) ;
     bool J_is_32 = (J_type == GrB_UINT32) ;
 
+    // the caller may assert that the tuples are sorted with no duplicates
+    bool known_sorted = (desc != NULL && desc->build_sorted) ;
+
     //--------------------------------------------------------------------------
     // build the matrix, ignoring duplicates
     //--------------------------------------------------------------------------
 
     GB_OK (GB_build (C, I, J, scalar->x, nvals, GxB_IGNORE_DUP, scalar->type,
-        /* is_matrix: */ true, /* X_iso: */ true, I_is_32, J_is_32, Werk)) ;
+        /* is_matrix: */ true, /* X_iso: */ true, I_is_32, J_is_32,
+        known_sorted, Werk)) ;
 
     //--------------------------------------------------------------------------
     // free workspace and return result
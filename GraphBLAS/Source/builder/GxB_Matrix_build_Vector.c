@@ -81,6 +81,9 @@ GrB_Info GxB_Matrix_build_Vector // build a matrix from (I,J,X) tuples
     bool I_is_32 = (I_type == GrB_UINT32) ;
     bool J_is_32 = (J_type == GrB_UINT32) ;
 
+    // the caller may assert that the tuples are sorted with no duplicates
+    bool known_sorted = (desc != NULL && desc->build_sorted) ;
+
     // FUTURE: if they come from List->i, then I,J,X are known to be sorted
     // with no duplicates.  Exploit this in GB_build.
 
@@ -92,7 +95,7 @@ GrB_Info GxB_Matrix_build_Vector // build a matrix from (I,J,X) tuples
     //--------------------------------------------------------------------------
 
     GB_OK (GB_build (C, I, J, X, nvals, dup, X_type, /* is_matrix: */ true,
-        /* X iso: */ false, I_is_32, J_is_32, Werk)) ;
+        /* X iso: */ false, I_is_32, J_is_32, known_sorted, Werk)) ;
 
     //--------------------------------------------------------------------------
     // free workspace and return result
@@ -53,7 +53,7 @@ GrB_Info GxB_Vector_build_Scalar    // build a vector from (i,scalar) tuples
     info = GB_build ((GrB_Matrix) w, I, NULL, scalar->x, nvals,
         GxB_IGNORE_DUP, scalar->type,
         /* is_matrix: */ false, /* X_iso: */ true,
-        /* I,J is 32: */ false, false, Werk) ;
+        /* I,J is 32: */ false, false, /* known_sorted: */ false, Werk) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -65,6 +65,9 @@ GrB_Info GxB_Vector_build_Scalar_Vector // build a vector from (I,s) tuples
         &I, &ni, &I_size, &I_type, Werk)) ;
     bool I_is_32 = (I_type == GrB_UINT32) ;
 
+    // the caller may assert that the tuples are sorted with no duplicates
+    bool known_sorted = (desc != NULL && desc->build_sorted) ;
+
     //--------------------------------------------------------------------------
     // build the vector
     //--------------------------------------------------------------------------
@@ -72,7 +75,7 @@ GrB_Info GxB_Vector_build_Scalar_Vector // build a vector from (I,s) tuples
     GB_OK (GB_build ((GrB_Matrix) w, I, NULL, scalar->x, ni,
         GxB_IGNORE_DUP, scalar->type,
         /* is_matrix: */ false, /* X_iso: */ true,
-        /* I,J is 32: */ I_is_32, false, Werk)) ;
+        /* I,J is 32: */ I_is_32, false, known_sorted, Werk)) ;
 
     //--------------------------------------------------------------------------
     // free workspace and return result
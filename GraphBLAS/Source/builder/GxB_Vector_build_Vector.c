@@ -74,6 +74,9 @@ GrB_Info GxB_Vector_build_Vector // build a vector from (I,X) tuples
         &X, &nx, &X_size, &X_type, Werk)) ;
     bool I_is_32 = (I_type == GrB_UINT32) ;
 
+    // the caller may assert that the tuples are sorted with no duplicates
+    bool known_sorted = (desc != NULL && desc->build_sorted) ;
+
     // FUTURE: if they come from List->i, then I,X are known to be sorted
     // with no duplicates.  Exploit this in GB_build.
 
@@ -85,7 +88,8 @@ GrB_Info GxB_Vector_build_Vector // build a vector from (I,X) tuples
     //--------------------------------------------------------------------------
 
     GB_OK (GB_build ((GrB_Matrix) w, I, NULL, X, nvals, dup, X_type,
-        /* is_matrix: */ false, /* X iso: */ false, I_is_32, false, Werk)) ;
+        /* is_matrix: */ false, /* X iso: */ false, I_is_32, false,
+        known_sorted, Werk)) ;
 
     //--------------------------------------------------------------------------
     // free workspace and return result
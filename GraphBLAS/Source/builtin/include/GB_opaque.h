@@ -467,6 +467,7 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int row_list ;          // how to use the row index list, I
     int col_list ;          // how to use the col index list, J
     int val_list ;          // how to use the value list, X
+    bool build_sorted ;     // if true, tuples for GrB_build are sorted
 } ;
 
 struct GB_Context_opaque    // content of GxB_Context
@@ -306,6 +306,22 @@ else
     fprintf (f, 'm4_define(`GB_semiring_has_avx'', `'')\n') ;
 end
 
+% compile the dot2, dot3, and saxpy3 methods for AVX2 and AVX512F, for the
+% plus_times and min_plus semirings on 32-bit and 64-bit integers and on float
+% and double, and for the any_pair_iso semiring.
+ztype_is_32_64 = any (strcmp (ztype, ...
+    {'int32_t', 'int64_t', 'uint32_t', 'uint64_t', 'float', 'double'})) ;
+has_isa_variants = is_any_pair || (ztype_is_32_64 && ...
+    ((is_plus && isequal (multop, 'times')) || ...
+     (is_min  && isequal (multop, 'plus')))) ;
+if (has_isa_variants)
+    fprintf (f, 'm4_define(`if_semiring_has_isa_variants'', `0'')\n') ;
+    fprintf (f, 'm4_define(`GB_semiring_has_isa_variants'', `#define GB_SEMIRING_HAS_ISA_VARIANTS 1'')\n') ;
+else
+    fprintf (f, 'm4_define(`if_semiring_has_isa_variants'', `-1'')\n') ;
+    fprintf (f, 'm4_define(`GB_semiring_has_isa_variants'', `'')\n') ;
+end
+
 one = '' ;
 if (is_pair)
     fprintf (f, 'm4_define(`GB_is_pair_multiplier'', `%s'')\n', ...
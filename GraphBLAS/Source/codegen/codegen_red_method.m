@@ -111,6 +111,22 @@ else
     fprintf (f, 'm4_define(`GB_panel'', `#define GB_PANEL %d'')\n', panel) ;
 end
 
+% enable the panel methods for AVX2 and AVX512F, for the PLUS monoid on 32-bit
+% and 64-bit integers and on float and double, and the MIN and MAX monoids on
+% float and double.  The MIN and MAX monoids on integers are terminal, and
+% their panel method does not benefit from wider vectors.
+is_fp = any (strcmp (atype, {'float', 'double'})) ;
+is_int = any (strcmp (atype, {'int32_t', 'int64_t', 'uint32_t', 'uint64_t'})) ;
+has_avx = (isequal (opname, 'plus') && (is_fp || is_int)) || ...
+    (any (strcmp (opname, {'min', 'max'})) && is_fp) ;
+if (has_avx)
+    fprintf (f, 'm4_define(`if_red_has_avx'', `0'')\n') ;
+    fprintf (f, 'm4_define(`GB_red_has_avx'', `#define GB_RED_HAS_AVX_IMPLEMENTATION 1'')\n') ;
+else
+    fprintf (f, 'm4_define(`if_red_has_avx'', `-1'')\n') ;
+    fprintf (f, 'm4_define(`GB_red_has_avx'', `#define GB_RED_HAS_AVX_IMPLEMENTATION 0'')\n') ;
+end
+
 % create the update operator
 update_op = op {1} ;
 update_op = strrep (update_op, 'zarg', 'z') ;
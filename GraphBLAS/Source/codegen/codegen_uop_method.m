@@ -31,6 +31,20 @@ else
     fprintf (f, 'm4_define(`if_uop_apply_enabled'', `0'')\n') ;
 end
 
+% enable the AVX2 and AVX512F variants of the apply method, for the operators
+% with no typecast that the wider ISAs vectorize: abs, ainv, and minv on float
+% and double, and abs and ainv on 32-bit and 64-bit signed integers.
+xtype_is_fp = any (strcmp (xtype, {'float', 'double'})) ;
+xtype_is_int = any (strcmp (xtype, {'int32_t', 'int64_t'})) ;
+has_avx = no_typecast && ...
+    ((xtype_is_fp && any (strcmp (uop, {'abs', 'ainv', 'minv'}))) || ...
+    (xtype_is_int && any (strcmp (uop, {'abs', 'ainv'})))) ;
+if (has_avx)
+    fprintf (f, 'm4_define(`if_uop_has_avx'', `0'')\n') ;
+else
+    fprintf (f, 'm4_define(`if_uop_has_avx'', `-1'')\n') ;
+end
+
 if (is_identity)
     % identity ops are never disabled
     fprintf (f, 'm4_define(`GB_type_enabled'', `#define GB_TYPE_ENABLED 1'')\n');
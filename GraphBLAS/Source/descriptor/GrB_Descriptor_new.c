@@ -58,6 +58,7 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->row_list = GxB_DEFAULT ; // use List->x of row index vector
     desc->col_list = GxB_DEFAULT ; // use List->x of col index vector
     desc->val_list = GxB_DEFAULT ; // use List->x of value vector
+    desc->build_sorted = false ;   // check if GrB_build tuples are sorted
     return (GrB_SUCCESS) ;
 }
 
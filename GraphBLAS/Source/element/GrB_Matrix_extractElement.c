@@ -15,7 +15,7 @@
 // GrB_NO_VALUE is returned; if x is a GrB_scalar, x is returned as empty,
 // and GrB_SUCCESS is returned.
 
-#include "GB.h"
+#include "pending/GB_Pending.h"
 
 #define GB_FREE_ALL ;
 
@@ -17,6 +17,10 @@
 // 13 built-in types, and the _UDT method for all user-defined types.
 // It also constructs GxB_Matrix_isStoredElement.
 
+// If A has pending tuples, A(row,col) is found in both A and its pending
+// tuples, without assembling them, unless there are more than
+// GxB_PENDING_THRESHOLD of them (see GB_Pending_lookup).
+
 // FUTURE: tolerate zombies
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
@@ -40,12 +44,11 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
-    // TODO: do not wait unless jumbled.  First try to find the element.
-    // If found (live or zombie), no need to wait.  If not found and pending
-    // tuples exist, wait and then extractElement again.
-
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
+    // delete any lingering zombies, and unjumble.  Pending tuples are
+    // assembled only if there are too many of them; otherwise A(i,j) is
+    // found in A and its pending tuples, without waiting.
+    if (A->nzombies > 0 || A->jumbled ||
+        GB_Pending_n (A) > GB_Global_pending_threshold_get ( ))
     { 
         GB_WHERE_1 (A, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Matrix_extractElement") ;
@@ -53,7 +56,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
 
     // look for index i in vector j
     int64_t i, j ;
@@ -77,6 +81,35 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // look for A(i,j) in the pending tuples
+    //--------------------------------------------------------------------------
+
+    // GB_wait would give A(i,j) the value of its pending tuples, so if it
+    // appears there, A itself need not be searched.
+
+    if (A->Pending != NULL)
+    {
+        bool found ;
+        size_t asize = A->type->size ;
+        GB_void ax [GB_VLA(asize)] ;
+        GB_OK (GB_Pending_lookup (ax, &found, A, i, j)) ;
+        if (found)
+        { 
+            #ifdef GB_XTYPE
+            GB_Type_code acode = A->type->code ;
+            if (!GB_code_compatible (GB_XCODE, acode))
+            { 
+                // x (GB_XCODE) and A (acode) must be compatible
+                return (GrB_DOMAIN_MISMATCH) ;
+            }
+            GB_cast_scalar (x, GB_XCODE, ax, acode, asize) ;
+            #pragma omp flush
+            #endif
+            return (GrB_SUCCESS) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // find the entry A(i,j)
     //--------------------------------------------------------------------------
@@ -17,6 +17,10 @@
 // 13 built-in types, and the _UDT method for all user-defined types.
 // It also constructs GxB_Vector_isStoredElement.
 
+// If V has pending tuples, V(i) is found in both V and its pending tuples,
+// without assembling them, unless there are more than GxB_PENDING_THRESHOLD
+// of them (see GB_Pending_lookup).
+
 // FUTURE: tolerate zombies
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
@@ -39,8 +43,11 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (V))
+    // delete any lingering zombies, and unjumble.  Pending tuples are
+    // assembled only if there are too many of them; otherwise V(i) is found
+    // in V and its pending tuples, without waiting.
+    if (V->nzombies > 0 || V->jumbled ||
+        GB_Pending_n ((GrB_Matrix) V) > GB_Global_pending_threshold_get ( ))
     { 
         GB_WHERE_1 (V, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Vector_extractElement") ;
@@ -48,7 +55,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (V)) ;
+    ASSERT (!GB_ZOMBIES (V)) ;
+    ASSERT (!GB_JUMBLED (V)) ;
 
     // check index
     if (i >= V->vlen)
@@ -56,6 +64,32 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         return (GrB_INVALID_INDEX) ;
     }
 
+    //--------------------------------------------------------------------------
+    // look for V(i) in the pending tuples
+    //--------------------------------------------------------------------------
+
+    if (V->Pending != NULL)
+    {
+        bool found ;
+        size_t vsize = V->type->size ;
+        GB_void vx [GB_VLA(vsize)] ;
+        GB_OK (GB_Pending_lookup (vx, &found, (GrB_Matrix) V, i, 0)) ;
+        if (found)
+        { 
+            #ifdef GB_XTYPE
+            GB_Type_code vcode = V->type->code ;
+            if (!GB_code_compatible (GB_XCODE, vcode))
+            { 
+                // x (GB_XCODE) and V (vcode) must be compatible
+                return (GrB_DOMAIN_MISMATCH) ;
+            }
+            GB_cast_scalar (x, GB_XCODE, vx, vcode, vsize) ;
+            #pragma omp flush
+            #endif
+            return (GrB_SUCCESS) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // find the entry V(i)
     //--------------------------------------------------------------------------
@@ -69,6 +69,12 @@ static GrB_Info GB_desc_get
                 GrB_DEFAULT : desc->compression) ;
             break ;
 
+        case GxB_BUILD_SORTED : 
+
+            (*value) = (int32_t) ((desc == NULL) ?
+                GrB_DEFAULT : desc->build_sorted) ;
+            break ;
+
         case GxB_IMPORT : 
 
             (*value) = (int32_t) ((desc == NULL) ? GrB_DEFAULT : desc->import) ;
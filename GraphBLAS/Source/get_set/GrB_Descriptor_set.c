@@ -119,6 +119,11 @@ static GrB_Info GB_desc_set
             desc->compression = value ;
             break ;
 
+        case GxB_BUILD_SORTED : 
+
+            desc->build_sorted = (value != 0) ;
+            break ;
+
         case GxB_IMPORT : 
 
             // In case the user application does not check the return value
@@ -151,6 +151,16 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_AxB_TUNING : 
+
+            (*value) = (int) GB_Global_AxB_tuning_get ( ) ;
+            break ;
+
+        case GxB_AxB_LAST_METHOD : 
+
+            (*value) = (int) GB_Global_AxB_last_method_get ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -226,6 +236,55 @@ GrB_Info GrB_Global_get_Scalar
                         GB_INT64_code, Werk) ;
                     break ;
 
+                case GxB_PENDING_THRESHOLD : 
+
+                    i64 = GB_Global_pending_threshold_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_AxB_DOT_RATIO : 
+
+                    x = GB_Global_AxB_dot_ratio_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &x, 0, 0,
+                        GB_FP64_code, Werk) ;
+                    break ;
+
+                case GxB_AxB_LAST_COST : 
+
+                    x = GB_Global_AxB_last_cost_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &x, 0, 0,
+                        GB_FP64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_LIMIT : 
+
+                    i64 = GB_Global_pool_limit_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_BYTES : 
+
+                    GB_pool_stats (NULL, &i64, NULL, NULL) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_HITS : 
+
+                    GB_pool_stats (NULL, NULL, &i64, NULL) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_MISSES : 
+
+                    GB_pool_stats (NULL, NULL, NULL, &i64) ;
+                    info = GB_setElement ((GrB_Matrix) scalar, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
                 default : 
 
                     info = GrB_INVALID_VALUE ;
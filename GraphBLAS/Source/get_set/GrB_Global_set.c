@@ -9,6 +9,7 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_mxm.h"
 
 //------------------------------------------------------------------------------
 // GB_global_enum_set: get an enum value from the global state
@@ -117,6 +118,15 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_control (value) ;
             break ;
 
+        case GxB_AxB_TUNING : 
+
+            if (value < GxB_AxB_TUNING_OFF || value > GxB_AxB_TUNING_TRAIN)
+            { 
+                return (GrB_INVALID_VALUE) ;
+            }
+            GB_Global_AxB_tuning_set (value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -185,6 +195,42 @@ GrB_Info GrB_Global_set_Scalar
                 }
                 break ;
 
+            case GxB_PENDING_THRESHOLD : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, scalar) ;
+                if (info == GrB_SUCCESS)
+                {
+                    GB_Global_pending_threshold_set (i64value) ;
+                }
+                break ;
+
+            case GxB_AxB_DOT_RATIO : 
+
+                info = GrB_Scalar_extractElement_FP64 (&dvalue, scalar) ;
+                if (info == GrB_SUCCESS)
+                {
+                    if (dvalue > 0 && isfinite (dvalue))
+                    { 
+                        GB_Global_AxB_dot_ratio_set (dvalue) ;
+                    }
+                    else
+                    { 
+                        info = GrB_INVALID_VALUE ;
+                    }
+                }
+                break ;
+
+            case GxB_MEMORY_POOL_LIMIT : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, scalar) ;
+                if (info == GrB_SUCCESS)
+                {
+                    // free all blocks in the pool and clear its statistics
+                    GB_pool_flush ( ) ;
+                    GB_Global_pool_limit_set (GB_IMAX (i64value, 0)) ;
+                }
+                break ;
+
             default : 
 
                 info = GrB_Scalar_extractElement_INT32 (&ivalue, scalar) ;
@@ -274,6 +320,26 @@ GrB_Info GrB_Global_set_String
                 info = GB_jitifyer_set_cache_path (value) ;
                 break ;
 
+            case GxB_JIT_ARCHIVE_EXPORT : 
+
+                info = GB_jitifyer_archive_export (value) ;
+                break ;
+
+            case GxB_JIT_ARCHIVE_IMPORT : 
+
+                info = GB_jitifyer_archive_import (value) ;
+                break ;
+
+            case GxB_AxB_PROFILE_SAVE : 
+
+                info = GB_AxB_profile_save (value) ;
+                break ;
+
+            case GxB_AxB_PROFILE_LOAD : 
+
+                info = GB_AxB_profile_load (value) ;
+                break ;
+
             default : 
 
                 info = GrB_INVALID_VALUE ;
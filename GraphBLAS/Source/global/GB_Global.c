@@ -40,6 +40,20 @@ typedef struct
     float hyper_switch ;        // default hyper_switch for new matrices
     bool is_csc ;               // default CSR/CSC format for new matrices
     int64_t hyper_hash ;        // controls when A->Y hyper_hash is created
+    int64_t pending_threshold ; // max # of pending tuples for extractElement
+    int64_t pool_limit ;        // max # of bytes in the CPU memory pool
+    int64_t pool_bytes ;        // # of bytes in the CPU memory pool
+
+    //--------------------------------------------------------------------------
+    // method selection for C<M>=A*B (see GB_AxB_cost_model.c)
+    //--------------------------------------------------------------------------
+
+    int AxB_tuning ;            // GxB_AxB_TUNING_OFF, _ON, or _TRAIN
+    double AxB_dot_ratio ;      // cost of dot3 work relative to saxpy3 work
+    int64_t AxB_nsamples ;      // # of timings that determined AxB_dot_ratio
+    int AxB_last_method ;       // method used by the last C=A*B
+    double AxB_last_dot_cost ;  // predicted cost of dot3 for the last C=A*B
+    double AxB_last_saxpy_cost ;    // and of saxpy3
 
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
@@ -133,6 +147,7 @@ typedef struct
 
     bool cpu_features_avx2 ;        // x86_64 with AVX2
     bool cpu_features_avx512f ;     // x86_64 with AVX512f
+    int cpu_isa ;                   // ISA variant of the FactoryKernels
 
     //--------------------------------------------------------------------------
     // integer control
@@ -187,6 +202,17 @@ static GB_Global_struct GB_Global =
     .is_csc = false,    // default is GxB_BY_ROW
 
     .hyper_hash = GB_HYPER_HASH_DEFAULT,
+    .pending_threshold = GB_PENDING_THRESHOLD_DEFAULT,
+    .pool_limit = 0,    // the CPU memory pool is disabled by default
+    .pool_bytes = 0,
+
+    // method selection for C<M>=A*B: fixed heuristics by default
+    .AxB_tuning = GxB_AxB_TUNING_OFF,
+    .AxB_dot_ratio = 1,
+    .AxB_nsamples = 0,
+    .AxB_last_method = GxB_DEFAULT,
+    .AxB_last_dot_cost = 0,
+    .AxB_last_saxpy_cost = 0,
 
     // abort function for debugging only
     .abort_function   = abort,
@@ -226,6 +252,7 @@ static GB_Global_struct GB_Global =
     // CPU features
     .cpu_features_avx2 = false,         // x86_64 with AVX2
     .cpu_features_avx512f = false,      // x86_64 with AVX512f
+    .cpu_isa = GB_CPU_ISA_BASELINE,     // ISA variant of the FactoryKernels
 
     // integer control
     .p_control = (int8_t) 32,
@@ -307,6 +334,29 @@ int8_t GB_Global_i_control_get (void)
 // cpu features
 //------------------------------------------------------------------------------
 
+// Some FactoryKernels are compiled for more than one ISA (see
+// Source/mxm/factory/GB_AxB_isa_template.c).  The widest ISA that both the
+// compiler and the CPU support is chosen once, by GB_Global_cpu_features_query,
+// and the kernels then use GB_Global_cpu_isa_get to select their variant.
+// GB_Global_cpu_isa_set is only used for testing, to select a narrower ISA.
+
+static int GB_Global_cpu_isa_max (void)
+{
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global.cpu_features_avx512f)
+    { 
+        return (GB_CPU_ISA_AVX512F) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global.cpu_features_avx2)
+    { 
+        return (GB_CPU_ISA_AVX2) ;
+    }
+    #endif
+    return (GB_CPU_ISA_BASELINE) ;
+}
+
 // GB_Global_cpu_features_query is used just once, by GrB_init or GxB_init,
 // to determine at run-time whether or not AVX2 and/or AVX512F is available.
 // Once these two flags are set, they are saved in the GB_Global struct, and
@@ -369,6 +419,12 @@ void GB_Global_cpu_features_query (void)
 
     }
     #endif
+
+    //--------------------------------------------------------------------------
+    // choose the ISA variant of the FactoryKernels
+    //--------------------------------------------------------------------------
+
+    GB_Global.cpu_isa = GB_Global_cpu_isa_max ( ) ;
 }
 
 bool GB_Global_cpu_features_avx2 (void)
@@ -381,6 +437,18 @@ bool GB_Global_cpu_features_avx512f (void)
     return (GB_Global.cpu_features_avx512f) ;
 }
 
+void GB_Global_cpu_isa_set (int cpu_isa)
+{ 
+    // never select an ISA that the compiler or the CPU does not support
+    GB_Global.cpu_isa = GB_IMAX (GB_CPU_ISA_BASELINE,
+        GB_IMIN (cpu_isa, GB_Global_cpu_isa_max ( ))) ;
+}
+
+int GB_Global_cpu_isa_get (void)
+{ 
+    return (GB_Global.cpu_isa) ;
+}
+
 //------------------------------------------------------------------------------
 // hyper_switch
 //------------------------------------------------------------------------------
@@ -409,6 +477,149 @@ int64_t GB_Global_hyper_hash_get (void)
     return (GB_Global.hyper_hash) ;
 }
 
+//------------------------------------------------------------------------------
+// pending_threshold
+//------------------------------------------------------------------------------
+
+void GB_Global_pending_threshold_set (int64_t pending_threshold)
+{ 
+    GB_Global.pending_threshold = pending_threshold ;
+}
+
+int64_t GB_Global_pending_threshold_get (void)
+{ 
+    return (GB_Global.pending_threshold) ;
+}
+
+//------------------------------------------------------------------------------
+// pool_limit and pool_bytes: for the CPU memory pool (see GB_pool.c)
+//------------------------------------------------------------------------------
+
+void GB_Global_pool_limit_set (int64_t pool_limit)
+{ 
+    GB_Global.pool_limit = pool_limit ;
+}
+
+int64_t GB_Global_pool_limit_get (void)
+{ 
+    return (GB_Global.pool_limit) ;
+}
+
+void GB_Global_pool_bytes_update (int64_t delta)
+{ 
+    GB_ATOMIC_UPDATE
+    GB_Global.pool_bytes += delta ;
+}
+
+int64_t GB_Global_pool_bytes_get (void)
+{ 
+    int64_t pool_bytes ;
+    GB_ATOMIC_READ
+    pool_bytes = GB_Global.pool_bytes ;
+    return (pool_bytes) ;
+}
+
+//------------------------------------------------------------------------------
+// AxB_*: method selection for C<M>=A*B
+//------------------------------------------------------------------------------
+
+void GB_Global_AxB_tuning_set (int tuning)
+{ 
+    GB_Global.AxB_tuning = tuning ;
+}
+
+int GB_Global_AxB_tuning_get (void)
+{ 
+    return (GB_Global.AxB_tuning) ;
+}
+
+// The dot_ratio and nsamples are updated by GB_AxB_autotune, and the last
+// method by GB_AxB_meta, by any number of user threads at the same time.  Each
+// is accessed in the critical section below, so that each update is not lost
+// and the GxB_AxB_LAST_* values are read as a consistent set.
+
+void GB_Global_AxB_dot_ratio_set (double dot_ratio)
+{ 
+    #pragma omp critical (GB_AxB_tuning)
+    GB_Global.AxB_dot_ratio = dot_ratio ;
+}
+
+double GB_Global_AxB_dot_ratio_get (void)
+{ 
+    double dot_ratio ;
+    #pragma omp critical (GB_AxB_tuning)
+    dot_ratio = GB_Global.AxB_dot_ratio ;
+    return (dot_ratio) ;
+}
+
+void GB_Global_AxB_nsamples_set (int64_t nsamples)
+{ 
+    #pragma omp critical (GB_AxB_tuning)
+    GB_Global.AxB_nsamples = nsamples ;
+}
+
+int64_t GB_Global_AxB_nsamples_get (void)
+{ 
+    int64_t nsamples ;
+    #pragma omp critical (GB_AxB_tuning)
+    nsamples = GB_Global.AxB_nsamples ;
+    return (nsamples) ;
+}
+
+double GB_Global_AxB_dot_ratio_update   // add a sample to the dot_ratio
+(
+    double r,                   // dot_ratio that predicts a single timing
+    int64_t max_weight          // max # of prior samples to give weight to
+)
+{ 
+    // dot_ratio becomes the weighted geometric mean of itself and r
+    double dot_ratio ;
+    #pragma omp critical (GB_AxB_tuning)
+    {
+        int64_t nsamples = GB_Global.AxB_nsamples ;
+        double w = (double) GB_IMIN (nsamples, max_weight) ;
+        dot_ratio = exp ((w * log (GB_Global.AxB_dot_ratio) + log (r))
+            / (w + 1)) ;
+        GB_Global.AxB_dot_ratio = dot_ratio ;
+        GB_Global.AxB_nsamples = nsamples + 1 ;
+    }
+    return (dot_ratio) ;
+}
+
+void GB_Global_AxB_last_set (int method, double dot_cost, double saxpy_cost)
+{ 
+    #pragma omp critical (GB_AxB_tuning)
+    {
+        GB_Global.AxB_last_method = method ;
+        GB_Global.AxB_last_dot_cost = dot_cost ;
+        GB_Global.AxB_last_saxpy_cost = saxpy_cost ;
+    }
+}
+
+int GB_Global_AxB_last_method_get (void)
+{ 
+    int method ;
+    #pragma omp critical (GB_AxB_tuning)
+    method = GB_Global.AxB_last_method ;
+    return (method) ;
+}
+
+double GB_Global_AxB_last_cost_get (void)
+{ 
+    // predicted cost of the method used, or zero if the model was not used
+    double cost ;
+    #pragma omp critical (GB_AxB_tuning)
+    {
+        switch (GB_Global.AxB_last_method)
+        {
+            case GxB_AxB_DOT   : cost = GB_Global.AxB_last_dot_cost ; break ;
+            case GxB_AxB_SAXPY : cost = GB_Global.AxB_last_saxpy_cost ; break ;
+            default            : cost = 0 ; break ;
+        }
+    }
+    return (cost) ;
+}
+
 //------------------------------------------------------------------------------
 // bitmap_switch
 //------------------------------------------------------------------------------
@@ -18,6 +18,13 @@ void     GB_Global_cpu_features_query (void) ;
 bool     GB_Global_cpu_features_avx2 (void) ;
 bool     GB_Global_cpu_features_avx512f (void) ;
 
+// ISA variants of the FactoryKernels
+#define GB_CPU_ISA_BASELINE 0
+#define GB_CPU_ISA_AVX2     1
+#define GB_CPU_ISA_AVX512F  2
+void     GB_Global_cpu_isa_set (int cpu_isa) ;
+int      GB_Global_cpu_isa_get (void) ;
+
 void     GB_Global_mode_set (int mode) ;
 int      GB_Global_mode_get (void) ;
 
@@ -32,6 +39,24 @@ float    GB_Global_hyper_switch_get (void) ;
 
 void     GB_Global_hyper_hash_set (int64_t hyper_hash) ;
 int64_t  GB_Global_hyper_hash_get (void) ;
+void     GB_Global_pending_threshold_set (int64_t pending_threshold) ;
+int64_t  GB_Global_pending_threshold_get (void) ;
+void     GB_Global_pool_limit_set (int64_t pool_limit) ;
+int64_t  GB_Global_pool_limit_get (void) ;
+void     GB_Global_pool_bytes_update (int64_t delta) ;
+int64_t  GB_Global_pool_bytes_get (void) ;
+
+void     GB_Global_AxB_tuning_set (int tuning) ;
+int      GB_Global_AxB_tuning_get (void) ;
+void     GB_Global_AxB_dot_ratio_set (double dot_ratio) ;
+double   GB_Global_AxB_dot_ratio_get (void) ;
+void     GB_Global_AxB_nsamples_set (int64_t nsamples) ;
+int64_t  GB_Global_AxB_nsamples_get (void) ;
+double   GB_Global_AxB_dot_ratio_update (double r, int64_t max_weight) ;
+void     GB_Global_AxB_last_set (int method, double dot_cost,
+            double saxpy_cost) ;
+int      GB_Global_AxB_last_method_get (void) ;
+double   GB_Global_AxB_last_cost_get (void) ;
 
 void     GB_Global_bitmap_switch_set (int k, float b) ;
 float    GB_Global_bitmap_switch_get (int k) ;
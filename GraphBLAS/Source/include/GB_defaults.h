@@ -26,5 +26,8 @@
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
+// GrB_*_extractElement searches up to this many pending tuples before waiting
+#define GB_PENDING_THRESHOLD_DEFAULT (64*1024)
+
 #endif
 
@@ -38,6 +38,7 @@
 #include "GB.h"
 #include "init/GB_init.h"
 #include "jitifyer/GB_stringify.h"
+#include "mxm/GB_mxm.h"
 
 //------------------------------------------------------------------------------
 // GB_init
@@ -173,6 +174,23 @@ GrB_Info GB_init            // start up GraphBLAS
     GB_Global_bitmap_switch_default ( ) ;
     GB_Global_is_csc_set (false) ;
 
+    //--------------------------------------------------------------------------
+    // method selection for C<M>=A*B
+    //--------------------------------------------------------------------------
+
+    // use the fixed heuristics by default, and load the parameters of the
+    // cost model from the GRAPHBLAS_AXB_PROFILE file, if it exists and is
+    // valid (it is silently ignored otherwise)
+
+    GB_Global_AxB_tuning_set (GxB_AxB_TUNING_OFF) ;
+    GB_Global_AxB_dot_ratio_set (1) ;
+    GB_Global_AxB_nsamples_set (0) ;
+    char *profile = getenv ("GRAPHBLAS_AXB_PROFILE") ;
+    if (profile != NULL)
+    { 
+        GB_AxB_profile_load (profile) ;
+    }
+
     //--------------------------------------------------------------------------
     // diagnostic output
     //--------------------------------------------------------------------------
@@ -14,10 +14,19 @@
 
 #include "GB.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_mxm.h"
 
 GrB_Info GrB_finalize ( )
 { 
+    // save the tuned cost model for C<M>=A*B, if requested
+    char *profile = getenv ("GRAPHBLAS_AXB_PROFILE") ;
+    if (profile != NULL &&
+        GB_Global_AxB_tuning_get ( ) == GxB_AxB_TUNING_TRAIN)
+    { 
+        GB_AxB_profile_save (profile) ;
+    }
     GB_jitifyer_finalize ( ) ;
+    GB_pool_flush ( ) ;
     return (GrB_SUCCESS) ;
 }
 
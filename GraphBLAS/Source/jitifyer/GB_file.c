@@ -19,6 +19,11 @@
 // https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/lock-file
 // https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/unlock-file
 
+// dladdr is a GNU extension on Linux
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "GB.h"
 #include "jitifyer/GB_file.h"
 
@@ -372,3 +377,51 @@ void GB_file_dlclose (void *dl_handle)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_file_dlpath: get the path of the dynamic library holding a function
+//------------------------------------------------------------------------------
+
+// Returns true if successful, false on error
+
+bool GB_file_dlpath             // true if successful, false on error
+(
+    // input
+    void *dl_function,          // any function in a dynamic library
+    // output
+    char *path,                 // full path to the library
+    size_t path_len             // size of the path array
+)
+{ 
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // find the Windows dll holding the function
+        HMODULE hdll = NULL ;
+        if (!GetModuleHandleExA (GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+            GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+            (LPCSTR) dl_function, &hdll))
+        {
+            return (false) ;
+        }
+        DWORD len = GetModuleFileNameA (hdll, path, (DWORD) path_len) ;
+        return (len > 0 && len < path_len) ;
+    }
+    #else
+    {
+        // find the POSIX dynamic library holding the function
+        Dl_info dl_info ;
+        if (dladdr (dl_function, &dl_info) == 0 || dl_info.dli_fname == NULL
+            || strlen (dl_info.dli_fname) >= path_len)
+        {
+            return (false) ;
+        }
+        strncpy (path, dl_info.dli_fname, path_len) ;
+        return (true) ;
+    }
+    #endif
+}
+
@@ -47,5 +47,14 @@ void *GB_file_dlsym (void *dl_handle, char *symbol) ;
 
 void GB_file_dlclose (void *dl_handle) ;
 
+bool GB_file_dlpath             // true if successful, false on error
+(
+    // input
+    void *dl_function,          // any function in a dynamic library
+    // output
+    char *path,                 // full path to the library
+    size_t path_len             // size of the path array
+) ;
+
 #endif
 
@@ -614,7 +614,18 @@ GrB_Info GB_jitifyer_init (void)
     // uncompress all the source files into the user source folder
     //--------------------------------------------------------------------------
 
-    return (GB_jitifyer_extract_JITpackage (GrB_SUCCESS)) ;
+    OK (GB_jitifyer_extract_JITpackage (GrB_SUCCESS)) ;
+
+    //--------------------------------------------------------------------------
+    // install the JIT kernels from GRAPHBLAS_JIT_ARCHIVE, if present
+    //--------------------------------------------------------------------------
+
+    char *archive = getenv ("GRAPHBLAS_JIT_ARCHIVE") ;
+    if (archive != NULL)
+    { 
+        return (GB_jitifyer_archive_import_worker (archive, GrB_SUCCESS)) ;
+    }
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -837,6 +848,454 @@ GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition)
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// JIT kernel archive
+//------------------------------------------------------------------------------
+
+// A JIT kernel archive is a single file that holds the compiled libraries of a
+// set of JIT kernels, so that they can be installed into the cache folder of
+// another process without compiling them.  The archive is relocatable: it
+// holds only the file name of each library, not its full path.  It can only
+// be used by the same version of GraphBLAS, on the same platform.  The archive
+// has the following layout:
+//
+//      header:     GB_jit_archive_header
+//      index:      GB_jit_archive_entry [nkernels]
+//      payload:    the file name and contents of each library
+//
+// Each entry in the index is keyed by the hash of its kernel, the same hash
+// used for the JIT hash table (computed by GB_encodify_*).  The index also
+// holds the location, size, and hash of each library, so that a corrupted
+// archive is detected before its libraries are written into the cache.  The
+// header and index entries are defined in GB_jitifyer.h.
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_export: write all loaded JIT kernels to an archive
+//------------------------------------------------------------------------------
+
+// This method is only used by GrB_set.  It returns GrB_SUCCESS if successful,
+// GrB_OUT_OF_MEMORY if out of memory, GrB_NULL_POINTER if the filename is
+// NULL, or GrB_INVALID_VALUE if any file I/O error occurs.  PreJIT kernels are
+// not exported, since they are already compiled into GraphBLAS itself.
+
+GrB_Info GB_jitifyer_archive_export (const char *filename)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (filename == NULL)
+    { 
+        return (GrB_NULL_POINTER) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // export the archive in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_archive_export_worker (filename) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_export_worker: export an archive in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_archive_export_worker (const char *filename)
+{
+
+    //--------------------------------------------------------------------------
+    // count the JIT kernels in the hash table
+    //--------------------------------------------------------------------------
+
+    int32_t nkernels = 0 ;
+    for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+    {
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->dl_function != NULL && e->dl_handle != NULL)
+        { 
+            nkernels++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the index and open the archive
+    //--------------------------------------------------------------------------
+
+    GB_jit_archive_entry *Index = NULL ;
+    GB_MALLOC_PERSISTENT (Index,
+        (nkernels + 1) * sizeof (GB_jit_archive_entry)) ;
+    if (Index == NULL)
+    { 
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    FILE *fp = fopen (filename, "wb") ;
+    if (fp == NULL)
+    { 
+        GB_FREE_PERSISTENT (Index) ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the payload of each kernel, after space for the header and index
+    //--------------------------------------------------------------------------
+
+    uint64_t offset = sizeof (GB_jit_archive_header)
+        + nkernels * sizeof (GB_jit_archive_entry) ;
+    bool ok = (fseek (fp, (long) offset, SEEK_SET) == 0) ;
+    uint8_t *lib = NULL ;
+    size_t lib_allocated = 0 ;
+    int32_t kernel = 0 ;
+
+    for (int64_t k = 0 ; ok && k < GB_jit_table_size ; k++)
+    {
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->dl_function == NULL || e->dl_handle == NULL)
+        { 
+            // empty entry, or a PreJIT kernel
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // read the library of this kernel
+        //----------------------------------------------------------------------
+
+        ok = GB_file_dlpath (e->dl_function, GB_jit_temp,
+            GB_jit_temp_allocated) ;
+        FILE *fp_lib = ok ? fopen (GB_jit_temp, "rb") : NULL ;
+        ok = (fp_lib != NULL) ;
+        long lib_size = -1 ;
+        if (ok)
+        { 
+            ok = (fseek (fp_lib, 0, SEEK_END) == 0) ;
+            lib_size = ftell (fp_lib) ;
+            ok = ok && (lib_size > 0) && (fseek (fp_lib, 0, SEEK_SET) == 0) ;
+        }
+        if (ok && (size_t) lib_size > lib_allocated)
+        { 
+            GB_FREE_PERSISTENT (lib) ;
+            lib_allocated = 0 ;
+            GB_MALLOC_PERSISTENT (lib, lib_size) ;
+            ok = (lib != NULL) ;
+            if (ok) lib_allocated = lib_size ;
+        }
+        ok = ok && (fread (lib, 1, lib_size, fp_lib) == (size_t) lib_size) ;
+        if (fp_lib != NULL) fclose (fp_lib) ;
+
+        //----------------------------------------------------------------------
+        // append the library file name and contents to the archive
+        //----------------------------------------------------------------------
+
+        if (ok)
+        { 
+            // discard the path, to make the archive relocatable
+            char *name = GB_jit_temp ;
+            for (char *p = GB_jit_temp ; *p != '\0' ; p++)
+            {
+                if (*p == '/' || *p == '\\') name = p + 1 ;
+            }
+            size_t name_len = strlen (name) ;
+            GB_jit_archive_entry *x = &(Index [kernel++]) ;
+            x->hash = e->hash ;
+            x->code = e->encoding.code ;
+            x->kcode = e->encoding.kcode ;
+            x->name_len = (uint32_t) name_len ;
+            x->name_offset = offset ;
+            x->lib_offset = offset + name_len ;
+            x->lib_size = (uint64_t) lib_size ;
+            x->lib_hash = GB_jitifyer_hash (lib, lib_size, true) ;
+            offset += name_len + lib_size ;
+            ok = (fwrite (name, 1, name_len, fp) == name_len) &&
+                 (fwrite (lib, 1, lib_size, fp) == (size_t) lib_size) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and index
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    { 
+        GB_jit_archive_header header ;
+        memset (&header, 0, sizeof (GB_jit_archive_header)) ;
+        memcpy (header.magic, GB_JIT_ARCHIVE_MAGIC, 8) ;
+        header.version [0] = GxB_IMPLEMENTATION_MAJOR ;
+        header.version [1] = GxB_IMPLEMENTATION_MINOR ;
+        header.version [2] = GxB_IMPLEMENTATION_SUB ;
+        header.nkernels = nkernels ;
+        ok = (fseek (fp, 0, SEEK_SET) == 0) &&
+            (fwrite (&header, sizeof (GB_jit_archive_header), 1, fp) == 1) &&
+            (fwrite (Index, sizeof (GB_jit_archive_entry), nkernels, fp)
+                == (size_t) nkernels) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and close the archive
+    //--------------------------------------------------------------------------
+
+    ok = (fclose (fp) == 0) && ok ;
+    GB_FREE_PERSISTENT (lib) ;
+    GB_FREE_PERSISTENT (Index) ;
+    if (!ok)
+    { 
+        // remove the partial archive
+        remove (filename) ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    GBURBLE ("(jit archive: %d kernels exported) ", nkernels) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_import: install JIT kernels from an archive
+//------------------------------------------------------------------------------
+
+// This method is used by GrB_set, and by GrB_init if the GRAPHBLAS_JIT_ARCHIVE
+// environment variable is set.  Each library in the archive is written into
+// the lib folder of the cache, unless the cache already holds a library for
+// that kernel.  The kernels are not loaded here; each one is loaded from the
+// cache the first time it is needed, and its definitions are checked at that
+// time, just like any other kernel in the cache.  A new process thus starts
+// with a warm cache, and does not need to compile any kernel in the archive.
+
+// Returns GrB_SUCCESS if successful, GrB_OUT_OF_MEMORY if out of memory,
+// GrB_NULL_POINTER if the filename is NULL, or GrB_INVALID_VALUE if the
+// archive is invalid or any file I/O error occurs.
+
+GrB_Info GB_jitifyer_archive_import (const char *filename)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (filename == NULL)
+    { 
+        return (GrB_NULL_POINTER) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // import the archive in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_archive_import_worker (filename, GrB_INVALID_VALUE) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_import_worker: import an archive in a critical section
+//------------------------------------------------------------------------------
+
+// Returns GrB_SUCCESS if successful, GrB_OUT_OF_MEMORY if out of memory, or
+// error_condition if the archive is invalid or cannot be installed in the
+// cache.  GrB_init uses this to return GrB_SUCCESS, since GraphBLAS can
+// continue without the archive.  If the JIT is disabled at compile time, this
+// method does nothing.
+
+GrB_Info GB_jitifyer_archive_import_worker
+(
+    const char *filename,
+    GrB_Info error_condition
+)
+{
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // check if the cache folder is available
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_cache_path == NULL || GB_jit_cache_path [0] == '\0')
+    { 
+        GBURBLE ("(jit archive: no cache path) ") ;
+        return (error_condition) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // open the archive and check its header
+    //--------------------------------------------------------------------------
+
+    FILE *fp = fopen (filename, "rb") ;
+    if (fp == NULL)
+    { 
+        GBURBLE ("(jit archive: not found) ") ;
+        return (error_condition) ;
+    }
+
+    GB_jit_archive_header header ;
+    bool ok = (fseek (fp, 0, SEEK_END) == 0) ;
+    long archive_size = ftell (fp) ;
+    ok = ok && (archive_size > 0) && (fseek (fp, 0, SEEK_SET) == 0) &&
+        (fread (&header, sizeof (GB_jit_archive_header), 1, fp) == 1) &&
+        (memcmp (header.magic, GB_JIT_ARCHIVE_MAGIC, 8) == 0) &&
+        (header.version [0] == GxB_IMPLEMENTATION_MAJOR) &&
+        (header.version [1] == GxB_IMPLEMENTATION_MINOR) &&
+        (header.version [2] == GxB_IMPLEMENTATION_SUB) &&
+        (header.nkernels >= 0) &&
+        ((uint64_t) archive_size >= sizeof (GB_jit_archive_header) +
+            header.nkernels * sizeof (GB_jit_archive_entry)) ;
+    if (!ok)
+    { 
+        // the archive is invalid, or from another version of GraphBLAS
+        fclose (fp) ;
+        GBURBLE ("(jit archive: invalid) ") ;
+        return (error_condition) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the index
+    //--------------------------------------------------------------------------
+
+    int32_t nkernels = header.nkernels ;
+    GB_jit_archive_entry *Index = NULL ;
+    GB_MALLOC_PERSISTENT (Index,
+        (nkernels + 1) * sizeof (GB_jit_archive_entry)) ;
+    if (Index == NULL)
+    { 
+        fclose (fp) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    ok = (fread (Index, sizeof (GB_jit_archive_entry), nkernels, fp)
+        == (size_t) nkernels) ;
+
+    //--------------------------------------------------------------------------
+    // install each library into the cache
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    uint8_t *lib = NULL ;
+    size_t lib_allocated = 0 ;
+    int32_t ninstalled = 0 ;
+
+    for (int32_t k = 0 ; ok && k < nkernels ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // check the index entry and get the library file name
+        //----------------------------------------------------------------------
+
+        GB_jit_archive_entry *x = &(Index [k]) ;
+        char name [GB_KLEN+1] ;
+        uint64_t size = (uint64_t) archive_size ;
+        ok = (x->name_len > 0 && x->name_len < GB_KLEN) &&
+            (x->name_offset <= size && x->name_len <= size - x->name_offset) &&
+            (x->lib_size > 0) &&
+            (x->lib_offset <= size && x->lib_size <= size - x->lib_offset) &&
+            (fseek (fp, (long) x->name_offset, SEEK_SET) == 0) &&
+            (fread (name, 1, x->name_len, fp) == x->name_len) ;
+        if (!ok) break ;
+        name [x->name_len] = '\0' ;
+        for (uint32_t i = 0 ; ok && i < x->name_len ; i++)
+        { 
+            // the library must be a plain file name, with no path
+            char c = name [i] ;
+            ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                 (c >= '0' && c <= '9') || (c == '_') || (c == '.' && i > 0) ;
+        }
+        if (!ok) break ;
+
+        //----------------------------------------------------------------------
+        // lock the kernel
+        //----------------------------------------------------------------------
+
+        uint32_t bucket = x->hash & 0xFF ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket,
+            x->hash) ;
+        FILE *fp_klock = NULL ;
+        int fd_klock = -1 ;
+        ok = GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock) ;
+        if (!ok) break ;
+
+        //----------------------------------------------------------------------
+        // install the library, unless the cache already has it
+        //----------------------------------------------------------------------
+
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s",
+            GB_jit_cache_path, bucket, name) ;
+        FILE *fp_lib = fopen (GB_jit_temp, "rb") ;
+        if (fp_lib != NULL)
+        { 
+            // the kernel is already in the cache
+            fclose (fp_lib) ;
+        }
+        else
+        {
+            // read the library from the archive and check its hash
+            if (x->lib_size > lib_allocated)
+            { 
+                GB_FREE_PERSISTENT (lib) ;
+                lib_allocated = 0 ;
+                GB_MALLOC_PERSISTENT (lib, x->lib_size) ;
+                if (lib == NULL)
+                { 
+                    info = GrB_OUT_OF_MEMORY ;
+                }
+                else
+                { 
+                    lib_allocated = x->lib_size ;
+                }
+            }
+            ok = (info == GrB_SUCCESS) &&
+                (fseek (fp, (long) x->lib_offset, SEEK_SET) == 0) &&
+                (fread (lib, 1, x->lib_size, fp) == x->lib_size) &&
+                (GB_jitifyer_hash (lib, x->lib_size, true) == x->lib_hash) ;
+            if (ok)
+            { 
+                // write the library into the cache
+                fp_lib = fopen (GB_jit_temp, "wb") ;
+                ok = (fp_lib != NULL) &&
+                    (fwrite (lib, 1, x->lib_size, fp_lib) == x->lib_size) ;
+                if (fp_lib != NULL) ok = (fclose (fp_lib) == 0) && ok ;
+                if (!ok)
+                { 
+                    // remove the partial library
+                    remove (GB_jit_temp) ;
+                }
+                if (ok) ninstalled++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // unlock the kernel
+        //----------------------------------------------------------------------
+
+        GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and close the archive
+    //--------------------------------------------------------------------------
+
+    fclose (fp) ;
+    GB_FREE_PERSISTENT (lib) ;
+    GB_FREE_PERSISTENT (Index) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
+    if (!ok)
+    { 
+        GBURBLE ("(jit archive: invalid) ") ;
+        return (error_condition) ;
+    }
+    GBURBLE ("(jit archive: %d of %d kernels installed) ", ninstalled,
+        nkernels) ;
+    #endif
+
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_control: get the JIT control
 //------------------------------------------------------------------------------
@@ -361,6 +361,46 @@ bool GB_jitifyer_path_256 (char *folder) ;
 
 GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition) ;
 
+//------------------------------------------------------------------------------
+// JIT kernel archive
+//------------------------------------------------------------------------------
+
+// An archive is a GB_jit_archive_header, then an index of nkernels
+// GB_jit_archive_entry structs, then the file name and contents of each
+// library.  All offsets are from the start of the archive.
+
+#define GB_JIT_ARCHIVE_MAGIC "GrBJITar"
+
+typedef struct
+{
+    char magic [8] ;        // GB_JIT_ARCHIVE_MAGIC (not null-terminated)
+    int32_t version [3] ;   // GraphBLAS version that created the archive
+    int32_t nkernels ;      // # of kernels in the archive
+}
+GB_jit_archive_header ;
+
+typedef struct
+{
+    uint64_t hash ;         // hash code of the kernel
+    uint64_t code ;         // encoding->code of the kernel
+    uint32_t kcode ;        // encoding->kcode of the kernel
+    uint32_t name_len ;     // length of the library file name
+    uint64_t name_offset ;  // location of the library file name
+    uint64_t lib_offset ;   // location of the library contents
+    uint64_t lib_size ;     // size of the library, in bytes
+    uint64_t lib_hash ;     // hash of the library contents
+}
+GB_jit_archive_entry ;
+
+GrB_Info GB_jitifyer_archive_export (const char *filename) ;
+GrB_Info GB_jitifyer_archive_export_worker (const char *filename) ;
+GrB_Info GB_jitifyer_archive_import (const char *filename) ;
+GrB_Info GB_jitifyer_archive_import_worker
+(
+    const char *filename,
+    GrB_Info error_condition
+) ;
+
 void GB_jitifyer_finalize (void) ;              // finalize the JIT
 void GB_jitifyer_table_free (bool freeall) ;    // free the JIT table
 
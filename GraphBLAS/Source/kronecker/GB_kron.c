@@ -151,9 +151,21 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     //--------------------------------------------------------------------------
 
     GB_CLEAR_MATRIX_HEADER (T, &T_header) ;
-    GB_OK (GB_kroner (T, T_is_csc, op, flipij,
-        A_transpose ? AT : A, A_is_pattern,
-        B_transpose ? BT : B, B_is_pattern, Werk)) ;
+    if (M != NULL && M->is_csc == T_is_csc)
+    { 
+        // T<M> = kron(A,B), computed in tiles, keeping only the entries of
+        // each tile permitted by the mask
+        GB_OK (GB_kron_tiles (T, NULL, NULL, M, Mask_comp, Mask_struct,
+            NULL, NULL, T_is_csc, op, flipij,
+            A_transpose ? AT : A, A_is_pattern,
+            B_transpose ? BT : B, B_is_pattern, Werk)) ;
+    }
+    else
+    { 
+        GB_OK (GB_kroner (T, T_is_csc, op, flipij,
+            A_transpose ? AT : A, A_is_pattern,
+            B_transpose ? BT : B, B_is_pattern, Werk)) ;
+    }
 
     GB_FREE_WORKSPACE ;
     ASSERT_MATRIX_OK (T, "T = kron(A,B)", GB0) ;
@@ -40,5 +40,46 @@ GrB_Info GB_kroner                  // C = kron (A,B)
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_kron_tiles              // T = kron(A,B), one tile at a time
+(
+    // output, if T is not NULL:
+    GrB_Matrix T,                   // output matrix (static header)
+    // or output to a callback, if T is NULL:
+    GxB_kronecker_function tile_function,   // called for each tile of T
+    void *arg,                      // passed to the tile_function
+    // mask and select operator:
+    const GrB_Matrix M,             // optional mask, same format as T
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar Thunk,         // scalar for the select operator
+    // input:
+    const bool T_is_csc,            // format of T, A, and B
+    const GrB_BinaryOp op,          // multiply operator
+    const bool flipij,              // if true, i and j are flipped: z=(x,y,j,i)
+    const GrB_Matrix A,             // input matrix
+    bool A_is_pattern,              // true if values of A are not used
+    const GrB_Matrix B,             // input matrix
+    bool B_is_pattern,              // true if values of B are not used
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_kron_stream             // stream T<M>=kron(A,B) in tiles
+(
+    GxB_kronecker_function tile_function,   // called for each tile of T
+    void *arg,                      // passed to the tile_function
+    const GrB_Matrix M,             // optional mask for T, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp op,          // defines '*' for kron(A,B)
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar Thunk,         // scalar for the select operator
+    GB_Werk Werk
+) ;
+
 #endif
 
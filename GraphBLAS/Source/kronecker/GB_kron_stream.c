@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+// GB_kron_stream: stream T<M>=kron(A,B) to a callback, one tile at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// T<M> = kron(A,B), optionally followed by T = select (T), is computed in
+// tiles by GB_kron_tiles, and each tile is passed to the tile_function.  The
+// input matrices A and B are optionally transposed.  T is held by column if M
+// is held by column, or if M is not present and the default format is by
+// column; otherwise T is held by row.
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_Matrix_free (&AT) ;  \
+    GB_Matrix_free (&BT) ;  \
+}
+
+#include "kronecker/GB_kron.h"
+#include "binaryop/GB_binop.h"
+#include "transpose/GB_transpose.h"
+
+GrB_Info GB_kron_stream             // stream T<M>=kron(A,B) in tiles
+(
+    GxB_kronecker_function tile_function,   // called for each tile of T
+    void *arg,                      // passed to the tile_function
+    const GrB_Matrix M,             // optional mask for T, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp op,          // defines '*' for kron(A,B)
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar Thunk,         // scalar for the select operator
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque AT_header, BT_header ;
+    GrB_Matrix AT = NULL, BT = NULL ;
+
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_kron_stream", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for GB_kron_stream", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_kron_stream", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_kron_stream", GB0) ;
+
+    // T=op(A,B) via op operator, so A and B must be compatible with z=op(a,b)
+    GB_OK (GB_BinaryOp_compatible (op, NULL, A->type, B->type, GB_ignore_code,
+        Werk)) ;
+
+    if (select_op != NULL)
+    {
+        // T = select (T) must be valid
+        GB_RETURN_IF_FAULTY (select_op) ;
+        GB_RETURN_IF_NULL_OR_INVALID (Thunk) ;
+        if (!GB_Type_compatible (op->ztype, select_op->xtype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for C=%s(A,Thunk):\n"
+                "input A type [%s]\n"
+                "cannot be typecast to operator input of type [%s]",
+                select_op->name, op->ztype->name, select_op->xtype->name) ;
+        }
+        if (!GB_Type_compatible (Thunk->type, select_op->ytype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for C=%s(A,Thunk):\n"
+                "input Thunk type [%s] and op thunk type [%s]"
+                " not compatible",
+                select_op->name, Thunk->type->name, select_op->ytype->name) ;
+        }
+        GB_MATRIX_WAIT (Thunk) ;
+        if (GB_nnz ((GrB_Matrix) Thunk) == 0)
+        {
+            // Thunk cannot be empty for GrB_select
+            GB_ERROR (GrB_EMPTY_OBJECT, "Thunk for C=%s(A,Thunk)"
+                " cannot be an empty scalar\n", select_op->name) ;
+        }
+    }
+
+    // delete any lingering zombies and assemble any pending tuples in A and B,
+    // so that tnz = nnz(A) * nnz(B) can be computed.
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    // check the dimensions of T
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    uint64_t tnrows, tncols, tnz = 0 ;
+    bool ok = GB_int64_multiply (&tnrows, anrows,  bnrows) ;
+    ok = ok && GB_int64_multiply (&tncols, ancols,  bncols) ;
+    ok = ok && GB_int64_multiply (&tnz, GB_nnz (A), GB_nnz (B)) ;
+    if (!ok)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH, "Problem too large:\n"
+            "first input is " GBd "-by-" GBd "%s with " GBd " entries\n"
+            "second input is " GBd "-by-" GBd "%s with " GBd " entries",
+            anrows, ancols, A_transpose ? " (transposed)" : "", GB_nnz (A),
+            bnrows, bncols, B_transpose ? " (transposed)" : "", GB_nnz (B)) ;
+    }
+
+    // check the mask
+    GB_OK (GB_Mask_compatible (M, Mask_struct, NULL, tnrows, tncols, Werk)) ;
+
+    // quick return if an empty mask is complemented: T is empty
+    if (M == NULL && Mask_comp)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // transpose A and B if requested
+    //--------------------------------------------------------------------------
+
+    bool T_is_csc = (M != NULL) ? M->is_csc : GB_Global_is_csc_get ( ) ;
+    if (T_is_csc != A->is_csc)
+    {
+        // Negate A_transpose
+        A_transpose = !A_transpose ;
+    }
+    if (T_is_csc != B->is_csc)
+    {
+        // Negate B_transpose
+        B_transpose = !B_transpose ;
+    }
+
+    bool flipij = (!T_is_csc) ;
+
+    bool A_is_pattern, B_is_pattern ;
+    GB_binop_pattern (&A_is_pattern, &B_is_pattern, false, op->opcode) ;
+    if (A_transpose)
+    {
+        // AT = A' and typecast to op->xtype
+        GBURBLE ("(A transpose) ") ;
+        GB_CLEAR_MATRIX_HEADER (AT, &AT_header) ;
+        GB_OK (GB_transpose_cast (AT, op->xtype, T_is_csc, A, A_is_pattern,
+            Werk)) ;
+        ASSERT_MATRIX_OK (AT, "AT kron stream", GB0) ;
+    }
+
+    if (B_transpose)
+    {
+        // BT = B' and typecast to op->ytype
+        GBURBLE ("(B transpose) ") ;
+        GB_CLEAR_MATRIX_HEADER (BT, &BT_header) ;
+        GB_OK (GB_transpose_cast (BT, op->ytype, T_is_csc, B, B_is_pattern,
+            Werk)) ;
+        ASSERT_MATRIX_OK (BT, "BT kron stream", GB0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T<M> = kron(A,B), passing each tile to the tile_function
+    //--------------------------------------------------------------------------
+
+    info = GB_kron_tiles (NULL, tile_function, arg,
+        M, Mask_comp, Mask_struct, select_op, Thunk,
+        T_is_csc, op, flipij,
+        A_transpose ? AT : A, A_is_pattern,
+        B_transpose ? BT : B, B_is_pattern, Werk) ;
+
+    GB_FREE_ALL ;
+    return (info) ;
+}
@@ -0,0 +1,311 @@
+//------------------------------------------------------------------------------
+// GB_kron_tiles: blocked Kronecker product, T = kron(A,B), one tile at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// T = kron(A,B) is computed in tiles.  Each tile is a contiguous range of
+// vectors of T, and is the Kronecker product of a range of vectors of A with
+// all of B:  if T, A, and B are held by column, then
+
+//      T (:, j1*bvdim : j2*bvdim-1) = kron (A (:, j1:j2-1), B)
+
+// and likewise for rows if all are held by row.  Each tile is computed by
+// GB_kroner, which uses the same factory and JIT kernels as GrB_kronecker, in
+// parallel.  The number of tiles is determined by GB_KRON_TILE, the target
+// number of entries in each tile.  It can be changed by
+// GB_Global_hack_set (7, tile) for testing.
+
+// If the mask M is present, it must be held in the same format as T, and
+// only the entries of each tile permitted by the mask are kept.  A tile is not
+// computed at all if its part of M has no entries (and M is not
+// complemented).  If select_op is present, only the entries of each tile that
+// satisfy select_op (T(i,j), i, j, Thunk) are kept.
+
+// If T is not NULL on input, the tiles are concatenated into T.  This is done
+// for GB_kron only if M is present, since otherwise all of T would be held at
+// once anyway.  In that case the mask is applied to each tile, but if T is
+// computed as a single tile, the mask is not applied to T (the caller must
+// still apply the mask to T, which GB_kron does).  select_op must be NULL.
+
+// If T is NULL on input, each tile (with at least one entry) is passed to the
+// tile_function, in order, and then freed.  The entire result T is never held
+// in memory at once.
+
+// T is computed as a single tile if op or select_op depend on the row and
+// column indices of the entries, since the indices of each tile are offset
+// from those of T.
+
+#define GB_FREE_WORKSPACE                                   \
+{                                                           \
+    GB_Matrix_free (&Ak) ;                                  \
+    GB_Matrix_free (&Mk) ;                                  \
+    GB_Matrix_free (&Tk) ;                                  \
+    GB_Matrix_free (&Sk) ;                                  \
+    GB_Matrix_free (&Bwork) ;                               \
+    if (Tiles != NULL)                                      \
+    {                                                       \
+        for (int64_t k = 0 ; k < ntiles ; k++)              \
+        {                                                   \
+            GB_Matrix_free (&(Tiles [k])) ;                 \
+        }                                                   \
+    }                                                       \
+    GB_FREE_MEMORY (&Tiles, Tiles_size) ;                   \
+}
+
+#define GB_FREE_ALL                                         \
+{                                                           \
+    GB_FREE_WORKSPACE ;                                     \
+    if (T != NULL) GB_phybix_free (T) ;                     \
+}
+
+#include "kronecker/GB_kron.h"
+#include "slice/GB_tile.h"
+#include "select/GB_select.h"
+#include "concat/GB_concat.h"
+#include "mask/GB_accum_mask.h"
+#include "slice/include/GB_partition.h"
+
+#define GB_KRON_TILE (256*1024)
+
+//------------------------------------------------------------------------------
+// GB_kron_tiles
+//------------------------------------------------------------------------------
+
+GrB_Info GB_kron_tiles              // T = kron(A,B), one tile at a time
+(
+    // output, if T is not NULL:
+    GrB_Matrix T,                   // output matrix (static header)
+    // or output to a callback, if T is NULL:
+    GxB_kronecker_function tile_function,   // called for each tile of T
+    void *arg,                      // passed to the tile_function
+    // mask and select operator:
+    const GrB_Matrix M,             // optional mask, same format as T
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar Thunk,         // scalar for the select operator
+    // input:
+    const bool T_is_csc,            // format of T, A, and B
+    const GrB_BinaryOp op,          // multiply operator
+    const bool flipij,              // if true, i and j are flipped: z=(x,y,j,i)
+    const GrB_Matrix A,             // input matrix
+    bool A_is_pattern,              // true if values of A are not used
+    const GrB_Matrix B_in,          // input matrix
+    bool B_is_pattern,              // true if values of B are not used
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque Ak_header, Mk_header, Tk_header, Bwork_header ;
+    GrB_Matrix Ak = NULL, Mk = NULL, Tk = NULL, Sk = NULL, Bwork = NULL ;
+    GrB_Matrix *Tiles = NULL ;
+    size_t Tiles_size = 0 ;
+    int64_t ntiles = 0 ;
+
+    ASSERT ((T == NULL) != (tile_function == NULL)) ;
+    ASSERT (T == NULL || select_op == NULL) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_kron_tiles", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for GB_kron_tiles", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_kron_tiles", GB0) ;
+    ASSERT_MATRIX_OK (B_in, "B for GB_kron_tiles", GB0) ;
+    ASSERT (A->is_csc == T_is_csc && B_in->is_csc == T_is_csc) ;
+    ASSERT (M == NULL || M->is_csc == T_is_csc) ;
+
+    GB_MATRIX_WAIT (M) ;
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B_in) ;
+
+    const int64_t avdim = A->vdim ;
+    const int64_t bvdim = B_in->vdim ;
+    const int64_t tvlen = A->vlen * B_in->vlen ;
+    const int64_t tvdim = avdim * bvdim ;
+    GrB_Type ttype = op->ztype ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of tiles
+    //--------------------------------------------------------------------------
+
+    bool tiled = !GB_OP_IS_POSITIONAL (op) && (T == NULL || M != NULL) ;
+    if (select_op != NULL && !(select_op->opcode >= GB_VALUENE_idxunop_code &&
+                               select_op->opcode <= GB_VALUELE_idxunop_code))
+    {
+        // the select operator depends on the row and column indices of T
+        tiled = false ;
+    }
+
+    if (tiled)
+    {
+        double work = ((double) GB_nnz (A)) * ((double) GB_nnz (B_in)) ;
+        double tile = (double) GB_Global_hack_get (7) ;
+        tile = (tile > 0) ? tile : GB_KRON_TILE ;
+        ntiles = (int64_t) GB_IMIN (ceil (work / tile), (double) avdim) ;
+    }
+    ntiles = GB_IMAX (ntiles, 1) ;
+
+    if (ntiles == 1 && T != NULL)
+    {
+        // T = kron (A,B) all at once; the caller applies the mask
+        return (GB_kroner (T, T_is_csc, op, flipij, A, A_is_pattern, B_in,
+            B_is_pattern, Werk)) ;
+    }
+
+    GBURBLE ("(kron tiles: " GBd ") ", ntiles) ;
+
+    //--------------------------------------------------------------------------
+    // convert B to sparse once, if bitmap, so it is not done for each tile
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix B = B_in ;
+    if (ntiles > 1 && GB_IS_BITMAP (B))
+    {
+        GBURBLE ("B:") ;
+        GB_CLEAR_MATRIX_HEADER (Bwork, &Bwork_header) ;
+        GB_OK (GB_dup_worker (&Bwork, B->iso, B, true, NULL)) ;
+        GB_OK (GB_convert_bitmap_to_sparse (Bwork, Werk)) ;
+        B = Bwork ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the tiles, if T is to be constructed
+    //--------------------------------------------------------------------------
+
+    if (T != NULL)
+    {
+        Tiles = GB_CALLOC_MEMORY (ntiles, sizeof (GrB_Matrix), &Tiles_size) ;
+        if (Tiles == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute each tile
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < ntiles ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the range of vectors of A and T for this tile
+        //----------------------------------------------------------------------
+
+        int64_t j1, j2 ;
+        GB_PARTITION (j1, j2, avdim, k, ntiles) ;
+        const int64_t t1 = j1 * bvdim ;
+        const int64_t t2 = j2 * bvdim ;
+
+        //----------------------------------------------------------------------
+        // Mk = the vectors t1:t2-1 of M
+        //----------------------------------------------------------------------
+
+        GrB_Matrix Mask = M ;
+        bool skip = false ;
+        if (M != NULL && ntiles > 1)
+        {
+            GB_CLEAR_MATRIX_HEADER (Mk, &Mk_header) ;
+            GB_OK (GB_vector_range (Mk, M, t1, t2, Werk)) ;
+            Mask = Mk ;
+            // no entries of Tk can appear if Mk is empty and not complemented
+            skip = (!Mask_comp && GB_nnz (Mk) == 0) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Tk = kron (Ak, B), where Ak = the vectors j1:j2-1 of A
+        //----------------------------------------------------------------------
+
+        if (skip)
+        {
+            // Tk is empty
+            GB_OK (GB_new_empty (&Tk, ttype, tvlen, t2 - t1, T_is_csc)) ;
+        }
+        else
+        {
+            if (ntiles > 1)
+            {
+                GB_CLEAR_MATRIX_HEADER (Ak, &Ak_header) ;
+                GB_OK (GB_vector_range (Ak, A, j1, j2, Werk)) ;
+            }
+            GB_CLEAR_MATRIX_HEADER (Tk, &Tk_header) ;
+            GB_OK (GB_kroner (Tk, T_is_csc, op, flipij,
+                (ntiles > 1) ? Ak : A, A_is_pattern, B, B_is_pattern, Werk)) ;
+            GB_Matrix_free (&Ak) ;
+
+            if (Mask != NULL)
+            {
+                // Sk<Mk> = Tk, and free Tk
+                GB_OK (GB_new_empty (&Sk, ttype, tvlen, t2 - t1, T_is_csc)) ;
+                GB_OK (GB_accum_mask (Sk, Mask, NULL, NULL, &Tk, false,
+                    Mask_comp, Mask_struct, Werk)) ;
+                Tk = Sk ;
+                Sk = NULL ;
+            }
+
+            if (select_op != NULL)
+            {
+                // Sk = select (Tk), and free Tk
+                GB_OK (GB_new_empty (&Sk, ttype, tvlen, t2 - t1, T_is_csc)) ;
+                GB_OK (GB_select (Sk, false, NULL, false, false, NULL,
+                    select_op, Tk, Thunk, false, Werk)) ;
+                GB_Matrix_free (&Tk) ;
+                Tk = Sk ;
+                Sk = NULL ;
+            }
+        }
+        GB_Matrix_free (&Mk) ;
+
+        //----------------------------------------------------------------------
+        // pass Tk to the tile_function, or save it for the concatenation
+        //----------------------------------------------------------------------
+
+        if (T != NULL)
+        {
+            // Tk is not a static header, since the mask has been applied
+            ASSERT (Tk->header_size > 0 || GBNSTATIC) ;
+            Tiles [k] = Tk ;
+            Tk = NULL ;
+        }
+        else
+        {
+            GB_MATRIX_WAIT (Tk) ;
+            if (GB_nnz (Tk) > 0)
+            {
+                uint64_t row_offset = (T_is_csc) ? 0 : t1 ;
+                uint64_t col_offset = (T_is_csc) ? t1 : 0 ;
+                info = tile_function (Tk, row_offset, col_offset, arg) ;
+                if (info != GrB_SUCCESS)
+                {
+                    // the tile_function has terminated the computation
+                    GB_FREE_ALL ;
+                    return (info) ;
+                }
+            }
+            GB_Matrix_free (&Tk) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // T = [Tiles{:}], if requested
+    //--------------------------------------------------------------------------
+
+    if (T != NULL)
+    {
+        GB_OK (GB_new_empty (&T, ttype, tvlen, tvdim, T_is_csc)) ;
+        GB_OK (GB_concat (T, Tiles, (T_is_csc) ? 1 : ntiles,
+            (T_is_csc) ? ntiles : 1, Werk)) ;
+        ASSERT_MATRIX_OK (T, "T = kron(A,B) from tiles", GB0) ;
+    }
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
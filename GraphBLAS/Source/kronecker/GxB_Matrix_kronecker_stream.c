@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_kronecker_stream: stream a Kronecker product to a callback
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = kron(A,B), optionally followed by C = select (op, C, y), is computed
+// one tile at a time, and each tile is passed to the tile_function.  C itself
+// is never held in memory all at once.  The input matrices A and B are
+// optionally transposed, as determined by the Descriptor desc.
+
+#include "kronecker/GB_kron.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_Matrix_kronecker_stream    // stream C<M>=kron(A,B) in tiles
+(
+    GxB_kronecker_function tile_function,   // called for each tile of C
+    void *arg,                      // passed to the tile_function
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp op,          // defines '*' for C=kron(A,B)
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp select_op,   // optional select operator
+    const GrB_Scalar y,             // scalar y for the select_op
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (tile_function) ;
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_NULL (B) ;
+    GB_WHERE_4 (Mask, A, B, y, "GxB_Matrix_kronecker_stream (tile_function, "
+        "arg, M, op, A, B, select_op, y, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_kronecker_stream") ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, Mask_comp, Mask_struct,
+        A_tran, B_tran, xx2, xx3) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (Mask, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = kron(A,B), one tile at a time
+    //--------------------------------------------------------------------------
+
+    info = GB_kron_stream (
+        tile_function, arg,         // callback for each tile of C
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        op,                         // operator that defines C=kron(A,B)
+        A,          A_tran,         // A matrix and its descriptor
+        B,          B_tran,         // B matrix and its descriptor
+        select_op, y,               // optional select operator
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -27,7 +27,13 @@ static inline void *GB_malloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // use a block from the memory pool, if available
+    (*size) = GB_pool_size (*size) ;
+    p = GB_pool_get (*size) ;
+    if (p == NULL)
+    { 
+        p = GB_Global_malloc_function (*size) ;
+    }
 
     #ifdef GB_MEMDUMP
     GBMDUMP ("malloc  %p %8ld: ", p, *size) ;
@@ -54,6 +54,29 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+//------------------------------------------------------------------------------
+// thread-local memory pool
+//------------------------------------------------------------------------------
+
+// size classes of the pool: blocks of size 2^GB_POOL_MINCLASS (8 bytes) to
+// 2^GB_POOL_MAXCLASS (1 MB)
+#define GB_POOL_MINCLASS 3
+#define GB_POOL_MAXCLASS 20
+#define GB_POOL_NCLASS (GB_POOL_MAXCLASS - GB_POOL_MINCLASS + 1)
+
+size_t GB_pool_size (size_t size) ;     // round size up to its size class
+void *GB_pool_get (size_t size) ;       // get a block from the pool
+bool GB_pool_put (void *p, size_t size) ;   // place a block in the pool
+void GB_pool_flush (void) ;             // free all blocks in all pools
+
+void GB_pool_stats
+(
+    int64_t *nblocks,       // # of blocks held in all pools
+    int64_t *nbytes,        // # of bytes held in all pools
+    int64_t *hits,          // # of allocations satisfied from a pool
+    int64_t *misses         // # of pool-sized allocations that used malloc
+) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// GB_pool: thread-local pool of free memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When GxB_MEMORY_POOL_LIMIT is nonzero, GB_malloc_memory and GB_calloc_memory
+// round small and medium requests up to a power of 2 (a size class), and
+// GB_free_memory keeps freed blocks of those sizes in a free list for the
+// calling thread, instead of returning them to free.  The next request for
+// that size class from the same thread is then satisfied from the free list,
+// with no call to malloc and no lock.  The blocks in the pool are ordinary
+// blocks obtained from the malloc function passed to GrB_init, so they can
+// be reallocated, freed by free, or exported to the user, like any other
+// block.  They remain in the GB_Global memtable while they are in the pool.
+
+// Each thread has its own pool, created the first time the thread uses it.
+// All pools are linked into a single list, so that the blocks held by all
+// threads can be freed by GB_pool_flush, even for threads that have since
+// terminated.  The total # of bytes held in all pools is kept at
+// or below GB_Global_pool_limit_get (except briefly, when threads free blocks
+// at the same time).  GB_pool_flush must not be called while other threads
+// are using GraphBLAS.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// the pool for each thread
+//------------------------------------------------------------------------------
+
+typedef struct GB_pool_struct
+{
+    void *head [GB_POOL_NCLASS] ;   // free list for each size class
+    int64_t nblocks ;               // # of blocks held in this pool
+    int64_t nbytes ;                // # of bytes held in this pool
+    int64_t hits ;                  // # of allocations from this pool
+    int64_t misses ;                // # of pool allocations that used malloc
+    struct GB_pool_struct *next ;   // next pool in the list of all pools
+}
+GB_pool_struct ;
+
+// the list of all pools
+static GB_pool_struct *GB_pool_all = NULL ;
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    static GB_pool_struct *GB_POOL_THREAD = NULL ;
+    #pragma omp threadprivate (GB_POOL_THREAD)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    static __thread GB_pool_struct *GB_POOL_THREAD = NULL ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    // Windows: __declspec (thread)
+    static __declspec ( thread ) GB_pool_struct *GB_POOL_THREAD = NULL ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // C11 threads
+    #include <threads.h>
+    static _Thread_local GB_pool_struct *GB_POOL_THREAD = NULL ;
+
+#else
+
+    // no thread-local storage: the pool is disabled
+    #define NO_THREAD_LOCAL_STORAGE
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_pool_class: return the size class of a block, or -1 if none
+//------------------------------------------------------------------------------
+
+static inline int GB_pool_class (size_t size)
+{
+    int k = (int) GB_CEIL_LOG2 (GB_IMAX (size, 8)) ;
+    return ((k <= GB_POOL_MAXCLASS) ? (k - GB_POOL_MINCLASS) : -1) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_this_thread: get the pool of this thread, creating it if needed
+//------------------------------------------------------------------------------
+
+#if !defined ( NO_THREAD_LOCAL_STORAGE )
+static GB_pool_struct *GB_pool_this_thread (void)
+{
+    GB_pool_struct *pool = GB_POOL_THREAD ;
+    if (pool == NULL)
+    {
+        // first use of the pool by this thread
+        pool = GB_Global_persistent_malloc (sizeof (GB_pool_struct)) ;
+        if (pool != NULL)
+        {
+            memset (pool, 0, sizeof (GB_pool_struct)) ;
+            #pragma omp critical (GB_pool_list)
+            {
+                pool->next = GB_pool_all ;
+                GB_pool_all = pool ;
+            }
+            GB_POOL_THREAD = pool ;
+        }
+    }
+    return (pool) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_pool_size: round a block size up to its size class
+//------------------------------------------------------------------------------
+
+// Returns the size of the block to allocate, which is size itself if the pool
+// is disabled or the block is too large for the pool.
+
+size_t GB_pool_size (size_t size)
+{
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (size) ;
+    #else
+    if (GB_Global_pool_limit_get ( ) == 0) return (size) ;
+    int c = GB_pool_class (size) ;
+    return ((c < 0) ? size : (((size_t) 1) << (c + GB_POOL_MINCLASS))) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_get: get a block from the pool of this thread
+//------------------------------------------------------------------------------
+
+// size must be the result of GB_pool_size.  Returns NULL if the pool is
+// disabled or has no block of the right size; the caller then uses malloc.
+
+void *GB_pool_get (size_t size)
+{
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (NULL) ;
+    #else
+    int c = GB_pool_class (size) ;
+    if (c < 0 || GB_Global_pool_limit_get ( ) == 0)
+    {
+        return (NULL) ;
+    }
+    GB_pool_struct *pool = GB_pool_this_thread ( ) ;
+    if (pool == NULL || pool->head [c] == NULL)
+    {
+        // no block available; the caller must use malloc
+        if (pool != NULL) pool->misses++ ;
+        return (NULL) ;
+    }
+    // pop the first block from the free list
+    void *p = pool->head [c] ;
+    pool->head [c] = *((void **) p) ;
+    pool->nblocks-- ;
+    pool->nbytes -= size ;
+    pool->hits++ ;
+    GB_Global_pool_bytes_update (-((int64_t) size)) ;
+    return (p) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_put: place a block in the pool of this thread
+//------------------------------------------------------------------------------
+
+// Returns true if the block was placed in the pool, or false if the caller
+// must free it.  Only blocks whose size is exactly a size class are kept.
+
+bool GB_pool_put (void *p, size_t size)
+{
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (false) ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // check if the block can be placed in the pool
+    //--------------------------------------------------------------------------
+
+    int64_t limit = GB_Global_pool_limit_get ( ) ;
+    int c = GB_pool_class (size) ;
+    if (limit == 0 || c < 0
+        || size != (((size_t) 1) << (c + GB_POOL_MINCLASS))
+        || GB_Global_pool_bytes_get ( ) + (int64_t) size > limit)
+    {
+        return (false) ;
+    }
+
+    GB_pool_struct *pool = GB_pool_this_thread ( ) ;
+    if (pool == NULL)
+    {
+        // out of memory; the caller must free the block
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // push the block onto its free list
+    //--------------------------------------------------------------------------
+
+    *((void **) p) = pool->head [c] ;
+    pool->head [c] = p ;
+    pool->nblocks++ ;
+    pool->nbytes += size ;
+    GB_Global_pool_bytes_update ((int64_t) size) ;
+    return (true) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_flush: free all blocks held in the pools of all threads
+//------------------------------------------------------------------------------
+
+// The statistics of all pools are also cleared.
+
+void GB_pool_flush (void)
+{
+    #pragma omp critical (GB_pool_list)
+    {
+        for (GB_pool_struct *pool = GB_pool_all ; pool != NULL ;
+            pool = pool->next)
+        {
+            for (int c = 0 ; c < GB_POOL_NCLASS ; c++)
+            {
+                void *p = pool->head [c] ;
+                while (p != NULL)
+                {
+                    void *pnext = *((void **) p) ;
+                    GB_Global_free_function (p) ;
+                    p = pnext ;
+                }
+                pool->head [c] = NULL ;
+            }
+            GB_Global_pool_bytes_update (-(pool->nbytes)) ;
+            pool->nblocks = 0 ;
+            pool->nbytes = 0 ;
+            pool->hits = 0 ;
+            pool->misses = 0 ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_stats: statistics of the pools of all threads
+//------------------------------------------------------------------------------
+
+void GB_pool_stats
+(
+    int64_t *nblocks,       // # of blocks held in all pools
+    int64_t *nbytes,        // # of bytes held in all pools
+    int64_t *hits,          // # of allocations satisfied from a pool
+    int64_t *misses         // # of pool-sized allocations that used malloc
+)
+{
+    int64_t b = 0, s = 0, h = 0, m = 0 ;
+    #pragma omp critical (GB_pool_list)
+    {
+        for (GB_pool_struct *pool = GB_pool_all ; pool != NULL ;
+            pool = pool->next)
+        {
+            b += pool->nblocks ;
+            s += pool->nbytes ;
+            h += pool->hits ;
+            m += pool->misses ;
+        }
+    }
+    if (nblocks != NULL) (*nblocks) = b ;
+    if (nbytes  != NULL) (*nbytes ) = s ;
+    if (hits    != NULL) (*hits   ) = h ;
+    if (misses  != NULL) (*misses ) = m ;
+}
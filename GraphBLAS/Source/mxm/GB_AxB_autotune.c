@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// GB_AxB_autotune: time dot3 and saxpy3 to tune the cost model
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When GxB_AxB_TUNING is GxB_AxB_TUNING_TRAIN, GB_mxm calls this function
+// before computing C<M>=A*B, for each product where both dot3 and saxpy3 can
+// be used.  T<M>=A*B is computed twice, once with each method, and each result
+// is discarded.  The measured ratio of the two run times is compared with the
+// costs predicted by GB_AxB_cost_model, to obtain the value of dot_ratio that
+// would have predicted the run times exactly.  GxB_AxB_DOT_RATIO is then
+// updated as the geometric mean of all such values seen so far (with the
+// weight of the past limited to GB_AXB_MAX_WEIGHT samples, so that the ratio
+// can continue to adapt).  The ratio and the number of samples can be saved to
+// a profile, and loaded by a later program (see GB_AxB_profile.c).
+
+// Training doubles the work of each such product, and is meant to be used
+// on representative problems, to create a profile for the machine.
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_Matrix_free (&MT) ;  \
+    GB_Matrix_free (&T) ;   \
+}
+
+#include "mxm/GB_mxm.h"
+
+#define GB_AXB_MAX_WEIGHT 100
+
+//------------------------------------------------------------------------------
+// GB_AxB_trial: compute T<M>=A*B with a given method and return its run time
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_AxB_trial
+(
+    double *t,                      // run time of the method
+    double *cost,                   // predicted cost of the method
+    const int AxB_method,           // GxB_AxB_DOT or GxB_AxB_SAXPY
+    const bool C_is_csc,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool A_transpose,
+    const bool B_transpose,
+    const bool flipxy,
+    const int do_sort,
+    GB_Werk Werk
+)
+{
+    GrB_Info info ;
+    struct GB_Matrix_opaque MT_header, T_header ;
+    GrB_Matrix MT = NULL, T = NULL ;
+    GB_CLEAR_MATRIX_HEADER (MT, &MT_header) ;
+    GB_CLEAR_MATRIX_HEADER (T, &T_header) ;
+    bool mask_applied = false, done_in_place = false, M_transposed = false ;
+
+    double t0 = GB_omp_get_wtime ( ) ;
+    GB_OK (GB_AxB_meta (T, NULL, false, C_is_csc, MT, &M_transposed, M,
+        false, Mask_struct, NULL, A, B, semiring, A_transpose, B_transpose,
+        flipxy, &mask_applied, &done_in_place, AxB_method, do_sort, Werk)) ;
+    (*t) = GB_omp_get_wtime ( ) - t0 ;
+
+    // get the method and its cost from the Werk, not the global last method,
+    // which can be changed by a C=A*B in another user thread
+    int method = Werk->AxB_method ;
+    (*cost) = (method != AxB_method) ? 0 :
+        ((method == GxB_AxB_DOT) ? Werk->AxB_dot_cost : Werk->AxB_saxpy_cost) ;
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL ;
+
+GrB_Info GB_AxB_autotune            // time both methods for C<M>=A*B
+(
+    const bool C_is_csc,            // desired CSR/CSC format of C
+    const GrB_Matrix M,             // mask for C<M>, sparse or hypersparse
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool A_transpose,         // if true, use A', else A
+    const bool B_transpose,         // if true, use B', else B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (GB_AxB_dot3_control (M, false)) ;
+
+    //--------------------------------------------------------------------------
+    // time both methods
+    //--------------------------------------------------------------------------
+
+    double t_dot, t_saxpy, dot_cost, saxpy_cost ;
+    GB_OK (GB_AxB_trial (&t_dot, &dot_cost, GxB_AxB_DOT, C_is_csc, M,
+        Mask_struct, A, B, semiring, A_transpose, B_transpose, flipxy, do_sort,
+        Werk)) ;
+    GB_OK (GB_AxB_trial (&t_saxpy, &saxpy_cost, GxB_AxB_SAXPY, C_is_csc, M,
+        Mask_struct, A, B, semiring, A_transpose, B_transpose, flipxy, do_sort,
+        Werk)) ;
+
+    if (t_dot <= 0 || t_saxpy <= 0 || dot_cost <= 0 || saxpy_cost <= 0)
+    {
+        // the product is too small to time, or a method could not be used
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the dot_ratio
+    //--------------------------------------------------------------------------
+
+    // the ratio that would have predicted the run times exactly
+    double r = (t_dot / t_saxpy) * (saxpy_cost / dot_cost) ;
+
+    // the update is done atomically, since other user threads may be
+    // training at the same time
+    double dot_ratio = GB_Global_AxB_dot_ratio_update (r, GB_AXB_MAX_WEIGHT) ;
+    GBURBLE ("(autotune: dot3 %g sec, saxpy3 %g sec, ratio %g) ",
+        t_dot, t_saxpy, dot_ratio) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// GB_AxB_cost_model: predict the cost of dot3 and saxpy3 for C<M>=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=X*Y is to be computed, where X = A or A' is m-by-k, Y = B or B' is
+// k-by-n, and the mask M is sparse or hypersparse and not complemented.  Both
+// the masked dot product method (dot3) and the saxpy3 method can be used.  By
+// default, GB_AxB_meta selects between them with fixed rules.  If
+// GxB_AxB_TUNING is enabled, this function is used instead, and dot3 is
+// selected if dot_ratio * dot_cost < saxpy_cost.
+
+// The costs are estimated in O(1) time from the dimensions and the number of
+// entries in M, A, and B, assuming the entries are evenly distributed:
+
+//      dot3 computes C(i,j) = X(i,:)*Y(:,j) for each entry M(i,j), by merging
+//      two lists of average length nnz(X)/m and nnz(Y)/n.
+
+//      saxpy3 computes C(:,j) = X*Y(:,j), with nnz(X)/k flops for each entry
+//      in Y, and scans all of M.
+
+// Both methods also require some matrices to be transposed first: dot3 needs
+// X' and Y, while saxpy3 needs X and Y.  The work to transpose a matrix is
+// taken as its number of entries.  The constant dot_ratio (GxB_AxB_DOT_RATIO)
+// accounts for the differing cost of each unit of work in the two methods on
+// a particular machine.  It is 1 by default, and can be set by the user,
+// loaded from a profile, or tuned by GB_AxB_autotune.
+
+#include "mxm/GB_mxm.h"
+
+bool GB_AxB_cost_model      // true if dot3 is predicted to be faster
+(
+    // output:
+    double *dot_cost,       // predicted cost of dot3 (if not NULL)
+    double *saxpy_cost,     // predicted cost of saxpy3 (if not NULL)
+    // input:
+    const GrB_Matrix M,     // mask, sparse or hypersparse, not complemented
+    const GrB_Matrix A,
+    const bool A_transpose, // if true, C<M>=A'*B or A'*B'
+    const GrB_Matrix B,
+    const bool B_transpose  // if true, C<M>=A*B' or A'*B'
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (M != NULL && A != NULL && B != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // get the dimensions and number of entries
+    //--------------------------------------------------------------------------
+
+    double m = (double) GB_IMAX (1, A_transpose ? A->vdim : A->vlen) ;
+    double k = (double) GB_IMAX (1, A_transpose ? A->vlen : A->vdim) ;
+    double n = (double) GB_IMAX (1, B_transpose ? B->vlen : B->vdim) ;
+    double mnz = (double) GB_nnz (M) ;
+    double anz = (double) GB_nnz_held (A) ;
+    double bnz = (double) GB_nnz_held (B) ;
+
+    //--------------------------------------------------------------------------
+    // estimate the cost of each method
+    //--------------------------------------------------------------------------
+
+    double dcost = mnz * (anz / m + bnz / n)
+        + (A_transpose ? 0 : anz)       // dot3 needs A' for C=A*B
+        + (B_transpose ? bnz : 0) ;     // dot3 needs B for C=A*B'
+
+    double scost = anz * bnz / k + mnz
+        + (A_transpose ? anz : 0)       // saxpy3 needs A for C=A'*B
+        + (B_transpose ? bnz : 0) ;     // saxpy3 needs B for C=A*B'
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    double dot_ratio = GB_Global_AxB_dot_ratio_get ( ) ;
+    GBURBLE ("(cost: dot3 %g saxpy3 %g ratio %g) ", dcost, scost, dot_ratio) ;
+    if (dot_cost   != NULL) (*dot_cost  ) = dcost ;
+    if (saxpy_cost != NULL) (*saxpy_cost) = scost ;
+    return (dot_ratio * dcost < scost) ;
+}
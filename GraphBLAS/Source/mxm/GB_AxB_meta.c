@@ -18,7 +18,9 @@
 // matrix C passed in from the user (C_in).
 
 // The method is chosen automatically:  a gather/scatter saxpy method
-// (Gustavson), or a dot product method.
+// (Gustavson), or a dot product method.  If GxB_AxB_TUNING is enabled, the
+// choice between the masked dot product (dot3) and saxpy3 for C<M>=A*B is
+// made by GB_AxB_cost_model instead of by fixed rules.
 
 // FUTURE:: an outer-product method for C=A*B'
 
@@ -565,6 +567,19 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // use GB_AxB_saxpy3 by default
     int axb_method = GB_USE_SAXPY ;
 
+    // predict the cost of dot3 and saxpy3, if both can be used and tuning is
+    // enabled.  The costs are also needed when training forces each method in
+    // turn, but the cost model is skipped entirely when tuning is off.
+    bool tuning = (GB_Global_AxB_tuning_get ( ) != GxB_AxB_TUNING_OFF) ;
+    bool use_cost_model = tuning && (AxB_method == GxB_DEFAULT) ;
+    double dot_cost = 0, saxpy_cost = 0 ;
+    bool dot_is_faster = false ;
+    if (tuning && GB_AxB_dot3_control (M, Mask_comp))
+    { 
+        dot_is_faster = GB_AxB_cost_model (&dot_cost, &saxpy_cost, M, A,
+            atrans, B, btrans) ;
+    }
+
     if (atrans)
     {
 
@@ -678,6 +693,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // only use the dot product method if explicitly requested
             axb_method = GB_USE_DOT ;
         }
+        else if (use_cost_model && dot_is_faster)
+        { 
+            // or if the cost model predicts it is faster
+            axb_method = GB_USE_DOT ;
+        }
 
         //----------------------------------------------------------------------
         // BT = B'
@@ -772,7 +792,13 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         else
         {
             // C = A*B: auto selection: select saxpy or dot
-            if (GB_IS_HYPERSPARSE (A) && (GB_IS_BITMAP (B) || GB_IS_FULL (B)))
+            if (use_cost_model && dot_is_faster)
+            { 
+                // the cost model predicts that dot3 is faster than saxpy3
+                axb_method = GB_USE_DOT ;
+            }
+            else if (GB_IS_HYPERSPARSE (A) &&
+                (GB_IS_BITMAP (B) || GB_IS_FULL (B)))
             {
                 // If A is hyper and B is bitmap/full, then saxpy will compute
                 // C as sparse or bitmap.  If bitmap, use saxpy; if sparse, use
@@ -840,6 +866,15 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         }
     }
 
+    // record the method used in the Werk, for the autotuner, and globally,
+    // for GxB_AxB_LAST_METHOD and GxB_AxB_LAST_COST
+    Werk->AxB_method =
+        (axb_method == GB_USE_DOT)   ? GxB_AxB_DOT :
+        (axb_method == GB_USE_SAXPY) ? GxB_AxB_SAXPY : GxB_DEFAULT ;
+    Werk->AxB_dot_cost = dot_cost ;
+    Werk->AxB_saxpy_cost = saxpy_cost ;
+    GB_Global_AxB_last_set (Werk->AxB_method, dot_cost, saxpy_cost) ;
+
     if (*M_transposed) { GBURBLE ("(M transposed) ") ; }
     if ((M != NULL) && !(*mask_applied)) { GBURBLE ("(mask later) ") ; }
 
@@ -76,9 +76,14 @@ void GB_AxB_meta_adotb_control
             (*axb_method) = GB_USE_DOT ;
         }
         else if (GB_AxB_dot3_control (M, Mask_comp))
-        { 
-            // C<M>=A'*B uses the masked dot product method (dot3)
-            (*axb_method) = GB_USE_DOT ;
+        {
+            // C<M>=A'*B uses the masked dot product method (dot3), unless
+            // the cost model is enabled and predicts saxpy3 to be faster
+            if (GB_Global_AxB_tuning_get ( ) == GxB_AxB_TUNING_OFF ||
+                GB_AxB_cost_model (NULL, NULL, M, A, true, B, false))
+            { 
+                (*axb_method) = GB_USE_DOT ;
+            }
         }
         else if (GB_AxB_dot2_control (A, B))
         { 
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_AxB_profile: save/load the tuned cost model for C<M>=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The profile is a short text file holding the parameters of the cost model
+// used by GB_AxB_cost_model, and the number of timings (from GB_AxB_autotune)
+// that determined them:
+
+//      SuiteSparse:GraphBLAS AxB profile
+//      dot_ratio 0.734
+//      nsamples 42
+
+// The profile is saved and loaded with GrB_Global_set_String and
+// GxB_AxB_PROFILE_SAVE and GxB_AxB_PROFILE_LOAD.  If the environment variable
+// GRAPHBLAS_AXB_PROFILE is set, GrB_init loads the profile from that file (if
+// it exists), and GrB_finalize saves it there if GxB_AxB_TUNING is
+// GxB_AxB_TUNING_TRAIN.  Loading a profile does not change GxB_AxB_TUNING.
+
+#include "mxm/GB_mxm.h"
+
+#define GB_AXB_PROFILE_HEADER "SuiteSparse:GraphBLAS AxB profile"
+
+//------------------------------------------------------------------------------
+// GB_AxB_profile_save
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_profile_save (const char *filename)
+{
+    if (filename == NULL)
+    {
+        return (GrB_NULL_POINTER) ;
+    }
+    FILE *f = fopen (filename, "w") ;
+    if (f == NULL)
+    {
+        // file cannot be created
+        return (GrB_INVALID_VALUE) ;
+    }
+    int result = fprintf (f, GB_AXB_PROFILE_HEADER "\ndot_ratio %.17g\n"
+        "nsamples %" PRId64 "\n", GB_Global_AxB_dot_ratio_get ( ),
+        GB_Global_AxB_nsamples_get ( )) ;
+    result = (fclose (f) != 0) ? (-1) : result ;
+    return ((result < 0) ? GrB_INVALID_VALUE : GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_profile_load
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_profile_load (const char *filename)
+{
+    if (filename == NULL)
+    {
+        return (GrB_NULL_POINTER) ;
+    }
+    FILE *f = fopen (filename, "r") ;
+    if (f == NULL)
+    {
+        // file does not exist or cannot be read
+        return (GrB_INVALID_VALUE) ;
+    }
+    char header [64] ;
+    double dot_ratio = 0 ;
+    int64_t nsamples = -1 ;
+    bool ok = (fgets (header, 64, f) != NULL)
+        && (strncmp (header, GB_AXB_PROFILE_HEADER,
+            strlen (GB_AXB_PROFILE_HEADER)) == 0)
+        && (fscanf (f, " dot_ratio %lg nsamples %" SCNd64, &dot_ratio,
+            &nsamples) == 2)
+        && (dot_ratio > 0) && isfinite (dot_ratio) && (nsamples >= 0) ;
+    fclose (f) ;
+    if (!ok)
+    {
+        // the file is not a valid profile; the cost model is unchanged
+        return (GrB_INVALID_VALUE) ;
+    }
+    GB_Global_AxB_dot_ratio_set (dot_ratio) ;
+    GB_Global_AxB_nsamples_set (nsamples) ;
+    return (GrB_SUCCESS) ;
+}
@@ -141,6 +141,15 @@ GrB_Info GB_mxm                     // C<M> = A*B
     bool mask_applied = false ;
     bool done_in_place = false ;
     bool M_transposed = false ;
+
+    if (GB_Global_AxB_tuning_get ( ) == GxB_AxB_TUNING_TRAIN
+        && AxB_method == GxB_DEFAULT && GB_AxB_dot3_control (M, Mask_comp))
+    {
+        // time dot3 and saxpy3 for T<M>=A*B to tune the cost model
+        GB_OK (GB_AxB_autotune (C->is_csc, M, Mask_struct, A, B, semiring,
+            A_transpose, B_transpose, flipxy, do_sort, Werk)) ;
+    }
+
     GB_OK (GB_AxB_meta (T, C, C_replace, C->is_csc, MT, &M_transposed, M,
         Mask_comp, Mask_struct, accum, A, B, semiring, A_transpose,
         B_transpose, flipxy, &mask_applied, &done_in_place, AxB_method,
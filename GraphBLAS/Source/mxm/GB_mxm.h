@@ -295,6 +295,78 @@ void GB_AxB_meta_adotb_control
     int AxB_method
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_cost_model: predict the cost of dot3 and saxpy3 for C<M>=A*B
+//------------------------------------------------------------------------------
+
+bool GB_AxB_cost_model      // true if dot3 is predicted to be faster
+(
+    // output:
+    double *dot_cost,       // predicted cost of dot3 (if not NULL)
+    double *saxpy_cost,     // predicted cost of saxpy3 (if not NULL)
+    // input:
+    const GrB_Matrix M,     // mask, sparse or hypersparse, not complemented
+    const GrB_Matrix A,
+    const bool A_transpose, // if true, C<M>=A'*B or A'*B'
+    const GrB_Matrix B,
+    const bool B_transpose  // if true, C<M>=A*B' or A'*B'
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune: time dot3 and saxpy3 to tune the cost model
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_autotune            // time both methods for C<M>=A*B
+(
+    const bool C_is_csc,            // desired CSR/CSC format of C
+    const GrB_Matrix M,             // mask for C<M>, sparse or hypersparse
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool A_transpose,         // if true, use A', else A
+    const bool B_transpose,         // if true, use B', else B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_profile_save, GB_AxB_profile_load: save/load the tuned cost model
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_profile_save (const char *filename) ;
+GrB_Info GB_AxB_profile_load (const char *filename) ;
+
+//------------------------------------------------------------------------------
+// GB_mxm_fused: T<M>=A*B fused with a reduction or selection of T
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mxm_fused               // fused T<M>=A*B and reduce/select of T
+(
+    // output for reduce, if s is not NULL:
+    GrB_Scalar s,                   // s = accum (s, reduce (monoid, T))
+    const GrB_Monoid monoid,        // monoid to reduce T
+    // output for select, if C is not NULL:
+    GrB_Matrix C,                   // C<M> = accum (C, select (op, T, y))
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_IndexUnaryOp op,      // select operator
+    const GrB_Scalar Thunk,         // scalar y for the select operator
+    // input:
+    const GrB_BinaryOp accum,       // optional accum for s or C
+    const GrB_Matrix M,             // optional mask for T (and C)
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const int AxB_method,           // for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+) ;
+
 // return value of axb_method from GB_AxB_meta_adotb_control
 #define GB_USE_ROWSCALE 0
 #define GB_USE_COLSCALE 1
@@ -0,0 +1,393 @@
+//------------------------------------------------------------------------------
+// GB_mxm_fused: T<M>=A*B fused with a reduction or selection of T
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function does the work for GxB_mxm_reduce_Scalar, which computes
+// s = accum (s, reduce (monoid, T)), and GxB_mxm_select, which computes
+// C<M> = accum (C, select (op, T, y)), where T<M>=A*B.  The product T is not
+// computed all at once.  Instead, the rows of T (or its columns) are split
+// into chunks, and each chunk Tk<Mk>=Ak*B (or Tk<Mk>=A*Bk) is computed with
+// GB_mxm, which uses the same factory kernels and JIT kernels as GrB_mxm.
+// Each chunk is reduced into a scalar, or selected, and then freed before the
+// next chunk is computed.  The workspace for T is thus bounded by the size of
+// a single chunk.  For GxB_mxm_select, only the selected entries of each
+// chunk are kept, and these are concatenated into the final result.
+
+// T is split by rows if M is held by row and the rows of A (or of A' if
+// A_transpose is true) are its stored vectors, so that each chunk Mk and Ak
+// is a contiguous range of vectors of M and A.  T is split by column if M and
+// B (or B') are held by column.  If M is not present, the formats of A and B
+// determine how T is split.  Otherwise, T is computed in a single chunk.  The
+// operand that is not split is transposed once beforehand, if required, so
+// that it is not transposed again for each chunk.
+
+// The number of chunks is determined by GB_MXM_FUSED_CHUNK, the target number
+// of entries in M and in each chunk of A (or B).  It can be changed by
+// GB_Global_hack_set (6, chunk) for testing.
+
+// For GxB_mxm_select, T is split only if the select operator depends solely
+// on the values of T (GrB_VALUE* operators), since the row and column indices
+// of each chunk are offset from those of T.
+
+#define GB_FREE_WORKSPACE                                   \
+{                                                           \
+    GB_Matrix_free (&Mk) ;                                  \
+    GB_Matrix_free (&Xk) ;                                  \
+    GB_Matrix_free (&Tk) ;                                  \
+    GB_Matrix_free (&XT) ;                                  \
+    GB_Matrix_free (&Z) ;                                   \
+    if (Tiles != NULL)                                      \
+    {                                                       \
+        for (int64_t k = 0 ; k < nchunks ; k++)             \
+        {                                                   \
+            GB_Matrix_free (&(Tiles [k])) ;                 \
+        }                                                   \
+    }                                                       \
+    GB_FREE_MEMORY (&Tiles, Tiles_size) ;                   \
+}
+
+#define GB_FREE_ALL                                         \
+{                                                           \
+    GB_FREE_WORKSPACE ;                                     \
+    GB_Matrix_free (&T) ;                                   \
+}
+
+#include "mxm/GB_mxm.h"
+#include "slice/GB_tile.h"
+#include "select/GB_select.h"
+#include "reduce/GB_reduce.h"
+#include "concat/GB_concat.h"
+#include "transpose/GB_transpose.h"
+#include "mask/GB_accum_mask.h"
+#include "slice/include/GB_partition.h"
+
+#define GB_MXM_FUSED_CHUNK (1024*1024)
+
+//------------------------------------------------------------------------------
+// GB_mxm_fused
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mxm_fused               // fused T<M>=A*B and reduce/select of T
+(
+    // output for reduce, if s is not NULL:
+    GrB_Scalar s,                   // s = accum (s, reduce (monoid, T))
+    const GrB_Monoid monoid,        // monoid to reduce T
+    // output for select, if C is not NULL:
+    GrB_Matrix C,                   // C<M> = accum (C, select (op, T, y))
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_IndexUnaryOp op,      // select operator
+    const GrB_Scalar Thunk,         // scalar y for the select operator
+    // input:
+    const GrB_BinaryOp accum,       // optional accum for s or C
+    const GrB_Matrix M,             // optional mask for T (and C)
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const int AxB_method,           // for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque Mk_header, Xk_header, XT_header ;
+    GrB_Matrix Mk = NULL, Xk = NULL, XT = NULL, Tk = NULL, T = NULL ;
+    GrB_Matrix Z = NULL, *Tiles = NULL ;
+    size_t Tiles_size = 0 ;
+    int64_t nchunks = 0 ;
+
+    ASSERT ((s == NULL) != (C == NULL)) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_mxm_fused", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_fused", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_fused", GB0) ;
+
+    GrB_Type ttype = semiring->add->op->ztype ;
+    if (s != NULL)
+    {
+        // the monoid must be able to reduce T
+        GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+        if (!GB_Type_compatible (monoid->op->ztype, ttype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Incompatible type for "
+                "reduction operator z=%s(x,y):\n"
+                "input matrix A*B of type [%s]\n"
+                "cannot be typecast to reduction operator of type [%s]",
+                monoid->op->name, ttype->name, monoid->op->ztype->name) ;
+        }
+    }
+    else
+    {
+        // C<M> = accum (C,T) must be valid
+        GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+        GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, ttype,
+            Werk)) ;
+    }
+
+    // check the dimensions of T=A*B and M
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || (M != NULL &&
+        (GB_NROWS (M) != anrows || GB_NCOLS (M) != bncols)))
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s\n"
+            "mask is " GBd "-by-" GBd,
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "",
+            (M == NULL) ? anrows : GB_NROWS (M),
+            (M == NULL) ? bncols : GB_NCOLS (M)) ;
+    }
+    if (C != NULL && (GB_NROWS (C) != anrows || GB_NCOLS (C) != bncols))
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "product is " GBd "-by-" GBd,
+            GB_NROWS (C), GB_NCOLS (C), anrows, bncols) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine how to split T into chunks
+    //--------------------------------------------------------------------------
+
+    // rows of T are the vectors of A if A is CSR and not transposed, or CSC
+    // and transposed; columns of T are the vectors of B if B is CSC and not
+    // transposed, or CSR and transposed.
+    bool A_by_row = (A->is_csc == A_transpose) ;
+    bool B_by_col = (B->is_csc != B_transpose) ;
+
+    bool by_row = false, by_col = false ;
+    if (M == NULL)
+    {
+        by_row = A_by_row ;
+        by_col = !by_row && B_by_col ;
+    }
+    else
+    {
+        by_row = !(M->is_csc) && A_by_row ;
+        by_col =  (M->is_csc) && B_by_col ;
+    }
+
+    if (C != NULL && !(op->opcode >= GB_VALUENE_idxunop_code &&
+                       op->opcode <= GB_VALUELE_idxunop_code))
+    {
+        // the select operator depends on the row and column indices of T
+        by_row = false ;
+        by_col = false ;
+    }
+
+    if (M == NULL && Mask_comp)
+    {
+        // T<!NULL>=A*B is empty; no need to split T
+        by_row = false ;
+        by_col = false ;
+    }
+
+    if (by_row || by_col)
+    {
+        // the chunks are ranges of vectors of M and of A (or B)
+        GB_MATRIX_WAIT (M) ;
+        GB_MATRIX_WAIT (A) ;
+        GB_MATRIX_WAIT (B) ;
+        GrB_Matrix X = (by_row) ? A : B ;
+        int64_t nvec = (by_row) ? anrows : bncols ;
+        int64_t work = GB_nnz_held (X) + ((M == NULL) ? 0 : GB_nnz_held (M)) ;
+        int64_t chunk = GB_Global_hack_get (6) ;
+        chunk = (chunk > 0) ? chunk : GB_MXM_FUSED_CHUNK ;
+        nchunks = (work + chunk - 1) / chunk ;
+        nchunks = GB_IMIN (nchunks, nvec) ;
+    }
+
+    if (nchunks <= 1)
+    {
+
+        //----------------------------------------------------------------------
+        // compute T<M>=A*B all at once
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_Matrix_new (&T, ttype, anrows, bncols)) ;
+        GB_OK (GB_mxm (T, false, M, Mask_comp, Mask_struct, NULL, semiring,
+            A, A_transpose, B, B_transpose, false, AxB_method, do_sort,
+            Werk)) ;
+        if (s != NULL)
+        {
+            // s = accum (s, reduce (T))
+            GB_OK (GB_Scalar_reduce (s, accum, monoid, T, Werk)) ;
+        }
+        else
+        {
+            // C<M> = accum (C, select (T))
+            GB_OK (GB_select (C, C_replace, M, Mask_comp, Mask_struct, accum,
+                op, T, Thunk, false, Werk)) ;
+        }
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(mxm fused: %s, " GBd " chunks) ",
+        (by_row) ? "by row" : "by col", nchunks) ;
+
+    //--------------------------------------------------------------------------
+    // transpose the operand that is not split, if needed
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A2 = A, B2 = B ;
+    bool A2_transpose = A_transpose, B2_transpose = B_transpose ;
+    if (by_row && B_transpose)
+    {
+        // B2 = B', held in the same format as B
+        GB_CLEAR_MATRIX_HEADER (XT, &XT_header) ;
+        GB_OK (GB_transpose_cast (XT, B->type, B->is_csc, B, false, Werk)) ;
+        B2 = XT ;
+        B2_transpose = false ;
+    }
+    else if (by_col && A_transpose)
+    {
+        // A2 = A', held in the same format as A
+        GB_CLEAR_MATRIX_HEADER (XT, &XT_header) ;
+        GB_OK (GB_transpose_cast (XT, A->type, A->is_csc, A, false, Werk)) ;
+        A2 = XT ;
+        A2_transpose = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace
+    //--------------------------------------------------------------------------
+
+    if (s != NULL)
+    {
+        // Z: the reduction of all chunks seen so far, with no entry at first
+        bool Zp_is_32, Zj_is_32, Zi_is_32 ;
+        GB_determine_pji_is_32 (&Zp_is_32, &Zj_is_32, &Zi_is_32,
+            GxB_SPARSE, 1, 1, 1, NULL) ;
+        GB_OK (GB_new (&Z, // sparse, new header
+            monoid->op->ztype, 1, 1, GB_ph_calloc, true, GxB_SPARSE,
+            GB_Global_hyper_switch_get ( ), 1, Zp_is_32, Zj_is_32, Zi_is_32)) ;
+    }
+    else
+    {
+        // Tiles: the selected entries of each chunk
+        Tiles = GB_CALLOC_MEMORY (nchunks, sizeof (GrB_Matrix), &Tiles_size) ;
+        if (Tiles == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute, reduce or select, and free each chunk of T
+    //--------------------------------------------------------------------------
+
+    int64_t nvec = (by_row) ? anrows : bncols ;
+    for (int64_t k = 0 ; k < nchunks ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the range of vectors of this chunk
+        //----------------------------------------------------------------------
+
+        int64_t k1, k2 ;
+        GB_PARTITION (k1, k2, nvec, k, nchunks) ;
+
+        //----------------------------------------------------------------------
+        // Mk = M (k1:k2-1,:) or M (:,k1:k2-1)
+        //----------------------------------------------------------------------
+
+        if (M != NULL)
+        {
+            GB_CLEAR_MATRIX_HEADER (Mk, &Mk_header) ;
+            GB_OK (GB_vector_range (Mk, M, k1, k2, Werk)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Tk<Mk> = Ak*B2 or A2*Bk
+        //----------------------------------------------------------------------
+
+        GB_CLEAR_MATRIX_HEADER (Xk, &Xk_header) ;
+        if (by_row)
+        {
+            // Xk = A (k1:k2-1,:) or A (:,k1:k2-1) if A is transposed
+            GB_OK (GB_vector_range (Xk, A, k1, k2, Werk)) ;
+            GB_OK (GB_new_empty (&Tk, ttype, bncols, k2 - k1, false)) ;
+            GB_OK (GB_mxm (Tk, false, Mk, Mask_comp, Mask_struct, NULL,
+                semiring, Xk, A_transpose, B2, B2_transpose, false,
+                AxB_method, do_sort, Werk)) ;
+        }
+        else
+        {
+            // Xk = B (:,k1:k2-1) or B (k1:k2-1,:) if B is transposed
+            GB_OK (GB_vector_range (Xk, B, k1, k2, Werk)) ;
+            GB_OK (GB_new_empty (&Tk, ttype, anrows, k2 - k1, true)) ;
+            GB_OK (GB_mxm (Tk, false, Mk, Mask_comp, Mask_struct, NULL,
+                semiring, A2, A2_transpose, Xk, B_transpose, false,
+                AxB_method, do_sort, Werk)) ;
+        }
+        GB_Matrix_free (&Mk) ;
+        GB_Matrix_free (&Xk) ;
+
+        //----------------------------------------------------------------------
+        // reduce or select the chunk
+        //----------------------------------------------------------------------
+
+        if (s != NULL)
+        {
+            // Z = Z + reduce (Tk)
+            GB_OK (GB_Scalar_reduce ((GrB_Scalar) Z, monoid->op, monoid, Tk,
+                Werk)) ;
+        }
+        else
+        {
+            // Tiles [k] = select (Tk)
+            GB_OK (GB_new_empty (&(Tiles [k]), ttype, Tk->vlen, Tk->vdim,
+                Tk->is_csc)) ;
+            GB_OK (GB_select (Tiles [k], false, NULL, false, false, NULL, op,
+                Tk, Thunk, false, Werk)) ;
+        }
+        GB_Matrix_free (&Tk) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize the result
+    //--------------------------------------------------------------------------
+
+    if (s != NULL)
+    {
+        // s = accum (s, Z)
+        GB_OK (GB_Scalar_reduce (s, accum, monoid, Z, Werk)) ;
+    }
+    else
+    {
+        // T = [Tiles {:}] ; C<M> = accum (C,T)
+        GB_OK (GB_new_empty (&T, ttype, by_col ? anrows : bncols,
+            by_col ? bncols : anrows, by_col)) ;
+        GB_OK (GB_concat (T, Tiles, (by_row) ? nchunks : 1,
+            (by_row) ? 1 : nchunks, Werk)) ;
+        GB_FREE_WORKSPACE ;
+        GB_OK (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+            Mask_struct, Werk)) ;
+    }
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce_Scalar: reduce a matrix-matrix product to a scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (monoid, T)) where T<M>=A*B, without computing all of
+// T at once.  The input matrices A and B are optionally transposed, as
+// determined by the Descriptor desc.  The result is the same as
+// GrB_mxm (T, M, NULL, semiring, A, B, desc) followed by
+// GrB_reduce (s, accum, monoid, T, NULL), for an initially empty matrix T.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_reduce_Scalar      // s = accum (s, reduce (T<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for results
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce T
+    const GrB_Matrix M_in,          // optional mask for T, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (s) ;
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_NULL (B) ;
+    GB_WHERE4 (s, M_in, A, B,
+        "GxB_mxm_reduce_Scalar (s, accum, monoid, M, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (T)) where T<M>=A*B
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_fused (
+        s, monoid,                  // s and the monoid to reduce T
+        NULL, false, NULL, NULL,    // no select
+        accum,                      // for accum (s,t)
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        semiring,                   // semiring that defines T=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        AxB_method, do_sort,        // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
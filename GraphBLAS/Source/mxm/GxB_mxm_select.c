@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_select: select entries from a matrix-matrix product
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, select (op, T, y)) where T<M>=A*B, without computing all of
+// T at once.  The input matrices A and B are optionally transposed, as
+// determined by the Descriptor desc.  The result is the same as
+// GrB_mxm (T, M, NULL, semiring, A, B, desc) followed by
+// GrB_select (C, M, accum, op, T, y, desc), for an initially empty matrix T,
+// except that T is not transposed by the descriptor for GrB_select.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_select             // C<M> = accum (C, select (A*B))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C and T
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp op,      // operator to select entries of T
+    const GrB_Scalar y,             // scalar y for the select operator
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_NULL (B) ;
+    GB_RETURN_IF_OUTPUT_IS_READONLY (C) ;
+    GB_WHERE5 (C, M_in, A, B, y,
+        "GxB_mxm_select (C, M, accum, semiring, A, B, op, y, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_select") ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, select (T)) where T<M>=A*B
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_fused (
+        NULL, NULL,                 // no reduce
+        C, C_replace, op, y,        // C, its descriptor, and the select op
+        accum,                      // for accum (C,T)
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        semiring,                   // semiring that defines T=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        AxB_method, do_sort,        // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
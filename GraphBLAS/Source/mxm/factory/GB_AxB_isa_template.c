@@ -0,0 +1,211 @@
+//------------------------------------------------------------------------------
+// GB_AxB_isa_template.c: dot2, dot3, and saxpy3 methods for one ISA
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This template is #include'd by a FactoryKernel (GB_AxB__*.c) once for each
+// ISA it is compiled for.  The caller defines GB_TARGET_ISA as GB_TARGET_AVX2
+// or GB_TARGET_AVX512F, and GB_ISA(f) to append the name of the ISA to f.
+// The methods must be compiled here, in a function with the target attribute,
+// and not just inlined into one: the parallel regions inside them are
+// outlined by OpenMP, and they take their ISA from the function that
+// lexically contains them.  The FactoryKernel selects a variant with
+// GB_Global_cpu_isa_get, which is set once by GrB_init.
+
+#ifdef GB_JIT_KERNEL
+#error "the ISA variants are only used in the FactoryKernels"
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Adot2B: C=A'*B, C<M>=A'*B, or C<!M>=A'*B: dot product method, C is bitmap
+//------------------------------------------------------------------------------
+
+GB_TARGET_ISA static GrB_Info GB_ISA (GB_Adot2B)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool A_not_transposed,
+    const GrB_Matrix A, int64_t *restrict A_slice,
+    const GrB_Matrix B, int64_t *restrict B_slice,
+    int nthreads, int naslice, int nbslice
+)
+{
+    #include "mxm/template/GB_AxB_dot2_meta.c"
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Adot3B: C<M>=A'*B: masked dot product, C is sparse or hyper
+//------------------------------------------------------------------------------
+
+GB_TARGET_ISA static GrB_Info GB_ISA (GB_Adot3B)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{
+    #include "mxm/template/GB_AxB_dot3_meta.c"
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_M: C<M>=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+GB_TARGET_ISA static GrB_Info GB_ISA (GB_Asaxpy3B_M)
+(
+    GrB_Matrix C,   // C<M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Werk Werk
+)
+{
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 0
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 0
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_noM: C=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+GB_TARGET_ISA static GrB_Info GB_ISA (GB_Asaxpy3B_noM)
+(
+    GrB_Matrix C,   // C=A*B, C sparse or hypersparse
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Werk Werk
+)
+{
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 1
+        #define GB_MASK_COMP 0
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 1
+        #define GB_MASK_COMP 0
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_notM: C<!M>=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+GB_TARGET_ISA static GrB_Info GB_ISA (GB_Asaxpy3B_notM)
+(
+    GrB_Matrix C,   // C<!M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Werk Werk
+)
+{
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 1
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 1
+        #include "mxm/include/GB_meta16_definitions.h"
+        #include "mxm/template/GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+// the saxpy3 methods leave the sparsity formats of A and B defined
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+#undef GB_B_IS_SPARSE
+#undef GB_B_IS_HYPER
+#undef GB_B_IS_BITMAP
+#undef GB_B_IS_FULL
+
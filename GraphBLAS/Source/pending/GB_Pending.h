@@ -37,6 +37,15 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+GrB_Info GB_Pending_lookup  // find A(i,j) in the pending tuples of A
+(
+    GB_void *ax,            // value of A(i,j), of type A->type, if found
+    bool *found,            // true if (i,j) appears in the pending tuples
+    GrB_Matrix A,           // matrix with pending tuples
+    const int64_t i,        // index into vector
+    const int64_t j         // vector index
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Pending_add:  add an entry C(i,j) to the list of pending tuples
 //------------------------------------------------------------------------------
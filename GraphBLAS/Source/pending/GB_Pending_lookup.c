@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+// GB_Pending_lookup: find A(i,j) in the pending tuples of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Finds the value that GB_wait would give to A(i,j) from the pending tuples of
+// A, without assembling them into A.  If the pending tuples are not yet in
+// sorted order, they are first sorted in place.  The sort is stable, so that
+// duplicates remain in the order in which they were added.  Pending->sorted
+// is then set true, so later lookups take O(log n) time with no sort (unless
+// more tuples are added out of order), and GB_wait need not sort them again.
+
+// If (i,j) appears in the pending tuples, its duplicates are assembled exactly
+// as GB_builder does for GB_wait:  the first tuple is typecast to A->type, and
+// each subsequent one is combined with the result via Pending->op (or the
+// implied SECOND operator if Pending->op is NULL), with typecasting.  The
+// result ax has type A->type.
+
+#include "pending/GB_Pending.h"
+#include "sort/GB_sort.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_MEMORY (&K, K_size) ;           \
+    GB_FREE_MEMORY (&X, X_size) ;           \
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_sort: stable sort of the pending tuples
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_Pending_sort
+(
+    GrB_Matrix A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_Pending Pending = A->Pending ;
+    const int64_t n = Pending->n ;
+    const size_t s = Pending->size ;
+    uint64_t *restrict K = NULL ; size_t K_size = 0 ;
+    GB_void *restrict X = NULL ; size_t X_size = 0 ;
+
+    K = GB_MALLOC_MEMORY (n, sizeof (uint64_t), &K_size) ;
+    if (Pending->x != NULL)
+    {
+        X = GB_MALLOC_MEMORY (Pending->nmax, s, &X_size) ;
+    }
+    if (K == NULL || (Pending->x != NULL && X == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // sort the tuples, using their position k as the last key
+    //--------------------------------------------------------------------------
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        K [k] = k ;
+    }
+
+    if (Pending->j != NULL)
+    {
+        // sort the (j,i,k) tuples
+        GB_OK (GB_msort_3 (Pending->j, A->j_is_32, Pending->i, A->i_is_32,
+            K, false, n, nthreads)) ;
+    }
+    else
+    {
+        // sort the (i,k) tuples of a vector
+        GB_OK (GB_msort_2 (Pending->i, A->i_is_32, K, false, n, nthreads)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // permute the values
+    //--------------------------------------------------------------------------
+
+    if (Pending->x != NULL)
+    {
+        const GB_void *restrict Px = Pending->x ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            memcpy (X + k*s, Px + K [k]*s, s) ;
+        }
+        GB_FREE_MEMORY (&(Pending->x), Pending->x_size) ;
+        Pending->x = X ;
+        Pending->x_size = X_size ;
+        X = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    Pending->sorted = true ;
+    GBURBLE ("(pending sort: %" PRId64 ") ", n) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_lookup
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_lookup  // find A(i,j) in the pending tuples of A
+(
+    GB_void *ax,            // value of A(i,j), of type A->type, if found
+    bool *found,            // true if (i,j) appears in the pending tuples
+    GrB_Matrix A,           // matrix with pending tuples
+    const int64_t i,        // index into vector
+    const int64_t j         // vector index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL && A->Pending != NULL) ;
+    ASSERT (ax != NULL && found != NULL) ;
+    (*found) = false ;
+
+    //--------------------------------------------------------------------------
+    // sort the pending tuples, if needed
+    //--------------------------------------------------------------------------
+
+    GB_Pending Pending = A->Pending ;
+    if (!Pending->sorted)
+    {
+        info = GB_Pending_sort (A) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory; the pending tuples are unchanged
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find the first tuple (i,j) in the sorted list
+    //--------------------------------------------------------------------------
+
+    GB_CPendingi_DECLARE (Pending_i) ; GB_CPendingi_PTR (Pending_i, A) ;
+    GB_CPendingj_DECLARE (Pending_j) ; GB_CPendingj_PTR (Pending_j, A) ;
+    const int64_t n = Pending->n ;
+
+    #define GB_PENDING_J(k) ((Pending_j == NULL) ? 0 : GB_IGET (Pending_j, k))
+    #define GB_PENDING_I(k) (GB_IGET (Pending_i, k))
+
+    int64_t pleft = 0, pright = n ;
+    while (pleft < pright)
+    {
+        int64_t pmiddle = (pleft + pright) / 2 ;
+        int64_t jm = GB_PENDING_J (pmiddle) ;
+        int64_t im = GB_PENDING_I (pmiddle) ;
+        if (jm < j || (jm == j && im < i))
+        {
+            pleft = pmiddle + 1 ;
+        }
+        else
+        {
+            pright = pmiddle ;
+        }
+    }
+
+    #define GB_PENDING_MATCH(k) \
+        ((k) < n && GB_PENDING_J (k) == j && GB_PENDING_I (k) == i)
+
+    if (!GB_PENDING_MATCH (pleft))
+    {
+        // (i,j) is not in the pending tuples
+        return (GrB_SUCCESS) ;
+    }
+    (*found) = true ;
+
+    //--------------------------------------------------------------------------
+    // assemble the duplicates of (i,j), in the order they were added
+    //--------------------------------------------------------------------------
+
+    GrB_Type atype = A->type ;
+    size_t asize = atype->size ;
+    if (A->iso)
+    {
+        // all pending tuples have the iso value of A
+        memcpy (ax, A->x, asize) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Type stype = Pending->type ;
+    size_t ssize = Pending->size ;
+    const GB_void *restrict Px = Pending->x ;
+
+    // ax = (atype) Px [pleft]
+    GB_cast_scalar (ax, atype->code, Px + pleft*ssize, stype->code, ssize) ;
+
+    GrB_BinaryOp op = Pending->op ;
+    bool op_is_2nd = (op == NULL) || GB_op_is_second (op, atype) ;
+    for (int64_t k = pleft + 1 ; GB_PENDING_MATCH (k) ; k++)
+    {
+        const GB_void *sx = Px + k*ssize ;
+        if (op_is_2nd)
+        {
+            // ax = (atype) Px [k]
+            GB_cast_scalar (ax, atype->code, sx, stype->code, ssize) ;
+        }
+        else
+        {
+            // ax = (atype) op ((xtype) ax, (ytype) Px [k])
+            GB_void xwork [GB_VLA(op->xtype->size)] ;
+            GB_void ywork [GB_VLA(op->ytype->size)] ;
+            GB_void zwork [GB_VLA(op->ztype->size)] ;
+            GB_cast_scalar (xwork, op->xtype->code, ax, atype->code, asize) ;
+            GB_cast_scalar (ywork, op->ytype->code, sx, stype->code, ssize) ;
+            op->binop_function (zwork, xwork, ywork) ;
+            GB_cast_scalar (ax, atype->code, zwork, op->ztype->code,
+                op->ztype->size) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
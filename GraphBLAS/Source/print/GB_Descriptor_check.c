@@ -160,6 +160,11 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("    d.compression = %d\n", D->compression) ;
     }
 
+    if (D->build_sorted)
+    { 
+        GBPR0 ("    d.build_sorted = true\n") ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
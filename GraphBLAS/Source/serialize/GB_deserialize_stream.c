@@ -0,0 +1,636 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: decompress and deserialize a blob from a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GB_deserialize, except that the blob is not held in memory.
+// Instead, it is read in order from a stream, via a user-provided
+// read_function.  The header and the sizes of all compressed blocks are read
+// first.  Each array (Cp, Ch, Cb, Ci, and Cx) is then allocated at its final
+// size, and its compressed blocks are read in batches and decompressed in
+// parallel directly into it.  An uncompressed array is read directly into its
+// final location.  Only one batch of compressed blocks is held in memory at
+// any one time, so the peak memory usage is the size of the matrix plus the
+// size of one batch, instead of the size of the matrix plus the size of the
+// whole blob.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#include "serialize/GB_serialize.h"
+#include "lz4_wrapper/GB_lz4.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+// target size of a batch of compressed blocks.  A batch holds at least one
+// block per thread, so it may exceed this size if the blocks are large.
+#define GB_STREAM_BATCH (64 * 1024 * 1024)
+
+//------------------------------------------------------------------------------
+// GB_stream_read: read exactly n bytes from the stream
+//------------------------------------------------------------------------------
+
+static bool GB_stream_read          // true if successful
+(
+    GB_void *buffer,                // output buffer of size n
+    size_t n,                       // # of bytes to read
+    GxB_read_function read_function,
+    void *stream,
+    size_t *s_handle                // # of bytes read so far from the stream
+)
+{
+    // the read_function may return fewer bytes than requested (as read(2)
+    // does), so keep reading until all n bytes are read or the stream ends
+    size_t k = 0 ;
+    while (k < n)
+    {
+        size_t r = read_function (buffer + k, n - k, stream) ;
+        if (r == 0 || r > n - k)
+        {
+            // end of stream, or the read_function is broken
+            return (false) ;
+        }
+        k += r ;
+    }
+    (*s_handle) += n ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_from_stream: uncompress a set of blocks from the stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_MEMORY (&X, X_size) ;           \
+}
+
+static GrB_Info GB_deserialize_from_stream
+(
+    // output:
+    GB_void **X_handle,         // uncompressed output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    int64_t X_len,              // size of X in bytes
+    GxB_read_function read_function,
+    void *stream,
+    uint64_t blob_size,         // size of the whole blob
+    uint64_t *Sblocks,          // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    // workspace:
+    GB_void **Buf_handle,       // buffer for a batch of compressed blocks
+    size_t *Buf_size_handle,    // size of Buf as allocated
+    // input/output:
+    size_t *s_handle            // # of bytes read so far from the stream
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (X_handle != NULL) ;
+    ASSERT (X_size_handle != NULL) ;
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+    size_t s = (*s_handle) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+
+    //--------------------------------------------------------------------------
+    // check the compressed block sizes
+    //--------------------------------------------------------------------------
+
+    // The blocks must be non-empty and each must fit in an int32_t.  All of
+    // the blocks must fit in what is left of the blob.  This ensures the
+    // batches read below are bounded by the blob_size of the header.
+
+    for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+    {
+        uint64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+        uint64_t s_end   = Sblocks [blockid] ;
+        if (s_start >= s_end || s_end - s_start > INT32_MAX
+            || s_end > blob_size - s)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output array
+    //--------------------------------------------------------------------------
+
+    size_t X_size = 0 ;
+    GB_void *X = NULL ;
+    if (nblocks == 0)
+    {
+        // allocate an "empty" block (of 8 bytes) and set it zero
+        X = GB_CALLOC_MEMORY (X_len, sizeof (GB_void), &X_size) ;
+    }
+    else
+    {
+        // allocate a block that is filled below
+        X = GB_MALLOC_MEMORY (X_len, sizeof (GB_void), &X_size) ;
+    }
+
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress the blocks from the stream
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+
+    if (nblocks == 0)
+    {
+
+        // nothing else to do for this array
+        ;
+
+    }
+    else if (algo == GxB_COMPRESSION_NONE)
+    {
+
+        //----------------------------------------------------------------------
+        // no compression; read the single block directly into X
+        //----------------------------------------------------------------------
+
+        ok = (nblocks == 1 && Sblocks [0] == X_len) &&
+            GB_stream_read (X, X_len, read_function, stream, &s) ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // LZ4, LZ4HC, or ZSTD compression
+        //----------------------------------------------------------------------
+
+        int32_t b1, b2 ;
+        for (b1 = 0 ; ok && b1 < nblocks ; b1 = b2)
+        {
+
+            //------------------------------------------------------------------
+            // determine the next batch of blocks, b1 to b2-1
+            //------------------------------------------------------------------
+
+            uint64_t s0 = (b1 == 0) ? 0 : Sblocks [b1-1] ;
+            b2 = b1 + 1 ;
+            while (b2 < nblocks && ((b2 - b1) < nthreads_max ||
+                   Sblocks [b2] - s0 <= GB_STREAM_BATCH))
+            {
+                b2++ ;
+            }
+            size_t batch_size = Sblocks [b2-1] - s0 ;
+
+            //------------------------------------------------------------------
+            // read the compressed blocks of the batch into the buffer
+            //------------------------------------------------------------------
+
+            if (batch_size > (*Buf_size_handle))
+            {
+                GB_FREE_MEMORY (Buf_handle, (*Buf_size_handle)) ;
+                (*Buf_handle) = GB_MALLOC_MEMORY (batch_size, sizeof (GB_void),
+                    Buf_size_handle) ;
+                if ((*Buf_handle) == NULL)
+                {
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+            }
+            GB_void *Buf = (*Buf_handle) ;
+            if (!GB_stream_read (Buf, batch_size, read_function, stream, &s))
+            {
+                // blob is invalid: stream is truncated
+                ok = false ;
+                break ;
+            }
+
+            //------------------------------------------------------------------
+            // decompress the batch in parallel
+            //------------------------------------------------------------------
+
+            int nthreads = GB_IMIN (nthreads_max, b2 - b1) ;
+            int32_t blockid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+                reduction(&&:ok)
+            for (blockid = b1 ; blockid < b2 ; blockid++)
+            {
+                // get the start and end of the compressed and uncompressed
+                // blocks; the compressed block sizes are already checked
+                int64_t kstart, kend ;
+                GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+                int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+                int64_t s_end   = Sblocks [blockid] ;
+                size_t  s_size  = s_end - s_start ;
+                size_t  d_size  = kend - kstart ;
+                if (kstart < 0 || kend < 0 || kstart >= kend ||
+                    kstart > X_len || kend > X_len || d_size > INT32_MAX)
+                {
+                    // blob is invalid
+                    ok = false ;
+                }
+                else
+                {
+                    // uncompress the compressed block of size s_size from
+                    // Buf [s_start-s0:s_end-s0-1] into X [kstart:kend-1]
+                    const char *src = (const char *) (Buf + (s_start - s0)) ;
+                    char *dst = (char *) (X + kstart) ;
+                    if (algo == GxB_COMPRESSION_ZSTD)
+                    {
+                        // ZSTD
+                        size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                        if (u != d_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                    else
+                    {
+                        // LZ4 or LZ4HC
+                        int src_size = (int) s_size ;
+                        int dst_size = (int) d_size ;
+                        int u = LZ4_decompress_safe (src, dst, src_size,
+                            dst_size) ;
+                        if (u != dst_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        // decompression failure or truncated stream; blob is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result: X, its size, and updated # of bytes read
+    //--------------------------------------------------------------------------
+
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    (*s_handle) = s ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: deserialize a matrix from a stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_WORKSPACE
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_MEMORY (&Sblocks, Sblocks_size) ;  \
+    GB_FREE_MEMORY (&Buf, Buf_size) ;       \
+}
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_Matrix_free (&C) ;                   \
+}
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_read_function read_function,    // reads the next bytes of the blob
+    void *stream                    // passed to read_function
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (read_function != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    uint64_t *Sblocks = NULL ; size_t Sblocks_size = 0 ;
+    GB_void *Buf = NULL ; size_t Buf_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the header (160 bytes) from the stream
+    //--------------------------------------------------------------------------
+
+    GB_void blob [GB_BLOB_HEADER_SIZE] ;
+    size_t nread = 0 ;
+    if (!GB_stream_read (blob, GB_BLOB_HEADER_SIZE, read_function, stream,
+        &nread))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse the header
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+    GB_BLOB_READ (blob_size, uint64_t) ;
+    GB_BLOB_READ (encoding, uint32_t) ;
+    uint32_t Cp_is_32 = GB_RSHIFT (encoding, 12, 4) ; // C->p_is_32
+    uint32_t Cj_is_32 = GB_RSHIFT (encoding,  8, 4) ; // C->j_is_32
+    uint32_t Ci_is_32 = GB_RSHIFT (encoding,  4, 4) ; // C->i_is_32
+    uint32_t typecode = GB_RSHIFT (encoding,  0, 4) ; // 4 bit typecode
+
+    if (blob_size < GB_BLOB_HEADER_SIZE
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN)
+        || (Cp_is_32 > 1) || (Cj_is_32 > 1) || (Ci_is_32 > 1))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (control_encoding, uint32_t) ;
+
+    uint32_t p_encoding = GB_RSHIFT (control_encoding, 16, 4) ;
+    uint32_t j_encoding = GB_RSHIFT (control_encoding, 12, 4) ;
+    uint32_t i_encoding = GB_RSHIFT (control_encoding,  8, 4) ;
+    int8_t p_control = GB_pji_control_decoding (p_encoding) ;
+    int8_t j_control = GB_pji_control_decoding (j_encoding) ;
+    int8_t i_control = GB_pji_control_decoding (i_encoding) ;
+    uint32_t sparsity_control = GB_RSHIFT (control_encoding,  0, 8) ;
+
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // blob is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        char type_name [GxB_MAX_NAME_LEN] ;
+        if (!GB_stream_read ((GB_void *) type_name, GxB_MAX_NAME_LEN,
+            read_function, stream, &nread))
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (strncmp (type_name, ctype->name, GxB_MAX_NAME_LEN) != 0)
+        {
+            // blob is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        // blob is invalid
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the compressed block sizes for each array
+    //--------------------------------------------------------------------------
+
+    if (Cp_nblocks < 0 || Ch_nblocks < 0 || Cb_nblocks < 0 || Ci_nblocks < 0
+        || Cx_nblocks < 0)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    uint64_t nblocks = (uint64_t) Cp_nblocks + (uint64_t) Ch_nblocks
+        + (uint64_t) Cb_nblocks + (uint64_t) Ci_nblocks + (uint64_t) Cx_nblocks;
+    if (nblocks > (blob_size - nread) / sizeof (uint64_t))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    Sblocks = GB_MALLOC_MEMORY (nblocks + 1, sizeof (uint64_t), &Sblocks_size) ;
+    if (Sblocks == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (!GB_stream_read ((GB_void *) Sblocks, nblocks * sizeof (uint64_t),
+        read_function, stream, &nread))
+    {
+        // blob is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    uint64_t *Cp_Sblocks = Sblocks ;
+    uint64_t *Ch_Sblocks = Cp_Sblocks + Cp_nblocks ;
+    uint64_t *Cb_Sblocks = Ch_Sblocks + Ch_nblocks ;
+    uint64_t *Ci_Sblocks = Cb_Sblocks + Cb_nblocks ;
+    uint64_t *Cx_Sblocks = Ci_Sblocks + Ci_nblocks ;
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    // allocate the matrix with info from the header
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, vdim, GB_ph_null, is_csc,
+        sparsity, hyper_switch, nvec, Cp_is_32, Cj_is_32, Ci_is_32)) ;
+
+    C->nvec = nvec ;
+    GB_nvec_nonempty_set (C, nvec_nonempty) ;
+    C->nvals = nvals ;      // revised below if version <= 7.2.0
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+    C->p_is_32 = Cp_is_32 ;
+    C->j_is_32 = Cj_is_32 ;
+    C->i_is_32 = Ci_is_32 ;
+    C->p_control = p_control ;
+    C->j_control = j_control ;
+    C->i_control = i_control ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    // The arrays appear in the blob in the same order as they are written by
+    // GB_serialize, so the stream is read in a single pass.
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+
+            // decompress Cp, Ch, and Ci
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->p),
+                &(C->p_size), Cp_len, read_function, stream, blob_size,
+                Cp_Sblocks, Cp_nblocks, Cp_method, &Buf, &Buf_size, &nread)) ;
+
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->h),
+                &(C->h_size), Ch_len, read_function, stream, blob_size,
+                Ch_Sblocks, Ch_nblocks, Ch_method, &Buf, &Buf_size, &nread)) ;
+
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->i),
+                &(C->i_size), Ci_len, read_function, stream, blob_size,
+                Ci_Sblocks, Ci_nblocks, Ci_method, &Buf, &Buf_size, &nread)) ;
+            break ;
+
+        case GxB_SPARSE :
+
+            // decompress Cp and Ci
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->p),
+                &(C->p_size), Cp_len, read_function, stream, blob_size,
+                Cp_Sblocks, Cp_nblocks, Cp_method, &Buf, &Buf_size, &nread)) ;
+
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->i),
+                &(C->i_size), Ci_len, read_function, stream, blob_size,
+                Ci_Sblocks, Ci_nblocks, Ci_method, &Buf, &Buf_size, &nread)) ;
+            break ;
+
+        case GxB_BITMAP :
+
+            // decompress Cb
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->b),
+                &(C->b_size), Cb_len, read_function, stream, blob_size,
+                Cb_Sblocks, Cb_nblocks, Cb_method, &Buf, &Buf_size, &nread)) ;
+            break ;
+
+        case GxB_FULL :
+            break ;
+        default: ;
+    }
+
+    // decompress Cx
+    GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->x), &(C->x_size),
+        Cx_len, read_function, stream, blob_size, Cx_Sblocks, Cx_nblocks,
+        Cx_method, &Buf, &Buf_size, &nread)) ;
+
+    if (C->p != NULL && version <= GxB_VERSION (7,2,0))
+    {
+        // C is sparse or hypersparse, from a blob written by v7.2.0 or
+        // earlier, which had nvals of zero for sparse and hypersparse
+        // matrices (see GB_deserialize).
+        const uint64_t *restrict Cp = C->p ; // OK; v7.2.0 only had 64-bit Cp
+        C->nvals = Cp [C->nvec] ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // get the GrB_NAME from the rest of the blob
+    //--------------------------------------------------------------------------
+
+    // v8.1.0 adds two nul-terminated uncompressed strings to the end of the
+    // blob: the user name and the element type name.  These are short, and
+    // are read in a single piece, reusing the Buf workspace.
+
+    size_t rest = blob_size - nread ;
+    if (version >= GxB_VERSION (8,1,0) && rest > 0 && rest <= GB_STREAM_BATCH)
+    {
+        if (rest > Buf_size)
+        {
+            GB_FREE_MEMORY (&Buf, Buf_size) ;
+            Buf = GB_MALLOC_MEMORY (rest, sizeof (GB_void), &Buf_size) ;
+            if (Buf == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+        if (!GB_stream_read (Buf, rest, read_function, stream, &nread))
+        {
+            // blob is invalid: stream is truncated
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        // look for the two nul bytes in Buf [0 : rest-1]
+        int nfound = 0 ;
+        for (size_t p = 0 ; p < rest && nfound < 2 ; p++)
+        {
+            if (Buf [p] == 0)
+            {
+                nfound++ ;
+            }
+        }
+
+        if (nfound == 2)
+        {
+            // extract the GrB_NAME from the blob;
+            // GrB_EL_TYPE_STRING not needed
+            GB_OK (GB_matvec_name_set (C, (char *) Buf, GrB_NAME)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize_stream", GB0) ;
+    return (GrB_SUCCESS) ;
+}
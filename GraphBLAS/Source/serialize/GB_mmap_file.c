@@ -0,0 +1,145 @@
+//------------------------------------------------------------------------------
+// GB_mmap_file: portable read-only memory map of a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_mmap_file maps an entire file into memory, read-only and shared, so that
+// all processes that map the same file share its pages in the page cache.
+// GB_munmap_file unmaps it.
+
+// Windows references:
+// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-createfilemappinga
+// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+
+#include "GB.h"
+#include "jitifyer/GB_file.h"
+#include "serialize/GB_serialize.h"
+
+#if GB_WINDOWS
+
+    // Windows
+    #include <windows.h>
+
+#else
+
+    // POSIX
+    #include <fcntl.h>
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_mmap_file: map a file into memory, read-only
+//------------------------------------------------------------------------------
+
+// Returns true if successful, false on error
+
+bool GB_mmap_file                   // map a file into memory, read-only
+(
+    const char *filename,           // file to map
+    void **map_handle,              // the memory-mapped file
+    size_t *map_size_handle         // size of the map (the file size)
+)
+{
+
+    (*map_handle) = NULL ;
+    (*map_size_handle) = 0 ;
+    void *map = NULL ;
+    size_t map_size = 0 ;
+
+    #if GB_WINDOWS
+    {
+        // Windows
+        HANDLE file = CreateFileA (filename, GENERIC_READ, FILE_SHARE_READ,
+            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL) ;
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return (false) ;
+        }
+        LARGE_INTEGER file_size ;
+        if (!GetFileSizeEx (file, &file_size) || file_size.QuadPart <= 0)
+        {
+            CloseHandle (file) ;
+            return (false) ;
+        }
+        map_size = (size_t) file_size.QuadPart ;
+        HANDLE mapping = CreateFileMappingA (file, NULL, PAGE_READONLY, 0, 0,
+            NULL) ;
+        CloseHandle (file) ;
+        if (mapping == NULL)
+        {
+            return (false) ;
+        }
+        // the view keeps the mapping alive after its handle is closed
+        map = MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0) ;
+        CloseHandle (mapping) ;
+        if (map == NULL)
+        {
+            return (false) ;
+        }
+    }
+    #else
+    {
+        // POSIX
+        int fd = open (filename, O_RDONLY) ;
+        if (fd == -1)
+        {
+            return (false) ;
+        }
+        struct stat st ;
+        if (fstat (fd, &st) != 0 || st.st_size <= 0)
+        {
+            close (fd) ;
+            return (false) ;
+        }
+        map_size = (size_t) st.st_size ;
+        // the map keeps the file open after fd is closed
+        map = mmap (NULL, map_size, PROT_READ, MAP_SHARED, fd, 0) ;
+        close (fd) ;
+        if (map == MAP_FAILED)
+        {
+            return (false) ;
+        }
+    }
+    #endif
+
+    (*map_handle) = map ;
+    (*map_size_handle) = map_size ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_munmap_file: unmap a file mapped by GB_mmap_file
+//------------------------------------------------------------------------------
+
+void GB_munmap_file                 // unmap a file mapped by GB_mmap_file
+(
+    void *map,                      // the memory-mapped file
+    size_t map_size                 // size of the map
+)
+{
+
+    if (map == NULL)
+    {
+        return ;
+    }
+
+    #if GB_WINDOWS
+    {
+        // Windows
+        UnmapViewOfFile (map) ;
+    }
+    #else
+    {
+        // POSIX
+        munmap (map, map_size) ;
+    }
+    #endif
+}
@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+// GB_mmap_load: load a read-only matrix from a memory-mapped file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file written by GB_mmap_save is mapped into memory, and its arrays are
+// loaded into a GxB_Container as read-only components, with no copy.  The
+// matrix A is then loaded from the Container, so A->[phbix] point directly
+// into the mapped file.  This takes O(1) time, unless fast_import is false,
+// in which case the content of A is also checked exhaustively.
+
+// The map is returned to the caller, who must free the matrix A before
+// unmapping the file.
+
+#include "container/GB_container.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GxB_Container_free (&Container) ;       \
+    if (A_loaded) GB_phybix_free (A) ;      \
+    GB_munmap_file (map, map_size) ;        \
+}
+
+GrB_Info GB_mmap_load               // load a matrix from a memory-mapped file
+(
+    // input/output:
+    GrB_Matrix A,                   // matrix to load; prior content freed
+    // output:
+    void **map_handle,              // the memory-mapped file
+    size_t *map_size_handle,        // size of the map
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename,           // file to map
+    bool fast_import,               // if false, check the matrix fully
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for mmap load", GB0) ;
+    (*map_handle) = NULL ;
+    (*map_size_handle) = 0 ;
+    GxB_Container Container = NULL ;
+    bool A_loaded = false ;
+
+    //--------------------------------------------------------------------------
+    // map the file
+    //--------------------------------------------------------------------------
+
+    void *map = NULL ;
+    size_t map_size = 0 ;
+    if (!GB_mmap_file (filename, &map, &map_size))
+    {
+        // file does not exist or cannot be mapped
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the header
+    //--------------------------------------------------------------------------
+
+    GB_mmap_header header ;
+    if (map_size < sizeof (GB_mmap_header))
+    {
+        // file is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    memcpy (&header, map, sizeof (GB_mmap_header)) ;
+
+    int format = header.format ;
+    if (memcmp (header.magic, GB_MMAP_MAGIC, 8) != 0
+        || header.version != GB_MMAP_VERSION
+        || header.typecode < GB_BOOL_code || header.typecode > GB_UDT_code
+        || !(format == GxB_HYPERSPARSE || format == GxB_SPARSE ||
+             format == GxB_BITMAP || format == GxB_FULL)
+        || !(header.orientation == GrB_ROWMAJOR ||
+             header.orientation == GrB_COLMAJOR)
+        || header.nrows > GB_NMAX || header.ncols > GB_NMAX
+        || header.nvals > GB_NMAX)
+    {
+        // file is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) header.typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size and name
+    if (ctype == NULL || ctype->size != header.typesize
+        || (ccode == GB_UDT_code && strncmp (header.type_name, ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        || (ccode != GB_UDT_code && type_expected != NULL &&
+            ctype != type_expected))
+    {
+        // file is invalid; type is missing or does not match
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the position and size of each array in the file
+    //--------------------------------------------------------------------------
+
+    GrB_Type etype [5] ;
+    etype [0] = (header.p_is_32) ? GrB_UINT32 : GrB_UINT64 ;
+    etype [1] = (header.j_is_32) ? GrB_UINT32 : GrB_UINT64 ;
+    etype [2] = GrB_INT8 ;
+    etype [3] = (header.i_is_32) ? GrB_UINT32 : GrB_UINT64 ;
+    etype [4] = ctype ;
+
+    bool present [5] ;
+    bool sparse_or_hyper = (format == GxB_SPARSE || format == GxB_HYPERSPARSE);
+    present [0] = sparse_or_hyper ;
+    present [1] = (format == GxB_HYPERSPARSE) ;
+    present [2] = (format == GxB_BITMAP) ;
+    present [3] = sparse_or_hyper ;
+    present [4] = true ;
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (!present [k]) continue ;
+        uint64_t offset = header.offset [k] ;
+        uint64_t size = header.size [k] ;
+        if (offset < sizeof (GB_mmap_header) || offset % GB_MMAP_ALIGN != 0
+            || offset > map_size || size > map_size - offset
+            || header.len [k] > size / etype [k]->size)
+        {
+            // file is invalid; the array is not inside the file
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // load the arrays into a Container, as read-only components
+    //--------------------------------------------------------------------------
+
+    GB_OK (GxB_Container_new (&Container)) ;
+    Container->nrows = header.nrows ;
+    Container->ncols = header.ncols ;
+    Container->nrows_nonempty = header.nrows_nonempty ;
+    Container->ncols_nonempty = header.ncols_nonempty ;
+    Container->nvals = header.nvals ;
+    Container->format = format ;
+    Container->orientation = header.orientation ;
+    Container->iso = header.iso ;
+    Container->jumbled = false ;
+
+    GrB_Vector component [5] = { Container->p, Container->h, Container->b,
+        Container->i, Container->x } ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (!present [k]) continue ;
+        void *X = ((GB_void *) map) + header.offset [k] ;
+        GB_vector_load (component [k], &X, etype [k], header.len [k],
+            header.size [k], true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the matrix A from the Container
+    //--------------------------------------------------------------------------
+
+    // The Container does its own basic checks, in O(1) time.
+    A_loaded = true ;
+    GB_OK (GB_load_from_container (A, Container, Werk)) ;
+    GxB_Container_free (&Container) ;
+
+    if (!fast_import)
+    {
+        // the file may not be trusted; check the content exhaustively
+        GBURBLE ("(secure mmap) ") ;
+        GB_OK (GB_matvec_check (A, "secure mmap", GxB_SILENT, NULL, "")) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(mmap load: %g MB) ", ((double) map_size) / 1e6) ;
+    ASSERT_MATRIX_OK (A, "A loaded from mmap", GB0) ;
+    (*map_handle) = map ;
+    (*map_size_handle) = map_size ;
+    return (GrB_SUCCESS) ;
+}
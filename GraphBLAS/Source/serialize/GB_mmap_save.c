@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// GB_mmap_save: write a matrix to a file that can be loaded with mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is written uncompressed, with each of its arrays starting at a
+// multiple of GB_MMAP_ALIGN bytes (see GB_serialize.h).  The arrays are
+// written directly from the matrix, with no intermediate copy.  Any pending
+// work on the matrix is finished first, including sorting any jumbled vectors,
+// since a read-only matrix cannot be jumbled.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_mmap_write: write n bytes to the file, and pad with zeros to size
+//------------------------------------------------------------------------------
+
+static bool GB_mmap_write       // true if successful
+(
+    FILE *fp,                   // file to write to
+    const void *X,              // array to write, of size n (may be NULL)
+    size_t n,                   // # of bytes of X to write
+    size_t size                 // total # of bytes to write (size >= n)
+)
+{
+    static const GB_void zeros [4096] = { 0 } ;
+    if (n > 0 && fwrite (X, 1, n, fp) != n)
+    {
+        return (false) ;
+    }
+    for (size_t k = n ; k < size ; k += sizeof (zeros))
+    {
+        size_t nz = GB_IMIN (sizeof (zeros), size - k) ;
+        if (fwrite (zeros, 1, nz, fp) != nz)
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_save
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mmap_save               // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    GrB_Matrix A,                   // matrix to write
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for mmap save", GB0) ;
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // construct the header
+    //--------------------------------------------------------------------------
+
+    GB_mmap_header header ;
+    memset (&header, 0, sizeof (GB_mmap_header)) ;
+    strncpy (header.magic, GB_MMAP_MAGIC, 7) ;
+    header.version = GB_MMAP_VERSION ;
+    header.typecode = (int32_t) A->type->code ;
+    header.typesize = (uint64_t) A->type->size ;
+    if (A->type->code == GB_UDT_code)
+    {
+        strncpy (header.type_name, A->type->name, GxB_MAX_NAME_LEN-1) ;
+    }
+
+    bool is_csc = A->is_csc ;
+    int64_t nvec_nonempty = GB_nvec_nonempty_get (A) ;
+    header.nrows = (is_csc) ? A->vlen : A->vdim ;
+    header.ncols = (is_csc) ? A->vdim : A->vlen ;
+    header.nvals = GB_nnz (A) ;
+    header.nrows_nonempty = (is_csc) ? -1 : nvec_nonempty ;
+    header.ncols_nonempty = (is_csc) ? nvec_nonempty : -1 ;
+    header.format = GB_sparsity (A) ;
+    header.orientation = (is_csc) ? GrB_COLMAJOR : GrB_ROWMAJOR ;
+    header.iso = A->iso ;
+    header.p_is_32 = A->p_is_32 ;
+    header.j_is_32 = A->j_is_32 ;
+    header.i_is_32 = A->i_is_32 ;
+
+    //--------------------------------------------------------------------------
+    // determine the layout of the A->[phbix] arrays in the file
+    //--------------------------------------------------------------------------
+
+    // Each array present in the matrix is given at least 8 bytes in the file,
+    // so that it is never mapped as a NULL pointer, even if it is empty.
+
+    const void *X [5] = { A->p, A->h, A->b, A->i, A->x } ;
+    size_t esize [5] ;
+    esize [0] = (A->p_is_32) ? sizeof (uint32_t) : sizeof (uint64_t) ;
+    esize [1] = (A->j_is_32) ? sizeof (uint32_t) : sizeof (uint64_t) ;
+    esize [2] = sizeof (int8_t) ;
+    esize [3] = (A->i_is_32) ? sizeof (uint32_t) : sizeof (uint64_t) ;
+    esize [4] = A->type->size ;
+
+    bool present [5] ;
+    int sparsity = header.format ;
+    bool sparse_or_hyper = (sparsity == GxB_SPARSE ||
+        sparsity == GxB_HYPERSPARSE) ;
+    present [0] = sparse_or_hyper ;
+    present [1] = (sparsity == GxB_HYPERSPARSE) ;
+    present [2] = (sparsity == GxB_BITMAP) ;
+    present [3] = sparse_or_hyper ;
+    present [4] = true ;
+
+    header.len [0] = (sparse_or_hyper) ? (A->nvec + 1) : 0 ;
+    header.len [1] = (sparsity == GxB_HYPERSPARSE) ? A->nvec : 0 ;
+    header.len [2] = (sparsity == GxB_BITMAP) ? GB_nnz_held (A) : 0 ;
+    header.len [3] = (sparse_or_hyper) ? GB_nnz (A) : 0 ;
+    header.len [4] = (A->iso) ? 1 : GB_nnz_held (A) ;
+
+    uint64_t offset = GB_MMAP_ALIGN ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (!present [k]) continue ;
+        header.size [k] = GB_IMAX (header.len [k] * esize [k], 8) ;
+        header.offset [k] = offset ;
+        offset += header.size [k] ;
+        offset = GB_MMAP_ALIGN * GB_ICEIL (offset, GB_MMAP_ALIGN) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and the arrays to the file
+    //--------------------------------------------------------------------------
+
+    FILE *fp = fopen (filename, "wb") ;
+    if (fp == NULL)
+    {
+        // unable to create the file
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    bool ok = GB_mmap_write (fp, &header, sizeof (GB_mmap_header),
+        sizeof (GB_mmap_header)) ;
+    uint64_t s = sizeof (GB_mmap_header) ;
+    for (int k = 0 ; ok && k < 5 ; k++)
+    {
+        if (!present [k]) continue ;
+        // pad with zeros to the start of A->[phbix], then write it
+        ok = GB_mmap_write (fp, NULL, 0, header.offset [k] - s) &&
+             GB_mmap_write (fp, X [k], header.len [k] * esize [k],
+                header.size [k]) ;
+        s = header.offset [k] + header.size [k] ;
+    }
+
+    if (fclose (fp) != 0 || !ok)
+    {
+        // unable to write the file; remove what was written
+        remove (filename) ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    GBURBLE ("(mmap save: %g MB) ", ((double) s) / 1e6) ;
+    return (GrB_SUCCESS) ;
+}
@@ -40,6 +40,16 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     size_t blob_size                // size of the blob
 ) ;
 
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_read_function read_function,    // reads the next bytes of the blob
+    void *stream                    // passed to read_function
+) ;
+
 typedef struct
 {
     void *p ;                   // pointer to the compressed block
@@ -137,6 +147,79 @@ GrB_Info GB_deserialize_from_blob
     uint64_t *S = (uint64_t *) (blob + s) ;                                 \
     s += n * sizeof (uint64_t) ;
 
+//------------------------------------------------------------------------------
+// memory-mapped matrix files, for GxB_Matrix_mmap_save and GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// The file starts with a GB_mmap_header, followed by the uncompressed A->p,
+// A->h, A->b, A->i, and A->x arrays, in that order, exactly as they appear in
+// memory.  Each array starts at a multiple of GB_MMAP_ALIGN bytes, which is a
+// multiple of the page size of all supported systems, so that the file can be
+// mapped into memory and each array used in place.  Integers are held in the
+// native byte order of the system that wrote the file.
+
+#define GB_MMAP_MAGIC   "GrBmmap"
+#define GB_MMAP_VERSION 1
+#define GB_MMAP_ALIGN   (64 * 1024)
+
+typedef struct
+{
+    char magic [8] ;            // GB_MMAP_MAGIC, nul-terminated
+    int32_t version ;           // GB_MMAP_VERSION
+    int32_t typecode ;          // type code of the matrix
+    uint64_t typesize ;         // size of the type of the matrix
+    char type_name [GxB_MAX_NAME_LEN] ; // name of the type, if user-defined
+    uint64_t nrows ;            // # of rows of the matrix
+    uint64_t ncols ;            // # of columns of the matrix
+    uint64_t nvals ;            // # of entries in the matrix
+    int64_t nrows_nonempty ;    // # of non-empty rows, or -1 if unknown
+    int64_t ncols_nonempty ;    // # of non-empty columns, or -1 if unknown
+    int32_t format ;            // hypersparse, sparse, bitmap, or full
+    int32_t orientation ;       // GrB_ROWMAJOR or GrB_COLMAJOR
+    int32_t iso ;               // true if the matrix is iso
+    int32_t p_is_32 ;           // true if A->p is 32-bit
+    int32_t j_is_32 ;           // true if A->h is 32-bit
+    int32_t i_is_32 ;           // true if A->i is 32-bit
+    uint64_t len [5] ;          // # of entries in A->[phbix]
+    uint64_t size [5] ;         // size of A->[phbix] in the file, in bytes
+    uint64_t offset [5] ;       // position of A->[phbix] in the file
+}
+GB_mmap_header ;
+
+GrB_Info GB_mmap_save               // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    GrB_Matrix A,                   // matrix to write
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mmap_load               // load a matrix from a memory-mapped file
+(
+    // input/output:
+    GrB_Matrix A,                   // matrix to load; prior content freed
+    // output:
+    void **map_handle,              // the memory-mapped file
+    size_t *map_size_handle,        // size of the map
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename,           // file to map
+    bool fast_import,               // if false, check the matrix fully
+    GB_Werk Werk
+) ;
+
+bool GB_mmap_file                   // map a file into memory, read-only
+(
+    const char *filename,           // file to map
+    void **map_handle,              // the memory-mapped file
+    size_t *map_size_handle         // size of the map (the file size)
+) ;
+
+void GB_munmap_file                 // unmap a file mapped by GB_mmap_file
+(
+    void *map,                      // the memory-mapped file
+    size_t map_size                 // size of the map
+) ;
+
 static inline uint32_t GB_pji_control_encoding (int8_t control)
 {
     switch (control)
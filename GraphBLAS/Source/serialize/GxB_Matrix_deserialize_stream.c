@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a stream of bytes
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a blob read from a stream
+
+// Identical to GxB_Matrix_deserialize, except that the blob is read in order
+// by the read_function, and is never held in memory all at once.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    GxB_read_function read_function,    // reads the next bytes of the blob
+    void *stream,       // passed to the read_function
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_CHECK_INIT ;
+    GB_RETURN_IF_NULL (read_function) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+
+    GrB_Info info ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_stream (C, type, read_function, stream) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
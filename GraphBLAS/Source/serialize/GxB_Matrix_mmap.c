@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap: load a read-only matrix from a memory-mapped file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file written by GxB_Matrix_mmap_save is mapped into memory read-only,
+// and the matrix A is loaded from it with no copy, in O(1) time.  All of the
+// arrays of A are read-only, in the same way as arrays loaded into a
+// GxB_Container with GxB_Vector_load and the GxB_IS_READONLY option.  A can be
+// used as an input to any method, but it cannot be modified.  Processes that
+// map the same file share its pages in the page cache.
+
+// Any prior content of A is freed, but its name and controls are preserved.
+// The map is owned by the user application.  The matrix A must be freed (or
+// its content replaced) before the map is released with GxB_munmap.
+
+// If the descriptor sets GxB_IMPORT to GxB_SECURE_IMPORT, the content of A is
+// also checked exhaustively, in case the file comes from an untrusted source.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_mmap        // load a read-only matrix from a mapped file
+(
+    // input/output:
+    GrB_Matrix A,               // matrix to load; any prior content is freed
+    // output:
+    void **map,                 // the memory-mapped file
+    uint64_t *map_size,         // size of the map
+    // input:
+    GrB_Type type,              // type of A.  Required if the file holds a
+                                // matrix of user-defined type.  May be NULL
+                                // if the file holds a built-in type; otherwise
+                                // must match the type of the matrix in the
+                                // file.
+    const char *filename,       // file written by GxB_Matrix_mmap_save
+    const GrB_Descriptor desc   // for GxB_IMPORT (fast or secure)
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (map) ;
+    GB_RETURN_IF_NULL (map_size) ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_WHERE_1 (A, "GxB_Matrix_mmap (A, &map, &map_size, type, filename, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap") ;
+
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+
+    //--------------------------------------------------------------------------
+    // map the file and load the matrix
+    //--------------------------------------------------------------------------
+
+    size_t size = 0 ;
+    info = GB_mmap_load (A, map, &size, type, filename, fast_import, Werk) ;
+    (*map_size) = (uint64_t) size ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap_save: write a matrix to a file for GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is written to the file uncompressed, with each of its arrays
+// aligned to a page boundary, so that GxB_Matrix_mmap can load it in O(1)
+// time by mapping the file into memory.  Example usage:
+
+/*
+    GrB_Matrix A, B ;
+    void *map ;
+    uint64_t map_size ;
+    // construct a matrix A, then save it:
+    GxB_Matrix_mmap_save ("A.grb", A, NULL) ;
+    // later, possibly in another process:
+    GrB_Matrix_new (&B, GrB_BOOL, 0, 0) ;
+    GxB_Matrix_mmap (B, &map, &map_size, NULL, "A.grb", NULL) ;
+    // use B, which is read-only
+    GrB_free (&B) ;                     // free B before unmapping the file
+    GxB_munmap (map, map_size) ;
+*/
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_mmap_save   // write a matrix to a file for GxB_Matrix_mmap
+(
+    const char *filename,       // file to write
+    GrB_Matrix A,               // matrix to write
+    const GrB_Descriptor desc   // currently unused
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL (A) ;
+    GB_WHERE_1 (A, "GxB_Matrix_mmap_save (filename, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap_save") ;
+
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix to the file
+    //--------------------------------------------------------------------------
+
+    info = GB_mmap_save (filename, A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GxB_munmap: release a file mapped by GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Any matrix loaded from the map must be freed first.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_munmap             // release a file mapped by GxB_Matrix_mmap
+(
+    void *map,                  // the memory-mapped file
+    uint64_t map_size           // size of the map
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_CHECK_INIT ;
+    GB_RETURN_IF_NULL (map) ;
+
+    //--------------------------------------------------------------------------
+    // unmap the file
+    //--------------------------------------------------------------------------
+
+    GB_munmap_file (map, (size_t) map_size) ;
+    return (GrB_SUCCESS) ;
+}
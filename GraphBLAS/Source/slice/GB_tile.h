@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// GB_tile.h: helpers for methods that compute their result in tiles
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_mxm_fused and GB_kron_tiles compute their result one tile (a range of
+// vectors) at a time.  GB_vector_range extracts the vectors of an input
+// matrix for one tile, and GB_new_empty creates an empty tile or result.
+
+#ifndef GB_TILE_H
+#define GB_TILE_H
+#include "extract/GB_subref.h"
+
+//------------------------------------------------------------------------------
+// GB_vector_range: X = the vectors k1:k2-1 of A, in the same format as A
+//------------------------------------------------------------------------------
+
+static inline GrB_Info GB_vector_range
+(
+    GrB_Matrix X,               // output matrix, static header
+    const GrB_Matrix A,
+    const int64_t k1,
+    const int64_t k2,
+    GB_Werk Werk
+)
+{
+    uint64_t J [2] ;
+    J [GxB_BEGIN] = k1 ;
+    J [GxB_END  ] = k2 - 1 ;
+    return (GB_subref (X, false, A->is_csc, A, GrB_ALL, false, A->vlen,
+        J, false, GxB_RANGE, false, Werk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_new_empty: create an empty vlen-by-vdim matrix in the given format
+//------------------------------------------------------------------------------
+
+static inline GrB_Info GB_new_empty
+(
+    GrB_Matrix *T,              // handle of matrix to create
+    const GrB_Type type,
+    const int64_t vlen,
+    const int64_t vdim,
+    const bool T_is_csc         // format of T
+)
+{
+    bool Tp_is_32, Tj_is_32, Ti_is_32 ;
+    GB_determine_pji_is_32 (&Tp_is_32, &Tj_is_32, &Ti_is_32,
+        GxB_AUTO_SPARSITY, 1, vlen, vdim, NULL) ;
+    return (GB_new (T, // auto sparsity (sparse/hyper), new or existing header
+        type, vlen, vdim, GB_ph_calloc, T_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1, Tp_is_32, Tj_is_32, Ti_is_32)) ;
+}
+
+#endif
+
@@ -340,6 +340,13 @@ static GrB_Info GB_msort_1_method      // sort array A of size 1-by-n
     { 
         int64_t leaf = Slice [tid] ;
         int64_t leafsize = Slice [tid+1] - leaf ;
+        // skip the sort if the leaf is already sorted
+        bool leaf_sorted = true ;
+        for (int64_t p = leaf + 1 ; leaf_sorted && p < leaf + leafsize ; p++)
+        { 
+            leaf_sorted = !GB_lt_1 (A_0, p, A_0, p-1) ;
+        }
+        if (leaf_sorted) continue ;
         GB_qsort_1_method (A_0 + leaf, leafsize) ;
     }
 
@@ -356,6 +356,13 @@ static GrB_Info GB_msort_2_method    // sort array A of size 2-by-n
     { 
         int64_t leaf = Slice [tid] ;
         int64_t leafsize = Slice [tid+1] - leaf ;
+        // skip the sort if the leaf is already sorted
+        bool leaf_sorted = true ;
+        for (int64_t p = leaf + 1 ; leaf_sorted && p < leaf + leafsize ; p++)
+        { 
+            leaf_sorted = !GB_lt_2 (A_0, A_1, p, A_0, A_1, p-1) ;
+        }
+        if (leaf_sorted) continue ;
         GB_qsort_2 (
             A_0 + leaf, sizeof (GB_A0_t) == sizeof (uint32_t),
             A_1 + leaf, sizeof (GB_A1_t) == sizeof (uint32_t),
@@ -32,6 +32,11 @@ static inline GB_Werk GB_Werk_init (GB_Werk Werk, const char *where_string)
     Werk->j_control = GB_Global_j_control_get ( ) ;
     Werk->i_control = GB_Global_i_control_get ( ) ;
 
+    // no C=A*B method has been selected yet
+    Werk->AxB_method = GxB_DEFAULT ;
+    Werk->AxB_dot_cost = 0 ;
+    Werk->AxB_saxpy_cost = 0 ;
+
     // return result
     return (Werk) ;
 }
@@ -40,6 +40,11 @@ typedef struct
     uint8_t p_control ;             // effective p_control for this method
     uint8_t j_control ;             // effective j_control for this method
     uint8_t i_control ;             // effective i_control for this method
+
+    // method selected by the last C=A*B in this method (see GB_AxB_meta):
+    int AxB_method ;                // GxB_AxB_DOT, GxB_AxB_SAXPY, or default
+    double AxB_dot_cost ;           // predicted cost of dot3
+    double AxB_saxpy_cost ;         // predicted cost of saxpy3
 }
 GB_Werk_struct ;
 
@@ -20,6 +20,8 @@
 //  2: GPU control
 //  3: disable the JIT entirely (returns GrB_NOT_IMPLEMENTED)
 //  4: enable 32-bit methods
+//  6: chunk size for GxB_mxm_reduce_Scalar and GxB_mxm_select
+//  7: tile size for GrB_kronecker and GxB_Matrix_kronecker_stream
 
 void mexFunction
 (
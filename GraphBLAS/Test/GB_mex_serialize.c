@@ -9,6 +9,7 @@
 
 // copy a matrix using one of:
 // GxB_Matrix_serialize and GxB_Matrix_deserialize
+// (also GxB_Matrix_deserialize_stream, reading the blob as a stream)
 // GrB_Matrix_serialize and GrB_Matrix_deserialize
 // GxB_Vector_serialize and GxB_Vector_deserialize
 // GrB_Vector_serialize and GrB_Vector_deserialize
@@ -35,10 +36,42 @@
     mxFree (blob) ;                     \
     GrB_Matrix_free_(&A) ;              \
     GrB_Matrix_free_(&C) ;              \
+    GrB_Matrix_free_(&C2) ;             \
     GrB_Descriptor_free_(&desc) ;       \
     GB_mx_put_global (true) ;           \
 }
 
+// read the blob as a stream, in small pieces
+typedef struct
+{
+    const uint8_t *blob ;
+    size_t blob_size ;
+    size_t p ;
+}
+blob_stream ;
+
+static size_t blob_read (void *buffer, size_t size, void *stream)
+{
+    blob_stream *S = (blob_stream *) stream ;
+    size_t n = GB_IMIN (size, GB_IMIN (S->blob_size - S->p, 10007)) ;
+    memcpy (buffer, S->blob + S->p, n) ;
+    S->p += n ;
+    return (n) ;
+}
+
+static GrB_Info deserialize_stream
+(
+    GrB_Matrix *C,
+    GrB_Type type,
+    const void *blob,
+    size_t blob_size,
+    GrB_Descriptor desc
+)
+{
+    blob_stream S = { .blob = blob, .blob_size = blob_size, .p = 0 } ;
+    return (GxB_Matrix_deserialize_stream (C, type, blob_read, &S, desc)) ;
+}
+
 void mexFunction
 (
     int nargout,
@@ -49,7 +82,7 @@ void mexFunction
 {
 
     bool malloc_debug = GB_mx_get_global (true) ;
-    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Matrix A = NULL, C = NULL, C2 = NULL ;
     GrB_Descriptor desc = NULL ;
     void *blob = NULL ;
     uint64_t blob_size = 0 ;
@@ -124,6 +157,10 @@ void mexFunction
             // test the matrix methods
             METHOD (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
             METHOD (GxB_Matrix_deserialize (&C, atype, blob, blob_size, desc)) ;
+            // deserialize the same blob from a stream
+            METHOD (deserialize_stream (&C2, atype, blob, blob_size, desc)) ;
+            CHECK (GB_mx_isequal (C, C2, 0)) ;
+            GrB_Matrix_free_(&C2) ;
         }
     }
 
@@ -9,6 +9,7 @@
 
 #include "GB_mex.h"
 #include "GB_mex_errors.h"
+#include "../Source/jitifyer/GB_jitifyer.h"
 
 #define FREE_ALL ;
 #define GET_DEEP_COPY ;
@@ -36,6 +37,50 @@ int myflush (void)
     return (0) ;
 }
 
+//------------------------------------------------------------------------------
+// a user-defined operator whose kernels must come from the JIT
+//------------------------------------------------------------------------------
+
+void myarchive_op (double *z, const double *x, const double *y) ;
+void myarchive_op (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + 2 * (*y) ;
+}
+#define MYARCHIVE_OP_DEFN \
+"void myarchive_op (double *z, const double *x, const double *y) \n" \
+"{                                                               \n" \
+"    (*z) = (*x) + 2 * (*y) ;                                    \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// read_file, write_file, file_exists: helpers for the JIT archive tests
+//------------------------------------------------------------------------------
+
+static size_t read_file (const char *filename, uint8_t *X, size_t xmax)
+{
+    FILE *fp = fopen (filename, "rb") ;
+    if (fp == NULL) return (0) ;
+    size_t n = fread (X, 1, xmax, fp) ;
+    fclose (fp) ;
+    return (n) ;
+}
+
+static bool write_file (const char *filename, const uint8_t *X, size_t n)
+{
+    FILE *fp = fopen (filename, "wb") ;
+    if (fp == NULL) return (false) ;
+    bool ok = (fwrite (X, 1, n, fp) == n) ;
+    return ((fclose (fp) == 0) && ok) ;
+}
+
+static bool file_exists (const char *filename)
+{
+    FILE *fp = fopen (filename, "rb") ;
+    if (fp == NULL) return (false) ;
+    fclose (fp) ;
+    return (true) ;
+}
+
 void mexFunction
 (
     int nargout,
@@ -373,6 +418,208 @@ void mexFunction
     CHECK (MATCH (defn2, defn)) ;
     int ignore = system ("ls /tmp/stuff ; rm -rf /tmp/stuff") ;
 
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels.grbjit",
+        GxB_JIT_ARCHIVE_EXPORT)) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels.grbjit",
+        GxB_JIT_ARCHIVE_IMPORT)) ;
+    ERR (GrB_Global_set_String_ (GrB_GLOBAL, "/nonexistent/folder/x.grbjit",
+        GxB_JIT_ARCHIVE_EXPORT)) ;
+    ERR (GrB_Global_get_String_ (GrB_GLOBAL, defn2, GxB_JIT_ARCHIVE_EXPORT)) ;
+    ignore = system ("rm -f /tmp/grb_kernels.grbjit") ;
+
+    //--------------------------------------------------------------------------
+    // JIT archive: export, then import into an empty cache and load from it
+    //--------------------------------------------------------------------------
+
+    int32_t save_control ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &save_control, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control, GxB_JIT_C_CONTROL)) ;
+    if (control == GxB_JIT_ON)
+    {
+        GrB_BinaryOp op = NULL ;
+        GrB_Matrix X = NULL, Y = NULL ;
+        size_t asize = 4 * 1024 * 1024 ;
+        uint8_t *Archive = mxMalloc (asize) ;
+        uint8_t *Bad = mxMalloc (asize) ;
+        CHECK (Archive != NULL && Bad != NULL) ;
+        ignore = system ("rm -rf /tmp/grb_archive_src /tmp/grb_archive_dst "
+            "/tmp/grb_archive_bad") ;
+
+        // compile the kernel for Y = X.*X with myarchive_op in a new cache
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_archive_src",
+            GxB_JIT_CACHE_PATH)) ;
+        OK (GxB_BinaryOp_new (&op, (GxB_binary_function) myarchive_op,
+            GrB_FP64, GrB_FP64, GrB_FP64, "myarchive_op",
+            MYARCHIVE_OP_DEFN)) ;
+        OK (GrB_Matrix_new (&X, GrB_FP64, 4, 4)) ;
+        OK (GrB_Matrix_new (&Y, GrB_FP64, 4, 4)) ;
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (X, (double) (k+1), k, k)) ;
+        }
+        OK (GrB_Matrix_eWiseMult_BinaryOp (Y, NULL, NULL, op, X, X, NULL)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&dvalue, Y, 3, 3)) ;
+        CHECK (dvalue == 12) ;
+
+        // export all loaded kernels
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels.grbjit",
+            GxB_JIT_ARCHIVE_EXPORT)) ;
+        size_t archive_size = read_file ("/tmp/grb_kernels.grbjit", Archive,
+            asize) ;
+        CHECK (archive_size > sizeof (GB_jit_archive_header) &&
+            archive_size < asize) ;
+        GB_jit_archive_header *header = (GB_jit_archive_header *) Archive ;
+        GB_jit_archive_entry *Index = (GB_jit_archive_entry *)
+            (Archive + sizeof (GB_jit_archive_header)) ;
+        int32_t nkernels = header->nkernels ;
+        CHECK (nkernels >= 1) ;
+
+        // unload all kernels, switch to an empty cache, and disable the
+        // compiler, as in a new process
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+            GxB_JIT_C_CONTROL)) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_archive_dst",
+            GxB_JIT_CACHE_PATH)) ;
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_LOAD,
+            GxB_JIT_C_CONTROL)) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels.grbjit",
+            GxB_JIT_ARCHIVE_IMPORT)) ;
+
+        // Y = X.*X again: the kernel can only be loaded from the archive
+        OK (GrB_Matrix_clear (Y)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (Y, NULL, NULL, op, X, X, NULL)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&dvalue, Y, 3, 3)) ;
+        CHECK (dvalue == 12) ;
+        OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control, GxB_JIT_C_CONTROL)) ;
+        CHECK (control == GxB_JIT_LOAD) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels2.grbjit",
+            GxB_JIT_ARCHIVE_EXPORT)) ;
+        size_t size2 = read_file ("/tmp/grb_kernels2.grbjit", Bad, asize) ;
+        CHECK (size2 > sizeof (GB_jit_archive_header)) ;
+        int32_t nloaded = ((GB_jit_archive_header *) Bad)->nkernels ;
+        printf ("jit archive: %d kernels exported, %d loaded\n", nkernels,
+            nloaded) ;
+        CHECK (nloaded >= 1 && nloaded <= nkernels) ;
+
+        //----------------------------------------------------------------------
+        // JIT archive: malformed archives are rejected
+        //----------------------------------------------------------------------
+
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_archive_bad",
+            GxB_JIT_CACHE_PATH)) ;
+        expected = GrB_INVALID_VALUE ;
+        char *bad = "/tmp/grb_bad.grbjit" ;
+        char libname [2048], libfile [4096] ;
+        GB_jit_archive_entry *x = (GB_jit_archive_entry *)
+            (Bad + sizeof (GB_jit_archive_header)) ;
+        CHECK (Index [0].name_len < 1024) ;
+        memcpy (libname, Archive + Index [0].name_offset, Index [0].name_len) ;
+        libname [Index [0].name_len] = '\0' ;
+
+        // bad magic, version, and # of kernels
+        memcpy (Bad, Archive, archive_size) ;
+        header = (GB_jit_archive_header *) Bad ;
+        header->magic [0] = 'X' ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        memcpy (Bad, Archive, archive_size) ;
+        header->version [2]++ ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        memcpy (Bad, Archive, archive_size) ;
+        header->nkernels = INT32_MAX ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        memcpy (Bad, Archive, archive_size) ;
+        header->nkernels = -1 ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        // corrupted sizes and offsets
+        for (int k = 0 ; k < 6 ; k++)
+        {
+            memcpy (Bad, Archive, archive_size) ;
+            switch (k)
+            {
+                case 0: x->name_len = 0 ;                   break ;
+                case 1: x->name_len = UINT32_MAX ;          break ;
+                case 2: x->name_offset = archive_size ;     break ;
+                case 3: x->lib_size = 0 ;                   break ;
+                case 4: x->lib_size = UINT64_MAX ;          break ;
+                default: x->lib_offset = UINT64_MAX - 8 ;   break ;
+            }
+            CHECK (write_file (bad, Bad, archive_size)) ;
+            ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad,
+                GxB_JIT_ARCHIVE_IMPORT)) ;
+        }
+
+        // corrupted library: its checksum does not match
+        memcpy (Bad, Archive, archive_size) ;
+        Bad [x->lib_offset + x->lib_size / 2] ^= 0xFF ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+        snprintf (libfile, sizeof (libfile), "/tmp/grb_archive_bad/lib/%02x/%s",
+            (unsigned int) (x->hash & 0xFF), libname) ;
+        CHECK (!file_exists (libfile)) ;
+
+        // library names with a relative or absolute path
+        memcpy (Bad, Archive, archive_size) ;
+        memcpy (Bad + x->name_offset, "../", 3) ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+        snprintf (libfile, sizeof (libfile), "/tmp/grb_archive_bad/lib/%s",
+            libname + 3) ;
+        CHECK (!file_exists (libfile)) ;
+
+        memcpy (Bad, Archive, archive_size) ;
+        Bad [x->name_offset] = '/' ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        memcpy (Bad, Archive, archive_size) ;
+        Bad [x->name_offset + x->name_len / 2] = '/' ;
+        CHECK (write_file (bad, Bad, archive_size)) ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad, GxB_JIT_ARCHIVE_IMPORT));
+
+        // truncated archives (the libraries before the truncation may be
+        // installed, but the archive is still reported as invalid)
+        size_t trunc [4] = { 0, sizeof (GB_jit_archive_header) - 1,
+            sizeof (GB_jit_archive_header)
+                + nkernels * sizeof (GB_jit_archive_entry) + 1,
+            archive_size - 1 } ;
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            CHECK (write_file (bad, Archive, trunc [k])) ;
+            ERR (GrB_Global_set_String_ (GrB_GLOBAL, bad,
+                GxB_JIT_ARCHIVE_IMPORT)) ;
+        }
+
+        // the unmodified archive is still accepted
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/grb_kernels.grbjit",
+            GxB_JIT_ARCHIVE_IMPORT)) ;
+        snprintf (libfile, sizeof (libfile), "/tmp/grb_archive_bad/lib/%02x/%s",
+            (unsigned int) (Index [0].hash & 0xFF), libname) ;
+        CHECK (file_exists (libfile)) ;
+
+        // restore the JIT cache and control
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+            GxB_JIT_C_CONTROL)) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, defn, GxB_JIT_CACHE_PATH)) ;
+        GrB_free (&op) ;
+        GrB_free (&X) ;
+        GrB_free (&Y) ;
+        mxFree (Archive) ;
+        mxFree (Bad) ;
+        ignore = system ("rm -rf /tmp/grb_archive_src /tmp/grb_archive_dst "
+            "/tmp/grb_archive_bad /tmp/grb_kernels.grbjit "
+            "/tmp/grb_kernels2.grbjit /tmp/grb_bad.grbjit") ;
+    }
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, save_control, GxB_JIT_C_CONTROL)) ;
+
     ERR (GrB_Global_set_String_ (GrB_GLOBAL, defn, GrB_NAME)) ;
 
     OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_JIT_CACHE_PATH)) ;
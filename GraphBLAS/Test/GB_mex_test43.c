@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test GxB_Matrix_mmap_save and GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FILENAME "/tmp/GB_mex_test43.grb"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (map != NULL) GxB_munmap (map, map_size) ; \
+    map = NULL ;                        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *map = NULL ;
+    uint64_t map_size = 0 ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int n = 100 ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_SECURE_IMPORT, GxB_IMPORT)) ;
+
+    //--------------------------------------------------------------------------
+    // save and map a matrix in each format
+    //--------------------------------------------------------------------------
+
+    int formats [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            // create a matrix A with pending work
+            OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+            for (int i = 0 ; i < n ; i++)
+            {
+                for (int j = 0 ; j < n ; j++)
+                {
+                    if (formats [k] == GxB_FULL || (i+j) % 7 == 0)
+                    {
+                        double x = iso ? 3 : (i + 1000*j) ;
+                        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                    }
+                }
+            }
+            OK (GrB_Matrix_set_INT32 (A, formats [k], GxB_SPARSITY_CONTROL)) ;
+
+            // save A and map it into B
+            OK (GxB_Matrix_mmap_save (FILENAME, A, NULL)) ;
+            OK (GrB_Matrix_new (&B, GrB_BOOL, 0, 0)) ;
+            OK (GxB_Matrix_mmap (B, &map, &map_size, NULL, FILENAME,
+                (k % 2 == 0) ? desc : NULL)) ;
+            CHECK (map != NULL) ;
+            OK (GxB_Matrix_fprint (B, "B mapped", 0, NULL)) ;
+            CHECK (GB_mx_isequal (A, B, 0)) ;
+
+            // B is read-only
+            int readonly = false ;
+            OK (GrB_Matrix_get_INT32 (B, &readonly, GxB_IS_READONLY)) ;
+            CHECK (readonly) ;
+            int32_t format = 0 ;
+            OK (GrB_Matrix_get_INT32 (B, &format, GxB_SPARSITY_STATUS)) ;
+            CHECK (format == formats [k]) ;
+            expected = GxB_OUTPUT_IS_READONLY ;
+            ERR (GrB_Matrix_setElement_FP64 (B, 1, 0, 0)) ;
+
+            // B can be used as an input
+            OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+            OK (GrB_Matrix_set_INT32 (C, formats [k], GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_apply (C, NULL, NULL, GrB_IDENTITY_FP64, B, NULL)) ;
+            CHECK (GB_mx_isequal (A, C, 0)) ;
+
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+            GrB_Matrix_free (&C) ;
+            OK (GxB_munmap (map, map_size)) ;
+            map = NULL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_BOOL, 0, 0)) ;
+    OK (GxB_Matrix_mmap_save (FILENAME, A, NULL)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_mmap (B, &map, &map_size, GrB_INT32, FILENAME, NULL)) ;
+    CHECK (map == NULL) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_mmap (B, &map, &map_size, NULL, "/nonexistent/x.grb",
+        NULL)) ;
+    ERR (GxB_Matrix_mmap_save ("/nonexistent/x.grb", A, NULL)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_mmap (B, &map, &map_size, NULL, NULL, NULL)) ;
+
+    // a file that is not a valid mmap file
+    FILE *f = fopen (FILENAME, "w") ;
+    CHECK (f != NULL) ;
+    fprintf (f, "not a GraphBLAS matrix") ;
+    fclose (f) ;
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_mmap (B, &map, &map_size, NULL, FILENAME, NULL)) ;
+    CHECK (map == NULL) ;
+    remove (FILENAME) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43:  all tests passed\n\n") ;
+}
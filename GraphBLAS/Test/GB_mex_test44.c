@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test GrB_Matrix_build with sorted and partially sorted input
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Vector_free (&Ivec) ;           \
+    GrB_Vector_free (&Jvec) ;           \
+    GrB_Vector_free (&Xvec) ;           \
+    GrB_Descriptor_free (&desc) ;       \
+    if (Ilist != NULL) mxFree (Ilist) ; \
+    if (Jlist != NULL) mxFree (Jlist) ; \
+    if (Xlist != NULL) mxFree (Xlist) ; \
+    if (Ishuf != NULL) mxFree (Ishuf) ; \
+    if (Jshuf != NULL) mxFree (Jshuf) ; \
+    if (Xshuf != NULL) mxFree (Xshuf) ; \
+    Ilist = NULL ; Jlist = NULL ; Xlist = NULL ;    \
+    Ishuf = NULL ; Jshuf = NULL ; Xshuf = NULL ;    \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL ;
+    GrB_Vector u = NULL, v = NULL, Ivec = NULL, Jvec = NULL, Xvec = NULL ;
+    GrB_Descriptor desc = NULL ;
+    uint64_t *Ilist = NULL, *Jlist = NULL, *Ishuf = NULL, *Jshuf = NULL ;
+    int64_t *Xlist = NULL, *Xshuf = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    int64_t n = 2000 ;
+    int64_t nvals = 100000 ;
+    Ilist = mxMalloc (nvals * sizeof (uint64_t)) ;
+    Jlist = mxMalloc (nvals * sizeof (uint64_t)) ;
+    Xlist = mxMalloc (nvals * sizeof (int64_t)) ;
+    Ishuf = mxMalloc (nvals * sizeof (uint64_t)) ;
+    Jshuf = mxMalloc (nvals * sizeof (uint64_t)) ;
+    Xshuf = mxMalloc (nvals * sizeof (int64_t)) ;
+
+    // use a small chunk so that multiple threads are used
+    int nthreads_max = 0 ;
+    double chunk = 0 ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_max, GxB_NTHREADS)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &chunk)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // build matrices from tuples with different orderings
+    //--------------------------------------------------------------------------
+
+    // kind 0: tuples sorted by row, but not within each row, with duplicates
+    // kind 1: tuples sorted in 8 chunks, with duplicates
+    // kind 2: tuples sorted by row and column, with no duplicates
+    // kind 3: one large row, not sorted, with duplicates
+
+    for (int kind = 0 ; kind <= 3 ; kind++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+            {
+                OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+                    GxB_NTHREADS)) ;
+
+                // create the tuples
+                int64_t nchunk = (kind == 1) ? (nvals / 8) : nvals ;
+                for (int64_t k = 0 ; k < nvals ; k++)
+                {
+                    if (kind == 0)
+                    {
+                        Ilist [k] = (k * n) / nvals ;
+                        Jlist [k] = simple_rand_i ( ) % n ;
+                    }
+                    else if (kind == 1)
+                    {
+                        int64_t kk = k % nchunk ;
+                        Ilist [k] = (kk * n) / nchunk ;
+                        Jlist [k] = (kk * 7) % n ;
+                    }
+                    else if (kind == 2)
+                    {
+                        Ilist [k] = k / n ;
+                        Jlist [k] = k % n ;
+                    }
+                    else
+                    {
+                        Ilist [k] = 3 ;
+                        Jlist [k] = simple_rand_i ( ) % n ;
+                    }
+                    Xlist [k] = (int64_t) (simple_rand_i ( ) % 1000) ;
+                }
+                if (by_col)
+                {
+                    // sort by column instead of by row
+                    uint64_t *T = Ilist ; Ilist = Jlist ; Jlist = T ;
+                }
+
+                // create a random permutation of the tuples
+                memcpy (Ishuf, Ilist, nvals * sizeof (uint64_t)) ;
+                memcpy (Jshuf, Jlist, nvals * sizeof (uint64_t)) ;
+                memcpy (Xshuf, Xlist, nvals * sizeof (int64_t)) ;
+                for (int64_t k = nvals - 1 ; k > 0 ; k--)
+                {
+                    int64_t t = simple_rand_i ( ) % (k+1) ;
+                    uint64_t i = Ishuf [k] ; Ishuf [k] = Ishuf [t] ;
+                    Ishuf [t] = i ;
+                    uint64_t j = Jshuf [k] ; Jshuf [k] = Jshuf [t] ;
+                    Jshuf [t] = j ;
+                    int64_t x = Xshuf [k] ; Xshuf [k] = Xshuf [t] ;
+                    Xshuf [t] = x ;
+                }
+
+                // build A from the ordered tuples and B from the shuffled ones
+                OK (GrB_Matrix_new (&A, GrB_INT64, n, n)) ;
+                OK (GrB_Matrix_new (&B, GrB_INT64, n, n)) ;
+                int fmt = by_col ? GrB_COLMAJOR : GrB_ROWMAJOR ;
+                OK (GrB_Matrix_set_INT32 (A, fmt,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                OK (GrB_Matrix_set_INT32 (B, fmt,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                OK (GrB_Matrix_build_INT64 (A, Ilist, Jlist, Xlist, nvals,
+                    GrB_PLUS_INT64)) ;
+                OK (GrB_Matrix_build_INT64 (B, Ishuf, Jshuf, Xshuf, nvals,
+                    GrB_PLUS_INT64)) ;
+                CHECK (GB_mx_isequal (A, B, 0)) ;
+                GrB_Matrix_free (&A) ;
+                GrB_Matrix_free (&B) ;
+
+                // build A and B again as iso
+                GrB_Scalar s = NULL ;
+                OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+                OK (GrB_Scalar_setElement_INT64 (s, 1)) ;
+                OK (GrB_Matrix_new (&A, GrB_INT64, n, n)) ;
+                OK (GrB_Matrix_new (&B, GrB_INT64, n, n)) ;
+                OK (GrB_Matrix_set_INT32 (A, fmt,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                OK (GrB_Matrix_set_INT32 (B, fmt,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                OK (GxB_Matrix_build_Scalar (A, Ilist, Jlist, s, nvals)) ;
+                OK (GxB_Matrix_build_Scalar (B, Ishuf, Jshuf, s, nvals)) ;
+                CHECK (GB_mx_isequal (A, B, 0)) ;
+                GrB_Matrix_free (&A) ;
+                GrB_Matrix_free (&B) ;
+                GrB_Scalar_free (&s) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // GxB_BUILD_SORTED descriptor
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    int32_t value = -1 ;
+    OK (GrB_Descriptor_get_INT32 (desc, &value, GxB_BUILD_SORTED)) ;
+    CHECK (value == GrB_DEFAULT) ;
+    OK (GrB_Descriptor_set_INT32 (desc, true, GxB_BUILD_SORTED)) ;
+    OK (GrB_Descriptor_get_INT32 (desc, &value, GxB_BUILD_SORTED)) ;
+    CHECK (value == true) ;
+    OK (GxB_Descriptor_fprint (desc, "desc", GxB_COMPLETE, NULL)) ;
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads, GxB_NTHREADS)) ;
+
+        // tuples sorted by row and column, with no duplicates
+        for (int64_t k = 0 ; k < nvals ; k++)
+        {
+            Ilist [k] = k / n ;
+            Jlist [k] = k % n ;
+            Xlist [k] = k ;
+        }
+        OK (GrB_Vector_new (&Ivec, GrB_UINT64, nvals)) ;
+        OK (GrB_Vector_new (&Jvec, GrB_UINT64, nvals)) ;
+        OK (GrB_Vector_new (&Xvec, GrB_INT64, nvals)) ;
+        for (int64_t k = 0 ; k < nvals ; k++)
+        {
+            OK (GrB_Vector_setElement_UINT64 (Ivec, Ilist [k], k)) ;
+            OK (GrB_Vector_setElement_UINT64 (Jvec, Jlist [k], k)) ;
+            OK (GrB_Vector_setElement_INT64  (Xvec, Xlist [k], k)) ;
+        }
+
+        // build A with the hint, and B without it
+        OK (GrB_Matrix_new (&A, GrB_INT64, n, n)) ;
+        OK (GrB_Matrix_new (&B, GrB_INT64, n, n)) ;
+        OK (GxB_Matrix_build_Vector (A, Ivec, Jvec, Xvec, GrB_PLUS_INT64,
+            desc)) ;
+        OK (GxB_Matrix_build_Vector (B, Ivec, Jvec, Xvec, GrB_PLUS_INT64,
+            NULL)) ;
+        CHECK (GB_mx_isequal (A, B, 0)) ;
+        OK (GxB_Matrix_fprint (A, "A built with hint", GxB_SILENT, NULL)) ;
+
+        // out-of-range indices are still detected with the hint
+        GrB_Matrix_free (&A) ;
+        OK (GrB_Matrix_new (&A, GrB_INT64, 10, n)) ;
+        expected = GrB_INDEX_OUT_OF_BOUNDS ;
+        ERR (GxB_Matrix_build_Vector (A, Ivec, Jvec, Xvec, GrB_PLUS_INT64,
+            desc)) ;
+
+        // vectors: build u with the hint, and v without it
+        OK (GrB_Vector_new (&u, GrB_INT64, nvals)) ;
+        OK (GrB_Vector_new (&v, GrB_INT64, nvals)) ;
+        OK (GxB_Vector_build_Vector (u, Xvec, Xvec, GrB_PLUS_INT64, desc)) ;
+        OK (GxB_Vector_build_Vector (v, Xvec, Xvec, GrB_PLUS_INT64, NULL)) ;
+        CHECK (GB_mx_isequal ((GrB_Matrix) u, (GrB_Matrix) v, 0)) ;
+        OK (GxB_Vector_fprint (u, "u built with hint", GxB_SILENT, NULL)) ;
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+        GrB_Vector_free (&u) ;
+        GrB_Vector_free (&v) ;
+        GrB_Vector_free (&Ivec) ;
+        GrB_Vector_free (&Jvec) ;
+        GrB_Vector_free (&Xvec) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_max, GxB_NTHREADS)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, chunk)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44:  all tests passed\n\n") ;
+}
+
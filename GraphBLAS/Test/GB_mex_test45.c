@@ -0,0 +1,269 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test GrB_extractElement on matrices with pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Scalar_free (&s) ;              \
+    if (X != NULL) mxFree (X) ;         \
+    if (P != NULL) mxFree (P) ;         \
+    X = NULL ; P = NULL ;               \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_Scalar s = NULL ;
+    int64_t *X = NULL ;
+    bool *P = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    int64_t m = 50, n = 60 ;
+    X = mxMalloc (m * n * sizeof (int64_t)) ;
+    P = mxMalloc (m * n * sizeof (bool)) ;
+
+    int64_t threshold = 0, t ;
+    int32_t will_wait ;
+    int64_t x ;
+    double d ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_PENDING_THRESHOLD)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&threshold, s)) ;
+    CHECK (threshold == 65536) ;
+
+    //--------------------------------------------------------------------------
+    // interleaved setElement/assign and extractElement
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        // k = 0: by col, setElement (implied SECOND)
+        // k = 1: by row, setElement (implied SECOND)
+        // k = 2: by col, assign with PLUS accum, from a double scalar
+        // k = 3: by row, assign with PLUS accum, from a double scalar
+        bool by_row = (k % 2 == 1) ;
+        bool accum = (k >= 2) ;
+
+        OK (GrB_Matrix_new (&A, GrB_INT64, m, n)) ;
+        OK (GrB_Matrix_set_INT32 (A, by_row ? GrB_ROWMAJOR : GrB_COLMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+        memset (P, 0, m * n * sizeof (bool)) ;
+
+        // A starts with some entries, already assembled
+        for (int64_t p = 0 ; p < m*n ; p += 7)
+        {
+            int64_t i = p % m, j = p / m ;
+            X [p] = p ;
+            P [p] = true ;
+            OK (GrB_Matrix_setElement_INT64 (A, X [p], i, j)) ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        for (int trial = 0 ; trial < 2000 ; trial++)
+        {
+            int64_t i = simple_rand ( ) % m ;
+            int64_t j = simple_rand ( ) % n ;
+            int64_t p = i + j * m ;
+            if (simple_rand ( ) % 2 == 0)
+            {
+                // A(i,j) = y or A(i,j) += y
+                int64_t y = (int64_t) (simple_rand ( ) % 1000) - 500 ;
+                if (accum)
+                {
+                    uint64_t I [1] = { i }, J [1] = { j } ;
+                    OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_INT64,
+                        (double) y, I, 1, J, 1, NULL)) ;
+                    X [p] = (P [p] ? X [p] : 0) + y ;
+                }
+                else
+                {
+                    OK (GrB_Matrix_setElement_INT64 (A, y, i, j)) ;
+                    X [p] = y ;
+                }
+                P [p] = true ;
+            }
+            else
+            {
+                // x = A(i,j), with and without typecasting
+                if (P [p])
+                {
+                    OK (GrB_Matrix_extractElement_INT64 (&x, A, i, j)) ;
+                    CHECK (x == X [p]) ;
+                    OK (GrB_Matrix_extractElement_FP64 (&d, A, i, j)) ;
+                    CHECK (d == (double) X [p]) ;
+                    OK (GrB_Matrix_extractElement_Scalar (s, A, i, j)) ;
+                    OK (GrB_Scalar_extractElement_INT64 (&x, s)) ;
+                    CHECK (x == X [p]) ;
+                }
+                else
+                {
+                    expected = GrB_NO_VALUE ;
+                    ERR (GrB_Matrix_extractElement_INT64 (&x, A, i, j)) ;
+                }
+                info = GxB_Matrix_isStoredElement (A, i, j) ;
+                CHECK (info == (P [p] ? GrB_SUCCESS : GrB_NO_VALUE)) ;
+            }
+        }
+
+        // the reads above have not assembled the pending tuples
+        OK (GrB_Matrix_get_INT32 (A, &will_wait, GxB_WILL_WAIT)) ;
+        CHECK (will_wait) ;
+
+        // check the assembled matrix
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GxB_Matrix_fprint (A, "A assembled", GxB_SILENT, NULL)) ;
+        uint64_t nvals ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        uint64_t nvals2 = 0 ;
+        for (int64_t p = 0 ; p < m*n ; p++)
+        {
+            int64_t i = p % m, j = p / m ;
+            if (P [p])
+            {
+                OK (GrB_Matrix_extractElement_INT64 (&x, A, i, j)) ;
+                CHECK (x == X [p]) ;
+                nvals2++ ;
+            }
+        }
+        CHECK (nvals == nvals2) ;
+
+        GrB_Matrix_free (&A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GxB_PENDING_THRESHOLD
+    //--------------------------------------------------------------------------
+
+    // threshold of 10: reads assemble the pending tuples once there are 11
+    OK (GrB_Scalar_setElement_INT64 (s, 10)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_PENDING_THRESHOLD)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_PENDING_THRESHOLD)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&t, s)) ;
+    CHECK (t == 10) ;
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, m, n)) ;
+    for (int64_t k = 0 ; k < 10 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k, k, 2*k)) ;
+    }
+    OK (GrB_Matrix_extractElement_INT64 (&x, A, 3, 6)) ;
+    CHECK (x == 3) ;
+    OK (GrB_Matrix_get_INT32 (A, &will_wait, GxB_WILL_WAIT)) ;
+    CHECK (will_wait) ;
+    OK (GrB_Matrix_setElement_INT64 (A, 10, 10, 20)) ;
+    OK (GrB_Matrix_extractElement_INT64 (&x, A, 10, 20)) ;
+    CHECK (x == 10) ;
+    OK (GrB_Matrix_get_INT32 (A, &will_wait, GxB_WILL_WAIT)) ;
+    CHECK (!will_wait) ;
+    GrB_Matrix_free (&A) ;
+
+    // threshold of zero: every read assembles the pending tuples
+    OK (GrB_Scalar_setElement_INT64 (s, 0)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_PENDING_THRESHOLD)) ;
+    OK (GrB_Matrix_new (&A, GrB_INT64, m, n)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, 42, 1, 2)) ;
+    OK (GrB_Matrix_extractElement_INT64 (&x, A, 1, 2)) ;
+    CHECK (x == 42) ;
+    OK (GrB_Matrix_get_INT32 (A, &will_wait, GxB_WILL_WAIT)) ;
+    CHECK (!will_wait) ;
+    GrB_Matrix_free (&A) ;
+
+    OK (GrB_Scalar_setElement_INT64 (s, threshold)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_PENDING_THRESHOLD)) ;
+
+    //--------------------------------------------------------------------------
+    // iso matrix with pending tuples
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, m, n)) ;
+    for (int64_t k = 0 ; k < 20 ; k++)
+    {
+        // added in descending order, so the pending tuples are not sorted
+        OK (GrB_Matrix_setElement_INT64 (A, 3, 40-2*k, 50-2*k)) ;
+    }
+    OK (GxB_Matrix_isStoredElement (A, 4, 14)) ;
+    OK (GrB_Matrix_extractElement_INT64 (&x, A, 4, 14)) ;
+    CHECK (x == 3) ;
+    expected = GrB_NO_VALUE ;
+    ERR (GrB_Matrix_extractElement_INT64 (&x, A, 5, 14)) ;
+    OK (GrB_Matrix_get_INT32 (A, &will_wait, GxB_WILL_WAIT)) ;
+    CHECK (will_wait) ;
+    bool iso ;
+    OK (GxB_Matrix_iso (&iso, A)) ;
+    CHECK (iso) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // vectors with pending tuples
+    //--------------------------------------------------------------------------
+
+    memset (P, 0, m * n * sizeof (bool)) ;
+    OK (GrB_Vector_new (&v, GrB_INT64, m*n)) ;
+    for (int trial = 0 ; trial < 500 ; trial++)
+    {
+        int64_t i = simple_rand ( ) % 200 ;
+        if (simple_rand ( ) % 2 == 0)
+        {
+            int64_t y = (int64_t) (simple_rand ( ) % 1000) ;
+            OK (GrB_Vector_setElement_INT64 (v, y, i)) ;
+            X [i] = y ;
+            P [i] = true ;
+        }
+        else if (P [i])
+        {
+            OK (GrB_Vector_extractElement_INT64 (&x, v, i)) ;
+            CHECK (x == X [i]) ;
+        }
+        else
+        {
+            expected = GrB_NO_VALUE ;
+            ERR (GrB_Vector_extractElement_INT64 (&x, v, i)) ;
+        }
+    }
+    OK (GrB_Vector_get_INT32 (v, &will_wait, GxB_WILL_WAIT)) ;
+    CHECK (will_wait) ;
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    for (int64_t i = 0 ; i < m*n ; i++)
+    {
+        if (P [i])
+        {
+            OK (GrB_Vector_extractElement_INT64 (&x, v, i)) ;
+            CHECK (x == X [i]) ;
+        }
+    }
+    GrB_Vector_free (&v) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45:  all tests passed\n\n") ;
+}
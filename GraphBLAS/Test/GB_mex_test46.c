@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test the CPU memory pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Scalar_free (&s) ;              \
+}
+
+//------------------------------------------------------------------------------
+// compute: a sequence of small operations
+//------------------------------------------------------------------------------
+
+static GrB_Info compute
+(
+    GrB_Matrix C,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    int ntrials
+)
+{
+    GrB_Info info ;
+    OK (GrB_Matrix_clear (C)) ;
+    for (int k = 0 ; k < ntrials ; k++)
+    {
+        OK (GrB_mxm (C, NULL, GrB_PLUS_FP64, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, B, NULL)) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, GrB_PLUS_FP64,
+            C, A, NULL)) ;
+        OK (GrB_Matrix_select_FP64 (C, NULL, NULL, GrB_VALUEGT_FP64, C, 0,
+            NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar s = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int64_t limit, nbytes, hits, misses ;
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&limit, s)) ;
+    CHECK (limit == 0) ;
+
+    int64_t n = 40 ;
+    simple_rand_seed (1) ;
+    OK (GB_mx_random_matrix (&A, false, false, n, n, 4*n, 0, false)) ;
+    OK (GB_mx_random_matrix (&B, false, false, n, n, 4*n, 0, false)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compute without the pool
+    //--------------------------------------------------------------------------
+
+    OK (compute (C1, A, B, 10)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_HITS)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&hits, s)) ;
+    CHECK (hits == 0) ;
+
+    //--------------------------------------------------------------------------
+    // compute with the pool
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_setElement_INT64 (s, 16 * 1024 * 1024)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&limit, s)) ;
+    CHECK (limit == 16 * 1024 * 1024) ;
+
+    OK (compute (C2, A, B, 10)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_HITS)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&hits, s)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_MISSES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&misses, s)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nbytes, s)) ;
+    printf ("pool: hits "GBd" misses "GBd" bytes "GBd"\n", hits, misses,
+        nbytes) ;
+    CHECK (hits > misses) ;
+    CHECK (nbytes > 0 && nbytes <= limit) ;
+
+    // blocks from the pool are included in the memory usage
+    size_t size ;
+    OK (GxB_Matrix_memoryUsage (&size, C2)) ;
+    CHECK (size > 0) ;
+    OK (GxB_Matrix_fprint (C2, "C2 with memory pool", GxB_SILENT, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // a small limit
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_setElement_INT64 (s, 1024)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_HITS)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&hits, s)) ;
+    CHECK (hits == 0) ;
+    OK (compute (C2, A, B, 10)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nbytes, s)) ;
+    CHECK (nbytes <= 1024) ;
+
+    //--------------------------------------------------------------------------
+    // disable the pool and free its blocks
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_setElement_INT64 (s, 0)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nbytes, s)) ;
+    CHECK (nbytes == 0) ;
+
+    // blocks allocated from the pool can be freed after the pool is disabled
+    GrB_Matrix_free (&C2) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (compute (C2, A, B, 2)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nbytes, s)) ;
+    CHECK (nbytes == 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46:  all tests passed\n\n") ;
+}
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test the cost model for C<M>=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define PROFILE "GB_mex_test47_profile.txt"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Scalar_free (&s) ;              \
+}
+
+//------------------------------------------------------------------------------
+// set_ratio: set the GxB_AxB_DOT_RATIO
+//------------------------------------------------------------------------------
+
+static GrB_Info set_ratio (GrB_Scalar s, double ratio)
+{
+    GrB_Info info ;
+    OK (GrB_Scalar_setElement_FP64 (s, ratio)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    return (GrB_SUCCESS) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar s = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int32_t tuning, method ;
+    double ratio, cost ;
+
+    OK (GrB_Scalar_new (&s, GrB_FP64)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tuning, GxB_AxB_TUNING)) ;
+    CHECK (tuning == GxB_AxB_TUNING_OFF) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio, s)) ;
+    CHECK (ratio == 1) ;
+
+    int64_t n = 500 ;
+    simple_rand_seed (1) ;
+    OK (GB_mx_random_matrix (&A, false, false, n, n, 8*n, 0, false)) ;
+    OK (GB_mx_random_matrix (&B, false, false, n, n, 8*n, 0, false)) ;
+    OK (GB_mx_random_matrix (&M, false, false, n, n, 4*n, 0, false)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=A*B, A'*B, and A*B' with each method
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor desc [3] = { NULL, GrB_DESC_T0, GrB_DESC_T1 } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        // default heuristics
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNING_OFF,
+            GxB_AxB_TUNING)) ;
+        OK (GrB_Matrix_clear (C1)) ;
+        OK (GrB_mxm (C1, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc [k])) ;
+        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+        // with tuning off, the cost model is not computed
+        OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_LAST_COST)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&cost, s)) ;
+        CHECK (cost == 0) ;
+
+        // the cost model, with a huge dot_ratio: use saxpy
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNING_ON,
+            GxB_AxB_TUNING)) ;
+        OK (set_ratio (s, 1e30)) ;
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc [k])) ;
+        OK (GrB_Global_get_INT32 (GrB_GLOBAL, &method, GxB_AxB_LAST_METHOD)) ;
+        CHECK (method == GxB_AxB_SAXPY) ;
+        OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_LAST_COST)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&cost, s)) ;
+        CHECK (cost > 0) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 1e-12)) ;
+
+        // the cost model, with a tiny dot_ratio: use dot3
+        OK (set_ratio (s, 1e-30)) ;
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc [k])) ;
+        OK (GrB_Global_get_INT32 (GrB_GLOBAL, &method, GxB_AxB_LAST_METHOD)) ;
+        CHECK (method == GxB_AxB_DOT) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 1e-12)) ;
+
+        // with no mask, the cost model is not used
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc [k])) ;
+        OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_LAST_COST)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&cost, s)) ;
+        CHECK (cost == 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // train the cost model
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNING_OFF,
+        GxB_AxB_TUNING)) ;
+    OK (GrB_Matrix_clear (C1)) ;
+    OK (GrB_mxm (C1, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (set_ratio (s, 1)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNING_TRAIN,
+        GxB_AxB_TUNING)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tuning, GxB_AxB_TUNING)) ;
+    CHECK (tuning == GxB_AxB_TUNING_TRAIN) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc [k])) ;
+    }
+    OK (GrB_Matrix_clear (C2)) ;
+    OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 1e-12)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio, s)) ;
+    printf ("trained dot_ratio: %g\n", ratio) ;
+    CHECK (ratio > 0 && ratio != 1) ;
+
+    //--------------------------------------------------------------------------
+    // save and load the profile
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_String (GrB_GLOBAL, PROFILE, GxB_AxB_PROFILE_SAVE)) ;
+    OK (set_ratio (s, 3)) ;
+    OK (GrB_Global_set_String (GrB_GLOBAL, PROFILE, GxB_AxB_PROFILE_LOAD)) ;
+    double ratio2 ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio2, s)) ;
+    CHECK (ratio == ratio2) ;
+
+    //--------------------------------------------------------------------------
+    // the profile options are distinct from GxB_NTHREADS
+    //--------------------------------------------------------------------------
+
+    CHECK (GxB_AxB_PROFILE_LOAD != GxB_NTHREADS) ;
+    CHECK (GxB_AxB_PROFILE_SAVE != GxB_NTHREADS) ;
+    int32_t nthreads_orig, nthreads ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_orig, GxB_NTHREADS)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 3, GxB_NTHREADS)) ;
+    OK (set_ratio (s, 3)) ;
+    OK (GrB_Global_set_String (GrB_GLOBAL, PROFILE, GxB_AxB_PROFILE_LOAD)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads, GxB_NTHREADS)) ;
+    CHECK (nthreads == 3) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio2, s)) ;
+    CHECK (ratio == ratio2) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_orig, GxB_NTHREADS)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads, GxB_NTHREADS)) ;
+    CHECK (nthreads == nthreads_orig) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio2, s)) ;
+    CHECK (ratio == ratio2) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, 3, GxB_AxB_TUNING)) ;
+    OK (GrB_Scalar_setElement_FP64 (s, -1)) ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_setElement_FP64 (s, INFINITY)) ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    ERR (GrB_Global_set_String (GrB_GLOBAL, "no_such_file.txt",
+        GxB_AxB_PROFILE_LOAD)) ;
+    ERR (GrB_Global_set_String (GrB_GLOBAL, PROFILE, GxB_NTHREADS)) ;
+    FILE *f = fopen (PROFILE, "w") ;
+    CHECK (f != NULL) ;
+    fprintf (f, "not a profile\n") ;
+    fclose (f) ;
+    ERR (GrB_Global_set_String (GrB_GLOBAL, PROFILE, GxB_AxB_PROFILE_LOAD)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_AxB_DOT_RATIO)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&ratio2, s)) ;
+    CHECK (ratio == ratio2) ;
+    remove (PROFILE) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNING_OFF,
+        GxB_AxB_TUNING)) ;
+    OK (set_ratio (s, 1)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47:  all tests passed\n\n") ;
+}
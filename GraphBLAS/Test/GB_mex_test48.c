@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_mxm_reduce_Scalar and GxB_mxm_select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Scalar_free (&s1) ;             \
+    GrB_Scalar_free (&s2) ;             \
+    GrB_Scalar_free (&y) ;              \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, T = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar s1 = NULL, s2 = NULL, y = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int64_t n = 300 ;
+    double x1, x2 ;
+
+    simple_rand_seed (1) ;
+    OK (GB_mx_random_matrix (&A, false, false, n, n, 8*n, 0, false)) ;
+    OK (GB_mx_random_matrix (&B, false, false, n, n, 8*n, 0, false)) ;
+    OK (GB_mx_random_matrix (&M, false, false, n, n, 4*n, 0, false)) ;
+    GrB_Matrix Inputs [3] = { A, B, M } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        // use integer values 0 to 9, so that sums are exact in any order
+        OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (Inputs [k], NULL, NULL,
+            GrB_TIMES_FP64, Inputs [k], 10, NULL)) ;
+        OK (GrB_Matrix_apply (Inputs [k], NULL, NULL, GxB_FLOOR_FP64,
+            Inputs [k], NULL)) ;
+    }
+    OK (GrB_Matrix_new (&T, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GrB_Scalar_new (&s1, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&s2, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&y, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (y, 20)) ;
+
+    //--------------------------------------------------------------------------
+    // compare with GrB_mxm followed by GrB_reduce or GrB_select
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor desc [4] = { NULL, GrB_DESC_T0, GrB_DESC_T1,
+        GrB_DESC_T0T1 } ;
+    GrB_IndexUnaryOp ops [2] = { GrB_VALUEGE_FP64, GrB_TRIL } ;
+    int64_t chunks [3] = { 0, 200, 1 } ;
+
+    for (int fmt = 0 ; fmt < 2 ; fmt++)
+    {
+        // all matrices by row, then all by column
+        int32_t orientation = (fmt == 0) ? GrB_ROWMAJOR : GrB_COLMAJOR ;
+        OK (GrB_Matrix_set_INT32 (A, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (B, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (M, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+
+        for (int c = 0 ; c < 3 ; c++)
+        {
+            // use the default chunk size, then force many chunks
+            GB_Global_hack_set (6, chunks [c]) ;
+
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                for (int masked = 0 ; masked < 2 ; masked++)
+                {
+                    GrB_Matrix Mask = (masked) ? M : NULL ;
+
+                    // T<M> = A*B
+                    OK (GrB_Matrix_clear (T)) ;
+                    OK (GrB_mxm (T, Mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                        A, B, desc [k])) ;
+
+                    // s = 1 + sum (T)
+                    OK (GrB_Scalar_setElement_FP64 (s1, 1)) ;
+                    OK (GrB_Scalar_setElement_FP64 (s2, 1)) ;
+                    OK (GrB_Matrix_reduce_Monoid_Scalar (s1, GrB_PLUS_FP64,
+                        GrB_PLUS_MONOID_FP64, T, NULL)) ;
+                    OK (GxB_mxm_reduce_Scalar (s2, GrB_PLUS_FP64,
+                        GrB_PLUS_MONOID_FP64, Mask,
+                        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc [k])) ;
+                    OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+                    OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+                    CHECK (x1 == x2) ;
+
+                    // s = max (T)
+                    OK (GrB_Scalar_clear (s1)) ;
+                    OK (GrB_Scalar_clear (s2)) ;
+                    OK (GrB_Matrix_reduce_Monoid_Scalar (s1, NULL,
+                        GrB_MAX_MONOID_FP64, T, NULL)) ;
+                    OK (GxB_mxm_reduce_Scalar (s2, NULL,
+                        GrB_MAX_MONOID_FP64, Mask,
+                        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc [k])) ;
+                    OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+                    OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+                    CHECK (x1 == x2) ;
+
+                    // C<M> = select (T)
+                    for (int o = 0 ; o < 2 ; o++)
+                    {
+                        OK (GrB_Matrix_clear (C1)) ;
+                        OK (GrB_Matrix_clear (C2)) ;
+                        OK (GrB_Matrix_select_Scalar (C1, Mask, NULL, ops [o],
+                            T, y, NULL)) ;
+                        OK (GxB_mxm_select (C2, Mask, NULL,
+                            GrB_PLUS_TIMES_SEMIRING_FP64, A, B, ops [o], y,
+                            desc [k])) ;
+                        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    }
+
+                    // C<M> += select (T)
+                    GrB_Matrix_free (&C1) ;
+                    GrB_Matrix_free (&C2) ;
+                    OK (GrB_Matrix_dup (&C1, B)) ;
+                    OK (GrB_Matrix_dup (&C2, B)) ;
+                    OK (GrB_Matrix_select_Scalar (C1, Mask, GrB_PLUS_FP64,
+                        GrB_VALUEGE_FP64, T, y, NULL)) ;
+                    OK (GxB_mxm_select (C2, Mask, GrB_PLUS_FP64,
+                        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_VALUEGE_FP64,
+                        y, desc [k])) ;
+                    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                }
+            }
+        }
+    }
+    GB_Global_hack_set (6, 0) ;
+
+    //--------------------------------------------------------------------------
+    // empty product
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_clear (T)) ;
+    OK (GrB_Scalar_setElement_FP64 (s2, 3)) ;
+    OK (GxB_mxm_reduce_Scalar (s2, GrB_PLUS_FP64, GrB_PLUS_MONOID_FP64, NULL,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, T, NULL)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+    CHECK (x2 == 3) ;
+    OK (GxB_mxm_reduce_Scalar (s2, NULL, GrB_PLUS_MONOID_FP64, NULL,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, T, NULL)) ;
+    GrB_Index nvals ;
+    OK (GrB_Scalar_nvals (&nvals, s2)) ;
+    CHECK (nvals == 0) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix R = NULL ;
+    OK (GrB_Matrix_new (&R, GrB_FP64, n, n+1)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_mxm_reduce_Scalar (s2, NULL, GrB_PLUS_MONOID_FP64, R,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    ERR (GxB_mxm_reduce_Scalar (s2, NULL, GrB_PLUS_MONOID_FP64, NULL,
+        GrB_PLUS_TIMES_SEMIRING_FP64, R, B, NULL)) ;
+    ERR (GxB_mxm_select (R, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        GrB_VALUEGE_FP64, y, NULL)) ;
+    GrB_Matrix_free (&R) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_mxm_reduce_Scalar (s2, NULL, NULL, NULL,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    ERR (GxB_mxm_select (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        NULL, y, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48:  all tests passed\n\n") ;
+}
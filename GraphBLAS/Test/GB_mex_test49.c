@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test the tiled GrB_kronecker and GxB_Matrix_kronecker_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&S) ;              \
+    GrB_Scalar_free (&y) ;              \
+    GrB_Scalar_free (&e) ;              \
+}
+
+//------------------------------------------------------------------------------
+// same: check if two matrices have the same entries
+//------------------------------------------------------------------------------
+
+// The matrices are computed in different ways, so they may differ in their
+// sparsity structure and integer sizes; only their entries are compared.
+
+static GrB_Info same (bool *result, GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info ;
+    GrB_Matrix E = NULL ;
+    GrB_Index n, nvals1, nvals2, nvals ;
+    bool all_equal = true ;
+    OK (GrB_Matrix_nrows (&n, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals1, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, C2)) ;
+    OK (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (E, NULL, NULL, GrB_EQ_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals, E)) ;
+    OK (GrB_Matrix_reduce_BOOL (&all_equal, NULL, GrB_LAND_MONOID_BOOL, E,
+        NULL)) ;
+    GrB_Matrix_free (&E) ;
+    (*result) = (nvals1 == nvals2) && (nvals == nvals1) && all_equal ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// tile_function: assign each tile into the matrix S
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GrB_Matrix S ;          // result, assembled from the tiles
+    int64_t ntiles ;        // # of tiles seen so far
+    int64_t fail_at ;       // return an error on this tile, if > 0
+}
+tile_arg ;
+
+static GrB_Info tile_function (const GrB_Matrix Tile, uint64_t row_offset,
+    uint64_t col_offset, void *arg)
+{
+    GrB_Info info ;
+    tile_arg *t = (tile_arg *) arg ;
+    t->ntiles++ ;
+    if (t->ntiles == t->fail_at) return (GrB_INVALID_VALUE) ;
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, Tile)) ;
+    OK (GrB_Matrix_ncols (&ncols, Tile)) ;
+    OK (GrB_Matrix_nvals (&nvals, Tile)) ;
+    CHECK (nvals > 0) ;
+    uint64_t Rows [2] = { row_offset, row_offset + nrows - 1 } ;
+    uint64_t Cols [2] = { col_offset, col_offset + ncols - 1 } ;
+    OK (GrB_Matrix_assign (t->S, NULL, NULL, Tile, Rows, GxB_RANGE, Cols,
+        GxB_RANGE, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL, S = NULL ;
+    GrB_Scalar y = NULL, e = NULL ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    bool ok ;
+    GrB_Index cnvals ;
+    int64_t an = 20, bn = 12, n = an * bn ;
+    tile_arg t ;
+
+    simple_rand_seed (1) ;
+    OK (GB_mx_random_matrix (&A, false, false, an, an, 4*an, 0, false)) ;
+    OK (GB_mx_random_matrix (&B, false, false, bn, bn, 4*bn, 0, false)) ;
+    OK (GB_mx_random_matrix (&M, false, false, n, n, 8*n, 0, false)) ;
+    GrB_Matrix Inputs [3] = { A, B, M } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        // use integer values 1 to 10, so that the results are exact
+        OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (Inputs [k], NULL, NULL,
+            GrB_TIMES_FP64, Inputs [k], 10, NULL)) ;
+        OK (GrB_Matrix_apply (Inputs [k], NULL, NULL, GxB_FLOOR_FP64,
+            Inputs [k], NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (Inputs [k], NULL, NULL,
+            GrB_PLUS_FP64, Inputs [k], 1, NULL)) ;
+    }
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&S, GrB_FP64, n, n)) ;
+    OK (GrB_Scalar_new (&y, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&e, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (y, 20)) ;
+
+    //--------------------------------------------------------------------------
+    // compare with GrB_kronecker computed all at once
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor desc [4] = { NULL, GrB_DESC_T0, GrB_DESC_ST1,
+        GrB_DESC_SCT0T1 } ;
+    int64_t tiles [2] = { 100, 1 } ;
+
+    for (int fmt = 0 ; fmt < 2 ; fmt++)
+    {
+        // all matrices by row, then all by column
+        int32_t orientation = (fmt == 0) ? GrB_ROWMAJOR : GrB_COLMAJOR ;
+        OK (GrB_Matrix_set_INT32 (A, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (B, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (M, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (C2, orientation,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            for (int masked = 0 ; masked < 2 ; masked++)
+            {
+                GrB_Matrix Mask = (masked) ? M : NULL ;
+
+                // C1<M> = kron (A,B), all at once
+                GB_Global_hack_set (7, 0) ;
+                OK (GrB_Matrix_clear (C1)) ;
+                OK (GrB_Matrix_kronecker_BinaryOp (C1, Mask, NULL,
+                    GrB_TIMES_FP64, A, B, desc [k])) ;
+                OK (GrB_Matrix_nvals (&cnvals, C1)) ;
+
+                for (int c = 0 ; c < 2 ; c++)
+                {
+                    // force many tiles
+                    GB_Global_hack_set (7, tiles [c]) ;
+
+                    // C2<M> = kron (A,B), in tiles
+                    OK (GrB_Matrix_clear (C2)) ;
+                    OK (GrB_Matrix_kronecker_BinaryOp (C2, Mask, NULL,
+                        GrB_TIMES_FP64, A, B, desc [k])) ;
+                    OK (same (&ok, C1, C2)) ;
+                    CHECK (ok) ;
+
+                    // S<M> = kron (A,B), streamed one tile at a time
+                    OK (GrB_Matrix_clear (S)) ;
+                    t.S = S ; t.ntiles = 0 ; t.fail_at = 0 ;
+                    OK (GxB_Matrix_kronecker_stream (tile_function, &t, Mask,
+                        GrB_TIMES_FP64, A, B, NULL, NULL, desc [k])) ;
+                    OK (same (&ok, C1, S)) ;
+                    CHECK (ok) ;
+                    CHECK ((cnvals == 0) ? (t.ntiles == 0) : (t.ntiles > 1)) ;
+
+                    // S<M> = select (kron (A,B) >= y), streamed
+                    OK (GrB_Matrix_clear (S)) ;
+                    OK (GrB_Matrix_clear (C2)) ;
+                    OK (GrB_Matrix_select_Scalar (C2, NULL, NULL,
+                        GrB_VALUEGE_FP64, C1, y, NULL)) ;
+                    t.ntiles = 0 ;
+                    OK (GxB_Matrix_kronecker_stream (tile_function, &t, Mask,
+                        GrB_TIMES_FP64, A, B, GrB_VALUEGE_FP64, y, desc [k])) ;
+                    OK (same (&ok, C2, S)) ;
+                    CHECK (ok) ;
+
+                    // S<M> = tril (kron (A,B),y), streamed as a single tile
+                    OK (GrB_Matrix_clear (S)) ;
+                    OK (GrB_Matrix_clear (C2)) ;
+                    OK (GrB_Matrix_select_Scalar (C2, NULL, NULL, GrB_TRIL,
+                        C1, y, NULL)) ;
+                    t.ntiles = 0 ;
+                    OK (GxB_Matrix_kronecker_stream (tile_function, &t, Mask,
+                        GrB_TIMES_FP64, A, B, GrB_TRIL, y, desc [k])) ;
+                    OK (same (&ok, C2, S)) ;
+                    CHECK (ok) ;
+                    CHECK (t.ntiles <= 1) ;
+                }
+            }
+        }
+
+        // positional operators are computed as a single tile
+        GB_Global_hack_set (7, 0) ;
+        OK (GrB_Matrix_clear (C1)) ;
+        OK (GrB_Matrix_kronecker_BinaryOp (C1, M, NULL, GxB_FIRSTI_INT64,
+            A, B, NULL)) ;
+        GB_Global_hack_set (7, 100) ;
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_Matrix_kronecker_BinaryOp (C2, M, NULL, GxB_FIRSTI_INT64,
+            A, B, NULL)) ;
+        OK (same (&ok, C1, C2)) ;
+        CHECK (ok) ;
+        OK (GrB_Matrix_clear (S)) ;
+        t.ntiles = 0 ;
+        OK (GxB_Matrix_kronecker_stream (tile_function, &t, M,
+            GxB_FIRSTI_INT64, A, B, NULL, NULL, NULL)) ;
+        OK (same (&ok, C1, S)) ;
+        CHECK (ok) ;
+        CHECK (t.ntiles == 1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the tile_function can terminate the computation
+    //--------------------------------------------------------------------------
+
+    GB_Global_hack_set (7, 100) ;
+    OK (GrB_Matrix_clear (S)) ;
+    t.ntiles = 0 ;
+    t.fail_at = 2 ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_kronecker_stream (tile_function, &t, NULL,
+        GrB_TIMES_FP64, A, B, NULL, NULL, NULL)) ;
+    CHECK (t.ntiles == 2) ;
+    GB_Global_hack_set (7, 0) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_kronecker_stream (NULL, &t, NULL, GrB_TIMES_FP64, A, B,
+        NULL, NULL, NULL)) ;
+    ERR (GxB_Matrix_kronecker_stream (tile_function, &t, NULL, NULL, A, B,
+        NULL, NULL, NULL)) ;
+    ERR (GxB_Matrix_kronecker_stream (tile_function, &t, NULL, GrB_TIMES_FP64,
+        A, B, GrB_VALUEGE_FP64, NULL, NULL)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_Matrix_kronecker_stream (tile_function, &t, A, GrB_TIMES_FP64,
+        A, B, NULL, NULL, NULL)) ;
+    expected = GrB_EMPTY_OBJECT ;
+    ERR (GxB_Matrix_kronecker_stream (tile_function, &t, NULL, GrB_TIMES_FP64,
+        A, B, GrB_VALUEGE_FP64, e, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49:  all tests passed\n\n") ;
+}
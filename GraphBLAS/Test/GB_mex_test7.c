@@ -334,6 +334,166 @@ void mexFunction
     bool have_avx512f = GB_Global_cpu_features_avx512f ( ) ;
     printf ("\navx2: %d avx512f: %d\n", have_avx2, have_avx512f) ;
 
+    //--------------------------------------------------------------------------
+    // ISA variants of the FactoryKernels
+    //--------------------------------------------------------------------------
+
+    // GrB_init chooses the widest ISA that the compiler and the CPU support.
+    // The FactoryKernels compiled for each ISA up to that one must give the
+    // same results as the baseline kernels.
+
+    int cpu_isa = GB_Global_cpu_isa_get ( ) ;
+    printf ("cpu_isa: %d\n", cpu_isa) ;
+    CHECK (cpu_isa >= GB_CPU_ISA_BASELINE && cpu_isa <= GB_CPU_ISA_AVX512F) ;
+    CHECK (cpu_isa != GB_CPU_ISA_AVX2 || have_avx2) ;
+    CHECK (cpu_isa != GB_CPU_ISA_AVX512F || have_avx512f) ;
+    GB_Global_cpu_isa_set (GB_CPU_ISA_AVX512F + 1) ;
+    CHECK (GB_Global_cpu_isa_get ( ) == cpu_isa) ;
+
+    #define NISA 22
+    GrB_Matrix F = NULL, G = NULL, Ff = NULL, Fi = NULL, Gi = NULL, M = NULL,
+        T = NULL, Cbase [NISA] ;
+    GrB_Descriptor d_saxpy = NULL, d_saxpy_comp = NULL, d_dot = NULL,
+        d_dot_comp = NULL ;
+    double rbase [2] ;
+    int64_t nisa = 1000 ;
+    OK (GrB_Matrix_new (&F, GrB_FP64, nisa, nisa)) ;
+    OK (GrB_Matrix_new (&G, GrB_FP64, nisa, nisa)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, nisa, nisa)) ;
+    for (int64_t j = 0 ; j < nisa ; j++)
+    {
+        for (int64_t t = 0 ; t < 5 ; t++)
+        {
+            int64_t i1 = (j * 31 + t * 97 + t * t * 13) % nisa ;
+            int64_t i2 = (j * 17 + t * 193 + 7) % nisa ;
+            int64_t i3 = (j * 7 + t * 101) % nisa ;
+            OK (GrB_Matrix_setElement_FP64 (F,
+                (double) ((i1 + j) % 11) - 5.25, i1, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (G,
+                (double) ((i2 * j) % 7) + 0.5, i2, j)) ;
+            OK (GrB_Matrix_setElement_BOOL (M, true, i3, j)) ;
+        }
+    }
+    OK (GrB_Matrix_new (&Ff, GrB_FP32, nisa, nisa)) ;
+    OK (GrB_Matrix_new (&Fi, GrB_INT64, nisa, nisa)) ;
+    OK (GrB_Matrix_new (&Gi, GrB_INT64, nisa, nisa)) ;
+    OK (GrB_apply (Ff, NULL, NULL, GrB_IDENTITY_FP32, F, NULL)) ;
+    OK (GrB_apply (Fi, NULL, NULL, GrB_IDENTITY_INT64, F, NULL)) ;
+    OK (GrB_apply (Gi, NULL, NULL, GrB_IDENTITY_INT64, G, NULL)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Descriptor_new (&d_saxpy)) ;
+    OK (GrB_Descriptor_set (d_saxpy, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_Descriptor_new (&d_saxpy_comp)) ;
+    OK (GrB_Descriptor_set (d_saxpy_comp, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_Descriptor_set (d_saxpy_comp, GrB_MASK, GrB_COMP)) ;
+    OK (GrB_Descriptor_new (&d_dot)) ;
+    OK (GrB_Descriptor_set (d_dot, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GrB_Descriptor_set (d_dot, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_new (&d_dot_comp)) ;
+    OK (GrB_Descriptor_set (d_dot_comp, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GrB_Descriptor_set (d_dot_comp, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (d_dot_comp, GrB_MASK, GrB_COMP)) ;
+
+    // the floating-point dot products use SIMD reductions, whose order of
+    // summation depends on the width of the vectors
+    #define ISA_RESULT(eps)                                         \
+    {                                                               \
+        if (isa == GB_CPU_ISA_BASELINE)                             \
+        {                                                           \
+            Cbase [k] = T ;                                         \
+            T = NULL ;                                              \
+        }                                                           \
+        else                                                        \
+        {                                                           \
+            CHECK (GB_mx_isequal (T, Cbase [k], eps)) ;             \
+            OK (GrB_Matrix_free (&T)) ;                             \
+        }                                                           \
+        k++ ;                                                       \
+    }
+
+    // saxpy3: C=A*B, C<M>=A*B, and C<!M>=A*B
+    // dot2: C=A'*B and C<!M>=A'*B
+    // dot3: C<M>=A'*B
+    GrB_Matrix Mask [6] = { NULL, M, M, NULL, M, M } ;
+    GrB_Descriptor Desc [6] = { d_saxpy, d_saxpy, d_saxpy_comp, d_dot,
+        d_dot_comp, d_dot } ;
+
+    for (int isa = GB_CPU_ISA_BASELINE ; isa <= cpu_isa ; isa++)
+    {
+        GB_Global_cpu_isa_set (isa) ;
+        CHECK (GB_Global_cpu_isa_get ( ) == isa) ;
+        printf ("testing the FactoryKernels for cpu_isa %d\n", isa) ;
+        int k = 0 ;
+
+        // mxm with the plus_times, min_plus, and any_pair semirings
+        for (int kind = 0 ; kind < 3 ; kind++)
+        {
+            GrB_Semiring semiring =
+                (kind == 0) ? GrB_PLUS_TIMES_SEMIRING_FP64 :
+                (kind == 1) ? GrB_MIN_PLUS_SEMIRING_INT64  : GxB_ANY_PAIR_FP64 ;
+            GrB_Type type = (kind == 1) ? GrB_INT64 : GrB_FP64 ;
+            GrB_Matrix X1 = (kind == 1) ? Fi : F ;
+            GrB_Matrix Y1 = (kind == 1) ? Gi : G ;
+            double eps = (kind == 1) ? 0 : 1e-12 ;
+            for (int c = 0 ; c < 6 ; c++)
+            {
+                OK (GrB_Matrix_new (&T, type, nisa, nisa)) ;
+                OK (GrB_mxm (T, Mask [c], NULL, semiring, X1, Y1, Desc [c])) ;
+                ISA_RESULT (eps) ;
+            }
+        }
+
+        // apply
+        OK (GrB_Matrix_new (&T, GrB_FP64, nisa, nisa)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_ABS_FP64, F, NULL)) ;
+        ISA_RESULT (0) ;
+        OK (GrB_Matrix_new (&T, GrB_FP64, nisa, nisa)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_MINV_FP64, F, NULL)) ;
+        ISA_RESULT (0) ;
+        OK (GrB_Matrix_new (&T, GrB_FP32, nisa, nisa)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_AINV_FP32, Ff, NULL)) ;
+        ISA_RESULT (0) ;
+        OK (GrB_Matrix_new (&T, GrB_INT64, nisa, nisa)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_AINV_INT64, Fi, NULL)) ;
+        ISA_RESULT (0) ;
+        CHECK (k == NISA) ;
+
+        // reduce to scalar
+        double r [2] ;
+        OK (GrB_Matrix_reduce_FP64 (&r [0], NULL, GrB_PLUS_MONOID_FP64, F,
+            NULL)) ;
+        OK (GrB_Matrix_reduce_FP64 (&r [1], NULL, GrB_MIN_MONOID_FP64, F,
+            NULL)) ;
+        if (isa == GB_CPU_ISA_BASELINE)
+        {
+            rbase [0] = r [0] ;
+            rbase [1] = r [1] ;
+        }
+        else
+        {
+            CHECK (fabs (r [0] - rbase [0]) <= 1e-12 * fabs (rbase [0])) ;
+            CHECK (r [1] == rbase [1]) ;
+        }
+    }
+
+    GB_Global_cpu_isa_set (cpu_isa) ;
+    CHECK (GB_Global_cpu_isa_get ( ) == cpu_isa) ;
+    for (int k = 0 ; k < NISA ; k++)
+    {
+        OK (GrB_Matrix_free (&Cbase [k])) ;
+    }
+    OK (GrB_Matrix_free (&F)) ;
+    OK (GrB_Matrix_free (&G)) ;
+    OK (GrB_Matrix_free (&Ff)) ;
+    OK (GrB_Matrix_free (&Fi)) ;
+    OK (GrB_Matrix_free (&Gi)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Descriptor_free (&d_saxpy)) ;
+    OK (GrB_Descriptor_free (&d_saxpy_comp)) ;
+    OK (GrB_Descriptor_free (&d_dot)) ;
+    OK (GrB_Descriptor_free (&d_dot_comp)) ;
+
     //--------------------------------------------------------------------------
     // compiler
     //--------------------------------------------------------------------------
@@ -0,0 +1,9 @@
+function test300
+%TEST300 GxB_Matrix_mmap_save and GxB_Matrix_mmap
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test43 ;
+fprintf ('\ntest300: all tests passed\n') ;
+
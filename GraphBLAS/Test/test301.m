@@ -0,0 +1,9 @@
+function test301
+%TEST301 GrB_Matrix_build with sorted and partially sorted input
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test44 ;
+fprintf ('\ntest301: all tests passed\n') ;
+
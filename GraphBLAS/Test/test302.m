@@ -0,0 +1,8 @@
+function test302
+%TEST302 GrB_extractElement on matrices with pending tuples
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test45 ;
+fprintf ('\ntest302: all tests passed\n') ;
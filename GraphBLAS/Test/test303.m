@@ -0,0 +1,8 @@
+function test303
+%TEST303 CPU memory pool
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test46 ;
+fprintf ('\ntest303: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test304
+%TEST304 cost model for C<M>=A*B
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('\ntest304: all tests passed\n') ;
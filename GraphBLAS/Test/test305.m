@@ -0,0 +1,8 @@
+function test305
+%TEST305 fused mxm + reduce and mxm + select
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test48 ;
+fprintf ('\ntest305: all tests passed\n') ;
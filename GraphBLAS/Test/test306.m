@@ -0,0 +1,8 @@
+function test306
+%TEST306 tiled kronecker and GxB_Matrix_kronecker_stream
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2025, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test49 ;
+fprintf ('\ntest306: all tests passed\n') ;
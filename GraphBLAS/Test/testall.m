@@ -120,6 +120,13 @@ F100 = {4,4,0,0} ;
 
 % < 1 second: debug_off
 set_malloc_debug (mdebug, 0) ;
+logstat ('test306'    ,t, J0   , F0   ) ; % tiled kronecker and kron stream
+logstat ('test305'    ,t, J0   , F0   ) ; % fused mxm + reduce/select
+logstat ('test304'    ,t, J0   , F0   ) ; % cost model for C<M>=A*B
+logstat ('test303'    ,t, J0   , F0   ) ; % CPU memory pool
+logstat ('test302'    ,t, J0   , F0   ) ; % extractElement with pending tuples
+logstat ('test301'    ,t, J0   , F0   ) ; % build with sorted input
+logstat ('test300'    ,t, J0   , F0   ) ; % mmap save and load
 logstat ('test299'    ,t, J0   , F0   ) ; % unload a vector, with wait
 logstat ('test298'    ,t, J40  , F10  ) ; % assign 08n when A is full
 logstat ('test297'    ,t, J4   , F0   ) ; % plus_one semiring
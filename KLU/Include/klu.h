@@ -211,6 +211,29 @@ typedef struct klu_common_struct
     size_t memusage ;   /* current memory usage, in bytes */
     size_t mempeak ;    /* peak memory usage, in bytes */
 
+    /* ---------------------------------------------------------------------- */
+    /* parameters (placed last to preserve the layout of the fields above) */
+    /* ---------------------------------------------------------------------- */
+
+    int nthreads ;      /* # of OpenMP threads used by klu_factor and
+        * klu_refactor to factorize independent diagonal blocks of the BTF
+        * form in parallel, and by klu_solve and klu_tsolve to solve chunks
+        * of right-hand sides in parallel (when nrhs > 4).  1: sequential
+        * (the default).  > 1: use up to this many threads.  <= 0: use the
+        * OpenMP default.  The results do not depend on the number of
+        * threads, except that mempeak also includes the workspace of the
+        * extra threads.  Ignored if KLU is not compiled with OpenMP. */
+
+    int dense_size ;    /* a diagonal block of the BTF form of dimension
+        * nk >= dense_size is factorized with a blocked dense LU kernel,
+        * instead of the sparse kernel, if its LU factors are expected to be
+        * nearly dense (see dense_ratio).  <= 0: the dense kernel is never
+        * used (the default). */
+
+    double dense_ratio ;    /* a block of dimension nk >= dense_size is
+        * treated as dense if nnz(L+U) is estimated to be at least
+        * dense_ratio*nk^2.  Default: 0.5 */
+
 } klu_common ;
 
 typedef struct klu_l_common_struct /* 64-bit version (otherwise same as above)*/
@@ -225,6 +248,8 @@ typedef struct klu_l_common_struct /* 64-bit version (otherwise same as above)*/
     int64_t structural_rank, numerical_rank, singular_col, noffdiag ;
     double flops, rcond, condest, rgrowth, work ;
     size_t memusage, mempeak ;
+    int nthreads, dense_size ;
+    double dense_ratio ;
 
 } klu_l_common ;
 
@@ -754,6 +779,94 @@ int klu_zl_extract (klu_l_numeric *, klu_l_symbolic *,
     int64_t *, klu_l_common *) ;
 
 
+/* -------------------------------------------------------------------------- */
+/* klu_serialize_symbolic, klu_serialize_numeric, and their inverses */
+/* -------------------------------------------------------------------------- */
+
+/* A Symbolic or Numeric object can be saved into a single array of bytes (a
+ * "blob"), which can be written to a file, and read back later to reconstruct
+ * the object without calling klu_analyze or klu_factor again.  The blob must
+ * be allocated by the caller; its size is given by klu_serialize_*_size.
+ * A blob can only be read back by the same variant of KLU (real or complex,
+ * int32_t or int64_t) on a machine with the same word sizes.  The
+ * deserialized Numeric object must be used with the Symbolic object that was
+ * used to compute it, which is passed to klu_deserialize_numeric.  The
+ * deserialize functions check the contents of the blob, and return NULL if
+ * it does not hold a valid object. */
+
+int klu_serialize_symbolic_size     /* returns TRUE if successful */
+(
+    klu_symbolic *Symbolic,     /* input, not modified */
+    int64_t *blobsize,          /* output: required size of the blob */
+    klu_common *Common
+) ;
+
+int klu_serialize_symbolic          /* returns TRUE if successful */
+(
+    klu_symbolic *Symbolic,     /* input, not modified */
+    int8_t *blob,               /* output: of size blobsize */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    klu_common *Common
+) ;
+
+klu_symbolic *klu_deserialize_symbolic  /* returns NULL if error */
+(
+    int8_t *blob,               /* input: blob from klu_serialize_symbolic */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    klu_common *Common
+) ;
+
+int klu_serialize_numeric_size      /* returns TRUE if successful */
+(
+    klu_numeric *Numeric,       /* input, not modified */
+    int64_t *blobsize,          /* output: required size of the blob */
+    klu_common *Common
+) ;
+
+int klu_serialize_numeric           /* returns TRUE if successful */
+(
+    klu_numeric *Numeric,       /* input, not modified */
+    int8_t *blob,               /* output: of size blobsize */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    klu_common *Common
+) ;
+
+klu_numeric *klu_deserialize_numeric    /* returns NULL if error */
+(
+    int8_t *blob,               /* input: blob from klu_serialize_numeric */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    klu_symbolic *Symbolic,     /* input: Symbolic object used to compute the
+                                 * Numeric object held in the blob */
+    klu_common *Common
+) ;
+
+int klu_z_serialize_numeric_size (klu_numeric *, int64_t *, klu_common *) ;
+int klu_z_serialize_numeric (klu_numeric *, int8_t *, int64_t, klu_common *) ;
+klu_numeric *klu_z_deserialize_numeric (int8_t *, int64_t, klu_symbolic *,
+    klu_common *) ;
+
+int klu_l_serialize_symbolic_size (klu_l_symbolic *, int64_t *,
+    klu_l_common *) ;
+int klu_l_serialize_symbolic (klu_l_symbolic *, int8_t *, int64_t,
+    klu_l_common *) ;
+klu_l_symbolic *klu_l_deserialize_symbolic (int8_t *, int64_t,
+    klu_l_common *) ;
+
+int klu_l_serialize_numeric_size (klu_l_numeric *, int64_t *,
+    klu_l_common *) ;
+int klu_l_serialize_numeric (klu_l_numeric *, int8_t *, int64_t,
+    klu_l_common *) ;
+klu_l_numeric *klu_l_deserialize_numeric (int8_t *, int64_t,
+    klu_l_symbolic *, klu_l_common *) ;
+
+int klu_zl_serialize_numeric_size (klu_l_numeric *, int64_t *,
+    klu_l_common *) ;
+int klu_zl_serialize_numeric (klu_l_numeric *, int8_t *, int64_t,
+    klu_l_common *) ;
+klu_l_numeric *klu_zl_deserialize_numeric (int8_t *, int64_t,
+    klu_l_symbolic *, klu_l_common *) ;
+
+
 /* -------------------------------------------------------------------------- */
 /* KLU memory management routines */
 /* -------------------------------------------------------------------------- */
@@ -823,33 +936,33 @@ void klu_version (int version [3]) ;
  *      #endif
  */
 
-#define KLU_DATE "Oct 10, 2024"
-#define KLU_MAIN_VERSION   2
-#define KLU_SUB_VERSION    3
-#define KLU_SUBSUB_VERSION 5
+#define KLU_DATE "Oct 18, 2026"
+#define KLU_MAIN_VERSION   3
+#define KLU_SUB_VERSION    0
+#define KLU_SUBSUB_VERSION 0
 
 #define KLU_VERSION_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define KLU_VERSION KLU_VERSION_CODE(2,3)
+#define KLU_VERSION KLU_VERSION_CODE(3,0)
 
-#define KLU__VERSION SUITESPARSE__VERCODE(2,3,5)
+#define KLU__VERSION SUITESPARSE__VERCODE(3,0,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,3))
-#error "KLU 2.3.5 requires SuiteSparse_config 7.8.3 or later"
+#error "KLU 3.0.0 requires SuiteSparse_config 7.8.3 or later"
 #endif
 
 #if !defined (AMD__VERSION) || \
     (AMD__VERSION < SUITESPARSE__VERCODE(3,3,3))
-#error "KLU 2.3.5 requires AMD 3.3.3 or later"
+#error "KLU 3.0.0 requires AMD 3.3.3 or later"
 #endif
 
 #if !defined (COLAMD__VERSION) || \
     (COLAMD__VERSION < SUITESPARSE__VERCODE(3,3,4))
-#error "KLU 2.3.5 requires COLAMD 3.3.4 or later"
+#error "KLU 3.0.0 requires COLAMD 3.3.4 or later"
 #endif
 
 #if !defined (BTF__VERSION) || \
     (BTF__VERSION < SUITESPARSE__VERCODE(2,3,2))
-#error "KLU 2.3.5 requires BTF 2.3.2 or later"
+#error "KLU 3.0.0 requires BTF 2.3.2 or later"
 #endif
 
 #endif
@@ -118,7 +118,7 @@ size_t KLU_kernel   /* final size of LU on output */
     double Rs [ ],      /* scale factors for A */
 
     /* inputs, modified on output */
-    Int Offp [ ],   /* off-diagonal matrix (modified by this routine) */
+    Int Offp [ ],   /* off-diagonal column pointers (not modified) */
     Int Offi [ ],
     Entry Offx [ ],
     KLU_common *Common  /* the control input/output structure */
@@ -156,7 +156,43 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     double Rs [ ],      /* scale factors for A */
 
     /* inputs, modified on output */
-    Int Offp [ ],   /* off-diagonal matrix (modified by this routine) */
+    Int Offp [ ],   /* off-diagonal column pointers (not modified) */
+    Int Offi [ ],
+    Entry Offx [ ],
+    KLU_common *Common  /* the control input/output structure */
+) ;
+
+Int KLU_dense_factor        /* TRUE if successful, FALSE if out of memory */
+(
+    /* inputs, not modified */
+    Int n,          /* the block is n-by-n. n must be > 0. */
+    Int Ap [ ],     /* size n+1, column pointers for A */
+    Int Ai [ ],     /* size nz = Ap [n], row indices for A */
+    Entry Ax [ ],   /* size nz, values of A */
+    Int Q [ ],      /* size n, column permutation */
+
+    /* outputs, not defined on input */
+    Unit **p_LU,        /* row indices and values of L and U */
+    size_t *p_lusize,   /* size of LU, in Units */
+    Entry Udiag [ ],    /* size n, diagonal of U */
+    Int Llen [ ],       /* size n, column length of L */
+    Int Ulen [ ],       /* size n, column length of U */
+    Int Lip [ ],        /* size n, column pointers for L */
+    Int Uip [ ],        /* size n, column pointers for U */
+    Int P [ ],          /* row permutation, size n */
+    Int *lnz,           /* size of L */
+    Int *unz,           /* size of U */
+
+    /* workspace, undefined on input */
+    Int *Work,      /* size 3n Int's */
+
+    /* inputs, not modified on output */
+    Int k1,             /* the block of A is from k1 to k2-1 */
+    Int PSinv [ ],      /* inverse of P from symbolic factorization */
+    double Rs [ ],      /* scale factors for A */
+
+    /* inputs, modified on output */
+    Int Offp [ ],   /* off-diagonal column pointers (not modified) */
     Int Offi [ ],
     Entry Offx [ ],
     KLU_common *Common  /* the control input/output structure */
@@ -242,4 +278,129 @@ size_t KLU_mult_size_t (size_t a, size_t k, Int *ok) ;
 
 KLU_symbolic *KLU_alloc_symbolic (Int n, Int *Ap, Int *Ai, KLU_common *Common) ;
 
+/* ========================================================================== */
+/* === OpenMP support ======================================================= */
+/* ========================================================================== */
+
+/* returns the # of threads to use for ntasks independent tasks (the diagonal
+ * blocks in klu_factor and klu_refactor, or the chunks of right-hand sides in
+ * klu_solve and klu_tsolve) */
+static inline int KLU_nthreads (Int ntasks, KLU_common *Common)
+{
+#ifdef _OPENMP
+    int nthreads = Common->nthreads ;
+    if (nthreads <= 0)
+    {
+        nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    }
+    nthreads = (int) MIN ((Int) nthreads, ntasks) ;
+    return (MAX (nthreads, 1)) ;
+#else
+    return (1) ;
+#endif
+}
+
+/* ========================================================================== */
+/* === blocked solve with many right-hand sides ============================= */
+/* ========================================================================== */
+
+/* klu_solve and klu_tsolve normally handle the right-hand sides 4 at a time,
+ * so L and U are traversed once for every 4 columns of B.  With more than 4
+ * right-hand sides, they are instead solved in chunks of up to
+ * KLU_SOLVE_MAX_WIDTH columns, so that each column of L and U is used for
+ * many right-hand sides while it is in cache.  The chunk width is chosen so
+ * that the n-by-width workspace fits in about KLU_SOLVE_CACHE bytes, but it
+ * is never less than KLU_SOLVE_MIN_WIDTH. */
+
+#ifndef KLU_SOLVE_CACHE
+#define KLU_SOLVE_CACHE (1024 * 1024)
+#endif
+
+#ifndef KLU_SOLVE_MIN_WIDTH
+#define KLU_SOLVE_MIN_WIDTH 8
+#endif
+
+#ifndef KLU_SOLVE_MAX_WIDTH
+#define KLU_SOLVE_MAX_WIDTH 32
+#endif
+
+/* returns the # of columns of B to solve at a time, for nrhs > 4 */
+static inline Int KLU_solve_width (Int n, Int nrhs)
+{
+    Int width, nchunks ;
+    width = (Int) (KLU_SOLVE_CACHE / (MAX (n, 1) * sizeof (Entry))) ;
+    width = MAX (width, KLU_SOLVE_MIN_WIDTH) ;
+    width = MIN (width, KLU_SOLVE_MAX_WIDTH) ;
+    /* split the nrhs columns into chunks of nearly equal width */
+    nchunks = (nrhs + width - 1) / width ;
+    return ((nrhs + nchunks - 1) / nchunks) ;
+}
+
+/* ========================================================================== */
+/* === serialized Symbolic and Numeric objects ============================== */
+/* ========================================================================== */
+
+/* A blob created by klu_serialize_symbolic or klu_serialize_numeric starts
+ * with a header: the int64_t size of the blob, followed by 10 int32_t's: the
+ * tag, the KLU main, sub, and subsub version, and the sizes of the object
+ * struct, Entry, Int, Unit, double, and (void *).  A blob can only be read
+ * back by the same variant of KLU (real or complex, int32_t or int64_t) on
+ * a machine with the same word sizes. */
+
+#define KLU_BLOB_SYMBOLIC 0x4B4C5553    /* "KLUS" */
+#define KLU_BLOB_NUMERIC  0x4B4C554E    /* "KLUN" */
+#define KLU_BLOB_HEADER_SIZE (sizeof (int64_t) + 10 * sizeof (int32_t))
+
+static inline void KLU_blob_header
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int32_t tag,
+    int32_t sizeof_object
+)
+{
+    int32_t h [10] ;
+    h [0] = tag ;
+    h [1] = KLU_MAIN_VERSION ;
+    h [2] = KLU_SUB_VERSION ;
+    h [3] = KLU_SUBSUB_VERSION ;
+    h [4] = sizeof_object ;
+    h [5] = (int32_t) sizeof (Entry) ;
+    h [6] = (int32_t) sizeof (Int) ;
+    h [7] = (int32_t) sizeof (Unit) ;
+    h [8] = (int32_t) sizeof (double) ;
+    h [9] = (int32_t) sizeof (void *) ;
+    memcpy (blob, &blobsize, sizeof (int64_t)) ;
+    memcpy (blob + sizeof (int64_t), h, 10 * sizeof (int32_t)) ;
+}
+
+/* returns TRUE if the blob header matches, FALSE otherwise */
+static inline int KLU_blob_header_ok
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int32_t tag,
+    int32_t sizeof_object
+)
+{
+    int64_t required ;
+    int32_t h [10] ;
+    if (blobsize < (int64_t) KLU_BLOB_HEADER_SIZE)
+    {
+        return (FALSE) ;
+    }
+    memcpy (&required, blob, sizeof (int64_t)) ;
+    memcpy (h, blob + sizeof (int64_t), 10 * sizeof (int32_t)) ;
+    return (required <= blobsize && h [0] == tag
+        && h [1] == KLU_MAIN_VERSION
+        && h [2] == KLU_SUB_VERSION
+        && h [3] == KLU_SUBSUB_VERSION
+        && h [4] == sizeof_object
+        && h [5] == (int32_t) sizeof (Entry)
+        && h [6] == (int32_t) sizeof (Int)
+        && h [7] == (int32_t) sizeof (Unit)
+        && h [8] == (int32_t) sizeof (double)
+        && h [9] == (int32_t) sizeof (void *)) ;
+}
+
 #endif
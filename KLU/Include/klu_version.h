@@ -59,6 +59,7 @@
 #define KLU_factor klu_zl_factor
 #define KLU_refactor klu_zl_refactor
 #define KLU_kernel_factor klu_zl_kernel_factor 
+#define KLU_dense_factor klu_zl_dense_factor
 #define KLU_lsolve klu_zl_lsolve
 #define KLU_ltsolve klu_zl_ltsolve
 #define KLU_usolve klu_zl_usolve
@@ -72,6 +73,9 @@
 #define KLU_extract klu_zl_extract
 #define KLU_condest klu_zl_condest
 #define KLU_flops klu_zl_flops
+#define KLU_serialize_numeric_size klu_zl_serialize_numeric_size
+#define KLU_serialize_numeric klu_zl_serialize_numeric
+#define KLU_deserialize_numeric klu_zl_deserialize_numeric
 
 #else
 
@@ -83,6 +87,7 @@
 #define KLU_factor klu_z_factor
 #define KLU_refactor klu_z_refactor
 #define KLU_kernel_factor klu_z_kernel_factor 
+#define KLU_dense_factor klu_z_dense_factor
 #define KLU_lsolve klu_z_lsolve
 #define KLU_ltsolve klu_z_ltsolve
 #define KLU_usolve klu_z_usolve
@@ -96,6 +101,9 @@
 #define KLU_extract klu_z_extract
 #define KLU_condest klu_z_condest
 #define KLU_flops klu_z_flops
+#define KLU_serialize_numeric_size klu_z_serialize_numeric_size
+#define KLU_serialize_numeric klu_z_serialize_numeric
+#define KLU_deserialize_numeric klu_z_deserialize_numeric
 
 #endif
 
@@ -111,6 +119,7 @@
 #define KLU_factor klu_l_factor
 #define KLU_refactor klu_l_refactor
 #define KLU_kernel_factor klu_l_kernel_factor 
+#define KLU_dense_factor klu_l_dense_factor
 #define KLU_lsolve klu_l_lsolve
 #define KLU_ltsolve klu_l_ltsolve
 #define KLU_usolve klu_l_usolve
@@ -124,6 +133,9 @@
 #define KLU_extract klu_l_extract
 #define KLU_condest klu_l_condest
 #define KLU_flops klu_l_flops
+#define KLU_serialize_numeric_size klu_l_serialize_numeric_size
+#define KLU_serialize_numeric klu_l_serialize_numeric
+#define KLU_deserialize_numeric klu_l_deserialize_numeric
 
 #else
 
@@ -135,6 +147,7 @@
 #define KLU_factor klu_factor
 #define KLU_refactor klu_refactor
 #define KLU_kernel_factor klu_kernel_factor 
+#define KLU_dense_factor klu_dense_factor
 #define KLU_lsolve klu_lsolve
 #define KLU_ltsolve klu_ltsolve
 #define KLU_usolve klu_usolve
@@ -148,6 +161,9 @@
 #define KLU_extract klu_extract
 #define KLU_condest klu_condest
 #define KLU_flops klu_flops
+#define KLU_serialize_numeric_size klu_serialize_numeric_size
+#define KLU_serialize_numeric klu_serialize_numeric
+#define KLU_deserialize_numeric klu_deserialize_numeric
 
 #endif
 
@@ -161,6 +177,9 @@
 #define KLU_analyze_given klu_l_analyze_given
 #define KLU_alloc_symbolic klu_l_alloc_symbolic
 #define KLU_free_symbolic klu_l_free_symbolic
+#define KLU_serialize_symbolic_size klu_l_serialize_symbolic_size
+#define KLU_serialize_symbolic klu_l_serialize_symbolic
+#define KLU_deserialize_symbolic klu_l_deserialize_symbolic
 #define KLU_defaults klu_l_defaults
 #define KLU_free klu_l_free
 #define KLU_malloc klu_l_malloc
@@ -186,6 +205,9 @@
 #define KLU_analyze_given klu_analyze_given
 #define KLU_alloc_symbolic klu_alloc_symbolic
 #define KLU_free_symbolic klu_free_symbolic
+#define KLU_serialize_symbolic_size klu_serialize_symbolic_size
+#define KLU_serialize_symbolic klu_serialize_symbolic
+#define KLU_deserialize_symbolic klu_deserialize_symbolic
 #define KLU_defaults klu_defaults
 #define KLU_free klu_free
 #define KLU_malloc klu_malloc
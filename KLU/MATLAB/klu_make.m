@@ -196,6 +196,7 @@ klu_src = {
     '../Source/klu_l_defaults', ...
     '../Source/klu_l_analyze_given', ...
     '../Source/klu_l_analyze', ...
+    '../Source/klu_l_serialize_symbolic', ...
     '../Source/klu_l_memory' } ;
 
 if (with_cholmod)
@@ -205,6 +206,7 @@ end
 klu_zlsrc = {
     '../Source/klu_zl', ...
     '../Source/klu_zl_kernel', ...
+    '../Source/klu_zl_dense', ...
     '../Source/klu_zl_dump', ...
     '../Source/klu_zl_factor', ...
     '../Source/klu_zl_free_numeric', ...
@@ -215,11 +217,13 @@ klu_zlsrc = {
     '../Source/klu_zl_diagnostics', ...
     '../Source/klu_zl_sort', ...
     '../Source/klu_zl_extract', ...
+    '../Source/klu_zl_serialize_numeric', ...
     } ;
 
 klu_lsrc = {
     '../Source/klu_l', ...
     '../Source/klu_l_kernel', ...
+    '../Source/klu_l_dense', ...
     '../Source/klu_l_dump', ...
     '../Source/klu_l_factor', ...
     '../Source/klu_l_free_numeric', ...
@@ -230,6 +234,7 @@ klu_lsrc = {
     '../Source/klu_l_diagnostics', ...
     '../Source/klu_l_sort', ...
     '../Source/klu_l_extract', ...
+    '../Source/klu_l_serialize_numeric', ...
     } ;
 
 try
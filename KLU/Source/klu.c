@@ -91,7 +91,7 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     double Rs [ ],      /* scale factors for A */
 
     /* inputs, modified on output */
-    Int Offp [ ],   /* off-diagonal matrix (modified by this routine) */
+    Int Offp [ ],   /* off-diagonal column pointers (not modified) */
     Int Offi [ ],
     Entry Offx [ ],
     /* --------------- */
@@ -195,8 +195,8 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
 
 /* Solve Lx=b.  Assumes L is unit lower triangular and where the unit diagonal
  * entry is NOT stored.  Overwrites B  with the solution X.  B is n-by-nrhs
- * and is stored in ROW form with row dimension nrhs.  nrhs must be in the
- * range 1 to 4. */
+ * and is stored in ROW form with row dimension nrhs.  nrhs must be 1 or
+ * more; the cases 1 to 4 are unrolled. */
 
 void KLU_lsolve
 (
@@ -212,8 +212,8 @@ void KLU_lsolve
 {
     Entry x [4], lik ;
     Int *Li ;
-    Entry *Lx ;
-    Int k, p, len, i ;
+    Entry *Lx, *Xk, *Xi ;
+    Int k, p, len, i, j ;
 
     switch (nrhs)
     {
@@ -289,6 +289,24 @@ void KLU_lsolve
             }
             break ;
 
+        default:
+
+            for (k = 0 ; k < n ; k++)
+            {
+                Xk = X + nrhs*k ;
+                GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+                for (p = 0 ; p < len ; p++)
+                {
+                    Xi = X + nrhs*Li [p] ;
+                    lik = Lx [p] ;
+                    for (j = 0 ; j < nrhs ; j++)
+                    {
+                        MULT_SUB (Xi [j], lik, Xk [j]) ;
+                    }
+                }
+            }
+            break ;
+
     }
 }
 
@@ -298,8 +316,8 @@ void KLU_lsolve
 
 /* Solve Ux=b.  Assumes U is non-unit upper triangular and where the diagonal
  * entry is NOT stored.  Overwrites B with the solution X.  B is n-by-nrhs
- * and is stored in ROW form with row dimension nrhs.  nrhs must be in the
- * range 1 to 4. */
+ * and is stored in ROW form with row dimension nrhs.  nrhs must be 1 or
+ * more; the cases 1 to 4 are unrolled. */
 
 void KLU_usolve
 (
@@ -316,8 +334,8 @@ void KLU_usolve
 {
     Entry x [4], uik, ukk ;
     Int *Ui ;
-    Entry *Ux ;
-    Int k, p, len, i ;
+    Entry *Ux, *Xk, *Xi ;
+    Int k, p, len, i, j ;
 
     switch (nrhs)
     {
@@ -422,6 +440,30 @@ void KLU_usolve
 
             break ;
 
+        default:
+
+            for (k = n-1 ; k >= 0 ; k--)
+            {
+                GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+                ukk = Udiag [k] ;
+                Xk = X + nrhs*k ;
+                for (j = 0 ; j < nrhs ; j++)
+                {
+                    DIV (Xk [j], Xk [j], ukk) ;
+                }
+                for (p = 0 ; p < len ; p++)
+                {
+                    Xi = X + nrhs*Ui [p] ;
+                    uik = Ux [p] ;
+                    for (j = 0 ; j < nrhs ; j++)
+                    {
+                        MULT_SUB (Xi [j], uik, Xk [j]) ;
+                    }
+                }
+            }
+
+            break ;
+
     }
 }
 
@@ -432,8 +474,8 @@ void KLU_usolve
 
 /* Solve L'x=b.  Assumes L is unit lower triangular and where the unit diagonal
  * entry is NOT stored.  Overwrites B with the solution X.  B is n-by-nrhs
- * and is stored in ROW form with row dimension nrhs.  nrhs must in the
- * range 1 to 4. */
+ * and is stored in ROW form with row dimension nrhs.  nrhs must be 1 or
+ * more; the cases 1 to 4 are unrolled. */
 
 void KLU_ltsolve
 (
@@ -452,8 +494,8 @@ void KLU_ltsolve
 {
     Entry x [4], lik ;
     Int *Li ;
-    Entry *Lx ;
-    Int k, p, len, i ;
+    Entry *Lx, *Xk, *Xi ;
+    Int k, p, len, i, j ;
 
     switch (nrhs)
     {
@@ -575,6 +617,33 @@ void KLU_ltsolve
                 X [4*k + 3] = x [3] ;
             }
             break ;
+
+        default:
+
+            for (k = n-1 ; k >= 0 ; k--)
+            {
+                Xk = X + nrhs*k ;
+                GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+                for (p = 0 ; p < len ; p++)
+                {
+                    Xi = X + nrhs*Li [p] ;
+#ifdef COMPLEX
+                    if (conj_solve)
+                    {
+                        CONJ (lik, Lx [p]) ;
+                    }
+                    else
+#endif
+                    {
+                        lik = Lx [p] ;
+                    }
+                    for (j = 0 ; j < nrhs ; j++)
+                    {
+                        MULT_SUB (Xk [j], lik, Xi [j]) ;
+                    }
+                }
+            }
+            break ;
     }
 }
 
@@ -586,7 +655,7 @@ void KLU_ltsolve
 /* Solve U'x=b.  Assumes U is non-unit upper triangular and where the diagonal
  * entry is stored (and appears last in each column of U).  Overwrites B
  * with the solution X.  B is n-by-nrhs and is stored in ROW form with row
- * dimension nrhs.  nrhs must be in the range 1 to 4. */
+ * dimension nrhs.  nrhs must be 1 or more; the cases 1 to 4 are unrolled. */
 
 void KLU_utsolve
 (
@@ -605,9 +674,9 @@ void KLU_utsolve
 )
 {
     Entry x [4], uik, ukk ;
-    Int k, p, len, i ;
+    Int k, p, len, i, j ;
     Int *Ui ;
-    Entry *Ux ;
+    Entry *Ux, *Xk, *Xi ;
 
     switch (nrhs)
     {
@@ -769,5 +838,46 @@ void KLU_utsolve
                 DIV (X [4*k + 3], x [3], ukk) ;
             }
             break ;
+
+        default:
+
+            for (k = 0 ; k < n ; k++)
+            {
+                GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+                Xk = X + nrhs*k ;
+                for (p = 0 ; p < len ; p++)
+                {
+                    Xi = X + nrhs*Ui [p] ;
+#ifdef COMPLEX
+                    if (conj_solve)
+                    {
+                        CONJ (uik, Ux [p]) ;
+                    }
+                    else
+#endif
+                    {
+                        uik = Ux [p] ;
+                    }
+                    for (j = 0 ; j < nrhs ; j++)
+                    {
+                        MULT_SUB (Xk [j], uik, Xi [j]) ;
+                    }
+                }
+#ifdef COMPLEX
+                if (conj_solve)
+                {
+                    CONJ (ukk, Udiag [k]) ;
+                }
+                else
+#endif
+                {
+                    ukk = Udiag [k] ;
+                }
+                for (j = 0 ; j < nrhs ; j++)
+                {
+                    DIV (Xk [j], Xk [j], ukk) ;
+                }
+            }
+            break ;
     }
 }
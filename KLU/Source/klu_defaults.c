@@ -36,6 +36,9 @@ int KLU_defaults
                                  * 0: none, but check for errors,
                                  * 1: sum, 2: max */
     Common->halt_if_singular = TRUE ;   /* quick halt if matrix is singular */
+    Common->nthreads = 1 ;      /* factorize the BTF blocks sequentially */
+    Common->dense_size = 0 ;    /* never use the dense kernel */
+    Common->dense_ratio = 0.5 ; /* a block is dense if nnz(L+U) >= 0.5*nk^2 */
 
     /* user ordering function and optional argument */
     Common->user_order = NULL ;
@@ -0,0 +1,380 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_dense: dense LU factorization of a diagonal block
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* Factorizes a diagonal block of the BTF form that is large and whose LU
+ * factors are expected to be nearly dense (see Common->dense_size and
+ * Common->dense_ratio).  For such a block, the sparse left-looking kernel in
+ * klu_kernel.c spends most of its time on the depth-first search and on
+ * scattered updates, one column at a time.  Here, the block is instead
+ * gathered into a dense n-by-n matrix and factorized with a right-looking
+ * LU, blocked by panels of KLU_DENSE_PANEL columns so that each column of the
+ * trailing submatrix is updated by a whole panel while it is in cache.
+ *
+ * The pivoting strategy is the same as in KLU_kernel: partial pivoting with a
+ * preference for the "diagonal" entry (with threshold Common->tol), where the
+ * diagonal is tracked in the same way as the off-diagonal pivots are chosen.
+ * If a column has no nonzero pivot candidate, the pivot is zero and the
+ * column of L is left as zero (it is not divided by the zero pivot).
+ *
+ * The factors are returned in the same packed form as KLU_kernel_factor, with
+ * every entry of L and U present, so that klu_solve, klu_refactor, klu_sort,
+ * klu_extract, and the diagnostics need no changes.  Offi and Offx are
+ * filled in for the columns of the block, as in KLU_kernel.
+ *
+ * Returns TRUE if the block was factorized (even if it is singular).  Returns
+ * FALSE if the dense workspace or the LU factors could not be allocated, in
+ * which case nothing has been computed and Common is not modified; the caller
+ * can then use the sparse kernel instead.
+ *
+ * NOTE: no error checking is done on the inputs.  This version is not meant to
+ * be called directly by the user.  Use klu_factor instead.
+ */
+
+#include "klu_internal.h"
+
+/* # of columns in each panel of the blocked factorization */
+#ifndef KLU_DENSE_PANEL
+#define KLU_DENSE_PANEL 32
+#endif
+
+Int KLU_dense_factor        /* TRUE if successful, FALSE if out of memory */
+(
+    /* inputs, not modified */
+    Int n,          /* the block is n-by-n. n must be > 0. */
+    Int Ap [ ],     /* size n+1, column pointers for A */
+    Int Ai [ ],     /* size nz = Ap [n], row indices for A */
+    Entry Ax [ ],   /* size nz, values of A */
+    Int Q [ ],      /* size n, column permutation */
+
+    /* outputs, not defined on input */
+    Unit **p_LU,        /* row indices and values of L and U */
+    size_t *p_lusize,   /* size of LU, in Units */
+    Entry Udiag [ ],    /* size n, diagonal of U */
+    Int Llen [ ],       /* size n, column length of L */
+    Int Ulen [ ],       /* size n, column length of U */
+    Int Lip [ ],        /* size n, column pointers for L */
+    Int Uip [ ],        /* size n, column pointers for U */
+    Int P [ ],          /* row permutation, size n */
+    Int *lnz,           /* size of L */
+    Int *unz,           /* size of U */
+
+    /* workspace, undefined on input */
+    Int *Work,      /* size 3n Int's */
+
+    /* inputs, not modified on output */
+    Int k1,             /* the block of A is from k1 to k2-1 */
+    Int PSinv [ ],      /* inverse of P from symbolic factorization */
+    double Rs [ ],      /* scale factors for A */
+
+    /* inputs, modified on output */
+    Int Offp [ ],   /* off-diagonal column pointers (not modified) */
+    Int Offi [ ],
+    Entry Offx [ ],
+    /* --------------- */
+    KLU_common *Common
+)
+{
+    Entry aik, pivot, ujc, *F, *Fj, *Fc, *Lx, *Ux ;
+    double dunits, abs_pivot, xabs, tol ;
+    Unit *LU ;
+    Int *Pinv, *Prow, *Rowpos, *Li, *Ui ;
+    Int i, j, c, p, k, j0, jend, ppos, dpos, pivrow, diagrow, kbar, pend,
+        oldcol, oldrow, poff, lup, len, scale, status ;
+    Int ok = TRUE ;
+    size_t fsize, lusize, s ;
+
+    ASSERT (Common != NULL) ;
+    scale = Common->scale ;
+    tol = Common->tol ;
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the dense workspace F and the LU factors */
+    /* ---------------------------------------------------------------------- */
+
+    /* column k of L has n-k-1 entries and column k of U has k entries */
+    dunits = 0 ;
+    for (k = 0 ; k < n ; k++)
+    {
+        dunits += DUNITS (Int, n-k-1) + DUNITS (Entry, n-k-1) +
+                  DUNITS (Int, k) + DUNITS (Entry, k) ;
+    }
+    lusize = (size_t) dunits ;
+    ok = !INT_OVERFLOW (dunits) ;
+    fsize = KLU_mult_size_t (n, n, &ok) ;
+
+    status = Common->status ;
+    F = ok ? KLU_malloc (fsize, sizeof (Entry), Common) : NULL ;
+    LU = ok ? KLU_malloc (lusize, sizeof (Unit), Common) : NULL ;
+    if (F == NULL || LU == NULL)
+    {
+        /* out of memory, or the block is too large for the dense kernel */
+        KLU_free (F, fsize, sizeof (Entry), Common) ;
+        KLU_free (LU, lusize, sizeof (Unit), Common) ;
+        Common->status = status ;
+        return (FALSE) ;
+    }
+
+    Pinv   = Work ;
+    Prow   = Work + n ;
+    Rowpos = Work + 2*n ;
+
+    /* ---------------------------------------------------------------------- */
+    /* scale and gather the block into F, and construct the off-diagonal part */
+    /* ---------------------------------------------------------------------- */
+
+    for (s = 0 ; s < fsize ; s++)
+    {
+        CLEAR (F [s]) ;
+    }
+
+    for (k = 0 ; k < n ; k++)
+    {
+        Fc = F + ((size_t) n) * k ;
+        poff = Offp [k + k1] ;
+        oldcol = Q [k + k1] ;
+        pend = Ap [oldcol+1] ;
+        for (p = Ap [oldcol] ; p < pend ; p++)
+        {
+            oldrow = Ai [p] ;
+            i = PSinv [oldrow] - k1 ;
+            aik = Ax [p] ;
+            if (scale > 0)
+            {
+                SCALE_DIV (aik, Rs [oldrow]) ;
+            }
+            if (i < 0)
+            {
+                /* this is an entry in the off-diagonal part */
+                Offi [poff] = oldrow ;
+                Offx [poff] = aik ;
+                poff++ ;
+            }
+            else
+            {
+                /* (i,k) is an entry in the block */
+                Fc [i] = aik ;
+            }
+        }
+        ASSERT (Offp [k + k1 + 1] == poff) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* mark all rows as non-pivotal, as in KLU_kernel */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        P [k] = k ;
+        Pinv [k] = FLIP (k) ;
+        Prow [k] = k ;          /* row Prow [i] is held in row i of F */
+        Rowpos [k] = k ;        /* row i is held in row Rowpos [i] of F */
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize F, one panel at a time */
+    /* ---------------------------------------------------------------------- */
+
+    for (j0 = 0 ; j0 < n ; j0 += KLU_DENSE_PANEL)
+    {
+        jend = MIN (j0 + KLU_DENSE_PANEL, n) ;
+
+        /* ------------------------------------------------------------------ */
+        /* factorize the panel F (j0:n-1, j0:jend-1) */
+        /* ------------------------------------------------------------------ */
+
+        for (j = j0 ; j < jend ; j++)
+        {
+            Fj = F + ((size_t) n) * j ;
+
+            /* find the partial-pivoting choice */
+            ppos = j ;
+            abs_pivot = EMPTY ;
+            for (i = j ; i < n ; i++)
+            {
+                ABS (xabs, Fj [i]) ;
+                if (xabs > abs_pivot)
+                {
+                    abs_pivot = xabs ;
+                    ppos = i ;
+                }
+            }
+
+            /* compare the diagonal with the largest entry */
+            diagrow = P [j] ;   /* might already be pivotal */
+            if (Pinv [diagrow] < 0)
+            {
+                dpos = Rowpos [diagrow] ;
+                ABS (xabs, Fj [dpos]) ;
+                if (xabs >= tol * abs_pivot)
+                {
+                    /* the diagonal is large enough */
+                    abs_pivot = xabs ;
+                    ppos = dpos ;
+                }
+            }
+            pivrow = Prow [ppos] ;
+            pivot = Fj [ppos] ;
+
+            if (IS_ZERO (pivot))
+            {
+                /* matrix is numerically singular */
+                Common->status = KLU_SINGULAR ;
+                if (Common->numerical_rank == EMPTY)
+                {
+                    Common->numerical_rank = j+k1 ;
+                    Common->singular_col = Q [j+k1] ;
+                }
+                if (Common->halt_if_singular)
+                {
+                    /* do not continue the factorization */
+                    KLU_free (F, fsize, sizeof (Entry), Common) ;
+                    *p_LU = LU ;
+                    *p_lusize = lusize ;
+                    return (TRUE) ;
+                }
+            }
+
+            /* swap rows j and ppos of F */
+            if (ppos != j)
+            {
+                for (c = 0 ; c < n ; c++)
+                {
+                    Fc = F + ((size_t) n) * c ;
+                    aik = Fc [j] ;
+                    Fc [j] = Fc [ppos] ;
+                    Fc [ppos] = aik ;
+                }
+                i = Prow [j] ;
+                Prow [j] = pivrow ;
+                Prow [ppos] = i ;
+                Rowpos [pivrow] = j ;
+                Rowpos [i] = ppos ;
+            }
+
+            /* log the pivot permutation */
+            if (pivrow != diagrow)
+            {
+                /* an off-diagonal pivot has been chosen */
+                Common->noffdiag++ ;
+                if (Pinv [diagrow] < 0)
+                {
+                    kbar = FLIP (Pinv [pivrow]) ;
+                    P [kbar] = diagrow ;
+                    Pinv [diagrow] = FLIP (kbar) ;
+                }
+            }
+            P [j] = pivrow ;
+            Pinv [pivrow] = j ;
+            Udiag [j] = pivot ;
+
+            /* divide the column of L by the pivot */
+            if (!IS_ZERO (pivot))
+            {
+                for (i = j+1 ; i < n ; i++)
+                {
+                    DIV (Fj [i], Fj [i], pivot) ;
+                }
+            }
+
+            /* update the rest of the panel */
+            for (c = j+1 ; c < jend ; c++)
+            {
+                Fc = F + ((size_t) n) * c ;
+                ujc = Fc [j] ;
+                if (IS_NONZERO (ujc))
+                {
+                    for (i = j+1 ; i < n ; i++)
+                    {
+                        MULT_SUB (Fc [i], Fj [i], ujc) ;
+                    }
+                }
+            }
+        }
+
+        /* ------------------------------------------------------------------ */
+        /* update the columns to the right of the panel */
+        /* ------------------------------------------------------------------ */
+
+        /* For each column c, solve for U (j0:jend-1, c) with the unit lower
+         * triangular part of the panel, and apply the panel to the rest of
+         * the column.  Column c stays in cache for all jend-j0 updates. */
+        for (c = jend ; c < n ; c++)
+        {
+            Fc = F + ((size_t) n) * c ;
+            for (j = j0 ; j < jend ; j++)
+            {
+                Fj = F + ((size_t) n) * j ;
+                ujc = Fc [j] ;
+                if (IS_NONZERO (ujc))
+                {
+                    for (i = j+1 ; i < n ; i++)
+                    {
+                        MULT_SUB (Fc [i], Fj [i], ujc) ;
+                    }
+                }
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* copy the factors from F into LU */
+    /* ---------------------------------------------------------------------- */
+
+    /* Row k of F is the kth pivot row, so the row indices of L are already in
+     * the pivotal order, as KLU_kernel leaves them. */
+    lup = 0 ;
+    *lnz = 0 ;
+    *unz = 0 ;
+    for (k = 0 ; k < n ; k++)
+    {
+        Fc = F + ((size_t) n) * k ;
+
+        /* column k of L: rows k+1 to n-1 */
+        Lip [k] = lup ;
+        Llen [k] = n-k-1 ;
+        GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+        for (p = 0 ; p < len ; p++)
+        {
+            Li [p] = k+1+p ;
+            Lx [p] = Fc [k+1+p] ;
+        }
+        lup += UNITS (Int, len) + UNITS (Entry, len) ;
+
+        /* column k of U: rows 0 to k-1 */
+        Uip [k] = lup ;
+        Ulen [k] = k ;
+        GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+        for (p = 0 ; p < len ; p++)
+        {
+            Ui [p] = p ;
+            Ux [p] = Fc [p] ;
+        }
+        lup += UNITS (Int, len) + UNITS (Entry, len) ;
+
+        *lnz += Llen [k] + 1 ; /* 1 added to lnz for diagonal */
+        *unz += Ulen [k] + 1 ; /* 1 added to unz for diagonal */
+    }
+    ASSERT ((size_t) lup == lusize) ;
+
+#ifndef NDEBUG
+    for (i = 0 ; i < n ; i++)
+    {
+        ASSERT (Pinv [i] >= 0 && Pinv [i] < n) ;
+        ASSERT (P [i] >= 0 && P [i] < n) ;
+        ASSERT (P [Pinv [i]] == i) ;
+        ASSERT (Prow [i] == P [i]) ;
+    }
+#endif
+
+    KLU_free (F, fsize, sizeof (Entry), Common) ;
+    *p_LU = LU ;
+    *p_lusize = lusize ;
+    return (TRUE) ;
+}
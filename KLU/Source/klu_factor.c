@@ -15,12 +15,66 @@
 #include "klu_internal.h"
 
 /* ========================================================================== */
-/* === KLU_factor2 ========================================================== */
+/* === use_dense_kernel ===================================================== */
 /* ========================================================================== */
 
-static void factor2
+/* Returns TRUE if the block should be factorized with the dense kernel: it
+ * must have at least Common->dense_size rows and columns, and its LU factors
+ * must be expected to have at least Common->dense_ratio*nk^2 entries.  The
+ * estimate of nnz(L) from AMD is used if available (it includes the diagonal,
+ * and U is assumed to be about as large as L).  Otherwise, nnz(A) in the
+ * columns of the block is used, which is a lower bound. */
+
+static Int use_dense_kernel
+(
+    Int block,
+    Int Ap [ ],
+    KLU_symbolic *Symbolic,
+    KLU_common *Common
+)
+{
+    double est, nk ;
+    Int k, k1, k2, oldcol ;
+
+    k1 = Symbolic->R [block] ;
+    k2 = Symbolic->R [block+1] ;
+    if (Common->dense_size <= 0 || k2 - k1 < MAX (Common->dense_size, 2))
+    {
+        return (FALSE) ;
+    }
+    nk = (double) (k2 - k1) ;
+    est = Symbolic->Lnz [block] ;
+    if (est >= 0)
+    {
+        est = 2 * est - nk ;
+    }
+    else
+    {
+        est = 0 ;
+        for (k = k1 ; k < k2 ; k++)
+        {
+            oldcol = Symbolic->Q [k] ;
+            est += Ap [oldcol+1] - Ap [oldcol] ;
+        }
+    }
+    return (est >= Common->dense_ratio * nk * nk) ;
+}
+
+
+/* ========================================================================== */
+/* === factor_block ========================================================= */
+/* ========================================================================== */
+
+/* Factorize a single diagonal block of the BTF form.  The blocks are
+ * independent of each other: each one writes only to its own part of the
+ * Numeric object and to its own columns of the off-diagonal part, so that
+ * different blocks can be factorized at the same time, each with its own
+ * workspace (X and Iwork) and its own Common object. */
+
+static void factor_block
 (
     /* inputs, not modified */
+    Int block,          /* the block to factorize */
     Int Ap [ ],         /* size n+1, column pointers */
     Int Ai [ ],         /* size nz, row indices */
     Entry Ax [ ],
@@ -28,31 +82,34 @@ static void factor2
 
     /* inputs, modified on output: */
     KLU_numeric *Numeric,
+
+    /* outputs, not defined on input */
+    Int *lnz_block,     /* nnz (L) for this block */
+    Int *unz_block,     /* nnz (U) for this block */
+
+    /* workspace, not defined on input */
+    Entry X [ ],        /* size maxblock */
+    Int Iwork [ ],      /* size 6*maxblock */
+
     KLU_common *Common
 )
 {
     double lsize ;
     double *Lnz, *Rs ;
-    Int *P, *Q, *R, *Pnum, *Offp, *Offi, *Pblock, *Pinv, *Iwork,
-        *Lip, *Uip, *Llen, *Ulen ;
-    Entry *Offx, *X, s, *Udiag ;
+    Int *P, *Q, *R, *Pnum, *Offp, *Offi, *Pblock, *Pinv, *Lip, *Uip, *Llen,
+        *Ulen ;
+    Entry *Offx, s, *Udiag ;
     Unit **LUbx ;
-    Int k1, k2, nk, k, block, oldcol, pend, oldrow, n, lnz, unz, p, newrow,
-        nblocks, poff, nzoff, lnz_block, unz_block, scale, max_lnz_block,
-        max_unz_block ;
+    Int k1, k2, nk, k, oldcol, pend, oldrow, p, newrow, poff, scale ;
 
     /* ---------------------------------------------------------------------- */
-    /* initializations */
+    /* get the contents of the Symbolic and Numeric objects */
     /* ---------------------------------------------------------------------- */
 
-    /* get the contents of the Symbolic object */
-    n = Symbolic->n ;
     P = Symbolic->P ;
     Q = Symbolic->Q ;
     R = Symbolic->R ;
     Lnz = Symbolic->Lnz ;
-    nblocks = Symbolic->nblocks ;
-    nzoff = Symbolic->nzoff ;
 
     Pnum = Numeric->Pnum ;
     Offp = Numeric->Offp ;
@@ -66,12 +123,414 @@ static void factor2
     LUbx = (Unit **) Numeric->LUbx ;
     Udiag = Numeric->Udiag ;
 
+    Rs = Numeric->Rs ;
+    Pinv = Numeric->Pinv ;
+    Pblock = Iwork + 5*((size_t) Symbolic->maxblock) ;
+    scale = Common->scale ;
+
+    /* ---------------------------------------------------------------------- */
+    /* the block is from rows/columns k1 to k2-1 */
+    /* ---------------------------------------------------------------------- */
+
+    k1 = R [block] ;
+    k2 = R [block+1] ;
+    nk = k2 - k1 ;
+    PRINTF (("FACTOR BLOCK %d, k1 %d k2-1 %d nk %d\n", block, k1,k2-1,nk)) ;
+
+    if (nk == 1)
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* singleton case */
+        /* ------------------------------------------------------------------ */
+
+        poff = Offp [k1] ;
+        oldcol = Q [k1] ;
+        pend = Ap [oldcol+1] ;
+        CLEAR (s) ;
+
+        if (scale <= 0)
+        {
+            /* no scaling */
+            for (p = Ap [oldcol] ; p < pend ; p++)
+            {
+                oldrow = Ai [p] ;
+                newrow = Pinv [oldrow] ;
+                if (newrow < k1)
+                {
+                    Offi [poff] = oldrow ;
+                    Offx [poff] = Ax [p] ;
+                    poff++ ;
+                }
+                else
+                {
+                    ASSERT (newrow == k1) ;
+                    PRINTF (("singleton block %d", block)) ;
+                    PRINT_ENTRY (Ax [p]) ;
+                    s = Ax [p] ;
+                }
+            }
+        }
+        else
+        {
+            /* row scaling.  NOTE: scale factors are not yet permuted
+             * according to the pivot row permutation, so Rs [oldrow] is
+             * used below.  When the factorization is done, the scale
+             * factors are permuted, so that Rs [newrow] will be used in
+             * klu_solve, klu_tsolve, and klu_rgrowth */
+            for (p = Ap [oldcol] ; p < pend ; p++)
+            {
+                oldrow = Ai [p] ;
+                newrow = Pinv [oldrow] ;
+                if (newrow < k1)
+                {
+                    Offi [poff] = oldrow ;
+                    /* Offx [poff] = Ax [p] / Rs [oldrow] ; */
+                    SCALE_DIV_ASSIGN (Offx [poff], Ax [p], Rs [oldrow]) ;
+                    poff++ ;
+                }
+                else
+                {
+                    ASSERT (newrow == k1) ;
+                    PRINTF (("singleton block %d ", block)) ;
+                    PRINT_ENTRY (Ax[p]) ;
+                    SCALE_DIV_ASSIGN (s, Ax [p], Rs [oldrow]) ;
+                }
+            }
+        }
+
+        Udiag [k1] = s ;
+
+        if (IS_ZERO (s))
+        {
+            /* singular singleton */
+            Common->status = KLU_SINGULAR ;
+            if (Common->numerical_rank == EMPTY)
+            {
+                Common->numerical_rank = k1 ;
+                Common->singular_col = oldcol ;
+            }
+            if (Common->halt_if_singular)
+            {
+                return ;
+            }
+        }
+
+        ASSERT (Offp [k1+1] == poff) ;
+        Pnum [k1] = P [k1] ;
+        *lnz_block = 1 ;
+        *unz_block = 1 ;
+
+    }
+    else
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* construct and factorize the kth block */
+        /* ------------------------------------------------------------------ */
+
+        if (Lnz [block] < 0)
+        {
+            /* COLAMD was used - no estimate of fill-in */
+            /* use 10 times the nnz in A, plus n */
+            lsize = -(Common->initmem) ;
+        }
+        else
+        {
+            lsize = Common->initmem_amd * Lnz [block] + nk ;
+        }
+
+        /* allocates 1 arrays: LUbx [block].  The dense kernel is used for
+         * large dense blocks, if its workspace can be allocated. */
+        if (!use_dense_kernel (block, Ap, Symbolic, Common) ||
+            !KLU_dense_factor (nk, Ap, Ai, Ax, Q, &LUbx [block],
+                &(Numeric->LUsize [block]), Udiag + k1, Llen + k1, Ulen + k1,
+                Lip + k1, Uip + k1, Pblock, lnz_block, unz_block,
+                Iwork, k1, Pinv, Rs, Offp, Offi, Offx, Common))
+        {
+            Numeric->LUsize [block] = KLU_kernel_factor (nk, Ap, Ai, Ax, Q,
+                lsize, &LUbx [block], Udiag + k1, Llen + k1, Ulen + k1,
+                Lip + k1, Uip + k1, Pblock, lnz_block, unz_block,
+                X, Iwork, k1, Pinv, Rs, Offp, Offi, Offx, Common) ;
+        }
+
+        if (Common->status < KLU_OK ||
+           (Common->status == KLU_SINGULAR && Common->halt_if_singular))
+        {
+            /* out of memory, invalid inputs, or singular */
+            return ;
+        }
+
+        PRINTF (("\n----------------------- L %d:\n", block)) ;
+        ASSERT (KLU_valid_LU (nk, TRUE, Lip+k1, Llen+k1, LUbx [block])) ;
+        PRINTF (("\n----------------------- U %d:\n", block)) ;
+        ASSERT (KLU_valid_LU (nk, FALSE, Uip+k1, Ulen+k1, LUbx [block])) ;
+
+        if (Lnz [block] == EMPTY)
+        {
+            /* revise estimate for subsequent factorization */
+            Lnz [block] = MAX (*lnz_block, *unz_block) ;
+        }
+
+        /* ------------------------------------------------------------------ */
+        /* combine the klu row ordering with the symbolic pre-ordering */
+        /* ------------------------------------------------------------------ */
+
+        PRINTF (("Pnum, 1-based:\n")) ;
+        for (k = 0 ; k < nk ; k++)
+        {
+            ASSERT (k + k1 < Symbolic->n) ;
+            ASSERT (Pblock [k] + k1 < Symbolic->n) ;
+            Pnum [k + k1] = P [Pblock [k] + k1] ;
+            PRINTF (("Pnum (%d + %d + 1 = %d) = %d + 1 = %d\n",
+                k, k1, k+k1+1, Pnum [k+k1], Pnum [k+k1]+1)) ;
+        }
+
+        /* the local pivot row permutation Pblock is no longer needed */
+    }
+}
+
+
+/* ========================================================================== */
+/* === factor_blocks_parallel =============================================== */
+/* ========================================================================== */
+
+/* statistics of a single block, for the parallel factorization */
+typedef struct
+{
+    size_t memusage ;       /* memory held by the block when done */
+    size_t mempeak ;        /* peak memory used while factorizing the block */
+    Int lnz, unz ;          /* nnz (L) and nnz (U) of the block */
+    Int noffdiag ;          /* # of off-diagonal pivots in the block */
+    Int numerical_rank ;    /* first zero pivot in the block, or EMPTY */
+    Int singular_col ;      /* column of A of that zero pivot */
+    int nrealloc ;          /* # of reallocations of the LU factors */
+    int status ;            /* status of the block */
+    int done ;              /* TRUE if the block has been factorized */
+
+} KLU_block_stats ;
+
+/* Factorize the diagonal blocks in parallel.  Each thread has its own
+ * workspace and its own copy of the Common object.  The statistics of each
+ * block are kept separately and combined in block order afterwards, so the
+ * factors and statistics are identical to the sequential factorization
+ * (except for Common->mempeak, which includes the workspace of the extra
+ * threads).  If a block fails (or is singular and Common->halt_if_singular
+ * is true), all the blocks before it are still factorized, but the blocks
+ * after it may be skipped.
+ * Returns FALSE if out of memory. */
+
+static int factor_blocks_parallel
+(
+    /* inputs, not modified */
+    Int Ap [ ],         /* size n+1, column pointers */
+    Int Ai [ ],         /* size nz, row indices */
+    Entry Ax [ ],
+    KLU_symbolic *Symbolic,
+    int nthreads,
+
+    /* inputs, modified on output: */
+    KLU_numeric *Numeric,
+    KLU_common *Common
+)
+{
+    KLU_block_stats *Stats ;
+    void *Work ;
+    size_t wsize ;
+    Int nblocks, maxblock, block, first_bad, lnz, unz, max_lnz_block,
+        max_unz_block ;
+    Int ok = TRUE ;
+
+    nblocks = Symbolic->nblocks ;
+    maxblock = Symbolic->maxblock ;
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the block statistics and the workspace of threads 1 and up */
+    /* ---------------------------------------------------------------------- */
+
+    /* thread 0 uses Numeric->Xwork and Numeric->Iwork */
+    wsize = KLU_add_size_t (KLU_mult_size_t (maxblock, sizeof (Entry), &ok),
+                            KLU_mult_size_t (maxblock, 6*sizeof (Int), &ok),
+                            &ok) ;
+    Stats = KLU_malloc (nblocks, sizeof (KLU_block_stats), Common) ;
+    Work = KLU_malloc (nthreads-1, wsize, Common) ;
+    if (!ok || Common->status < KLU_OK)
+    {
+        Common->status = ok ? KLU_OUT_OF_MEMORY : KLU_TOO_LARGE ;
+        KLU_free (Stats, nblocks, sizeof (KLU_block_stats), Common) ;
+        KLU_free (Work, nthreads-1, wsize, Common) ;
+        return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize each block */
+    /* ---------------------------------------------------------------------- */
+
+    first_bad = nblocks ;
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+        KLU_common ThreadCommon ;
+        Entry *X ;
+        Int *Iwork ;
+        Int bad ;
+        int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        if (tid == 0)
+        {
+            X = (Entry *) Numeric->Xwork ;
+            Iwork = Numeric->Iwork ;
+        }
+        else
+        {
+            X = (Entry *) (((char *) Work) + (tid-1) * wsize) ;
+            Iwork = (Int *) (X + maxblock) ;
+        }
+        ThreadCommon = *Common ;
+
+        #pragma omp for schedule(dynamic,1)
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            KLU_block_stats *S = &(Stats [block]) ;
+            #pragma omp atomic read
+            bad = first_bad ;
+            if (block > bad)
+            {
+                /* an earlier block has failed; skip this one */
+                S->done = FALSE ;
+                continue ;
+            }
+
+            ThreadCommon.status = KLU_OK ;
+            ThreadCommon.numerical_rank = EMPTY ;
+            ThreadCommon.singular_col = EMPTY ;
+            ThreadCommon.noffdiag = 0 ;
+            ThreadCommon.nrealloc = 0 ;
+            ThreadCommon.memusage = 0 ;
+            ThreadCommon.mempeak = 0 ;
+            S->lnz = 0 ;
+            S->unz = 0 ;
+
+            factor_block (block, Ap, Ai, Ax, Symbolic, Numeric, &(S->lnz),
+                &(S->unz), X, Iwork, &ThreadCommon) ;
+
+            S->memusage = ThreadCommon.memusage ;
+            S->mempeak = ThreadCommon.mempeak ;
+            S->noffdiag = ThreadCommon.noffdiag ;
+            S->numerical_rank = ThreadCommon.numerical_rank ;
+            S->singular_col = ThreadCommon.singular_col ;
+            S->nrealloc = ThreadCommon.nrealloc ;
+            S->status = ThreadCommon.status ;
+            S->done = TRUE ;
+
+            if (S->status < KLU_OK ||
+               (S->status == KLU_SINGULAR && Common->halt_if_singular))
+            {
+                #pragma omp critical (klu_factor_first_bad)
+                {
+                    if (block < first_bad) first_bad = block ;
+                }
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* combine the statistics of each block, in order */
+    /* ---------------------------------------------------------------------- */
+
+    lnz = 0 ;
+    unz = 0 ;
+    max_lnz_block = 1 ;
+    max_unz_block = 1 ;
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        KLU_block_stats *S = &(Stats [block]) ;
+        if (!S->done) continue ;
+
+        /* memory usage, as if the blocks were factorized one at a time */
+        Common->mempeak = MAX (Common->mempeak,
+            Common->memusage + S->mempeak) ;
+        Common->memusage += S->memusage ;
+
+        if (block > first_bad) continue ;
+
+        /* statistics, as if the factorization stopped at block first_bad */
+        Common->noffdiag += S->noffdiag ;
+        Common->nrealloc += S->nrealloc ;
+        if (S->status == KLU_SINGULAR || S->status < KLU_OK)
+        {
+            Common->status = S->status ;
+        }
+        if (S->numerical_rank != EMPTY && Common->numerical_rank == EMPTY)
+        {
+            Common->numerical_rank = S->numerical_rank ;
+            Common->singular_col = S->singular_col ;
+        }
+        lnz += S->lnz ;
+        unz += S->unz ;
+        max_lnz_block = MAX (max_lnz_block, S->lnz) ;
+        max_unz_block = MAX (max_unz_block, S->unz) ;
+    }
+
+    Numeric->lnz = lnz ;
+    Numeric->unz = unz ;
+    Numeric->max_lnz_block = max_lnz_block ;
+    Numeric->max_unz_block = max_unz_block ;
+
+    /* ---------------------------------------------------------------------- */
+    /* free workspace and return result */
+    /* ---------------------------------------------------------------------- */
+
+    KLU_free (Stats, nblocks, sizeof (KLU_block_stats), Common) ;
+    KLU_free (Work, nthreads-1, wsize, Common) ;
+    return (TRUE) ;
+}
+
+
+/* ========================================================================== */
+/* === KLU_factor2 ========================================================== */
+/* ========================================================================== */
+
+static void factor2
+(
+    /* inputs, not modified */
+    Int Ap [ ],         /* size n+1, column pointers */
+    Int Ai [ ],         /* size nz, row indices */
+    Entry Ax [ ],
+    KLU_symbolic *Symbolic,
+
+    /* inputs, modified on output: */
+    KLU_numeric *Numeric,
+    KLU_common *Common
+)
+{
+    double *Rs ;
+    Int *P, *Q, *R, *Pnum, *Offp, *Offi, *Pinv, *Iwork ;
+    Entry *X ;
+    Int k1, k2, k, block, oldcol, pend, n, lnz, unz, p, nblocks, poff, nzoff,
+        lnz_block, unz_block, scale, max_lnz_block, max_unz_block ;
+    int nthreads ;
+
+    /* ---------------------------------------------------------------------- */
+    /* initializations */
+    /* ---------------------------------------------------------------------- */
+
+    /* get the contents of the Symbolic object */
+    n = Symbolic->n ;
+    P = Symbolic->P ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+    nblocks = Symbolic->nblocks ;
+    nzoff = Symbolic->nzoff ;
+
+    Pnum = Numeric->Pnum ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+
     Rs = Numeric->Rs ;
     Pinv = Numeric->Pinv ;
     X = (Entry *) Numeric->Xwork ;              /* X is of size n */
     Iwork = Numeric->Iwork ;                    /* 5*maxblock for KLU_factor */
                                                 /* 1*maxblock for Pblock */
-    Pblock = Iwork + 5*((size_t) Symbolic->maxblock) ;
     Common->nrealloc = 0 ;
     scale = Common->scale ;
     max_lnz_block = 1 ;
@@ -98,7 +557,6 @@ static void factor2
     lnz = 0 ;
     unz = 0 ;
     Common->noffdiag = 0 ;
-    Offp [0] = 0 ;
 
     /* ---------------------------------------------------------------------- */
     /* optionally check input matrix and compute scale factors */
@@ -129,126 +587,63 @@ static void factor2
 #endif
 
     /* ---------------------------------------------------------------------- */
-    /* factor each block using klu */
+    /* find the column pointers of the off-diagonal part */
     /* ---------------------------------------------------------------------- */
 
+    /* An entry A (oldrow,oldcol) is in the off-diagonal part if its row is in
+     * an earlier block than its column.  This depends only on the symbolic
+     * pre-ordering, not on the partial pivoting within each block, so Offp
+     * can be found before any block is factorized. */
+    Offp [0] = 0 ;
+    poff = 0 ;
     for (block = 0 ; block < nblocks ; block++)
     {
-
-        /* ------------------------------------------------------------------ */
-        /* the block is from rows/columns k1 to k2-1 */
-        /* ------------------------------------------------------------------ */
-
         k1 = R [block] ;
         k2 = R [block+1] ;
-        nk = k2 - k1 ;
-        PRINTF (("FACTOR BLOCK %d, k1 %d k2-1 %d nk %d\n", block, k1,k2-1,nk)) ;
-
-        if (nk == 1)
+        for (k = k1 ; k < k2 ; k++)
         {
-
-            /* -------------------------------------------------------------- */
-            /* singleton case */
-            /* -------------------------------------------------------------- */
-
-            poff = Offp [k1] ;
-            oldcol = Q [k1] ;
+            oldcol = Q [k] ;
             pend = Ap [oldcol+1] ;
-            CLEAR (s) ;
-
-            if (scale <= 0)
-            {
-                /* no scaling */
-                for (p = Ap [oldcol] ; p < pend ; p++)
-                {
-                    oldrow = Ai [p] ;
-                    newrow = Pinv [oldrow] ;
-                    if (newrow < k1)
-                    {
-                        Offi [poff] = oldrow ;
-                        Offx [poff] = Ax [p] ;
-                        poff++ ;
-                    }
-                    else
-                    {
-                        ASSERT (newrow == k1) ;
-                        PRINTF (("singleton block %d", block)) ;
-                        PRINT_ENTRY (Ax [p]) ;
-                        s = Ax [p] ;
-                    }
-                }
-            }
-            else
+            for (p = Ap [oldcol] ; p < pend ; p++)
             {
-                /* row scaling.  NOTE: scale factors are not yet permuted
-                 * according to the pivot row permutation, so Rs [oldrow] is
-                 * used below.  When the factorization is done, the scale
-                 * factors are permuted, so that Rs [newrow] will be used in
-                 * klu_solve, klu_tsolve, and klu_rgrowth */
-                for (p = Ap [oldcol] ; p < pend ; p++)
-                {
-                    oldrow = Ai [p] ;
-                    newrow = Pinv [oldrow] ;
-                    if (newrow < k1)
-                    {
-                        Offi [poff] = oldrow ;
-                        /* Offx [poff] = Ax [p] / Rs [oldrow] ; */
-                        SCALE_DIV_ASSIGN (Offx [poff], Ax [p], Rs [oldrow]) ;
-                        poff++ ;
-                    }
-                    else
-                    {
-                        ASSERT (newrow == k1) ;
-                        PRINTF (("singleton block %d ", block)) ;
-                        PRINT_ENTRY (Ax[p]) ;
-                        SCALE_DIV_ASSIGN (s, Ax [p], Rs [oldrow]) ;
-                    }
-                }
-            }
-
-            Udiag [k1] = s ;
-
-            if (IS_ZERO (s))
-            {
-                /* singular singleton */
-                Common->status = KLU_SINGULAR ;
-                Common->numerical_rank = k1 ;
-                Common->singular_col = oldcol ;
-                if (Common->halt_if_singular)
-                {
-                    return ;
-                }
+                if (Pinv [Ai [p]] < k1) poff++ ;
             }
+            Offp [k+1] = poff ;
+        }
+    }
+    if (poff != nzoff)
+    {
+        /* the pattern of A differs from the one given to KLU_analyze */
+        Common->status = KLU_INVALID ;
+        return ;
+    }
 
-            Offp [k1+1] = poff ;
-            Pnum [k1] = P [k1] ;
-            lnz++ ;
-            unz++ ;
+    /* ---------------------------------------------------------------------- */
+    /* factor each block using klu */
+    /* ---------------------------------------------------------------------- */
 
+    nthreads = KLU_nthreads (nblocks, Common) ;
+    if (nthreads > 1)
+    {
+        if (!factor_blocks_parallel (Ap, Ai, Ax, Symbolic, nthreads, Numeric,
+            Common))
+        {
+            /* out of memory */
+            return ;
         }
-        else
+        if (Common->status < KLU_OK ||
+           (Common->status == KLU_SINGULAR && Common->halt_if_singular))
         {
-
-            /* -------------------------------------------------------------- */
-            /* construct and factorize the kth block */
-            /* -------------------------------------------------------------- */
-
-            if (Lnz [block] < 0)
-            {
-                /* COLAMD was used - no estimate of fill-in */
-                /* use 10 times the nnz in A, plus n */
-                lsize = -(Common->initmem) ;
-            }
-            else
-            {
-                lsize = Common->initmem_amd * Lnz [block] + nk ;
-            }
-
-            /* allocates 1 arrays: LUbx [block] */
-            Numeric->LUsize [block] = KLU_kernel_factor (nk, Ap, Ai, Ax, Q,
-                    lsize, &LUbx [block], Udiag + k1, Llen + k1, Ulen + k1,
-                    Lip + k1, Uip + k1, Pblock, &lnz_block, &unz_block,
-                    X, Iwork, k1, Pinv, Rs, Offp, Offi, Offx, Common) ;
+            /* out of memory, invalid inputs, or singular */
+            return ;
+        }
+    }
+    else
+    {
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            factor_block (block, Ap, Ai, Ax, Symbolic, Numeric, &lnz_block,
+                &unz_block, X, Iwork, Common) ;
 
             if (Common->status < KLU_OK ||
                (Common->status == KLU_SINGULAR && Common->halt_if_singular))
@@ -257,11 +652,6 @@ static void factor2
                 return ;
             }
 
-            PRINTF (("\n----------------------- L %d:\n", block)) ;
-            ASSERT (KLU_valid_LU (nk, TRUE, Lip+k1, Llen+k1, LUbx [block])) ;
-            PRINTF (("\n----------------------- U %d:\n", block)) ;
-            ASSERT (KLU_valid_LU (nk, FALSE, Uip+k1, Ulen+k1, LUbx [block])) ;
-
             /* -------------------------------------------------------------- */
             /* get statistics */
             /* -------------------------------------------------------------- */
@@ -270,38 +660,17 @@ static void factor2
             unz += unz_block ;
             max_lnz_block = MAX (max_lnz_block, lnz_block) ;
             max_unz_block = MAX (max_unz_block, unz_block) ;
-
-            if (Lnz [block] == EMPTY)
-            {
-                /* revise estimate for subsequent factorization */
-                Lnz [block] = MAX (lnz_block, unz_block) ;
-            }
-
-            /* -------------------------------------------------------------- */
-            /* combine the klu row ordering with the symbolic pre-ordering */
-            /* -------------------------------------------------------------- */
-
-            PRINTF (("Pnum, 1-based:\n")) ;
-            for (k = 0 ; k < nk ; k++)
-            {
-                ASSERT (k + k1 < n) ;
-                ASSERT (Pblock [k] + k1 < n) ;
-                Pnum [k + k1] = P [Pblock [k] + k1] ;
-                PRINTF (("Pnum (%d + %d + 1 = %d) = %d + 1 = %d\n",
-                    k, k1, k+k1+1, Pnum [k+k1], Pnum [k+k1]+1)) ;
-            }
-
-            /* the local pivot row permutation Pblock is no longer needed */
         }
+
+        Numeric->lnz = lnz ;
+        Numeric->unz = unz ;
+        Numeric->max_lnz_block = max_lnz_block ;
+        Numeric->max_unz_block = max_unz_block ;
     }
+
     ASSERT (nzoff == Offp [n]) ;
     PRINTF (("\n------------------- Off diagonal entries:\n")) ;
-    ASSERT (KLU_valid (n, Offp, Offi, Offx)) ;
-
-    Numeric->lnz = lnz ;
-    Numeric->unz = unz ;
-    Numeric->max_lnz_block = max_lnz_block ;
-    Numeric->max_unz_block = max_unz_block ;
+    ASSERT (KLU_valid (n, Offp, Offi, (Entry *) Numeric->Offx)) ;
 
     /* compute the inverse of Pnum */
 #ifndef NDEBUG
@@ -333,7 +702,7 @@ static void factor2
     }
 
     PRINTF (("\n------------------- Off diagonal entries, old:\n")) ;
-    ASSERT (KLU_valid (n, Offp, Offi, Offx)) ;
+    ASSERT (KLU_valid (n, Offp, Offi, (Entry *) Numeric->Offx)) ;
 
     /* apply the pivot row permutations to the off-diagonal entries */
     for (p = 0 ; p < nzoff ; p++)
@@ -343,10 +712,11 @@ static void factor2
     }
 
     PRINTF (("\n------------------- Off diagonal entries, new:\n")) ;
-    ASSERT (KLU_valid (n, Offp, Offi, Offx)) ;
+    ASSERT (KLU_valid (n, Offp, Offi, (Entry *) Numeric->Offx)) ;
 
 #ifndef NDEBUG
     {
+        Int nk ;
         PRINTF (("\n ------------ KLU_BTF_FACTOR done, nblocks %d\n",nblocks));
         Entry ss, *Udiag = Numeric->Udiag ;
         for (block = 0 ; block < nblocks && Common->status == KLU_OK ; block++)
@@ -0,0 +1,10 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_l_serialize_numeric.c: int64_t version of klu_serialize_numeric
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (C) 2004-2024, University of Florida, All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+#define DLONG
+#include "klu_serialize_numeric.c"
@@ -17,6 +17,330 @@
 #include "klu_internal.h"
 
 
+/* ========================================================================== */
+/* === refactor_block ======================================================= */
+/* ========================================================================== */
+
+/* Refactorize a single diagonal block of the BTF form.  Each block writes
+ * only to its own part of the Numeric object and to its own columns of the
+ * off-diagonal part, so different blocks can be refactorized at the same time,
+ * each with its own workspace X.  Returns KLU_OK, or KLU_SINGULAR if a zero
+ * pivot is found, in which case *numerical_rank and *singular_col give the
+ * first one.  The workspace X must be zero on input, and is zero on output if
+ * KLU_OK is returned. */
+
+static int refactor_block
+(
+    /* inputs, not modified */
+    Int block,          /* the block to refactorize */
+    Int Ap [ ],         /* size n+1, column pointers */
+    Int Ai [ ],         /* size nz, row indices */
+    Entry Az [ ],
+    KLU_symbolic *Symbolic,
+    Int scale,
+    Int halt_if_singular,
+
+    /* input/output */
+    KLU_numeric *Numeric,
+
+    /* outputs, only defined if KLU_SINGULAR is returned */
+    Int *numerical_rank,
+    Int *singular_col,
+
+    /* workspace, zero on input */
+    Entry X [ ]         /* size maxblock */
+)
+{
+    Entry ukk, ujk, s ;
+    Entry *Offx, *Lx, *Ux, *Udiag ;
+    double *Rs ;
+    Int *Q, *R, *Ui, *Li, *Pinv, *Lip, *Uip, *Llen, *Ulen ;
+    Unit *LU ;
+    Int k1, k2, nk, k, oldcol, pend, oldrow, p, newrow, poff, poffend, i, j,
+        up, ulen, llen ;
+    int status = KLU_OK ;
+
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+    Offx = (Entry *) Numeric->Offx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+    Pinv = Numeric->Pinv ;
+
+    /* ---------------------------------------------------------------------- */
+    /* the block is from rows/columns k1 to k2-1 */
+    /* ---------------------------------------------------------------------- */
+
+    k1 = R [block] ;
+    k2 = R [block+1] ;
+    nk = k2 - k1 ;
+
+    /* the off-diagonal entries in columns k1 to k2-1 */
+    poff = Numeric->Offp [k1] ;
+    poffend = Numeric->Offp [k2] ;
+
+    if (scale <= 0)
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* no scaling */
+        /* ------------------------------------------------------------------ */
+
+        if (nk == 1)
+        {
+
+            /* -------------------------------------------------------------- */
+            /* singleton case */
+            /* -------------------------------------------------------------- */
+
+            oldcol = Q [k1] ;
+            pend = Ap [oldcol+1] ;
+            CLEAR (s) ;
+            for (p = Ap [oldcol] ; p < pend ; p++)
+            {
+                newrow = Pinv [Ai [p]] - k1 ;
+                if (newrow < 0 && poff < poffend)
+                {
+                    /* entry in off-diagonal block */
+                    Offx [poff] = Az [p] ;
+                    poff++ ;
+                }
+                else
+                {
+                    /* singleton */
+                    s = Az [p] ;
+                }
+            }
+            Udiag [k1] = s ;
+
+        }
+        else
+        {
+
+            /* -------------------------------------------------------------- */
+            /* construct and factor the kth block */
+            /* -------------------------------------------------------------- */
+
+            Lip  = Numeric->Lip  + k1 ;
+            Llen = Numeric->Llen + k1 ;
+            Uip  = Numeric->Uip  + k1 ;
+            Ulen = Numeric->Ulen + k1 ;
+            LU = (Unit *) Numeric->LUbx [block] ;
+
+            for (k = 0 ; k < nk ; k++)
+            {
+
+                /* ---------------------------------------------------------- */
+                /* scatter kth column of the block into workspace X */
+                /* ---------------------------------------------------------- */
+
+                oldcol = Q [k+k1] ;
+                pend = Ap [oldcol+1] ;
+                for (p = Ap [oldcol] ; p < pend ; p++)
+                {
+                    newrow = Pinv [Ai [p]] - k1 ;
+                    if (newrow < 0 && poff < poffend)
+                    {
+                        /* entry in off-diagonal block */
+                        Offx [poff] = Az [p] ;
+                        poff++ ;
+                    }
+                    else
+                    {
+                        /* (newrow,k) is an entry in the block */
+                        X [newrow] = Az [p] ;
+                    }
+                }
+
+                /* ---------------------------------------------------------- */
+                /* compute kth column of U, and update kth column of A */
+                /* ---------------------------------------------------------- */
+
+                GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, ulen) ;
+                for (up = 0 ; up < ulen ; up++)
+                {
+                    j = Ui [up] ;
+                    ujk = X [j] ;
+                    /* X [j] = 0 */
+                    CLEAR (X [j]) ;
+                    Ux [up] = ujk ;
+                    GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
+                    for (p = 0 ; p < llen ; p++)
+                    {
+                        /* X [Li [p]] -= Lx [p] * ujk */
+                        MULT_SUB (X [Li [p]], Lx [p], ujk) ;
+                    }
+                }
+                /* get the diagonal entry of U */
+                ukk = X [k] ;
+                /* X [k] = 0 */
+                CLEAR (X [k]) ;
+                /* singular case */
+                if (IS_ZERO (ukk))
+                {
+                    /* matrix is numerically singular */
+                    if (status == KLU_OK)
+                    {
+                        status = KLU_SINGULAR ;
+                        *numerical_rank = k+k1 ;
+                        *singular_col = Q [k+k1] ;
+                    }
+                    if (halt_if_singular)
+                    {
+                        /* do not continue the factorization */
+                        return (status) ;
+                    }
+                }
+                Udiag [k+k1] = ukk ;
+                /* gather and divide by pivot to get kth column of L */
+                GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
+                for (p = 0 ; p < llen ; p++)
+                {
+                    i = Li [p] ;
+                    DIV (Lx [p], X [i], ukk) ;
+                    CLEAR (X [i]) ;
+                }
+
+            }
+        }
+
+    }
+    else
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* scaling */
+        /* ------------------------------------------------------------------ */
+
+        if (nk == 1)
+        {
+
+            /* -------------------------------------------------------------- */
+            /* singleton case */
+            /* -------------------------------------------------------------- */
+
+            oldcol = Q [k1] ;
+            pend = Ap [oldcol+1] ;
+            CLEAR (s) ;
+            for (p = Ap [oldcol] ; p < pend ; p++)
+            {
+                oldrow = Ai [p] ;
+                newrow = Pinv [oldrow] - k1 ;
+                if (newrow < 0 && poff < poffend)
+                {
+                    /* entry in off-diagonal block */
+                    /* Offx [poff] = Az [p] / Rs [oldrow] */
+                    SCALE_DIV_ASSIGN (Offx [poff], Az [p], Rs [oldrow]) ;
+                    poff++ ;
+                }
+                else
+                {
+                    /* singleton */
+                    /* s = Az [p] / Rs [oldrow] */
+                    SCALE_DIV_ASSIGN (s, Az [p], Rs [oldrow]) ;
+                }
+            }
+            Udiag [k1] = s ;
+
+        }
+        else
+        {
+
+            /* -------------------------------------------------------------- */
+            /* construct and factor the kth block */
+            /* -------------------------------------------------------------- */
+
+            Lip  = Numeric->Lip  + k1 ;
+            Llen = Numeric->Llen + k1 ;
+            Uip  = Numeric->Uip  + k1 ;
+            Ulen = Numeric->Ulen + k1 ;
+            LU = (Unit *) Numeric->LUbx [block] ;
+
+            for (k = 0 ; k < nk ; k++)
+            {
+
+                /* ---------------------------------------------------------- */
+                /* scatter kth column of the block into workspace X */
+                /* ---------------------------------------------------------- */
+
+                oldcol = Q [k+k1] ;
+                pend = Ap [oldcol+1] ;
+                for (p = Ap [oldcol] ; p < pend ; p++)
+                {
+                    oldrow = Ai [p] ;
+                    newrow = Pinv [oldrow] - k1 ;
+                    if (newrow < 0 && poff < poffend)
+                    {
+                        /* entry in off-diagonal part */
+                        /* Offx [poff] = Az [p] / Rs [oldrow] */
+                        SCALE_DIV_ASSIGN (Offx [poff], Az [p], Rs [oldrow]);
+                        poff++ ;
+                    }
+                    else
+                    {
+                        /* (newrow,k) is an entry in the block */
+                        /* X [newrow] = Az [p] / Rs [oldrow] */
+                        SCALE_DIV_ASSIGN (X [newrow], Az [p], Rs [oldrow]) ;
+                    }
+                }
+
+                /* ---------------------------------------------------------- */
+                /* compute kth column of U, and update kth column of A */
+                /* ---------------------------------------------------------- */
+
+                GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, ulen) ;
+                for (up = 0 ; up < ulen ; up++)
+                {
+                    j = Ui [up] ;
+                    ujk = X [j] ;
+                    /* X [j] = 0 */
+                    CLEAR (X [j]) ;
+                    Ux [up] = ujk ;
+                    GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
+                    for (p = 0 ; p < llen ; p++)
+                    {
+                        /* X [Li [p]] -= Lx [p] * ujk */
+                        MULT_SUB (X [Li [p]], Lx [p], ujk) ;
+                    }
+                }
+                /* get the diagonal entry of U */
+                ukk = X [k] ;
+                /* X [k] = 0 */
+                CLEAR (X [k]) ;
+                /* singular case */
+                if (IS_ZERO (ukk))
+                {
+                    /* matrix is numerically singular */
+                    if (status == KLU_OK)
+                    {
+                        status = KLU_SINGULAR ;
+                        *numerical_rank = k+k1 ;
+                        *singular_col = Q [k+k1] ;
+                    }
+                    if (halt_if_singular)
+                    {
+                        /* do not continue the factorization */
+                        return (status) ;
+                    }
+                }
+                Udiag [k+k1] = ukk ;
+                /* gather and divide by pivot to get kth column of L */
+                GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
+                for (p = 0 ; p < llen ; p++)
+                {
+                    i = Li [p] ;
+                    DIV (Lx [p], X [i], ukk) ;
+                    CLEAR (X [i]) ;
+                }
+            }
+        }
+    }
+
+    ASSERT (poff == poffend) ;
+    return (status) ;
+}
+
+
 /* ========================================================================== */
 /* === KLU_refactor ========================================================= */
 /* ========================================================================== */
@@ -34,14 +358,12 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     KLU_common  *Common
 )
 {
-    Entry ukk, ujk, s ;
-    Entry *Offx, *Lx, *Ux, *X, *Az, *Udiag ;
+    Entry *X, *Az, *Work ;
     double *Rs ;
-    Int *Q, *R, *Pnum, *Ui, *Li, *Pinv, *Lip, *Uip, *Llen, *Ulen ;
-    Unit **LUbx ;
-    Unit *LU ;
-    Int k1, k2, nk, k, block, oldcol, pend, oldrow, n, p, newrow, scale,
-        nblocks, poff, i, j, up, ulen, llen, maxblock, nzoff ;
+    Int *Pnum ;
+    Int k, block, n, scale, nblocks, maxblock, first_singular, numerical_rank,
+        singular_col, halt_if_singular ;
+    int status, nthreads ;
 
     /* ---------------------------------------------------------------------- */
     /* check inputs */
@@ -70,8 +392,6 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     /* ---------------------------------------------------------------------- */
 
     n = Symbolic->n ;
-    Q = Symbolic->Q ;
-    R = Symbolic->R ;
     nblocks = Symbolic->nblocks ;
     maxblock = Symbolic->maxblock ;
 
@@ -80,9 +400,6 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     /* ---------------------------------------------------------------------- */
 
     Pnum = Numeric->Pnum ;
-    Offx = (Entry *) Numeric->Offx ;
-
-    LUbx = (Unit **) Numeric->LUbx ;
 
     scale = Common->scale ;
     if (scale > 0)
@@ -106,11 +423,8 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     }
     Rs = Numeric->Rs ;
 
-    Pinv = Numeric->Pinv ;
     X = (Entry *) Numeric->Xwork ;
     Common->nrealloc = 0 ;
-    Udiag = Numeric->Udiag ;
-    nzoff = Symbolic->nzoff ;
 
     /* ---------------------------------------------------------------------- */
     /* check the input matrix compute the row scale factors, Rs */
@@ -126,298 +440,129 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
         }
     }
 
-    /* ---------------------------------------------------------------------- */
-    /* clear workspace X */
-    /* ---------------------------------------------------------------------- */
-
-    for (k = 0 ; k < maxblock ; k++)
-    {
-        /* X [k] = 0 */
-        CLEAR (X [k]) ;
-    }
-
-    poff = 0 ;
-
     /* ---------------------------------------------------------------------- */
     /* factor each block */
     /* ---------------------------------------------------------------------- */
 
-    if (scale <= 0)
+    first_singular = nblocks ;
+    numerical_rank = EMPTY ;
+    singular_col = EMPTY ;
+    nthreads = KLU_nthreads (nblocks, Common) ;
+
+    if (nthreads > 1)
     {
 
         /* ------------------------------------------------------------------ */
-        /* no scaling */
+        /* refactorize the blocks in parallel */
         /* ------------------------------------------------------------------ */
 
-        for (block = 0 ; block < nblocks ; block++)
+        /* thread 0 uses Numeric->Xwork; each other thread needs its own X */
+        Work = KLU_malloc (((size_t) nthreads-1) * maxblock, sizeof (Entry),
+            Common) ;
+        if (Common->status < KLU_OK)
         {
+            Common->status = KLU_OUT_OF_MEMORY ;
+            return (FALSE) ;
+        }
+        halt_if_singular = Common->halt_if_singular ;
 
-            /* -------------------------------------------------------------- */
-            /* the block is from rows/columns k1 to k2-1 */
-            /* -------------------------------------------------------------- */
-
-            k1 = R [block] ;
-            k2 = R [block+1] ;
-            nk = k2 - k1 ;
-
-            if (nk == 1)
+        #pragma omp parallel num_threads(nthreads)
+        {
+            Entry *Xt ;
+            Int i, bad, rank, col ;
+            int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+            Xt = (tid == 0) ? X : (Work + ((size_t) tid-1) * maxblock) ;
+            for (i = 0 ; i < maxblock ; i++)
             {
+                /* X [i] = 0 */
+                CLEAR (Xt [i]) ;
+            }
 
-                /* ---------------------------------------------------------- */
-                /* singleton case */
-                /* ---------------------------------------------------------- */
-
-                oldcol = Q [k1] ;
-                pend = Ap [oldcol+1] ;
-                CLEAR (s) ;
-                for (p = Ap [oldcol] ; p < pend ; p++)
+            #pragma omp for schedule(dynamic,1)
+            for (block = 0 ; block < nblocks ; block++)
+            {
+                if (halt_if_singular)
                 {
-                    newrow = Pinv [Ai [p]] - k1 ;
-                    if (newrow < 0 && poff < nzoff)
+                    #pragma omp atomic read
+                    bad = first_singular ;
+                    if (block > bad)
                     {
-                        /* entry in off-diagonal block */
-                        Offx [poff] = Az [p] ;
-                        poff++ ;
-                    }
-                    else
-                    {
-                        /* singleton */
-                        s = Az [p] ;
+                        /* an earlier block is singular; skip this one */
+                        continue ;
                     }
                 }
-                Udiag [k1] = s ;
-
-            }
-            else
-            {
-
-                /* ---------------------------------------------------------- */
-                /* construct and factor the kth block */
-                /* ---------------------------------------------------------- */
-
-                Lip  = Numeric->Lip  + k1 ;
-                Llen = Numeric->Llen + k1 ;
-                Uip  = Numeric->Uip  + k1 ;
-                Ulen = Numeric->Ulen + k1 ;
-                LU = LUbx [block] ;
-
-                for (k = 0 ; k < nk ; k++)
+                if (refactor_block (block, Ap, Ai, Az, Symbolic, scale,
+                    halt_if_singular, Numeric, &rank, &col, Xt) == KLU_SINGULAR)
                 {
-
-                    /* ------------------------------------------------------ */
-                    /* scatter kth column of the block into workspace X */
-                    /* ------------------------------------------------------ */
-
-                    oldcol = Q [k+k1] ;
-                    pend = Ap [oldcol+1] ;
-                    for (p = Ap [oldcol] ; p < pend ; p++)
+                    #pragma omp critical (klu_refactor_first_singular)
                     {
-                        newrow = Pinv [Ai [p]] - k1 ;
-                        if (newrow < 0 && poff < nzoff)
-                        {
-                            /* entry in off-diagonal block */
-                            Offx [poff] = Az [p] ;
-                            poff++ ;
-                        }
-                        else
+                        if (block < first_singular)
                         {
-                            /* (newrow,k) is an entry in the block */
-                            X [newrow] = Az [p] ;
+                            first_singular = block ;
+                            numerical_rank = rank ;
+                            singular_col = col ;
                         }
                     }
-
-                    /* ------------------------------------------------------ */
-                    /* compute kth column of U, and update kth column of A */
-                    /* ------------------------------------------------------ */
-
-                    GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, ulen) ;
-                    for (up = 0 ; up < ulen ; up++)
+                    if (halt_if_singular)
                     {
-                        j = Ui [up] ;
-                        ujk = X [j] ;
-                        /* X [j] = 0 */
-                        CLEAR (X [j]) ;
-                        Ux [up] = ujk ;
-                        GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
-                        for (p = 0 ; p < llen ; p++)
+                        /* X is not cleared if the block halts early */
+                        for (i = 0 ; i < maxblock ; i++)
                         {
-                            /* X [Li [p]] -= Lx [p] * ujk */
-                            MULT_SUB (X [Li [p]], Lx [p], ujk) ;
+                            CLEAR (Xt [i]) ;
                         }
                     }
-                    /* get the diagonal entry of U */
-                    ukk = X [k] ;
-                    /* X [k] = 0 */
-                    CLEAR (X [k]) ;
-                    /* singular case */
-                    if (IS_ZERO (ukk))
-                    {
-                        /* matrix is numerically singular */
-                        Common->status = KLU_SINGULAR ;
-                        if (Common->numerical_rank == EMPTY)
-                        {
-                            Common->numerical_rank = k+k1 ;
-                            Common->singular_col = Q [k+k1] ;
-                        }
-                        if (Common->halt_if_singular)
-                        {
-                            /* do not continue the factorization */
-                            return (FALSE) ;
-                        }
-                    }
-                    Udiag [k+k1] = ukk ;
-                    /* gather and divide by pivot to get kth column of L */
-                    GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
-                    for (p = 0 ; p < llen ; p++)
-                    {
-                        i = Li [p] ;
-                        DIV (Lx [p], X [i], ukk) ;
-                        CLEAR (X [i]) ;
-                    }
-
                 }
             }
         }
 
+        KLU_free (Work, ((size_t) nthreads-1) * maxblock, sizeof (Entry),
+            Common) ;
+
+        if (first_singular < nblocks)
+        {
+            /* matrix is numerically singular */
+            Common->status = KLU_SINGULAR ;
+            Common->numerical_rank = numerical_rank ;
+            Common->singular_col = singular_col ;
+            if (Common->halt_if_singular)
+            {
+                /* do not continue the factorization */
+                return (FALSE) ;
+            }
+        }
+
     }
     else
     {
 
         /* ------------------------------------------------------------------ */
-        /* scaling */
+        /* refactorize the blocks one at a time */
         /* ------------------------------------------------------------------ */
 
-        for (block = 0 ; block < nblocks ; block++)
+        for (k = 0 ; k < maxblock ; k++)
         {
+            /* X [k] = 0 */
+            CLEAR (X [k]) ;
+        }
 
-            /* -------------------------------------------------------------- */
-            /* the block is from rows/columns k1 to k2-1 */
-            /* -------------------------------------------------------------- */
-
-            k1 = R [block] ;
-            k2 = R [block+1] ;
-            nk = k2 - k1 ;
-
-            if (nk == 1)
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            status = refactor_block (block, Ap, Ai, Az, Symbolic, scale,
+                Common->halt_if_singular, Numeric, &numerical_rank,
+                &singular_col, X) ;
+            if (status == KLU_SINGULAR)
             {
-
-                /* ---------------------------------------------------------- */
-                /* singleton case */
-                /* ---------------------------------------------------------- */
-
-                oldcol = Q [k1] ;
-                pend = Ap [oldcol+1] ;
-                CLEAR (s) ;
-                for (p = Ap [oldcol] ; p < pend ; p++)
+                /* matrix is numerically singular */
+                Common->status = KLU_SINGULAR ;
+                if (Common->numerical_rank == EMPTY)
                 {
-                    oldrow = Ai [p] ;
-                    newrow = Pinv [oldrow] - k1 ;
-                    if (newrow < 0 && poff < nzoff)
-                    {
-                        /* entry in off-diagonal block */
-                        /* Offx [poff] = Az [p] / Rs [oldrow] */
-                        SCALE_DIV_ASSIGN (Offx [poff], Az [p], Rs [oldrow]) ;
-                        poff++ ;
-                    }
-                    else
-                    {
-                        /* singleton */
-                        /* s = Az [p] / Rs [oldrow] */
-                        SCALE_DIV_ASSIGN (s, Az [p], Rs [oldrow]) ;
-                    }
+                    Common->numerical_rank = numerical_rank ;
+                    Common->singular_col = singular_col ;
                 }
-                Udiag [k1] = s ;
-
-            }
-            else
-            {
-
-                /* ---------------------------------------------------------- */
-                /* construct and factor the kth block */
-                /* ---------------------------------------------------------- */
-
-                Lip  = Numeric->Lip  + k1 ;
-                Llen = Numeric->Llen + k1 ;
-                Uip  = Numeric->Uip  + k1 ;
-                Ulen = Numeric->Ulen + k1 ;
-                LU = LUbx [block] ;
-
-                for (k = 0 ; k < nk ; k++)
+                if (Common->halt_if_singular)
                 {
-
-                    /* ------------------------------------------------------ */
-                    /* scatter kth column of the block into workspace X */
-                    /* ------------------------------------------------------ */
-
-                    oldcol = Q [k+k1] ;
-                    pend = Ap [oldcol+1] ;
-                    for (p = Ap [oldcol] ; p < pend ; p++)
-                    {
-                        oldrow = Ai [p] ;
-                        newrow = Pinv [oldrow] - k1 ;
-                        if (newrow < 0 && poff < nzoff)
-                        {
-                            /* entry in off-diagonal part */
-                            /* Offx [poff] = Az [p] / Rs [oldrow] */
-                            SCALE_DIV_ASSIGN (Offx [poff], Az [p], Rs [oldrow]);
-                            poff++ ;
-                        }
-                        else
-                        {
-                            /* (newrow,k) is an entry in the block */
-                            /* X [newrow] = Az [p] / Rs [oldrow] */
-                            SCALE_DIV_ASSIGN (X [newrow], Az [p], Rs [oldrow]) ;
-                        }
-                    }
-
-                    /* ------------------------------------------------------ */
-                    /* compute kth column of U, and update kth column of A */
-                    /* ------------------------------------------------------ */
-
-                    GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, ulen) ;
-                    for (up = 0 ; up < ulen ; up++)
-                    {
-                        j = Ui [up] ;
-                        ujk = X [j] ;
-                        /* X [j] = 0 */
-                        CLEAR (X [j]) ;
-                        Ux [up] = ujk ;
-                        GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
-                        for (p = 0 ; p < llen ; p++)
-                        {
-                            /* X [Li [p]] -= Lx [p] * ujk */
-                            MULT_SUB (X [Li [p]], Lx [p], ujk) ;
-                        }
-                    }
-                    /* get the diagonal entry of U */
-                    ukk = X [k] ;
-                    /* X [k] = 0 */
-                    CLEAR (X [k]) ;
-                    /* singular case */
-                    if (IS_ZERO (ukk))
-                    {
-                        /* matrix is numerically singular */
-                        Common->status = KLU_SINGULAR ;
-                        if (Common->numerical_rank == EMPTY)
-                        {
-                            Common->numerical_rank = k+k1 ;
-                            Common->singular_col = Q [k+k1] ;
-                        }
-                        if (Common->halt_if_singular)
-                        {
-                            /* do not continue the factorization */
-                            return (FALSE) ;
-                        }
-                    }
-                    Udiag [k+k1] = ukk ;
-                    /* gather and divide by pivot to get kth column of L */
-                    GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
-                    for (p = 0 ; p < llen ; p++)
-                    {
-                        i = Li [p] ;
-                        DIV (Lx [p], X [i], ukk) ;
-                        CLEAR (X [i]) ;
-                    }
+                    /* do not continue the factorization */
+                    return (FALSE) ;
                 }
             }
         }
@@ -440,12 +585,16 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     }
 
 #ifndef NDEBUG
-    ASSERT (Numeric->Offp [n] == poff) ;
-    ASSERT (Symbolic->nzoff == poff) ;
+    ASSERT (Symbolic->nzoff == Numeric->Offp [n]) ;
     PRINTF (("\n------------------- Off diagonal entries, new:\n")) ;
-    ASSERT (KLU_valid (n, Numeric->Offp, Numeric->Offi, Offx)) ;
+    ASSERT (KLU_valid (n, Numeric->Offp, Numeric->Offi,
+        (Entry *) Numeric->Offx)) ;
     if (Common->status == KLU_OK)
     {
+        Int k1, k2, nk, *R, *Lip, *Uip, *Llen, *Ulen ;
+        Entry *Udiag = Numeric->Udiag ;
+        Unit *LU ;
+        R = Symbolic->R ;
         PRINTF (("\n ----------- KLU_BTF_REFACTOR done, nblocks %d\n",nblocks));
         for (block = 0 ; block < nblocks ; block++)
         {
@@ -0,0 +1,432 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_serialize_numeric: serialize/deserialize a Numeric object
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* User-callable.  Saves a Numeric object to a single int8_t array of bytes
+ * (the "blob"), and reconstructs a Numeric object from a blob.  Together with
+ * klu_serialize_symbolic, this allows a factorization to be written to a file
+ * and read back later (by the same variant of KLU), to avoid calling
+ * klu_analyze and klu_factor again.  The deserialized Numeric object can be
+ * used by klu_solve, klu_tsolve, klu_refactor, and so on, with the Symbolic
+ * object that was used to compute it.  That Symbolic object must be passed to
+ * klu_deserialize_numeric, which checks the contents of the blob against it.
+ *
+ * The blob holds the header described in klu_internal.h, the Numeric struct,
+ * the permutations Pnum and Pinv, the column pointers and lengths of L and U,
+ * the diagonal of U, the scale factors Rs (if present), the off-diagonal
+ * blocks, and then the size and contents of LUbx [block] for each block.  The
+ * workspace Numeric->Work is not saved; it is reallocated when the blob is
+ * read back.
+ */
+
+#include "klu_internal.h"
+
+/* write n entries of an array to the blob, or just count them if blob is NULL */
+#define SERIALIZE(X,type,n)                                         \
+{                                                                   \
+    if (blob != NULL)                                               \
+    {                                                               \
+        memcpy (blob + offset, X, (n) * sizeof (type)) ;            \
+    }                                                               \
+    offset += (n) * sizeof (type) ;                                 \
+}
+
+/* ========================================================================== */
+/* === serialize_numeric ==================================================== */
+/* ========================================================================== */
+
+/* Writes the Numeric object into the blob, or just computes the size of the
+ * blob if blob is NULL.  Returns the size of the blob, in bytes. */
+
+static int64_t serialize_numeric
+(
+    KLU_numeric *Numeric,
+    int8_t *blob
+)
+{
+    Unit **LUbx ;
+    int64_t offset, lusize ;
+    Int n, nzoff, nblocks, block ;
+
+    n = Numeric->n ;
+    nzoff = Numeric->nzoff ;
+    nblocks = Numeric->nblocks ;
+    LUbx = (Unit **) Numeric->LUbx ;
+
+    offset = KLU_BLOB_HEADER_SIZE ;
+    SERIALIZE (Numeric,          KLU_numeric, 1) ;
+    SERIALIZE (Numeric->Pnum,    Int,   n) ;
+    SERIALIZE (Numeric->Pinv,    Int,   n) ;
+    SERIALIZE (Numeric->Lip,     Int,   n) ;
+    SERIALIZE (Numeric->Uip,     Int,   n) ;
+    SERIALIZE (Numeric->Llen,    Int,   n) ;
+    SERIALIZE (Numeric->Ulen,    Int,   n) ;
+    SERIALIZE (Numeric->Udiag,   Entry, n) ;
+    if (Numeric->Rs != NULL)
+    {
+        SERIALIZE (Numeric->Rs, double, n) ;
+    }
+    SERIALIZE (Numeric->Offp,    Int,   n+1) ;
+    SERIALIZE (Numeric->Offi,    Int,   nzoff) ;
+    SERIALIZE (Numeric->Offx,    Entry, nzoff) ;
+
+    /* LUbx [block] is NULL for singleton blocks, and LUsize [block] is then
+     * undefined */
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        lusize = (LUbx [block] == NULL) ? 0 : Numeric->LUsize [block] ;
+        SERIALIZE (&lusize,       int64_t, 1) ;
+        SERIALIZE (LUbx [block],  Unit,    lusize) ;
+    }
+
+    if (blob != NULL)
+    {
+        KLU_blob_header (blob, offset, KLU_BLOB_NUMERIC,
+            (int32_t) sizeof (KLU_numeric)) ;
+    }
+    return (offset) ;
+}
+
+/* ========================================================================== */
+/* === KLU_serialize_numeric_size =========================================== */
+/* ========================================================================== */
+
+int KLU_serialize_numeric_size      /* returns TRUE if successful */
+(
+    KLU_numeric *Numeric,       /* input, not modified */
+    int64_t *blobsize,          /* output: required size of the blob */
+    KLU_common *Common
+)
+{
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    if (Numeric == NULL || blobsize == NULL)
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    *blobsize = serialize_numeric (Numeric, NULL) ;
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === KLU_serialize_numeric ================================================ */
+/* ========================================================================== */
+
+int KLU_serialize_numeric           /* returns TRUE if successful */
+(
+    KLU_numeric *Numeric,       /* input, not modified */
+    int8_t *blob,               /* output: allocated by the caller, of size
+                                 * blobsize, not defined on input */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    KLU_common *Common
+)
+{
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    if (Numeric == NULL || blob == NULL ||
+        blobsize < serialize_numeric (Numeric, NULL))
+    {
+        /* blob is missing or not large enough */
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    serialize_numeric (Numeric, blob) ;
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === KLU_deserialize_numeric ============================================== */
+/* ========================================================================== */
+
+/* return NULL if fewer than n entries of the given type remain in the blob */
+#define CHECK_BLOB(type,n)                                          \
+{                                                                   \
+    if ((n) > (blobsize - offset) / (int64_t) sizeof (type))        \
+    {                                                               \
+        /* blob is truncated */                                     \
+        KLU_free_numeric (&Numeric, Common) ;                       \
+        Common->status = KLU_INVALID ;                              \
+        return (NULL) ;                                             \
+    }                                                               \
+}
+
+/* read n entries of an array from the blob into X, allocated of size nalloc */
+#define DESERIALIZE(X,type,n,nalloc)                                \
+{                                                                   \
+    CHECK_BLOB (type, n) ;                                          \
+    X = KLU_malloc (nalloc, sizeof (type), Common) ;                \
+    if (Common->status < KLU_OK)                                    \
+    {                                                               \
+        KLU_free_numeric (&Numeric, Common) ;                       \
+        return (NULL) ;                                             \
+    }                                                               \
+    memcpy (X, blob + offset, (n) * sizeof (type)) ;                \
+    offset += (n) * sizeof (type) ;                                 \
+}
+
+/* return TRUE if the nk columns of L or U of one block all lie inside its LU
+ * factors, of size lusize Units, and if their row indices are in the range 0
+ * to nk-1.  The number of entries in the nk columns is returned in *xnz. */
+static int valid_LU
+(
+    Int nk,
+    Int *Xip,
+    Int *Xlen,
+    Unit *LU,
+    int64_t lusize,
+    int64_t *xnz
+)
+{
+    Int *Xi ;
+    Int k, p, len ;
+    int64_t xp ;
+
+    *xnz = 0 ;
+    for (k = 0 ; k < nk ; k++)
+    {
+        xp = Xip [k] ;
+        len = Xlen [k] ;
+        if (xp < 0 || len < 0 || len > nk ||
+            xp + (int64_t) (UNITS (Int, len) + UNITS (Entry, len)) > lusize)
+        {
+            return (FALSE) ;
+        }
+        GET_I_POINTER (LU, Xip, Xi, k) ;
+        for (p = 0 ; p < len ; p++)
+        {
+            if (Xi [p] < 0 || Xi [p] >= nk)
+            {
+                return (FALSE) ;
+            }
+        }
+        (*xnz) += len ;
+    }
+    return (TRUE) ;
+}
+
+KLU_numeric *KLU_deserialize_numeric    /* returns NULL if error */
+(
+    int8_t *blob,               /* input: blob from klu_serialize_numeric */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    KLU_symbolic *Symbolic,     /* input: Symbolic object used to compute the
+                                 * Numeric object held in the blob */
+    KLU_common *Common
+)
+{
+    KLU_numeric *Numeric ;
+    Unit **LUbx ;
+    Int *R, *Pnum, *Pinv, *Offp, *Offi ;
+    int64_t offset, lusize, lnz_block, unz_block ;
+    size_t worksize, s, n3, b6 ;
+    Int n, nzoff, nblocks, block, has_Rs, k1, nk, k, p, ok ;
+
+    if (Common == NULL)
+    {
+        return (NULL) ;
+    }
+    Common->status = KLU_OK ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the blob header */
+    /* ---------------------------------------------------------------------- */
+
+    if (blob == NULL || Symbolic == NULL ||
+        !KLU_blob_header_ok (blob, blobsize, KLU_BLOB_NUMERIC,
+        (int32_t) sizeof (KLU_numeric)) ||
+        blobsize < (int64_t) (KLU_BLOB_HEADER_SIZE + sizeof (KLU_numeric)))
+    {
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* read the Numeric struct */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric = KLU_malloc (1, sizeof (KLU_numeric), Common) ;
+    if (Common->status < KLU_OK)
+    {
+        return (NULL) ;
+    }
+    offset = KLU_BLOB_HEADER_SIZE ;
+    memcpy (Numeric, blob + offset, sizeof (KLU_numeric)) ;
+    offset += sizeof (KLU_numeric) ;
+
+    has_Rs = (Numeric->Rs != NULL) ;
+    worksize = Numeric->worksize ;
+    Numeric->Pnum = NULL ;
+    Numeric->Pinv = NULL ;
+    Numeric->Lip = NULL ;
+    Numeric->Uip = NULL ;
+    Numeric->Llen = NULL ;
+    Numeric->Ulen = NULL ;
+    Numeric->LUbx = NULL ;
+    Numeric->LUsize = NULL ;
+    Numeric->Udiag = NULL ;
+    Numeric->Rs = NULL ;
+    Numeric->worksize = 0 ;
+    Numeric->Work = NULL ;
+    Numeric->Xwork = NULL ;
+    Numeric->Iwork = NULL ;
+    Numeric->Offp = NULL ;
+    Numeric->Offi = NULL ;
+    Numeric->Offx = NULL ;
+
+    /* KLU_free_numeric can now be safely called if an error occurs */
+
+    /* the Numeric object must match the Symbolic object, and its workspace
+     * must be as large as the one allocated by klu_factor */
+    n = Numeric->n ;
+    nzoff = Numeric->nzoff ;
+    nblocks = Numeric->nblocks ;
+    R = Symbolic->R ;
+    s = ((size_t) n) * sizeof (Entry) ;
+    n3 = ((size_t) n) * 3 * sizeof (Entry) ;
+    b6 = ((size_t) Symbolic->maxblock) * 6 * sizeof (Int) ;
+    if (n != Symbolic->n || nblocks != Symbolic->nblocks ||
+        nzoff != Symbolic->nzoff || Numeric->max_lnz_block < 1 ||
+        Numeric->max_unz_block < 1 || worksize < s + MAX (n3, b6))
+    {
+        /* the blob does not hold a valid Numeric object */
+        KLU_free_numeric (&Numeric, Common) ;
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* read the arrays, allocated at the same size as klu_factor */
+    /* ---------------------------------------------------------------------- */
+
+    DESERIALIZE (Numeric->Pnum,  Int,    n,     n) ;
+    DESERIALIZE (Numeric->Pinv,  Int,    n,     n) ;
+    DESERIALIZE (Numeric->Lip,   Int,    n,     n) ;
+    DESERIALIZE (Numeric->Uip,   Int,    n,     n) ;
+    DESERIALIZE (Numeric->Llen,  Int,    n,     n) ;
+    DESERIALIZE (Numeric->Ulen,  Int,    n,     n) ;
+    DESERIALIZE (Numeric->Udiag, Entry,  n,     n) ;
+    if (has_Rs)
+    {
+        DESERIALIZE (Numeric->Rs, double, n,    n) ;
+    }
+    DESERIALIZE (Numeric->Offp,  Int,    n+1,   n+1) ;
+    DESERIALIZE (Numeric->Offi,  Int,    nzoff, nzoff+1) ;
+    DESERIALIZE (Numeric->Offx,  Entry,  nzoff, nzoff+1) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* read the LU factors of each block */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric->LUsize = KLU_malloc (nblocks, sizeof (size_t), Common) ;
+    Numeric->LUbx = KLU_malloc (nblocks, sizeof (Unit *), Common) ;
+    if (Common->status < KLU_OK)
+    {
+        KLU_free_numeric (&Numeric, Common) ;
+        return (NULL) ;
+    }
+    LUbx = (Unit **) Numeric->LUbx ;
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        Numeric->LUsize [block] = 0 ;
+        LUbx [block] = NULL ;
+    }
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        CHECK_BLOB (int64_t, 1) ;
+        memcpy (&lusize, blob + offset, sizeof (int64_t)) ;
+        offset += sizeof (int64_t) ;
+        nk = R [block+1] - R [block] ;
+        if (lusize < 0 || (nk == 1) != (lusize == 0))
+        {
+            /* LUbx [block] is NULL only for singleton blocks */
+            KLU_free_numeric (&Numeric, Common) ;
+            Common->status = KLU_INVALID ;
+            return (NULL) ;
+        }
+        if (lusize > 0)
+        {
+            DESERIALIZE (LUbx [block], Unit, lusize, lusize) ;
+            Numeric->LUsize [block] = lusize ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* check the contents of the arrays */
+    /* ---------------------------------------------------------------------- */
+
+    /* Pnum must be a permutation of 0..n-1, and Pinv its inverse */
+    Pnum = Numeric->Pnum ;
+    Pinv = Numeric->Pinv ;
+    ok = TRUE ;
+    for (k = 0 ; ok && k < n ; k++)
+    {
+        ok = (Pnum [k] >= 0 && Pnum [k] < n && Pinv [Pnum [k]] == k) ;
+    }
+
+    /* the off-diagonal blocks must have nzoff entries in rows 0 to n-1 */
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    ok = ok && (Offp [0] == 0 && Offp [n] == nzoff) ;
+    for (k = 0 ; ok && k < n ; k++)
+    {
+        ok = (Offp [k] <= Offp [k+1]) ;
+    }
+    for (p = 0 ; ok && p < nzoff ; p++)
+    {
+        ok = (Offi [p] >= 0 && Offi [p] < n) ;
+    }
+
+    /* each column of L and U must lie inside the LU factors of its block,
+     * which are no larger than max_lnz_block and max_unz_block */
+    for (block = 0 ; ok && block < nblocks ; block++)
+    {
+        k1 = R [block] ;
+        nk = R [block+1] - k1 ;
+        if (nk > 1)
+        {
+            lusize = Numeric->LUsize [block] ;
+            ok = valid_LU (nk, Numeric->Lip + k1, Numeric->Llen + k1,
+                    LUbx [block], lusize, &lnz_block) &&
+                 valid_LU (nk, Numeric->Uip + k1, Numeric->Ulen + k1,
+                    LUbx [block], lusize, &unz_block) &&
+                 lnz_block <= Numeric->max_lnz_block &&
+                 unz_block <= Numeric->max_unz_block ;
+        }
+    }
+
+    if (!ok)
+    {
+        /* the blob does not hold a valid Numeric object */
+        KLU_free_numeric (&Numeric, Common) ;
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the permanent workspace for klu_refactor and klu_solve */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric->Work = KLU_malloc (worksize, 1, Common) ;
+    if (Common->status < KLU_OK)
+    {
+        KLU_free_numeric (&Numeric, Common) ;
+        return (NULL) ;
+    }
+    Numeric->worksize = worksize ;
+    Numeric->Xwork = Numeric->Work ;
+    Numeric->Iwork = (Int *) ((Entry *) Numeric->Xwork + n) ;
+
+    return (Numeric) ;
+}
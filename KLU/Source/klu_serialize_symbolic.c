@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_serialize_symbolic: serialize/deserialize a Symbolic object
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* User-callable.  Saves a Symbolic object to a single int8_t array of bytes
+ * (the "blob"), and reconstructs a Symbolic object from a blob.  The blob can
+ * be written to a file and read back later (by the same variant of KLU) to
+ * avoid calling klu_analyze again.  The blob holds the header described in
+ * klu_internal.h, the Symbolic struct, and the arrays P, Q, R, and Lnz.
+ */
+
+#include "klu_internal.h"
+
+/* write n entries of an array to the blob, or just count them if blob is NULL */
+#define SERIALIZE(X,type,n)                                         \
+{                                                                   \
+    if (blob != NULL)                                               \
+    {                                                               \
+        memcpy (blob + offset, X, (n) * sizeof (type)) ;            \
+    }                                                               \
+    offset += (n) * sizeof (type) ;                                 \
+}
+
+/* ========================================================================== */
+/* === serialize_symbolic =================================================== */
+/* ========================================================================== */
+
+/* Writes the Symbolic object into the blob, or just computes the size of the
+ * blob if blob is NULL.  Returns the size of the blob, in bytes. */
+
+static int64_t serialize_symbolic
+(
+    KLU_symbolic *Symbolic,
+    int8_t *blob
+)
+{
+    int64_t offset ;
+    Int n, nblocks ;
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+
+    offset = KLU_BLOB_HEADER_SIZE ;
+    SERIALIZE (Symbolic,      KLU_symbolic, 1) ;
+    SERIALIZE (Symbolic->P,   Int,    n) ;
+    SERIALIZE (Symbolic->Q,   Int,    n) ;
+    SERIALIZE (Symbolic->R,   Int,    nblocks+1) ;
+    SERIALIZE (Symbolic->Lnz, double, nblocks) ;
+
+    if (blob != NULL)
+    {
+        KLU_blob_header (blob, offset, KLU_BLOB_SYMBOLIC,
+            (int32_t) sizeof (KLU_symbolic)) ;
+    }
+    return (offset) ;
+}
+
+/* ========================================================================== */
+/* === KLU_serialize_symbolic_size ========================================== */
+/* ========================================================================== */
+
+int KLU_serialize_symbolic_size     /* returns TRUE if successful */
+(
+    KLU_symbolic *Symbolic,     /* input, not modified */
+    int64_t *blobsize,          /* output: required size of the blob */
+    KLU_common *Common
+)
+{
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    if (Symbolic == NULL || blobsize == NULL)
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    *blobsize = serialize_symbolic (Symbolic, NULL) ;
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === KLU_serialize_symbolic =============================================== */
+/* ========================================================================== */
+
+int KLU_serialize_symbolic          /* returns TRUE if successful */
+(
+    KLU_symbolic *Symbolic,     /* input, not modified */
+    int8_t *blob,               /* output: allocated by the caller, of size
+                                 * blobsize, not defined on input */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    KLU_common *Common
+)
+{
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    if (Symbolic == NULL || blob == NULL ||
+        blobsize < serialize_symbolic (Symbolic, NULL))
+    {
+        /* blob is missing or not large enough */
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    serialize_symbolic (Symbolic, blob) ;
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === KLU_deserialize_symbolic ============================================= */
+/* ========================================================================== */
+
+/* read n entries of an array from the blob into X, allocated of size nalloc */
+#define DESERIALIZE(X,type,n,nalloc)                                \
+{                                                                   \
+    if ((n) > (blobsize - offset) / (int64_t) sizeof (type))        \
+    {                                                               \
+        /* blob is truncated */                                     \
+        KLU_free_symbolic (&Symbolic, Common) ;                     \
+        Common->status = KLU_INVALID ;                              \
+        return (NULL) ;                                             \
+    }                                                               \
+    X = KLU_malloc (nalloc, sizeof (type), Common) ;                \
+    if (Common->status < KLU_OK)                                    \
+    {                                                               \
+        KLU_free_symbolic (&Symbolic, Common) ;                     \
+        return (NULL) ;                                             \
+    }                                                               \
+    memcpy (X, blob + offset, (n) * sizeof (type)) ;                \
+    offset += (n) * sizeof (type) ;                                 \
+}
+
+/* return TRUE if P [0..n-1] is a permutation of 0..n-1, using W [0..n-1] as
+ * workspace */
+static int is_permutation
+(
+    Int *P,
+    Int n,
+    Int *W
+)
+{
+    Int i, k ;
+    for (i = 0 ; i < n ; i++)
+    {
+        W [i] = EMPTY ;
+    }
+    for (k = 0 ; k < n ; k++)
+    {
+        i = P [k] ;
+        if (i < 0 || i >= n || W [i] != EMPTY)
+        {
+            return (FALSE) ;
+        }
+        W [i] = k ;
+    }
+    return (TRUE) ;
+}
+
+KLU_symbolic *KLU_deserialize_symbolic  /* returns NULL if error */
+(
+    int8_t *blob,               /* input: blob from klu_serialize_symbolic */
+    int64_t blobsize,           /* input: size of the blob, in bytes */
+    KLU_common *Common
+)
+{
+    KLU_symbolic *Symbolic ;
+    Int *R, *W ;
+    int64_t offset ;
+    Int n, nblocks, block, nk, ok ;
+
+    if (Common == NULL)
+    {
+        return (NULL) ;
+    }
+    Common->status = KLU_OK ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the blob header */
+    /* ---------------------------------------------------------------------- */
+
+    if (blob == NULL || !KLU_blob_header_ok (blob, blobsize, KLU_BLOB_SYMBOLIC,
+        (int32_t) sizeof (KLU_symbolic)) ||
+        blobsize < (int64_t) (KLU_BLOB_HEADER_SIZE + sizeof (KLU_symbolic)))
+    {
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* read the Symbolic struct */
+    /* ---------------------------------------------------------------------- */
+
+    Symbolic = KLU_malloc (1, sizeof (KLU_symbolic), Common) ;
+    if (Common->status < KLU_OK)
+    {
+        return (NULL) ;
+    }
+    offset = KLU_BLOB_HEADER_SIZE ;
+    memcpy (Symbolic, blob + offset, sizeof (KLU_symbolic)) ;
+    offset += sizeof (KLU_symbolic) ;
+    Symbolic->P = NULL ;
+    Symbolic->Q = NULL ;
+    Symbolic->R = NULL ;
+    Symbolic->Lnz = NULL ;
+
+    /* KLU_free_symbolic can now be safely called if an error occurs */
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+    if (n <= 0 || nblocks <= 0 || nblocks > n || Symbolic->nz < 0 ||
+        Symbolic->nzoff < 0 || Symbolic->maxblock <= 0 ||
+        Symbolic->maxblock > n)
+    {
+        /* the blob does not hold a valid Symbolic object */
+        KLU_free_symbolic (&Symbolic, Common) ;
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* read the arrays, allocated at the same size as klu_analyze */
+    /* ---------------------------------------------------------------------- */
+
+    DESERIALIZE (Symbolic->P,   Int,    n,         n) ;
+    DESERIALIZE (Symbolic->Q,   Int,    n,         n) ;
+    DESERIALIZE (Symbolic->R,   Int,    nblocks+1, n+1) ;
+    DESERIALIZE (Symbolic->Lnz, double, nblocks,   n) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the contents of the arrays */
+    /* ---------------------------------------------------------------------- */
+
+    /* R must define nblocks non-empty blocks that span 0 to n, each of size
+     * maxblock or less */
+    R = Symbolic->R ;
+    ok = (R [0] == 0 && R [nblocks] == n) ;
+    for (block = 0 ; ok && block < nblocks ; block++)
+    {
+        nk = R [block+1] - R [block] ;
+        ok = (nk > 0 && nk <= Symbolic->maxblock) ;
+    }
+
+    /* P and Q must be permutations of 0..n-1 */
+    if (ok)
+    {
+        W = KLU_malloc (n, sizeof (Int), Common) ;
+        if (Common->status < KLU_OK)
+        {
+            KLU_free_symbolic (&Symbolic, Common) ;
+            return (NULL) ;
+        }
+        ok = is_permutation (Symbolic->P, n, W) &&
+             is_permutation (Symbolic->Q, n, W) ;
+        KLU_free (W, n, sizeof (Int), Common) ;
+    }
+
+    if (!ok)
+    {
+        /* the blob does not hold a valid Symbolic object */
+        KLU_free_symbolic (&Symbolic, Common) ;
+        Common->status = KLU_INVALID ;
+        return (NULL) ;
+    }
+
+    return (Symbolic) ;
+}
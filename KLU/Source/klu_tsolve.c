@@ -13,10 +13,231 @@
  * performed.  Uses Numeric->Xwork as workspace (undefined on input and output),
  * of size 4n Entry's (note that columns 2 to 4 of Xwork overlap with
  * Numeric->Iwork).
+ *
+ * With more than 4 right-hand sides, B is solved in wider chunks, in parallel
+ * if Common->nthreads allows it, just as in KLU_solve.
  */
 
 #include "klu_internal.h"
 
+/* ========================================================================== */
+/* === tsolve_chunk ========================================================= */
+/* ========================================================================== */
+
+/* Solve A'*X=B (or A.'*X=B) for nr columns of B, for any nr >= 1.  X is
+ * workspace of size n*nr, holding the nr right-hand sides in ROW form. */
+
+static void tsolve_chunk
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,                  /* leading dimension of B */
+    Int nr,                 /* number of columns of B to solve */
+    /* right-hand-side on input, overwritten with solution to Ax=b on output */
+    Entry Bz [ ],
+#ifdef COMPLEX
+    int conj_solve,
+#endif
+    /* workspace */
+    Entry X [ ]             /* size n*nr */
+)
+{
+    Entry offik, s ;
+    double rs, *Rs ;
+    Entry *Offx, *Udiag, *Xk, *Xi ;
+    Int *Q, *R, *Pnum, *Offp, *Offi, *Lip, *Uip, *Llen, *Ulen ;
+    Unit **LUbx ;
+    Int k1, k2, nk, k, block, pend, n, p, nblocks, i, j ;
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+    Pnum = Numeric->Pnum ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    Offx = (Entry *) Numeric->Offx ;
+    Lip  = Numeric->Lip ;
+    Llen = Numeric->Llen ;
+    Uip  = Numeric->Uip ;
+    Ulen = Numeric->Ulen ;
+    LUbx = (Unit **) Numeric->LUbx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+
+    /* ---------------------------------------------------------------------- */
+    /* permute the right hand side, X = Q'*B */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Q [k] ;
+        Xk = X + nr*k ;
+        for (j = 0 ; j < nr ; j++)
+        {
+            Xk [j] = Bz [i + d*j] ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve X = (L*U + Off)'\X */
+    /* ---------------------------------------------------------------------- */
+
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        k1 = R [block] ;
+        k2 = R [block+1] ;
+        nk = k2 - k1 ;
+
+        /* block back-substitution for the off-diagonal-block entries */
+        if (block > 0)
+        {
+            for (k = k1 ; k < k2 ; k++)
+            {
+                pend = Offp [k+1] ;
+                Xk = X + nr*k ;
+                for (p = Offp [k] ; p < pend ; p++)
+                {
+                    Xi = X + nr*Offi [p] ;
+#ifdef COMPLEX
+                    if (conj_solve)
+                    {
+                        CONJ (offik, Offx [p]) ;
+                    }
+                    else
+#endif
+                    {
+                        offik = Offx [p] ;
+                    }
+                    for (j = 0 ; j < nr ; j++)
+                    {
+                        MULT_SUB (Xk [j], offik, Xi [j]) ;
+                    }
+                }
+            }
+        }
+
+        /* solve the block system */
+        if (nk == 1)
+        {
+#ifdef COMPLEX
+            if (conj_solve)
+            {
+                CONJ (s, Udiag [k1]) ;
+            }
+            else
+#endif
+            {
+                s = Udiag [k1] ;
+            }
+            Xk = X + nr*k1 ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                DIV (Xk [j], Xk [j], s) ;
+            }
+        }
+        else
+        {
+            KLU_utsolve (nk, Uip + k1, Ulen + k1, LUbx [block],
+                    Udiag + k1, nr,
+#ifdef COMPLEX
+                    conj_solve,
+#endif
+                    X + nr*k1) ;
+            KLU_ltsolve (nk, Lip + k1, Llen + k1, LUbx [block], nr,
+#ifdef COMPLEX
+                    conj_solve,
+#endif
+                    X + nr*k1) ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* scale and permute the result, Bz  = P'(R\X) */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Pnum [k] ;
+        Xk = X + nr*k ;
+        if (Rs == NULL)
+        {
+            for (j = 0 ; j < nr ; j++)
+            {
+                Bz [i + d*j] = Xk [j] ;
+            }
+        }
+        else
+        {
+            rs = Rs [k] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                SCALE_DIV_ASSIGN (Bz [i + d*j], Xk [j], rs) ;
+            }
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === tsolve_blocked ======================================================= */
+/* ========================================================================== */
+
+/* Solve A'*X=B in chunks of KLU_solve_width columns, in parallel if requested.
+ * Returns FALSE if the workspace cannot be allocated (with Common->status left
+ * unchanged), in which case B is not modified. */
+
+static int tsolve_blocked
+(
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,
+    Int nrhs,
+    Entry Bz [ ],
+#ifdef COMPLEX
+    int conj_solve,
+#endif
+    KLU_common *Common
+)
+{
+    Entry *Work ;
+    size_t wsize ;
+    Int n, width, nchunks, chunk ;
+    Int ok = TRUE ;
+    int nthreads, status ;
+
+    n = Symbolic->n ;
+    width = KLU_solve_width (n, nrhs) ;
+    nchunks = (nrhs + width - 1) / width ;
+    nthreads = KLU_nthreads (nchunks, Common) ;
+
+    /* each thread has its own n-by-width workspace */
+    wsize = KLU_mult_size_t (KLU_mult_size_t (n, width, &ok), nthreads, &ok) ;
+    status = Common->status ;
+    Work = ok ? KLU_malloc (wsize, sizeof (Entry), Common) : NULL ;
+    if (Work == NULL)
+    {
+        Common->status = status ;
+        return (FALSE) ;
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (chunk = 0 ; chunk < nchunks ; chunk++)
+    {
+        int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        Int c1 = chunk * width ;
+        tsolve_chunk (Symbolic, Numeric, d, MIN (width, nrhs - c1),
+            Bz + d*c1,
+#ifdef COMPLEX
+            conj_solve,
+#endif
+            Work + ((size_t) n) * width * tid) ;
+    }
+
+    KLU_free (Work, wsize, sizeof (Entry), Common) ;
+    return (TRUE) ;
+}
+
 int KLU_tsolve
 (
     /* inputs, not modified */
@@ -91,6 +312,19 @@ int KLU_tsolve
     X = (Entry *) Numeric->Xwork ;
     ASSERT (KLU_valid (n, Offp, Offi, Offx)) ;
 
+    /* ---------------------------------------------------------------------- */
+    /* solve many right-hand sides in wide chunks, if workspace is available */
+    /* ---------------------------------------------------------------------- */
+
+    if (nrhs > 4 && tsolve_blocked (Symbolic, Numeric, d, nrhs, Bz,
+#ifdef COMPLEX
+        conj_solve,
+#endif
+        Common))
+    {
+        return (TRUE) ;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* solve in chunks of 4 columns at a time */
     /* ---------------------------------------------------------------------- */
@@ -50,6 +50,9 @@
 #define klu_z_extract klu_zl_extract
 #define klu_z_condest klu_zl_condest
 #define klu_z_flops klu_zl_flops
+#define klu_z_serialize_numeric_size klu_zl_serialize_numeric_size
+#define klu_z_serialize_numeric klu_zl_serialize_numeric
+#define klu_z_deserialize_numeric klu_zl_deserialize_numeric
 
 #define klu_scale klu_l_scale
 #define klu_solve klu_l_solve
@@ -67,6 +70,9 @@
 #define klu_extract klu_l_extract
 #define klu_condest klu_l_condest
 #define klu_flops klu_l_flops
+#define klu_serialize_numeric_size klu_l_serialize_numeric_size
+#define klu_serialize_numeric klu_l_serialize_numeric
+#define klu_deserialize_numeric klu_l_deserialize_numeric
 
 #define klu_analyze klu_l_analyze
 #define klu_analyze_given klu_l_analyze_given
@@ -74,6 +80,9 @@
 #define klu_free klu_l_free
 #define klu_realloc klu_l_realloc
 #define klu_free_symbolic klu_l_free_symbolic
+#define klu_serialize_symbolic_size klu_l_serialize_symbolic_size
+#define klu_serialize_symbolic klu_l_serialize_symbolic
+#define klu_deserialize_symbolic klu_l_deserialize_symbolic
 #define klu_free_numeric klu_l_free_numeric
 #define klu_defaults klu_l_defaults
 
@@ -150,23 +159,35 @@ Int my_tries = -1 ;
 
 void *my_malloc (size_t size)
 {
-    if (my_tries == 0) return (NULL) ;      /* pretend to fail */
-    if (my_tries > 0) my_tries-- ;
-    return (malloc (size)) ;
+    int fail ;
+    #pragma omp critical (my_tries)
+    {
+        fail = (my_tries == 0) ;            /* pretend to fail */
+        if (my_tries > 0) my_tries-- ;
+    }
+    return (fail ? NULL : malloc (size)) ;
 }
 
 void *my_calloc (size_t n, size_t size)
 {
-    if (my_tries == 0) return (NULL) ;      /* pretend to fail */
-    if (my_tries > 0) my_tries-- ;
-    return (calloc (n, size)) ;
+    int fail ;
+    #pragma omp critical (my_tries)
+    {
+        fail = (my_tries == 0) ;            /* pretend to fail */
+        if (my_tries > 0) my_tries-- ;
+    }
+    return (fail ? NULL : calloc (n, size)) ;
 }
 
 void *my_realloc (void *p, size_t size)
 {
-    if (my_tries == 0) return (NULL) ;      /* pretend to fail */
-    if (my_tries > 0) my_tries-- ;
-    return (realloc (p, size)) ;
+    int fail ;
+    #pragma omp critical (my_tries)
+    {
+        fail = (my_tries == 0) ;            /* pretend to fail */
+        if (my_tries > 0) my_tries-- ;
+    }
+    return (fail ? NULL : realloc (p, size)) ;
 }
 
 void my_free (void *p)
@@ -753,6 +774,670 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
 }
 
 
+/* ========================================================================== */
+/* === check_parallel ======================================================= */
+/* ========================================================================== */
+
+/* Factorize and refactorize A with 1 thread and with 4 threads, and check that
+ * the results are identical. */
+
+static void check_parallel (cholmod_sparse *A, KLU_common *Common)
+{
+    KLU_symbolic *Symbolic ;
+    KLU_numeric *Num [2] ;
+    Int *Ai, *Ap ;
+    double *Ax ;
+    size_t usage [2], esize ;
+    Int n, t, block, isreal, noffdiag [2], rank [2] ;
+
+    Ap = A->p ;
+    Ai = A->i ;
+    Ax = A->x ;
+    n = A->nrow ;
+    isreal = (A->xtype == CHOLMOD_REAL) ;
+    esize = (isreal ? 1 : 2) * sizeof (double) ;
+
+    Symbolic = klu_analyze (n, Ap, Ai, Common) ;
+    OK (Symbolic) ;
+
+    for (t = 0 ; t <= 1 ; t++)
+    {
+        Common->nthreads = (t == 0) ? 1 : 4 ;
+        usage [t] = Common->memusage ;
+        if (isreal)
+        {
+            Num [t] = klu_factor (Ap, Ai, Ax, Symbolic, Common) ;
+        }
+        else
+        {
+            Num [t] = klu_z_factor (Ap, Ai, Ax, Symbolic, Common) ;
+        }
+        usage [t] = Common->memusage - usage [t] ;
+        noffdiag [t] = Common->noffdiag ;
+        rank [t] = Common->numerical_rank ;
+    }
+    printf ("parallel check: nblocks "ID" usage %g %g\n", Symbolic->nblocks,
+        (double) usage [0], (double) usage [1]) ;
+    OK ((Num [0] == NULL) == (Num [1] == NULL)) ;
+    OK (usage [0] == usage [1]) ;
+    OK (noffdiag [0] == noffdiag [1]) ;
+    OK (rank [0] == rank [1]) ;
+
+    if (Num [0] != NULL)
+    {
+        OK (Num [0]->lnz == Num [1]->lnz) ;
+        OK (Num [0]->unz == Num [1]->unz) ;
+        OK (Num [0]->max_lnz_block == Num [1]->max_lnz_block) ;
+        OK (Num [0]->max_unz_block == Num [1]->max_unz_block) ;
+        OK (!memcmp (Num [0]->Pnum, Num [1]->Pnum, n * sizeof (Int))) ;
+        OK (!memcmp (Num [0]->Offp, Num [1]->Offp, (n+1) * sizeof (Int))) ;
+        OK (!memcmp (Num [0]->Offi, Num [1]->Offi,
+            Symbolic->nzoff * sizeof (Int))) ;
+        OK (!memcmp (Num [0]->Offx, Num [1]->Offx, Symbolic->nzoff * esize)) ;
+        OK (!memcmp (Num [0]->Udiag, Num [1]->Udiag, n * esize)) ;
+        for (block = 0 ; block < Symbolic->nblocks && rank [0] == EMPTY ;
+            block++)
+        {
+            /* compare the factors of each block, if not singular (the values
+             * in the columns of L after a zero pivot are not defined) */
+            Unit *L0, *L1, *U0, *U1 ;
+            Int k1 = Symbolic->R [block], k2 = Symbolic->R [block+1], k,
+                llen, ulen ;
+            if (k2 - k1 == 1) continue ;
+            OK (Num [0]->LUsize [block] == Num [1]->LUsize [block]) ;
+            for (k = k1 ; k < k2 ; k++)
+            {
+                /* compare the pattern and values of L(:,k) and U(:,k) */
+                OK (Num [0]->Lip [k] == Num [1]->Lip [k]) ;
+                OK (Num [0]->Uip [k] == Num [1]->Uip [k]) ;
+                OK (Num [0]->Llen [k] == Num [1]->Llen [k]) ;
+                OK (Num [0]->Ulen [k] == Num [1]->Ulen [k]) ;
+                L0 = (Unit *) Num [0]->LUbx [block] + Num [0]->Lip [k] ;
+                L1 = (Unit *) Num [1]->LUbx [block] + Num [1]->Lip [k] ;
+                U0 = (Unit *) Num [0]->LUbx [block] + Num [0]->Uip [k] ;
+                U1 = (Unit *) Num [1]->LUbx [block] + Num [1]->Uip [k] ;
+                llen = Num [0]->Llen [k] ;
+                ulen = Num [0]->Ulen [k] ;
+                OK (!memcmp (L0, L1, llen * sizeof (Int))) ;
+                OK (!memcmp (L0 + UNITS (Int, llen), L1 + UNITS (Int, llen),
+                    llen * esize)) ;
+                OK (!memcmp (U0, U1, ulen * sizeof (Int))) ;
+                OK (!memcmp (U0 + UNITS (Int, ulen), U1 + UNITS (Int, ulen),
+                    ulen * esize)) ;
+            }
+        }
+
+        /* refactorize, and compare again */
+        for (t = 0 ; t <= 1 ; t++)
+        {
+            Common->nthreads = (t == 0) ? 1 : 4 ;
+            if (isreal)
+            {
+                klu_refactor (Ap, Ai, Ax, Symbolic, Num [t], Common) ;
+            }
+            else
+            {
+                klu_z_refactor (Ap, Ai, Ax, Symbolic, Num [t], Common) ;
+            }
+            rank [t] = Common->numerical_rank ;
+        }
+        OK (rank [0] == rank [1]) ;
+        if (!Common->halt_if_singular || rank [0] == EMPTY)
+        {
+            OK (!memcmp (Num [0]->Udiag, Num [1]->Udiag, n * esize)) ;
+            OK (!memcmp (Num [0]->Offx, Num [1]->Offx,
+                Symbolic->nzoff * esize)) ;
+        }
+    }
+
+    Common->nthreads = 1 ;
+    for (t = 0 ; t <= 1 ; t++)
+    {
+        if (isreal)
+        {
+            klu_free_numeric (&(Num [t]), Common) ;
+        }
+        else
+        {
+            klu_z_free_numeric (&(Num [t]), Common) ;
+        }
+    }
+    klu_free_symbolic (&Symbolic, Common) ;
+}
+
+
+/* ========================================================================== */
+/* === check_multi_rhs ====================================================== */
+/* ========================================================================== */
+
+/* Solve with many right-hand sides, which uses the blocked solve, with 1 and 4
+ * threads, and check that the results are identical to solving one column at
+ * a time, and to solving 4 columns at a time if the blocked solve runs out of
+ * memory. */
+
+#define MULTI_NRHS 40
+
+static void check_multi_rhs (cholmod_sparse *A, KLU_common *Common)
+{
+    KLU_symbolic *Symbolic ;
+    KLU_numeric *Numeric ;
+    double *B, *X [4] ;
+    Int *Ai, *Ap ;
+    double *Ax ;
+    size_t bsize ;
+    Int n, d, i, j, t, isreal, xsize, transpose ;
+
+    Ap = A->p ;
+    Ai = A->i ;
+    Ax = A->x ;
+    n = A->nrow ;
+    d = n + 1 ;
+    isreal = (A->xtype == CHOLMOD_REAL) ;
+    xsize = isreal ? 1 : 2 ;
+    bsize = d * MULTI_NRHS * xsize * sizeof (double) ;
+
+    Symbolic = klu_analyze (n, Ap, Ai, Common) ;
+    OK (Symbolic) ;
+    if (isreal)
+    {
+        Numeric = klu_factor (Ap, Ai, Ax, Symbolic, Common) ;
+    }
+    else
+    {
+        Numeric = klu_z_factor (Ap, Ai, Ax, Symbolic, Common) ;
+    }
+    OK (Numeric) ;
+
+    B = malloc (bsize) ;
+    OK (B) ;
+    for (i = 0 ; i < d * MULTI_NRHS * xsize ; i++)
+    {
+        B [i] = 1 + (i % 7) + (i % 11) / 10. ;
+    }
+    for (t = 0 ; t < 4 ; t++)
+    {
+        X [t] = malloc (bsize) ;
+        OK (X [t]) ;
+    }
+
+    for (transpose = (isreal ? 0 : -1) ; transpose <= 1 ; transpose++)
+    {
+        /* X [0]: one column at a time, X [1]: all columns with 1 thread,
+           X [2]: all columns with 4 threads, X [3]: all columns, with the
+           workspace for the blocked solve not available */
+        for (t = 0 ; t < 4 ; t++)
+        {
+            memcpy (X [t], B, bsize) ;
+            Common->nthreads = (t == 2) ? 4 : 1 ;
+            my_tries = (t == 3) ? 0 : -1 ;
+            for (j = 0 ; j < ((t == 0) ? MULTI_NRHS : 1) ; j++)
+            {
+                Int nrhs = (t == 0) ? 1 : MULTI_NRHS ;
+                double *Xj = X [t] + j * d * xsize ;
+                if (isreal)
+                {
+                    if (transpose)
+                    {
+                        klu_tsolve (Symbolic, Numeric, d, nrhs, Xj, Common) ;
+                    }
+                    else
+                    {
+                        klu_solve (Symbolic, Numeric, d, nrhs, Xj, Common) ;
+                    }
+                }
+                else
+                {
+                    if (transpose)
+                    {
+                        klu_z_tsolve (Symbolic, Numeric, d, nrhs, Xj,
+                            (transpose == 1), Common) ;
+                    }
+                    else
+                    {
+                        klu_z_solve (Symbolic, Numeric, d, nrhs, Xj, Common) ;
+                    }
+                }
+                OK (Common->status == KLU_OK) ;
+            }
+        }
+        my_tries = -1 ;
+        OK (memcmp (X [0], X [1], bsize) == 0) ;
+        OK (memcmp (X [0], X [2], bsize) == 0) ;
+        OK (memcmp (X [0], X [3], bsize) == 0) ;
+        printf ("multi rhs: transpose "ID" OK\n", transpose) ;
+    }
+    Common->nthreads = 1 ;
+
+    for (t = 0 ; t < 4 ; t++)
+    {
+        free (X [t]) ;
+    }
+    free (B) ;
+    klu_free_symbolic (&Symbolic, Common) ;
+    if (isreal)
+    {
+        klu_free_numeric (&Numeric, Common) ;
+    }
+    else
+    {
+        klu_z_free_numeric (&Numeric, Common) ;
+    }
+}
+
+/* ========================================================================== */
+/* === check_serialize ====================================================== */
+/* ========================================================================== */
+
+/* Serialize the Symbolic and Numeric objects, read them back, and check that
+ * the solution and the refactorization with the deserialized objects are
+ * identical to those with the original objects.  Also check that invalid or
+ * truncated blobs are rejected, and that no memory is leaked if malloc fails
+ * during deserialization. */
+
+/* set the Int at byte offset p of the Symbolic blob to x, check that the blob
+ * is rejected, and restore it */
+#define BAD_SYMBOLIC(p,x)                                               \
+{                                                                       \
+    Int save, bad = (x) ;                                               \
+    memcpy (&save, sblob + (p), sizeof (Int)) ;                         \
+    memcpy (sblob + (p), &bad, sizeof (Int)) ;                          \
+    FAIL (klu_deserialize_symbolic (sblob, ssize, Common)) ;            \
+    OK (Common->status == KLU_INVALID) ;                                \
+    memcpy (sblob + (p), &save, sizeof (Int)) ;                         \
+}
+
+/* same as BAD_SYMBOLIC, for the Numeric blob */
+#define BAD_NUMERIC(p,x)                                                \
+{                                                                       \
+    Int save, bad = (x) ;                                               \
+    memcpy (&save, nblob + (p), sizeof (Int)) ;                         \
+    memcpy (nblob + (p), &bad, sizeof (Int)) ;                          \
+    if (isreal)                                                         \
+    {                                                                   \
+        FAIL (klu_deserialize_numeric (nblob, nsize, Symbolic, Common)) ; \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        FAIL (klu_z_deserialize_numeric (nblob, nsize, Symbolic, Common)) ; \
+    }                                                                   \
+    OK (Common->status == KLU_INVALID) ;                                \
+    memcpy (nblob + (p), &save, sizeof (Int)) ;                         \
+}
+
+static void check_serialize (cholmod_sparse *A, KLU_common *Common)
+{
+    KLU_symbolic *Symbolic, *Symbolic2 ;
+    KLU_numeric *Numeric, *Numeric2 ;
+    KLU_symbolic Sym ;
+    KLU_numeric Num ;
+    int8_t *sblob, *nblob ;
+    int64_t ssize, nsize, s, step, lusize, sp, np ;
+    double *X [2] ;
+    Int *Ai, *Ap ;
+    double *Ax ;
+    size_t memusage, xsize, usize ;
+    Int n, i, t, isreal, tries, nb, k1, k, done ;
+
+    Ap = A->p ;
+    Ai = A->i ;
+    Ax = A->x ;
+    n = A->nrow ;
+    isreal = (A->xtype == CHOLMOD_REAL) ;
+    xsize = n * (isreal ? 1 : 2) * sizeof (double) ;
+    memusage = Common->memusage ;
+
+    Symbolic = klu_analyze (n, Ap, Ai, Common) ;
+    OK (Symbolic) ;
+    if (isreal)
+    {
+        Numeric = klu_factor (Ap, Ai, Ax, Symbolic, Common) ;
+    }
+    else
+    {
+        Numeric = klu_z_factor (Ap, Ai, Ax, Symbolic, Common) ;
+    }
+    OK (Numeric) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* serialize the Symbolic and Numeric objects */
+    /* ---------------------------------------------------------------------- */
+
+    OK (klu_serialize_symbolic_size (Symbolic, &ssize, Common)) ;
+    if (isreal)
+    {
+        OK (klu_serialize_numeric_size (Numeric, &nsize, Common)) ;
+    }
+    else
+    {
+        OK (klu_z_serialize_numeric_size (Numeric, &nsize, Common)) ;
+    }
+    sblob = malloc (ssize) ;
+    nblob = malloc (nsize) ;
+    OK (sblob && nblob) ;
+
+    /* blobs that are too small */
+    FAIL (klu_serialize_symbolic (Symbolic, sblob, ssize-1, Common)) ;
+    OK (Common->status == KLU_INVALID) ;
+    if (isreal)
+    {
+        FAIL (klu_serialize_numeric (Numeric, nblob, nsize-1, Common)) ;
+    }
+    else
+    {
+        FAIL (klu_z_serialize_numeric (Numeric, nblob, nsize-1, Common)) ;
+    }
+    OK (Common->status == KLU_INVALID) ;
+
+    OK (klu_serialize_symbolic (Symbolic, sblob, ssize, Common)) ;
+    if (isreal)
+    {
+        OK (klu_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+    else
+    {
+        OK (klu_z_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* deserialize them, with malloc failures */
+    /* ---------------------------------------------------------------------- */
+
+    Symbolic2 = NULL ;
+    Numeric2 = NULL ;
+    my_tries = 0 ;
+    for (tries = 0 ; Symbolic2 == NULL && my_tries == 0 ; tries++)
+    {
+        my_tries = tries ;
+        Symbolic2 = klu_deserialize_symbolic (sblob, ssize, Common) ;
+    }
+    my_tries = 0 ;
+    for (tries = 0 ; Numeric2 == NULL && my_tries == 0 ; tries++)
+    {
+        my_tries = tries ;
+        if (isreal)
+        {
+            Numeric2 = klu_deserialize_numeric (nblob, nsize, Symbolic,
+                Common) ;
+        }
+        else
+        {
+            Numeric2 = klu_z_deserialize_numeric (nblob, nsize, Symbolic,
+                Common) ;
+        }
+    }
+    my_tries = -1 ;
+    OK (Symbolic2 && Numeric2) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* solve and refactorize with the original and deserialized objects */
+    /* ---------------------------------------------------------------------- */
+
+    for (t = 0 ; t < 2 ; t++)
+    {
+        KLU_symbolic *S = (t == 0) ? Symbolic : Symbolic2 ;
+        KLU_numeric *N = (t == 0) ? Numeric : Numeric2 ;
+        X [t] = malloc (xsize) ;
+        OK (X [t]) ;
+        for (i = 0 ; i < n * (isreal ? 1 : 2) ; i++)
+        {
+            X [t][i] = 1 + (i % 5) ;
+        }
+        if (isreal)
+        {
+            OK (klu_solve (S, N, n, 1, X [t], Common)) ;
+            OK (klu_refactor (Ap, Ai, Ax, S, N, Common)) ;
+            OK (klu_tsolve (S, N, n, 1, X [t], Common)) ;
+        }
+        else
+        {
+            OK (klu_z_solve (S, N, n, 1, X [t], Common)) ;
+            OK (klu_z_refactor (Ap, Ai, Ax, S, N, Common)) ;
+            OK (klu_z_tsolve (S, N, n, 1, X [t], TRUE, Common)) ;
+        }
+    }
+    OK (memcmp (X [0], X [1], xsize) == 0) ;
+    free (X [0]) ;
+    free (X [1]) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* invalid blobs */
+    /* ---------------------------------------------------------------------- */
+
+    /* wrong kind of blob, or missing */
+    FAIL (klu_deserialize_symbolic (nblob, nsize, Common)) ;
+    OK (Common->status == KLU_INVALID) ;
+    FAIL (klu_deserialize_symbolic (NULL, ssize, Common)) ;
+    OK (Common->status == KLU_INVALID) ;
+    FAIL (klu_deserialize_symbolic (sblob, ssize, NULL)) ;
+    if (isreal)
+    {
+        FAIL (klu_deserialize_numeric (sblob, ssize, Symbolic, Common)) ;
+    }
+    else
+    {
+        FAIL (klu_z_deserialize_numeric (sblob, ssize, Symbolic, Common)) ;
+    }
+    OK (Common->status == KLU_INVALID) ;
+
+    /* truncated blobs, with a header that claims the blob is complete */
+    step = MAX (1, nsize / 40) ;
+    for (s = nsize - 1 ; s >= 0 ; s -= step)
+    {
+        memcpy (nblob, &s, sizeof (int64_t)) ;
+        if (isreal)
+        {
+            FAIL (klu_deserialize_numeric (nblob, s, Symbolic, Common)) ;
+        }
+        else
+        {
+            FAIL (klu_z_deserialize_numeric (nblob, s, Symbolic, Common)) ;
+        }
+        OK (Common->status == KLU_INVALID) ;
+    }
+    memcpy (nblob, &nsize, sizeof (int64_t)) ;
+    step = MAX (1, ssize / 40) ;
+    for (s = ssize - 1 ; s >= 0 ; s -= step)
+    {
+        memcpy (sblob, &s, sizeof (int64_t)) ;
+        FAIL (klu_deserialize_symbolic (sblob, s, Common)) ;
+        OK (Common->status == KLU_INVALID) ;
+    }
+    memcpy (sblob, &ssize, sizeof (int64_t)) ;
+
+    /* invalid Symbolic and Numeric structs */
+    memcpy (&Sym, sblob + KLU_BLOB_HEADER_SIZE, sizeof (KLU_symbolic)) ;
+    Sym.nblocks = n + 1 ;
+    memcpy (sblob + KLU_BLOB_HEADER_SIZE, &Sym, sizeof (KLU_symbolic)) ;
+    FAIL (klu_deserialize_symbolic (sblob, ssize, Common)) ;
+    OK (Common->status == KLU_INVALID) ;
+    memcpy (&Num, nblob + KLU_BLOB_HEADER_SIZE, sizeof (KLU_numeric)) ;
+    Num.nzoff = -1 ;
+    memcpy (nblob + KLU_BLOB_HEADER_SIZE, &Num, sizeof (KLU_numeric)) ;
+    if (isreal)
+    {
+        FAIL (klu_deserialize_numeric (nblob, nsize, Symbolic, Common)) ;
+    }
+    else
+    {
+        FAIL (klu_z_deserialize_numeric (nblob, nsize, Symbolic, Common)) ;
+    }
+    OK (Common->status == KLU_INVALID) ;
+
+    /* a negative size of the LU factors of the last block */
+    if (isreal)
+    {
+        OK (klu_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+    else
+    {
+        OK (klu_z_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+    i = Numeric->nblocks - 1 ;
+    lusize = (Numeric->LUbx [i] == NULL) ? 0 : Numeric->LUsize [i] ;
+    /* a Unit is a double in the real case, and 2 doubles in the complex case */
+    s = nsize - lusize * (isreal ? 1 : 2) * sizeof (double)
+        - sizeof (int64_t) ;
+    lusize = -1 ;
+    memcpy (nblob + s, &lusize, sizeof (int64_t)) ;
+    if (isreal)
+    {
+        FAIL (klu_deserialize_numeric (nblob, nsize, Symbolic, Common)) ;
+    }
+    else
+    {
+        FAIL (klu_z_deserialize_numeric (nblob, nsize, Symbolic, Common)) ;
+    }
+    OK (Common->status == KLU_INVALID) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* blobs with invalid array contents */
+    /* ---------------------------------------------------------------------- */
+
+    OK (klu_serialize_symbolic (Symbolic, sblob, ssize, Common)) ;
+    if (isreal)
+    {
+        OK (klu_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+    else
+    {
+        OK (klu_z_serialize_numeric (Numeric, nblob, nsize, Common)) ;
+    }
+
+    /* P, Q, and R of the Symbolic object */
+    sp = KLU_BLOB_HEADER_SIZE + sizeof (KLU_symbolic) ;
+    nb = Symbolic->nblocks ;
+    BAD_SYMBOLIC (sp, n) ;                          /* P [0] out of range */
+    BAD_SYMBOLIC (sp + n * sizeof (Int), -1) ;      /* Q [0] out of range */
+    if (n > 1)
+    {
+        BAD_SYMBOLIC (sp, Symbolic->P [1]) ;        /* P [0] == P [1] */
+        BAD_SYMBOLIC (sp + n * sizeof (Int), Symbolic->Q [1]) ;
+    }
+    sp += 2 * n * sizeof (Int) ;
+    BAD_SYMBOLIC (sp, 1) ;                          /* R [0] != 0 */
+    BAD_SYMBOLIC (sp + nb * sizeof (Int), n-1) ;    /* R [nblocks] != n */
+    if (nb > 1)
+    {
+        BAD_SYMBOLIC (sp + sizeof (Int), 0) ;       /* R [1] == R [0] */
+    }
+
+    /* Pnum, Pinv, Lip, Uip, Llen, Ulen, Offp, and Offi of the Numeric
+     * object */
+    np = KLU_BLOB_HEADER_SIZE + sizeof (KLU_numeric) ;
+    BAD_NUMERIC (np, n) ;                           /* Pnum [0] out of range */
+    if (n > 1)
+    {
+        /* Pinv [Pnum [0]] != 0 */
+        BAD_NUMERIC (np + (n + Numeric->Pnum [0]) * sizeof (Int), 1) ;
+    }
+    for (i = 0 ; i < nb ; i++)
+    {
+        k1 = Symbolic->R [i] ;
+        if (Symbolic->R [i+1] - k1 > 1)
+        {
+            /* the first column of L or U of the first non-singleton block
+             * starts past the end of its LU factors, or has a negative
+             * length */
+            lusize = Numeric->LUsize [i] ;
+            BAD_NUMERIC (np + (2*n + k1) * sizeof (Int), lusize + 1) ;
+            BAD_NUMERIC (np + (3*n + k1) * sizeof (Int), lusize + 1) ;
+            BAD_NUMERIC (np + (4*n + k1) * sizeof (Int), -1) ;
+            BAD_NUMERIC (np + (5*n + k1) * sizeof (Int), -1) ;
+            break ;
+        }
+    }
+    np += 6 * n * sizeof (Int) + n * (isreal ? 1 : 2) * sizeof (double) ;
+    if (Numeric->Rs != NULL)
+    {
+        np += n * sizeof (double) ;
+    }
+    BAD_NUMERIC (np, 1) ;                           /* Offp [0] != 0 */
+    BAD_NUMERIC (np + n * sizeof (Int), Numeric->nzoff + 1) ;
+    if (Numeric->nzoff > 0)
+    {
+        BAD_NUMERIC (np + (n + 1) * sizeof (Int), n) ;  /* Offi [0] == n */
+    }
+
+    /* a row index of L out of range, in the first column of L with any
+     * entries.  The LU factors of each block follow Offi, Offx, and the
+     * size of the LU factors of the block. */
+    usize = (isreal ? 1 : 2) * sizeof (double) ;
+    np += (n + 1 + Numeric->nzoff) * sizeof (Int) + Numeric->nzoff * usize ;
+    done = FALSE ;
+    for (i = 0 ; !done && i < nb ; i++)
+    {
+        k1 = Symbolic->R [i] ;
+        lusize = (Numeric->LUbx [i] == NULL) ? 0 : Numeric->LUsize [i] ;
+        np += sizeof (int64_t) ;
+        for (k = k1 ; !done && lusize > 0 && k < Symbolic->R [i+1] ; k++)
+        {
+            if (Numeric->Llen [k] > 0)
+            {
+                /* L (k,k) has row index nk, the size of the block */
+                BAD_NUMERIC (np + Numeric->Lip [k] * usize,
+                    Symbolic->R [i+1] - k1) ;
+                done = TRUE ;
+            }
+        }
+        np += lusize * usize ;
+    }
+
+    /* a Numeric object that does not match the Symbolic object, or no
+     * Symbolic object at all */
+    for (t = 0 ; t < 2 ; t++)
+    {
+        Symbolic->nzoff++ ;
+        if (isreal)
+        {
+            FAIL (klu_deserialize_numeric (nblob, nsize,
+                (t == 0) ? Symbolic : NULL, Common)) ;
+        }
+        else
+        {
+            FAIL (klu_z_deserialize_numeric (nblob, nsize,
+                (t == 0) ? Symbolic : NULL, Common)) ;
+        }
+        OK (Common->status == KLU_INVALID) ;
+        Symbolic->nzoff-- ;
+    }
+
+    /* missing inputs */
+    FAIL (klu_serialize_symbolic_size (NULL, &ssize, Common)) ;
+    FAIL (klu_serialize_symbolic_size (Symbolic, &ssize, NULL)) ;
+    FAIL (klu_serialize_symbolic (Symbolic, sblob, ssize, NULL)) ;
+    if (isreal)
+    {
+        FAIL (klu_serialize_numeric_size (NULL, &nsize, Common)) ;
+        FAIL (klu_serialize_numeric_size (Numeric, &nsize, NULL)) ;
+        FAIL (klu_serialize_numeric (Numeric, nblob, nsize, NULL)) ;
+        FAIL (klu_deserialize_numeric (nblob, nsize, Symbolic, NULL)) ;
+    }
+    else
+    {
+        FAIL (klu_z_serialize_numeric_size (NULL, &nsize, Common)) ;
+        FAIL (klu_z_serialize_numeric_size (Numeric, &nsize, NULL)) ;
+        FAIL (klu_z_serialize_numeric (Numeric, nblob, nsize, NULL)) ;
+        FAIL (klu_z_deserialize_numeric (nblob, nsize, Symbolic, NULL)) ;
+    }
+    printf ("serialize: OK\n") ;
+
+    free (sblob) ;
+    free (nblob) ;
+    klu_free_symbolic (&Symbolic, Common) ;
+    klu_free_symbolic (&Symbolic2, Common) ;
+    if (isreal)
+    {
+        klu_free_numeric (&Numeric, Common) ;
+        klu_free_numeric (&Numeric2, Common) ;
+    }
+    else
+    {
+        klu_z_free_numeric (&Numeric, Common) ;
+        klu_z_free_numeric (&Numeric2, Common) ;
+    }
+    OK (Common->memusage == memusage) ;
+}
+
 /* ========================================================================== */
 /* === do_solves ============================================================ */
 /* ========================================================================== */
@@ -823,6 +1508,59 @@ static double do_solves (cholmod_sparse *A, cholmod_dense *B, cholmod_dense *X,
         }
     }
 
+    /* ---------------------------------------------------------------------- */
+    /* test the parallel factorization of the BTF blocks */
+    /* ---------------------------------------------------------------------- */
+
+    Common->btf = TRUE ;
+    Common->maxwork = 0 ;
+    Common->ordering = 0 ;
+    Common->scale = 2 ;
+    for (Common->halt_if_singular = 0 ; Common->halt_if_singular <= 1 ;
+        Common->halt_if_singular++)
+    {
+        check_parallel (A, Common) ;
+        Common->nthreads = 4 ;
+        err = do_1_solve (A, B, X, NULL, NULL, Common, ch, isnan) ;
+        printf ("nthreads %d err %g\n", Common->nthreads, err) ;
+        maxerr = MAX (maxerr, err) ;
+        Common->nthreads = 1 ;
+    }
+    Common->halt_if_singular = FALSE ;
+    check_multi_rhs (A, Common) ;
+    for (Common->scale = 0 ; Common->scale <= 2 ; Common->scale += 2)
+    {
+        check_serialize (A, Common) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* test the dense kernel */
+    /* ---------------------------------------------------------------------- */
+
+    /* use the dense kernel for all blocks of size 2 or more (dense_ratio 0),
+       or for none of them (dense_ratio 2) */
+    Common->dense_size = 2 ;
+    for (Common->ordering = 0 ; Common->ordering <= 1 ; Common->ordering++)
+    {
+        for (Common->halt_if_singular = 0 ; Common->halt_if_singular <= 1 ;
+            Common->halt_if_singular++)
+        {
+            Common->dense_ratio = 0 ;
+            Common->nthreads = Common->halt_if_singular ? 4 : 1 ;
+            err = do_1_solve (A, B, X, NULL, NULL, Common, ch, isnan) ;
+            printf ("dense err %g\n", err) ;
+            maxerr = MAX (maxerr, err) ;
+        }
+    }
+    Common->ordering = 0 ;
+    Common->dense_ratio = 2 ;
+    err = do_1_solve (A, B, X, NULL, NULL, Common, ch, isnan) ;
+    printf ("not dense err %g\n", err) ;
+    maxerr = MAX (maxerr, err) ;
+    Common->dense_size = 0 ;
+    Common->dense_ratio = 0.5 ;
+    Common->nthreads = 1 ;
+
     /* restore defaults */
     Common->btf = TRUE ;
     Common->maxwork = 0 ;
@@ -1232,6 +1970,40 @@ int main (void)
         FAIL (Numeric) ;
         Ai [0] = save ;
 
+        /* ------------------------------------------------------------------ */
+        /* factorize a matrix with a pattern different from A */
+        /* ------------------------------------------------------------------ */
+
+        if (Symbolic->nzoff > 0)
+        {
+            /* the identity matrix has no entries in the off-diagonal part */
+            Int *Ip = malloc ((n+1) * sizeof (Int)) ;
+            Int *Ii = malloc (n * sizeof (Int)) ;
+            double *Ix = malloc (2 * n * sizeof (double)) ;
+            OK (Ip && Ii && Ix) ;
+            for (k = 0 ; k < n ; k++)
+            {
+                Ip [k] = k ;
+                Ii [k] = k ;
+                Ix [2*k] = 1 ;
+                Ix [2*k+1] = 0 ;
+            }
+            Ip [n] = n ;
+            if (isreal)
+            {
+                Numeric = klu_factor (Ip, Ii, Ix, Symbolic, &Common) ;
+            }
+            else
+            {
+                Numeric = klu_z_factor (Ip, Ii, Ix, Symbolic, &Common) ;
+            }
+            FAIL (Numeric) ;
+            OK (Common.status == KLU_INVALID) ;
+            free (Ip) ;
+            free (Ii) ;
+            free (Ix) ;
+        }
+
         /* ------------------------------------------------------------------ */
         /* nan and inf handling */
         /* ------------------------------------------------------------------ */
@@ -1299,6 +2071,34 @@ int main (void)
                 OK (Common.status = KLU_SINGULAR) ;
             }
         }
+
+        /* all zero, with the blocks refactorized in parallel; the result
+           must match the sequential one (singletons are not checked) */
+        Common.scale = 0 ;
+        for (Common.halt_if_singular = 0 ; Common.halt_if_singular <= 1 ;
+            Common.halt_if_singular++)
+        {
+            Int status [2], rank [2], col [2] ;
+            for (k = 0 ; k <= 1 ; k++)
+            {
+                Common.nthreads = (k == 0) ? 1 : 4 ;
+                if (isreal)
+                {
+                    klu_refactor (Ap, Ai, A2x, Symbolic, Numeric, &Common) ;
+                }
+                else
+                {
+                    klu_z_refactor (Ap, Ai, A2x, Symbolic, Numeric, &Common) ;
+                }
+                status [k] = Common.status ;
+                rank [k] = Common.numerical_rank ;
+                col [k] = Common.singular_col ;
+            }
+            OK (status [0] == status [1]) ;
+            OK (rank [0] == rank [1]) ;
+            OK (col [0] == col [1]) ;
+        }
+        Common.nthreads = 1 ;
         CHOLMOD_free_sparse (&A2, &ch) ;
 
         /* ------------------------------------------------------------------ */
@@ -253,6 +253,47 @@ int main(int argc, char **argv)
         << "Multiple right hand side: relative residual is |"
         << rresid << "|." << std::endl;
 
+    //~~~~~~~~~~~~~~~~~~~Refactorize with new values~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    // change the values of A, but not its pattern, and refactorize it
+    {
+        double *Anew = (double *) A->x ;
+        int64_t *Apnew = (int64_t *) A->p ;
+        for (int64_t p = 0; p < Apnew[n]; p++)
+        {
+            Anew[p] *= 1 + 1e-3 * sin ((double) p) ;
+        }
+    }
+    std::cout << "\n--------- ParU_Refactor:\n";
+    double my_start_time_refac = SUITESPARSE_TIME;
+    info = ParU_Refactor(A, Sym, &Num, Control);
+    double my_time_refac = SUITESPARSE_TIME - my_start_time_refac;
+    if (info != PARU_SUCCESS)
+    {
+        std::cout << "ParU: refactorization failed" << std::endl;
+        FREE_ALL_AND_RETURN (info) ;
+    }
+    std::cout << std::scientific << std::setprecision(1)
+        << "ParU: refactorization was successful in " << my_time_refac
+        << " seconds.\n";
+    for (int64_t i = 0; i < n; ++i) b[i] = i + 1;
+    info = ParU_Solve(Sym, Num, b, xx, Control);
+    if (info != PARU_SUCCESS)
+    {
+        std::cout << "ParU: solve failed" << std::endl;
+        FREE_ALL_AND_RETURN (info) ;
+    }
+    info = ParU_Residual(A, xx, b, resid, anorm, xnorm, Control);
+    if (info != PARU_SUCCESS)
+    {
+        std::cout << "ParU: resid failed" << std::endl;
+        FREE_ALL_AND_RETURN (info) ;
+    }
+    rresid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    std::cout << std::scientific << std::setprecision(2)
+        << "Refactorization: relative residual is |" << rresid << "|."
+        << std::endl;
+
     //~~~~~~~~~~~~~~~~~~~End computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     //~~~~~~~~~~~~~~~~~~~Calling umfpack~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
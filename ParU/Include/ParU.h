@@ -53,25 +53,25 @@ typedef enum ParU_Info
     PARU_TOO_LARGE = -4         // problem too large for the BLAS
 } ParU_Info ;
 
-#define PARU_DATE "Sept 5, 2024"
+#define PARU_DATE "Oct 18, 2026"
 #define PARU_VERSION_MAJOR  1
-#define PARU_VERSION_MINOR  0
+#define PARU_VERSION_MINOR  1
 #define PARU_VERSION_UPDATE 0
 
-#define PARU__VERSION SUITESPARSE__VERCODE(1,0,0)
+#define PARU__VERSION SUITESPARSE__VERCODE(1,1,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,3))
-#error "ParU 1.0.0 requires SuiteSparse_config 7.8.3 or later"
+#error "ParU 1.1.0 requires SuiteSparse_config 7.8.3 or later"
 #endif
 
 #if !defined (UMFPACK__VERSION) || \
-    (UMFPACK__VERSION < SUITESPARSE__VERCODE(6,3,5))
-#error "ParU 1.0.0 requires UMFPACK 6.3.5 or later"
+    (UMFPACK__VERSION < SUITESPARSE__VERCODE(6,4,0))
+#error "ParU 1.1.0 requires UMFPACK 6.4.0 or later"
 #endif
 
 #if !defined (CHOLMOD__VERSION) || \
-    (CHOLMOD__VERSION < SUITESPARSE__VERCODE(5,3,0))
-#error "ParU 1.0.0 requires CHOLMOD 5.3.0 or later"
+    (CHOLMOD__VERSION < SUITESPARSE__VERCODE(6,0,0))
+#error "ParU 1.1.0 requires CHOLMOD 6.0.0 or later"
 #endif
 
 //  the same values as UMFPACK_STRATEGY defined in UMFPACK/Include/umfpack.h
@@ -211,6 +211,7 @@ ParU_Control_enum ;
 #endif
 
 #include <cmath>
+#include <complex>
 
 //------------------------------------------------------------------------------
 // opaque objects (ParU_Symbolic, ParU_Numeric, and ParU_Control):
@@ -232,7 +233,8 @@ ParU_Info ParU_Version (int ver [3], char date [128]) ;
 // ParU_Analyze: Symbolic analysis is done in this routine. UMFPACK is called
 // here and after that some more specialized symbolic computation is done for
 // ParU. ParU_Analyze can be called once and can be used for different
-// ParU_Factorize calls.
+// ParU_Factorize calls.  The matrix A may be real or complex (CHOLMOD_REAL or
+// CHOLMOD_COMPLEX, with a dtype of CHOLMOD_DOUBLE).
 //------------------------------------------------------------------------------
 
 ParU_Info ParU_Analyze
@@ -262,6 +264,27 @@ ParU_Info ParU_Factorize
     ParU_Control Control
 ) ;
 
+//------------------------------------------------------------------------------
+// ParU_Refactor: Numeric refactorization of a matrix with the same pattern as
+// the one factorized by ParU_Factorize, but with new values.  The pivot
+// sequence and the frontal structure of Num are reused, so no pivot search is
+// done.  If a pivot is too small, or the new values do not fit in the prior
+// frontal structure, Num is freed and the matrix is factorized with
+// ParU_Factorize instead.  Num is freed if an error occurs.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Refactor
+(
+    // input:
+    cholmod_sparse *A,          // input matrix to factorize, with the same
+                                // pattern as the matrix analyzed by Sym
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_Numeric *Num_handle,   // numeric factorization from ParU_Factorize
+    // control:
+    ParU_Control Control
+) ;
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -479,6 +502,215 @@ ParU_Info ParU_Residual
     ParU_Control Control
 ) ;
 
+//------------------------------------------------------------------------------
+//-------------- complex solve, permutation, and residual ----------------------
+//------------------------------------------------------------------------------
+
+// If A is complex (A->xtype is CHOLMOD_COMPLEX, with A->x holding the real and
+// imaginary parts interleaved), ParU_Analyze, ParU_Factorize, and
+// ParU_Refactor compute a complex factorization, which is used with the
+// following complex versions of the solve routines.  The real versions return
+// PARU_INVALID for a complex factorization, and vice versa.  The scale
+// factors s are always real.
+
+//-------- x = A\x -------------------------------------------------------------
+ParU_Info ParU_Solve            // solve Ax=b, overwriting b with solution x
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // input/output:
+    std::complex<double> *x,    // vector of size n-by-1; right-hand on input,
+                                // solution on output
+    // control:
+    ParU_Control Control
+) ;
+
+//-------- x = A\b -------------------------------------------------------------
+ParU_Info ParU_Solve            // solve Ax=b
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    std::complex<double> *b,    // vector of size n-by-1
+    // output
+    std::complex<double> *x,    // vector of size n-by-1
+    // control:
+    ParU_Control Control
+) ;
+
+//-------- X = A\X -------------------------------------------------------------
+ParU_Info ParU_Solve            // solve AX=B, overwriting B with solution X
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    int64_t nrhs,               // # of right-hand sides
+    // input/output:
+    std::complex<double> *X,    // X is n-by-nrhs, where A is n-by-n;
+                                // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+) ;
+
+//-------- X = A\B -------------------------------------------------------------
+ParU_Info ParU_Solve            // solve AX=B
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    int64_t nrhs,               // # of right-hand sides
+    std::complex<double> *B,    // n-by-nrhs, in column-major storage
+    // output:
+    std::complex<double> *X,    // n-by-nrhs, in column-major storage
+    // control:
+    ParU_Control Control
+) ;
+
+// Solve L*x=b where x and b are vectors (no scaling or permutations)
+ParU_Info ParU_LSolve           // solve Lx=b
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // input/output:
+    std::complex<double> *x,    // n-by-1, in column-major storage;
+                                // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+) ;
+
+// Solve L*X=B where X and B are matrices (no scaling or permutations)
+ParU_Info ParU_LSolve           // solve LX=B
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    int64_t nrhs,               // # of right-hand-sides (# columns of X)
+    // input/output:
+    std::complex<double> *X,    // X is n-by-nrhs, where A is n-by-n;
+                                // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+) ;
+
+// Solve U*x=b where x and b are vectors (no scaling or permutations)
+ParU_Info ParU_USolve           // solve Ux=b
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // input/output
+    std::complex<double> *x,    // n-by-1, in column-major storage;
+                                // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+) ;
+
+// Solve U*X=B where X and B are matrices (no scaling or permutations)
+ParU_Info ParU_USolve           // solve UX=B
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    int64_t nrhs,               // # of right-hand-sides (# columns of X)
+    // input/output:
+    std::complex<double> *X,    // X is n-by-nrhs, where A is n-by-n;
+                                // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+) ;
+
+// apply inverse perm x(p) = b, or with scaling: x(p)=b ; x=x./s
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const std::complex<double> *b, // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    std::complex<double> *x, // vector of size n
+    // control:
+    ParU_Control Control
+) ;
+
+// apply inverse perm X(p,:) = B or with scaling: X(p,:)=B ; X = X./s
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const std::complex<double> *B, // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    std::complex<double> *X, // array of size nrows-by-ncols
+    // control:
+    ParU_Control Control
+) ;
+
+// apply perm and scale x = b(P) / s
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const std::complex<double> *b, // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    std::complex<double> *x, // vector of size n
+    // control:
+    ParU_Control Control
+) ;
+
+// apply perm and scale X = B(P,:) / s
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const std::complex<double> *B, // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    std::complex<double> *X, // array of size nrows-by-ncols
+    // control:
+    ParU_Control Control
+) ;
+
+// resid = norm1(b-A*x) / (norm1(A) * norm1 (x))
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    std::complex<double> *x, // vector of size n, solution to Ax=b
+    std::complex<double> *b, // vector of size n
+    // output:
+    double &resid,      // residual: norm1(b-A*x) / (norm1(A) * norm1 (x))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of x
+    // control:
+    ParU_Control Control
+) ;
+
+// resid = norm1(B-A*X) / (norm1(A) * norm1 (X))
+// (multiple rhs)
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    std::complex<double> *X, // array of size n-by-nrhs, solution to AX=B
+    std::complex<double> *B, // array of size n-by-nrhs
+    int64_t nrhs,
+    // output:
+    double &resid,      // residual: norm1(B-A*X) / (norm1(A) * norm1 (X))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of X
+    // control:
+    ParU_Control Control
+) ;
+
 //------------------------------------------------------------------------------
 //------------ Get statistics and contents of factorization --------------------
 //------------------------------------------------------------------------------
@@ -577,6 +809,101 @@ ParU_Info ParU_Get              // get string from Control
     ParU_Control Control
 ) ;
 
+//------------------------------------------------------------------------------
+//------------ Serialize and deserialize ---------------------------------------
+//------------------------------------------------------------------------------
+
+// ParU_Serialize_Symbolic and ParU_Serialize_Numeric copy the Symbolic and
+// Numeric objects into a flat "blob" (an array of int8_t of size blobsize,
+// given by ParU_Serialize_*_Size) that can be saved to a file or sent to
+// other processes.  The blob records the version of its format and is only
+// read back by a ParU with the same format on a platform with the same sizes
+// of its data types.
+
+// ParU_Deserialize_Symbolic and ParU_Deserialize_Numeric construct a new
+// object from the blob.  If copy is true, its contents are copied and the
+// blob can then be freed.  If copy is false, the object is "shallow": its
+// arrays point into the blob, which must then be 8-byte aligned (as it is if
+// it comes from malloc or mmap), and must not be freed or modified until the
+// object is freed.  This allows a read-only memory-mapped blob to be used to
+// solve systems without copying it.  ParU_Refactor does not overwrite a
+// shallow Numeric object; it frees it and calls ParU_Factorize instead.
+
+// The deserialize methods check the contents of the blob (the sizes, the
+// permutations, and the pointers and indices of the fronts) and return
+// PARU_INVALID if it does not hold a valid object.  A deserialized Numeric
+// object must be used with the Symbolic object it was computed from.
+// ParU_Solve, ParU_LSolve, ParU_USolve, and ParU_Refactor return PARU_INVALID
+// if the Numeric object does not match the Symbolic object.
+
+ParU_Info ParU_Serialize_Symbolic_Size
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // output:
+    int64_t *blobsize,          // required size of the blob, in bytes
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Serialize_Symbolic
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // output:
+    int8_t *blob,               // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,           // size of the blob, in bytes
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Deserialize_Symbolic
+(
+    // input:
+    const int8_t *blob,         // blob from ParU_Serialize_Symbolic
+    int64_t blobsize,           // size of the blob, in bytes
+    bool copy,                  // if false, Sym points into the blob
+    // output:
+    ParU_Symbolic *Sym_handle,  // Symbolic object created from the blob
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Serialize_Numeric_Size
+(
+    // input:
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // output:
+    int64_t *blobsize,          // required size of the blob, in bytes
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Serialize_Numeric
+(
+    // input:
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // output:
+    int8_t *blob,               // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,           // size of the blob, in bytes
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Deserialize_Numeric
+(
+    // input:
+    const int8_t *blob,         // blob from ParU_Serialize_Numeric
+    int64_t blobsize,           // size of the blob, in bytes
+    bool copy,                  // if false, Num points into the blob
+    // output:
+    ParU_Numeric *Num_handle,   // Numeric object created from the blob
+    // control:
+    ParU_Control Control
+) ;
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
@@ -649,7 +976,8 @@ ParU_Info ParU_C_InitControl (ParU_C_Control *Control_C_handle) ;
 // ParU_C_Analyze: Symbolic analysis is done in this routine. UMFPACK is called
 // here and after that some more speciaized symbolic computation is done for
 // ParU. ParU_Analyze can be called once and can be used for different
-// ParU_Factorize calls.
+// ParU_Factorize calls.  The matrix A may be real or complex (CHOLMOD_REAL or
+// CHOLMOD_COMPLEX, with a dtype of CHOLMOD_DOUBLE).
 //------------------------------------------------------------------------------
 
 ParU_Info ParU_C_Analyze
@@ -680,6 +1008,24 @@ ParU_Info ParU_C_Factorize
     ParU_C_Control Control_C
 ) ;
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactor: Numeric refactorization of a matrix with the same pattern
+// as the one factorized by ParU_C_Factorize, reusing its pivot sequence and
+// frontal structure.  See ParU_Refactor.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_Refactor
+(
+    // input:
+    cholmod_sparse *A,              // input matrix to factorize of size n-by-n
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_C_Numeric *Num_handle_C,   // numerical factorization from
+                                    // ParU_C_Factorize
+    // control:
+    ParU_C_Control Control_C
+) ;
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -969,6 +1315,80 @@ ParU_Info ParU_C_Set_Control_FP64       // set double parameter in Control
     ParU_C_Control Control_C
 ) ;
 
+//------------------------------------------------------------------------------
+//------------ ParU_C_Serialize_* and ParU_C_Deserialize_* ---------------------
+//------------------------------------------------------------------------------
+
+// See ParU_Serialize_Symbolic and related methods above.
+
+ParU_Info ParU_C_Serialize_Symbolic_Size
+(
+    // input:
+    const ParU_C_Symbolic Sym_C, // symbolic analysis from ParU_C_Analyze
+    // output:
+    int64_t *blobsize,           // required size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Serialize_Symbolic
+(
+    // input:
+    const ParU_C_Symbolic Sym_C, // symbolic analysis from ParU_C_Analyze
+    // output:
+    int8_t *blob,                // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,            // size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Deserialize_Symbolic
+(
+    // input:
+    const int8_t *blob,          // blob from ParU_C_Serialize_Symbolic
+    int64_t blobsize,            // size of the blob, in bytes
+    bool copy,                   // if false, Sym_C points into the blob
+    // output:
+    ParU_C_Symbolic *Sym_handle_C,  // Symbolic object created from the blob
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Serialize_Numeric_Size
+(
+    // input:
+    const ParU_C_Numeric Num_C,  // numeric factorization from ParU_C_Factorize
+    // output:
+    int64_t *blobsize,           // required size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Serialize_Numeric
+(
+    // input:
+    const ParU_C_Numeric Num_C,  // numeric factorization from ParU_C_Factorize
+    // output:
+    int8_t *blob,                // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,            // size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Deserialize_Numeric
+(
+    // input:
+    const int8_t *blob,          // blob from ParU_C_Serialize_Numeric
+    int64_t blobsize,            // size of the blob, in bytes
+    bool copy,                   // if false, Num_C points into the blob
+    // output:
+    ParU_C_Numeric *Num_handle_C,   // Numeric object created from the blob
+    // control:
+    ParU_C_Control Control_C
+) ;
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
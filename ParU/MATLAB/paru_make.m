@@ -374,6 +374,7 @@ paru_src = {
     '../Source/paru_heap', ...
     '../Source/paru_init_rel', ...
     '../Source/paru_init_rowFronts', ...
+    '../Source/paru_init_values', ...
     '../Source/paru_intersection', ...
     '../Source/ParU_InvPerm', ...
     '../Source/ParU_LSolve', ...
@@ -384,9 +385,13 @@ paru_src = {
     '../Source/paru_norms', ...
     '../Source/paru_nthreads', ...
     '../Source/ParU_Perm', ...
+    '../Source/ParU_Refactor', ...
+    '../Source/paru_refactor_map', ...
     '../Source/paru_pivotal', ...
     '../Source/paru_prior_assemble', ...
     '../Source/ParU_Residual', ...
+    '../Source/ParU_Serialize', ...
+    '../Source/ParU_Deserialize', ...
     '../Source/ParU_Set', ...
     '../Source/ParU_Solve', ...
     '../Source/paru_tasked_dgemm', ...
@@ -90,7 +90,8 @@ ParU_Info ParU_Analyze
 )
 {
     if (!A || !Sym_handle || A->nrow != A->ncol ||
-        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE)
+        (A->xtype != CHOLMOD_REAL && A->xtype != CHOLMOD_COMPLEX) ||
+        A->dtype != CHOLMOD_DOUBLE)
     {
         return (PARU_INVALID) ;
     }
@@ -131,7 +132,7 @@ ParU_Info ParU_Analyze
     int64_t n = A->ncol;
     int64_t *Ap = static_cast<int64_t*>(A->p);
     int64_t *Ai = static_cast<int64_t*>(A->i);
-    double *Ax = static_cast<double*>(A->x);
+    double *Ax = static_cast<double*>(A->x);   // real or packed complex
 
     // Initializaing pointers with NULL; just in case for an early exit
     // not to free an uninitialized space
@@ -367,8 +368,19 @@ ParU_Info ParU_Analyze
 
     /* performing the symbolic analysis */
 
+    // The Symbolic object and SW hold no numerical values, so the
+    // umfpack_dl_* routines are used to free them, even if A is complex.
     void *SW = NULL;
-    int status = umfpack_dl_paru_symbolic(m, n, Ap, Ai, Ax,
+    int status = (A->xtype == CHOLMOD_COMPLEX) ?
+        umfpack_zl_paru_symbolic(m, n, Ap, Ai, Ax,
+                                      NULL,   // Az: A is packed complex
+                                      NULL,   // user provided ordering
+                                      FALSE,  // No user ordering
+                                      NULL,   // user params
+                                      &Symbolic,
+                                      &SW,  // new in/out
+                                      umf_Control, umf_Info) :
+        umfpack_dl_paru_symbolic(m, n, Ap, Ai, Ax,
                                       NULL,   // user provided ordering
                                       FALSE,  // No user ordering
                                       NULL,   // user params
@@ -147,6 +147,50 @@ ParU_Info ParU_C_Factorize
     return (info) ;
 }
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactor: Numeric refactorization of a matrix with the same pattern
+// as the one factorized by ParU_C_Factorize.  On error, Num_C is freed.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_Refactor
+(
+    // input:
+    cholmod_sparse *A,          // input matrix to factorize of size n-by-n
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_C_Numeric *Num_handle_C,    // numerical factorization from
+                                     // ParU_C_Factorize
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!A || !Sym_C || !Num_handle_C || !(*Num_handle_C))
+    {
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_Symbolic Sym = static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_C_Numeric Num_C = (*Num_handle_C) ;
+    ParU_Numeric Num = static_cast<ParU_Numeric>(Num_C->num_handle);
+
+    ParU_Info info;
+    info = ParU_Refactor(A, Sym, &Num, Control);
+    if (info != PARU_SUCCESS)
+    {
+        if (Num == NULL)
+        {
+            // the numeric factorization has been freed
+            PARU_FREE (1, ParU_C_Numeric_struct, *Num_handle_C);
+        }
+        return info;
+    }
+    Num_C->num_handle = static_cast<void*>(Num);
+    return (info) ;
+}
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -639,6 +683,160 @@ ParU_Info ParU_C_Set_Control_FP64       // set double parameter in Control
     return (ParU_Set (field, c, Control)) ;
 }
 
+//------------------------------------------------------------------------------
+//------------ ParU_C_Serialize_* and ParU_C_Deserialize_* ---------------------
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_Serialize_Symbolic_Size
+(
+    // input:
+    const ParU_C_Symbolic Sym_C,  // symbolic analysis from ParU_C_Analyze
+    // output:
+    int64_t *blobsize,            // required size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Symbolic Sym = (Sym_C == NULL) ? NULL :
+        static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize_Symbolic_Size (Sym, blobsize, Control)) ;
+}
+
+ParU_Info ParU_C_Serialize_Symbolic
+(
+    // input:
+    const ParU_C_Symbolic Sym_C,  // symbolic analysis from ParU_C_Analyze
+    // output:
+    int8_t *blob,                 // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,             // size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Symbolic Sym = (Sym_C == NULL) ? NULL :
+        static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize_Symbolic (Sym, blob, blobsize, Control)) ;
+}
+
+ParU_Info ParU_C_Deserialize_Symbolic
+(
+    // input:
+    const int8_t *blob,           // blob from ParU_C_Serialize_Symbolic
+    int64_t blobsize,             // size of the blob, in bytes
+    bool copy,                    // if false, Sym_C points into the blob
+    // output:
+    ParU_C_Symbolic *Sym_handle_C,  // Symbolic object created from the blob
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!Sym_handle_C)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Sym_handle_C) = NULL ;
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_C_Symbolic Sym_C = PARU_CALLOC (1, ParU_C_Symbolic_struct);
+    if (!Sym_C)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    ParU_Symbolic Sym ;
+    ParU_Info info = ParU_Deserialize_Symbolic (blob, blobsize, copy, &Sym,
+        Control) ;
+    if (info != PARU_SUCCESS)
+    {
+        PARU_FREE (1, ParU_C_Symbolic_struct, Sym_C);
+        return (info) ;
+    }
+    Sym_C->sym_handle = static_cast<void*>(Sym);
+    (*Sym_handle_C) = Sym_C;
+    return (info) ;
+}
+
+ParU_Info ParU_C_Serialize_Numeric_Size
+(
+    // input:
+    const ParU_C_Numeric Num_C,   // numeric factorization from ParU_C_Factorize
+    // output:
+    int64_t *blobsize,            // required size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Numeric Num = (Num_C == NULL) ? NULL :
+        static_cast<ParU_Numeric>(Num_C->num_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize_Numeric_Size (Num, blobsize, Control)) ;
+}
+
+ParU_Info ParU_C_Serialize_Numeric
+(
+    // input:
+    const ParU_C_Numeric Num_C,   // numeric factorization from ParU_C_Factorize
+    // output:
+    int8_t *blob,                 // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,             // size of the blob, in bytes
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Numeric Num = (Num_C == NULL) ? NULL :
+        static_cast<ParU_Numeric>(Num_C->num_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize_Numeric (Num, blob, blobsize, Control)) ;
+}
+
+ParU_Info ParU_C_Deserialize_Numeric
+(
+    // input:
+    const int8_t *blob,           // blob from ParU_C_Serialize_Numeric
+    int64_t blobsize,             // size of the blob, in bytes
+    bool copy,                    // if false, Num_C points into the blob
+    // output:
+    ParU_C_Numeric *Num_handle_C,   // Numeric object created from the blob
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!Num_handle_C)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Num_handle_C) = NULL ;
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_C_Numeric Num_C = PARU_CALLOC (1, ParU_C_Numeric_struct);
+    if (!Num_C)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    ParU_Numeric Num ;
+    ParU_Info info = ParU_Deserialize_Numeric (blob, blobsize, copy, &Num,
+        Control) ;
+    if (info != PARU_SUCCESS)
+    {
+        PARU_FREE (1, ParU_C_Numeric_struct, Num_C);
+        return (info) ;
+    }
+    Num_C->num_handle = static_cast<void*>(Num);
+    (*Num_handle_C) = Num_C;
+    return (info) ;
+}
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
@@ -0,0 +1,721 @@
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////// ParU_Deserialize.cpp ////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  Construct the Symbolic and Numeric objects from serialized blobs.
+ *
+ *  The blobs are created by ParU_Serialize_Symbolic and
+ *  ParU_Serialize_Numeric.  If copy is true, all arrays are copied from the
+ *  blob and the blob may be freed once the object is constructed.  Otherwise,
+ *  the object is "shallow": its arrays point into the blob, which must not be
+ *  freed or modified until the object is freed.  Only O(1) memory (plus O(nf)
+ *  for the Numeric object) is then allocated, and the blob may be a read-only
+ *  memory-mapped file shared by many processes.
+ *
+ *  The contents of the blob are checked: arrays that every object has must be
+ *  present, permutations must be valid, pointer arrays must be monotonic, and
+ *  row and column indices must be in range, so that a corrupted blob is
+ *  rejected rather than causing ParU_Solve to access memory out of bounds.
+ *
+ * @author Aznaveh
+ *
+ */
+
+#include "paru_internal.hpp"
+
+//------------------------------------------------------------------------------
+// deserialize an array of n entries
+//------------------------------------------------------------------------------
+
+// The array X is copied from the blob, or points into it if copy is false.  A
+// count of -1 denotes a NULL array, which is only allowed if the array is not
+// required.  If the blob is truncated or corrupted, the object is freed with
+// FREE_ALL.
+
+#define DESERIALIZE(X, type, n, required)                                   \
+{                                                                           \
+    int64_t count = -2 ;                                                    \
+    if (offset <= blobsize - (int64_t) sizeof (int64_t))                    \
+    {                                                                       \
+        memcpy (&count, blob + offset, sizeof (int64_t)) ;                  \
+        offset += sizeof (int64_t) ;                                        \
+    }                                                                       \
+    if ((count == -1) ? (required) : (count != (n) || count < 0 ||          \
+        count > (blobsize - offset) / (int64_t) sizeof (type)))             \
+    {                                                                       \
+        FREE_ALL ;                                                          \
+        return (PARU_INVALID) ;                                             \
+    }                                                                       \
+    if (count >= 0)                                                         \
+    {                                                                       \
+        if (copy)                                                           \
+        {                                                                   \
+            X = PARU_MALLOC (std::max (count, (int64_t) 1), type) ;         \
+            if (X == NULL)                                                  \
+            {                                                               \
+                FREE_ALL ;                                                  \
+                return (PARU_OUT_OF_MEMORY) ;                               \
+            }                                                               \
+            memcpy (X, blob + offset, count * sizeof (type)) ;              \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            X = (type *) (blob + offset) ;                                  \
+        }                                                                   \
+        offset += count * sizeof (type) ;                                   \
+    }                                                                       \
+}
+
+// a single int64_t scalar
+#define DESERIALIZE_SCALAR(x)                                               \
+{                                                                           \
+    if (offset > blobsize - (int64_t) sizeof (int64_t))                     \
+    {                                                                       \
+        FREE_ALL ;                                                          \
+        return (PARU_INVALID) ;                                             \
+    }                                                                       \
+    memcpy (&(x), blob + offset, sizeof (int64_t)) ;                        \
+    offset += sizeof (int64_t) ;                                            \
+}
+
+//------------------------------------------------------------------------------
+// paru_check_blob_header: check the header of a blob
+//------------------------------------------------------------------------------
+
+static bool paru_check_blob_header
+(
+    const int8_t *blob,
+    int64_t blobsize,
+    int32_t tag,
+    int32_t sizeof_struct,
+    bool copy
+)
+{
+    if (blob == NULL ||
+        blobsize < (int64_t) sizeof (ParU_Blob_header) + sizeof_struct)
+    {
+        return (false) ;
+    }
+    if (!copy && ((uintptr_t) blob) % sizeof (int64_t) != 0)
+    {
+        // the arrays cannot be used in place if the blob is misaligned
+        return (false) ;
+    }
+    ParU_Blob_header header ;
+    memcpy (&header, blob, sizeof (ParU_Blob_header)) ;
+    return (header.blobsize <= blobsize
+        && header.tag == tag
+        && header.blob_version == PARU_BLOB_VERSION
+        && header.sizeof_struct == sizeof_struct
+        && header.sizeof_int64 == (int32_t) sizeof (int64_t)
+        && header.sizeof_double == (int32_t) sizeof (double)
+        && header.sizeof_void_star == (int32_t) sizeof (void *)) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_is_permutation: check if P [0..n-1] is a permutation of 0..n-1
+//------------------------------------------------------------------------------
+
+// W is workspace of size n.
+
+static bool paru_is_permutation (const int64_t *P, int64_t n, int64_t *W)
+{
+    for (int64_t k = 0; k < n; k++)
+    {
+        W[k] = -1;
+    }
+    for (int64_t k = 0; k < n; k++)
+    {
+        int64_t i = P[k];
+        if (i < 0 || i >= n || W[i] != -1)
+        {
+            return (false) ;
+        }
+        W[i] = k;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_is_pointer: check if Xp [0..n] is monotonic, from 0 to nz
+//------------------------------------------------------------------------------
+
+static bool paru_is_pointer (const int64_t *Xp, int64_t n, int64_t nz)
+{
+    if (Xp[0] != 0 || Xp[n] != nz)
+    {
+        return (false) ;
+    }
+    for (int64_t k = 0; k < n; k++)
+    {
+        if (Xp[k] > Xp[k + 1])
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_in_range: check if all entries in X [0..n-1] are in the range lo:hi-1
+//------------------------------------------------------------------------------
+
+static bool paru_in_range (const int64_t *X, int64_t n, int64_t lo, int64_t hi)
+{
+    for (int64_t k = 0; k < n; k++)
+    {
+        if (X[k] < lo || X[k] >= hi)
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_valid_symbolic: check the contents of a deserialized Symbolic object
+//------------------------------------------------------------------------------
+
+// All arrays that are required have been deserialized.  W is workspace of size
+// n, which is also the size of A (m = n).
+
+static bool paru_valid_symbolic (const ParU_Symbolic Sym, int64_t *W)
+{
+    int64_t n = Sym->n;
+    int64_t n1 = Sym->n1;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+    int64_t nf = Sym->nf;
+    int64_t ntasks = Sym->ntasks;
+    int64_t ns = n - n1;    // S is ns-by-ns
+
+    // the row and column permutations
+    if (!paru_is_permutation (Sym->Qfill, n, W) ||
+        !paru_is_permutation (Sym->Pinit, n, W))
+    {
+        return (false) ;
+    }
+    for (int64_t k = 0; k < n; k++)
+    {
+        if (Sym->Pinv[Sym->Pinit[k]] != k)
+        {
+            return (false) ;
+        }
+    }
+    if (Sym->Diag_map != NULL && !paru_is_permutation (Sym->Diag_map, n, W))
+    {
+        return (false) ;
+    }
+
+    // the pattern of S and of the singletons
+    if (!paru_is_pointer (Sym->Sp, ns, Sym->snz) ||
+        !paru_in_range (Sym->Sj, Sym->snz, 0, ns))
+    {
+        return (false) ;
+    }
+    if (cs1 > 0 &&
+        (!paru_is_pointer (Sym->ustons.Sup, cs1, Sym->ustons.nnz) ||
+         !paru_in_range (Sym->ustons.Suj, Sym->ustons.nnz, 0, n)))
+    {
+        return (false) ;
+    }
+    if (rs1 > 0 &&
+        (!paru_is_pointer (Sym->lstons.Slp, rs1, Sym->lstons.nnz) ||
+         !paru_in_range (Sym->lstons.Sli, Sym->lstons.nnz, 0, n)))
+    {
+        return (false) ;
+    }
+    // Sleft [0..ns] is monotonic, and Sleft [ns+1] is the # of empty rows of S
+    const int64_t *Sleft = Sym->Sleft;
+    for (int64_t k = 0; k < ns; k++)
+    {
+        if (Sleft[k] > Sleft[k + 1])
+        {
+            return (false) ;
+        }
+    }
+    if (Sleft[0] != 0 || Sleft[ns] > ns || Sleft[ns + 1] < 0 ||
+        Sleft[ns + 1] > ns)
+    {
+        return (false) ;
+    }
+    if (nf == 0)
+    {
+        return (true) ;
+    }
+
+    // the fronts: each front has at least one pivot column, and its parent
+    // comes after it
+    const int64_t *Super = Sym->Super;
+    if (Super[0] != 0 || Super[nf] != ns)
+    {
+        return (false) ;
+    }
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t parent = Sym->Parent[f];
+        if (Super[f] >= Super[f + 1] ||
+            (parent != -1 && (parent <= f || parent >= nf)))
+        {
+            return (false) ;
+        }
+    }
+    const int64_t *Childp = Sym->Childp;
+    for (int64_t f = 0; f <= nf; f++)
+    {
+        if (Childp[f] > Childp[f + 1])
+        {
+            return (false) ;
+        }
+    }
+    if (Childp[0] != 0 || Childp[nf + 1] > nf + 1 ||
+        !paru_in_range (Sym->Child, Childp[nf + 1], 0, nf))
+    {
+        return (false) ;
+    }
+
+    // the tasks: each task is a nonempty range of fronts
+    const int64_t *task_map = Sym->task_map;
+    if (ntasks == 0 || task_map[0] != -1 || task_map[ntasks] != nf - 1 ||
+        !paru_in_range (Sym->task_parent, ntasks, -1, ntasks))
+    {
+        return (false) ;
+    }
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (task_map[t] >= task_map[t + 1])
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Deserialize_Symbolic: construct a Symbolic object from a blob
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ParU_FreeSymbolic (&Sym, Control) ;
+
+ParU_Info ParU_Deserialize_Symbolic
+(
+    // input:
+    const int8_t *blob,         // blob from ParU_Serialize_Symbolic
+    int64_t blobsize,           // size of the blob, in bytes
+    bool copy,                  // if false, Sym points into the blob
+    // output:
+    ParU_Symbolic *Sym_handle,  // Symbolic object created from the blob
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Sym_handle)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Sym_handle) = NULL ;
+    if (!paru_check_blob_header (blob, blobsize, PARU_BLOB_SYMBOLIC,
+        sizeof (ParU_Symbolic_struct), copy))
+    {
+        return (PARU_INVALID) ;
+    }
+    ParU_Symbolic Sym = PARU_CALLOC (1, ParU_Symbolic_struct);
+    if (!Sym)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the scalars of Sym, and clear its pointers
+    //--------------------------------------------------------------------------
+
+    int64_t offset = sizeof (ParU_Blob_header) ;
+    memcpy (Sym, blob + offset, sizeof (ParU_Symbolic_struct)) ;
+    offset += sizeof (ParU_Symbolic_struct) ;
+    Sym->Sp = NULL;
+    Sym->Sj = NULL;
+    Sym->ustons.Sup = NULL;
+    Sym->ustons.Suj = NULL;
+    Sym->lstons.Slp = NULL;
+    Sym->lstons.Sli = NULL;
+    Sym->Qfill = NULL;
+    Sym->Pinit = NULL;
+    Sym->Pinv = NULL;
+    Sym->Diag_map = NULL;
+    Sym->Sleft = NULL;
+    Sym->Parent = NULL;
+    Sym->Child = NULL;
+    Sym->Childp = NULL;
+    Sym->Depth = NULL;
+    Sym->aParent = NULL;
+    Sym->aChild = NULL;
+    Sym->aChildp = NULL;
+    Sym->first = NULL;
+    Sym->Fm = NULL;
+    Sym->Cm = NULL;
+    Sym->Super = NULL;
+    Sym->row2atree = NULL;
+    Sym->super2atree = NULL;
+    Sym->Chain_start = NULL;
+    Sym->Chain_maxrows = NULL;
+    Sym->Chain_maxcols = NULL;
+    Sym->front_flop_bound = NULL;
+    Sym->stree_flop_bound = NULL;
+    Sym->task_map = NULL;
+    Sym->task_parent = NULL;
+    Sym->task_num_child = NULL;
+    Sym->task_depth = NULL;
+    Sym->shallow = !copy ;
+
+    // ParU_FreeSymbolic can now be safely called if an error occurs
+
+    int64_t m = Sym->m;
+    int64_t n = Sym->n;
+    int64_t n1 = Sym->n1;
+    int64_t nf = Sym->nf;
+    int64_t ms = m - n1;
+    int64_t ntasks = Sym->ntasks;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+    if (m != n || n1 < 0 || ms < 0 || nf < 0 || nf > ms || ntasks < 0 ||
+        cs1 < 0 || rs1 < 0 || cs1 + rs1 != n1 || Sym->snz < 0 ||
+        (cs1 > 0 && Sym->ustons.nnz < cs1) ||
+        (rs1 > 0 && Sym->lstons.nnz < rs1))
+    {
+        // blob does not hold a valid Symbolic object
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the arrays of Sym
+    //--------------------------------------------------------------------------
+
+    // the arrays for the singletons exist only if there are singletons, and
+    // the arrays for the fronts and tasks only if there are fronts
+    bool fronts = (nf > 0) ;
+    DESERIALIZE (Sym->Sp, int64_t, m + 1 - n1, true) ;
+    DESERIALIZE (Sym->Sj, int64_t, Sym->snz, true) ;
+    DESERIALIZE (Sym->ustons.Sup, int64_t, cs1 + 1, cs1 > 0) ;
+    DESERIALIZE (Sym->ustons.Suj, int64_t, Sym->ustons.nnz, cs1 > 0) ;
+    DESERIALIZE (Sym->lstons.Slp, int64_t, rs1 + 1, rs1 > 0) ;
+    DESERIALIZE (Sym->lstons.Sli, int64_t, Sym->lstons.nnz, rs1 > 0) ;
+    DESERIALIZE (Sym->Qfill, int64_t, n, true) ;
+    DESERIALIZE (Sym->Pinit, int64_t, m, true) ;
+    DESERIALIZE (Sym->Pinv, int64_t, m, true) ;
+    DESERIALIZE (Sym->Diag_map, int64_t, n, false) ;
+    DESERIALIZE (Sym->Sleft, int64_t, n + 2 - n1, true) ;
+    DESERIALIZE (Sym->Parent, int64_t, nf + 1, true) ;
+    DESERIALIZE (Sym->Child, int64_t, nf + 1, fronts) ;
+    DESERIALIZE (Sym->Childp, int64_t, nf + 2, fronts) ;
+    DESERIALIZE (Sym->Depth, int64_t, nf, fronts) ;
+    DESERIALIZE (Sym->aParent, int64_t, ms + nf, fronts) ;
+    DESERIALIZE (Sym->aChild, int64_t, ms + nf + 1, fronts) ;
+    DESERIALIZE (Sym->aChildp, int64_t, ms + nf + 2, fronts) ;
+    DESERIALIZE (Sym->first, int64_t, nf + 1, fronts) ;
+    DESERIALIZE (Sym->Fm, int64_t, nf + 1, fronts) ;
+    DESERIALIZE (Sym->Cm, int64_t, nf + 1, fronts) ;
+    DESERIALIZE (Sym->Super, int64_t, nf + 1, fronts) ;
+    DESERIALIZE (Sym->row2atree, int64_t, ms, fronts) ;
+    DESERIALIZE (Sym->super2atree, int64_t, nf, fronts) ;
+    DESERIALIZE (Sym->front_flop_bound, double, nf + 1, fronts) ;
+    DESERIALIZE (Sym->stree_flop_bound, double, nf + 1, fronts) ;
+    DESERIALIZE (Sym->task_map, int64_t, ntasks + 1, fronts) ;
+    DESERIALIZE (Sym->task_parent, int64_t, ntasks, fronts) ;
+    DESERIALIZE (Sym->task_num_child, int64_t, ntasks, fronts) ;
+    DESERIALIZE (Sym->task_depth, int64_t, ntasks, fronts) ;
+
+    //--------------------------------------------------------------------------
+    // check the contents of the arrays
+    //--------------------------------------------------------------------------
+
+    int64_t *W = PARU_MALLOC (n + 1, int64_t) ;
+    if (W == NULL)
+    {
+        FREE_ALL ;
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    bool ok = paru_valid_symbolic (Sym, W) ;
+    PARU_FREE (n + 1, int64_t, W) ;
+    if (!ok)
+    {
+        // blob does not hold a valid Symbolic object
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+
+    (*Sym_handle) = Sym ;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_valid_numeric: check the contents of a deserialized Numeric object
+//------------------------------------------------------------------------------
+
+// All arrays that are required have been deserialized, and the row and column
+// counts of each front have been checked.  W is workspace of size sym_m.  The
+// factors of each front must also match the fronts of the Symbolic object,
+// which is checked by paru_num_matches_sym when the Numeric object is used.
+
+static bool paru_valid_numeric (const ParU_Numeric Num, int64_t *W)
+{
+    int64_t ms = Num->m;    // S is ms-by-ms
+
+    // the final row permutation, and the row permutation of S, held in the
+    // first ms entries of Ps
+    if (!paru_is_permutation (Num->Pfin, Num->sym_m, W) ||
+        !paru_is_permutation (Num->Ps, ms, W))
+    {
+        return (false) ;
+    }
+
+    // the rows and columns of each front, and the size of its factors
+    for (int64_t f = 0; f < Num->nf; f++)
+    {
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        const ParU_Factors *LU = &(Num->partial_LUs[f]);
+        const ParU_Factors *U = &(Num->partial_Us[f]);
+        if (!paru_in_range (Num->frowList[f], rowCount, 0, ms) ||
+            !paru_in_range (Num->fcolList[f], colCount, 0, ms) ||
+            LU->m != rowCount || LU->n > rowCount || U->n != colCount ||
+            (colCount > 0 && U->m != LU->n))
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Deserialize_Numeric: construct a Numeric object from a blob
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ParU_FreeNumeric (&Num, Control) ;
+
+ParU_Info ParU_Deserialize_Numeric
+(
+    // input:
+    const int8_t *blob,         // blob from ParU_Serialize_Numeric
+    int64_t blobsize,           // size of the blob, in bytes
+    bool copy,                  // if false, Num points into the blob
+    // output:
+    ParU_Numeric *Num_handle,   // Numeric object created from the blob
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Num_handle)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Num_handle) = NULL ;
+    if (!paru_check_blob_header (blob, blobsize, PARU_BLOB_NUMERIC,
+        sizeof (ParU_Numeric_struct), copy))
+    {
+        return (PARU_INVALID) ;
+    }
+    ParU_Numeric Num = PARU_CALLOC (1, ParU_Numeric_struct);
+    if (!Num)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the scalars of Num, and clear its pointers
+    //--------------------------------------------------------------------------
+
+    int64_t offset = sizeof (ParU_Blob_header) ;
+    memcpy (Num, blob + offset, sizeof (ParU_Numeric_struct)) ;
+    offset += sizeof (ParU_Numeric_struct) ;
+    Num->Rs = NULL;
+    Num->Ps = NULL;
+    Num->Pfin = NULL;
+    Num->Sx = NULL;
+    Num->Sux = NULL;
+    Num->Slx = NULL;
+    Num->frowCount = NULL;
+    Num->fcolCount = NULL;
+    Num->frowList = NULL;
+    Num->fcolList = NULL;
+    Num->partial_Us = NULL;
+    Num->partial_LUs = NULL;
+    Num->refactor_map = NULL;
+    Num->shallow = !copy ;
+
+    // ParU_FreeNumeric can now be safely called if an error occurs
+
+    int64_t nf = Num->nf;
+    int64_t m = Num->sym_m;
+    int64_t ms = Num->m;
+    if ((Num->xtype != CHOLMOD_REAL && Num->xtype != CHOLMOD_COMPLEX) ||
+        m < 0 || ms < 0 || ms > m || nf < 0 || nf > ms || Num->snz < 0 ||
+        Num->sunz < 0 || Num->slnz < 0 || Num->max_row_count < 0 ||
+        Num->max_col_count < 0)
+    {
+        // blob does not hold a valid Numeric object
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+    int64_t xsize = paru_xsize(Num) ;   // # of doubles per entry
+
+    //--------------------------------------------------------------------------
+    // get the permutations, scale factors, and values of S
+    //--------------------------------------------------------------------------
+
+    // Rs is present only if the matrix was scaled
+    bool fronts = (nf > 0) ;
+    DESERIALIZE (Num->Rs, double, m, false) ;
+    DESERIALIZE (Num->Ps, int64_t, m, true) ;
+    DESERIALIZE (Num->Pfin, int64_t, m, true) ;
+    DESERIALIZE (Num->Sx, double, xsize * Num->snz, true) ;
+    DESERIALIZE (Num->Sux, double, xsize * Num->sunz, Num->sunz > 0) ;
+    DESERIALIZE (Num->Slx, double, xsize * Num->slnz, Num->slnz > 0) ;
+    DESERIALIZE (Num->frowCount, int64_t, nf, fronts) ;
+    DESERIALIZE (Num->fcolCount, int64_t, nf, fronts) ;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        if (rowCount < 0 || rowCount > Num->max_row_count ||
+            colCount < 0 || colCount > Num->max_col_count)
+        {
+            FREE_ALL ;
+            return (PARU_INVALID) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get the row and column lists of each front
+    //--------------------------------------------------------------------------
+
+    int64_t nrowList = -1, ncolList = -1 ;
+    DESERIALIZE_SCALAR (nrowList) ;
+    DESERIALIZE_SCALAR (ncolList) ;
+    if (nrowList != (fronts ? nf : -1) || ncolList != (fronts ? nf : -1))
+    {
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+    if (nrowList == nf)
+    {
+        Num->frowList = PARU_CALLOC (nf, int64_t *);
+        if (Num->frowList == NULL)
+        {
+            FREE_ALL ;
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    if (ncolList == nf)
+    {
+        Num->fcolList = PARU_CALLOC (nf, int64_t *);
+        if (Num->fcolList == NULL)
+        {
+            FREE_ALL ;
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    for (int64_t f = 0; f < nf; f++)
+    {
+        if (Num->frowList)
+        {
+            DESERIALIZE (Num->frowList[f], int64_t, Num->frowCount[f],
+                Num->frowCount[f] > 0) ;
+        }
+        if (Num->fcolList)
+        {
+            DESERIALIZE (Num->fcolList[f], int64_t, Num->fcolCount[f],
+                Num->fcolCount[f] > 0) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get the factors of each front
+    //--------------------------------------------------------------------------
+
+    int64_t nLUs = -1, nUs = -1 ;
+    DESERIALIZE_SCALAR (nLUs) ;
+    DESERIALIZE_SCALAR (nUs) ;
+    if (nLUs != (fronts ? nf : -1) || nUs != (fronts ? nf : -1))
+    {
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+    if (nLUs == nf)
+    {
+        Num->partial_LUs = PARU_CALLOC (nf, ParU_Factors);
+        if (Num->partial_LUs == NULL)
+        {
+            FREE_ALL ;
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    if (nUs == nf)
+    {
+        Num->partial_Us = PARU_CALLOC (nf, ParU_Factors);
+        if (Num->partial_Us == NULL)
+        {
+            FREE_ALL ;
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    ParU_Factors *LUs = Num->partial_LUs;
+    ParU_Factors *Us = Num->partial_Us;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        if (LUs)
+        {
+            DESERIALIZE_SCALAR (LUs[f].m) ;
+            DESERIALIZE_SCALAR (LUs[f].n) ;
+            if (LUs[f].m < 0 || LUs[f].n < 0)
+            {
+                LUs[f].m = LUs[f].n = 0 ;
+                FREE_ALL ;
+                return (PARU_INVALID) ;
+            }
+            DESERIALIZE (LUs[f].p, double, xsize * LUs[f].m * LUs[f].n,
+                LUs[f].m * LUs[f].n > 0) ;
+        }
+        if (Us)
+        {
+            DESERIALIZE_SCALAR (Us[f].m) ;
+            DESERIALIZE_SCALAR (Us[f].n) ;
+            if (Us[f].m < 0 || Us[f].n < 0)
+            {
+                Us[f].m = Us[f].n = 0 ;
+                FREE_ALL ;
+                return (PARU_INVALID) ;
+            }
+            DESERIALIZE (Us[f].p, double, xsize * Us[f].m * Us[f].n,
+                Us[f].m * Us[f].n > 0) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check the contents of the arrays
+    //--------------------------------------------------------------------------
+
+    int64_t *W = PARU_MALLOC (m + 1, int64_t) ;
+    if (W == NULL)
+    {
+        FREE_ALL ;
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    bool ok = paru_valid_numeric (Num, W) ;
+    PARU_FREE (m + 1, int64_t, W) ;
+    if (!ok)
+    {
+        // blob does not hold a valid Numeric object
+        FREE_ALL ;
+        return (PARU_INVALID) ;
+    }
+
+    (*Num_handle) = Num ;
+    return (PARU_SUCCESS) ;
+}
@@ -93,7 +93,8 @@ ParU_Info ParU_Factorize
 )
 {
     if (!A || !Sym || !Num_handle ||
-        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE)
+        (A->xtype != CHOLMOD_REAL && A->xtype != CHOLMOD_COMPLEX) ||
+        A->dtype != CHOLMOD_DOUBLE)
     {
         return (PARU_INVALID) ;
     }
@@ -134,8 +135,11 @@ ParU_Info ParU_Factorize
     #pragma omp atomic write
     Work->naft = 0;
     ParU_Numeric Num = *Num_handle ;
+    bool cmplx = (A->xtype == CHOLMOD_COMPLEX) ;
 
-    info = paru_init_rowFronts(Work, &Num, A, Sym);
+    info = cmplx ?
+        paru_init_rowFronts<std::complex<double>>(Work, &Num, A, Sym) :
+        paru_init_rowFronts<double>(Work, &Num, A, Sym) ;
     *Num_handle = Num;
 
     PRLEVEL(1, ("%% init_row is done\n"));
@@ -256,9 +260,11 @@ ParU_Info ParU_Factorize
                     #pragma omp atomic update
                     Work->naft++;
 
-                    ParU_Info myInfo =
-                        paru_exec_tasks(t, task_num_child, chain_task, Work,
-                            Sym, Num);
+                    ParU_Info myInfo = cmplx ?
+                        paru_exec_tasks<std::complex<double>>(t,
+                            task_num_child, chain_task, Work, Sym, Num) :
+                        paru_exec_tasks<double>(t,
+                            task_num_child, chain_task, Work, Sym, Num) ;
                     if (myInfo != PARU_SUCCESS)
                     {
                         #pragma omp atomic write
@@ -279,8 +285,11 @@ ParU_Info ParU_Factorize
             #pragma omp atomic write
             Work->naft = 1;
             PRLEVEL(1, ("Chain_taskd " LD " has remained\n", chain_task));
-            info = paru_exec_tasks_seq(chain_task, task_num_child, Work,
-                Sym, Num);
+            info = cmplx ?
+                paru_exec_tasks_seq<std::complex<double>>(chain_task,
+                    task_num_child, Work, Sym, Num) :
+                paru_exec_tasks_seq<double>(chain_task,
+                    task_num_child, Work, Sym, Num) ;
         }
         if (info != PARU_SUCCESS)
         {
@@ -305,7 +314,9 @@ ParU_Info ParU_Factorize
         Work->naft = 1;
         for (int64_t i = 0; i < nf; i++)
         {
-            info = paru_front(i, Work, Sym, Num);
+            info = cmplx ?
+                paru_front<std::complex<double>>(i, Work, Sym, Num) :
+                paru_front<double>(i, Work, Sym, Num) ;
             if (info != PARU_SUCCESS)
             {
                 PRLEVEL(1, ("%% A problem happend in " LD "\n", i));
@@ -350,7 +361,8 @@ ParU_Info ParU_Factorize
     if (nf > 0)
     {
         ParU_Factors *LUs = Num->partial_LUs;
-        max_udiag = min_udiag = fabs(*(LUs[0].p));
+        int64_t xsize = paru_xsize(Num) ;
+        max_udiag = min_udiag = paru_entry_abs(LUs[0].p, 0, xsize);
         #ifdef PARU_COVERAGE
         #define M1 1000
         #else
@@ -376,7 +388,7 @@ ParU_Info ParU_Factorize
 
                 for (int64_t i = 0; i < fp; i++)
                 {
-                    double udiag = fabs(X[rowCount * i + i]);
+                    double udiag = paru_entry_abs(X, rowCount * i + i, xsize);
                     min_udiag = std::min(min_udiag, udiag);
                     max_udiag = std::max(max_udiag, udiag);
                 }
@@ -417,7 +429,7 @@ ParU_Info ParU_Factorize
                     num_threads(nthreads)
                 for (int64_t i = 0; i < fp; i++)
                 {
-                    double udiag = fabs(X[rowCount * i + i]);
+                    double udiag = paru_entry_abs(X, rowCount * i + i, xsize);
                     min_udiag = std::min(min_udiag, udiag);
                     max_udiag = std::max(max_udiag, udiag);
                 }
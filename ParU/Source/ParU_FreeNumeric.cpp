@@ -36,63 +36,71 @@ ParU_Info ParU_FreeNumeric
     ParU_Numeric Num = *Num_handle ;
 
     int64_t nf = Num->nf;
+    int64_t xsize = paru_xsize(Num) ;   // # of doubles per entry
 
-    // freeing the numerical input
-    PARU_FREE(Num->snz, double, Num->Sx);
-    if (Num->sunz > 0)
+    if (!Num->shallow)
     {
-        PARU_FREE(Num->sunz, double, Num->Sux);
-    }
-    if (Num->slnz > 0)
-    {
-        PARU_FREE(Num->slnz, double, Num->Slx);
-    }
-
-    PARU_FREE(Num->sym_m, int64_t, Num->Rs);
-    PARU_FREE(Num->sym_m, int64_t, Num->Pfin);
-    PARU_FREE(Num->sym_m, int64_t, Num->Ps);
+        // the arrays of a shallow Num are held in the user's blob
 
-    // free the factors
-    ParU_Factors *LUs = Num->partial_LUs;
-    ParU_Factors *Us = Num->partial_Us;
-
-    for (int64_t i = 0; i < nf; i++)
-    {
-        if (Num->frowList)
+        // freeing the numerical input
+        PARU_FREE(xsize * Num->snz, double, Num->Sx);
+        if (Num->sunz > 0)
         {
-            PARU_FREE(Num->frowCount[i], int64_t, Num->frowList[i]);
+            PARU_FREE(xsize * Num->sunz, double, Num->Sux);
         }
-        if (Num->fcolList)
+        if (Num->slnz > 0)
         {
-            PARU_FREE(Num->fcolCount[i], int64_t, Num->fcolList[i]);
+            PARU_FREE(xsize * Num->slnz, double, Num->Slx);
         }
 
-        if (Us)
+        PARU_FREE(Num->sym_m, int64_t, Num->Rs);
+        PARU_FREE(Num->sym_m, int64_t, Num->Pfin);
+        PARU_FREE(Num->sym_m, int64_t, Num->Ps);
+
+        // free the factors
+        ParU_Factors *LUs = Num->partial_LUs;
+        ParU_Factors *Us = Num->partial_Us;
+
+        for (int64_t i = 0; i < nf; i++)
         {
-            if (Us[i].p != NULL)
+            if (Num->frowList)
             {
-                PRLEVEL(1, ("%% Freeing Us=%p\n", Us[i].p));
-                int64_t mm = Us[i].m;
-                int64_t nn = Us[i].n;
-                PARU_FREE(mm * nn, double, Us[i].p);
+                PARU_FREE(Num->frowCount[i], int64_t, Num->frowList[i]);
+            }
+            if (Num->fcolList)
+            {
+                PARU_FREE(Num->fcolCount[i], int64_t, Num->fcolList[i]);
             }
-        }
 
-        if (LUs)
-        {
-            if (LUs[i].p != NULL)
+            if (Us)
             {
-                PRLEVEL(1, ("%% Freeing LUs=%p\n", LUs[i].p));
-                int64_t mm = LUs[i].m;
-                int64_t nn = LUs[i].n;
-                PARU_FREE(mm * nn, double, LUs[i].p);
+                if (Us[i].p != NULL)
+                {
+                    PRLEVEL(1, ("%% Freeing Us=%p\n", Us[i].p));
+                    int64_t mm = Us[i].m;
+                    int64_t nn = Us[i].n;
+                    PARU_FREE(xsize * mm * nn, double, Us[i].p);
+                }
+            }
+
+            if (LUs)
+            {
+                if (LUs[i].p != NULL)
+                {
+                    PRLEVEL(1, ("%% Freeing LUs=%p\n", LUs[i].p));
+                    int64_t mm = LUs[i].m;
+                    int64_t nn = LUs[i].n;
+                    PARU_FREE(xsize * mm * nn, double, LUs[i].p);
+                }
             }
         }
+
+        PRLEVEL(1, ("%% Done LUs\n"));
+        PARU_FREE(nf, int64_t, Num->frowCount);
+        PARU_FREE(nf, int64_t, Num->fcolCount);
     }
 
-    PRLEVEL(1, ("%% Done LUs\n"));
-    PARU_FREE(nf, int64_t, Num->frowCount);
-    PARU_FREE(nf, int64_t, Num->fcolCount);
+    paru_free_refactor_map (&(Num->refactor_map)) ;
     PARU_FREE(nf, int64_t *, Num->frowList);
     PARU_FREE(nf, int64_t *, Num->fcolList);
     PARU_FREE(nf, ParU_Factors, Num->partial_LUs) ;
@@ -49,15 +49,16 @@
 
 // apply inverse perm x(p) = b, or with scaling: x(p)=b ; x=x./s
 
-ParU_Info ParU_InvPerm
+template <typename T>
+static ParU_Info paru_inv_perm
 (
     // inputs
     const int64_t *P,   // permutation vector of size n
     const double *s,    // vector of size n (optional)
-    const double *b,    // vector of size n
+    const T *b,         // vector of size n
     int64_t n,          // length of P, s, B, and X
     // output
-    double *x,          // vector of size n
+    T *x,               // vector of size n
     // control
     ParU_Control Control
 )
@@ -116,16 +117,17 @@ ParU_Info ParU_InvPerm
 
 // apply inverse perm X(p,:) = B or with scaling: X(p,:)=B ; X = X./s
 
-ParU_Info ParU_InvPerm
+template <typename T>
+static ParU_Info paru_inv_perm
 (
     // inputs
     const int64_t *P,   // permutation vector of size nrows
     const double *s,    // vector of size nrows (optional)
-    const double *B,    // array of size nrows-by-ncols
+    const T *B,         // array of size nrows-by-ncols
     int64_t nrows,      // # of rows of X and B
     int64_t ncols,      // # of columns of X and B
     // output
-    double *X,          // array of size nrows-by-ncols
+    T *X,               // array of size nrows-by-ncols
     // control
     ParU_Control Control
 )
@@ -207,3 +209,72 @@ ParU_Info ParU_InvPerm
     return (PARU_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// ParU_InvPerm: real and complex cases
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const double *b,    // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    double *x,          // vector of size n
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_inv_perm (P, s, b, n, x, Control)) ;
+}
+
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const std::complex<double> *b, // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    std::complex<double> *x, // vector of size n
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_inv_perm (P, s, b, n, x, Control)) ;
+}
+
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const double *B,    // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    double *X,          // array of size nrows-by-ncols
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_inv_perm (P, s, B, nrows, ncols, X, Control)) ;
+}
+
+ParU_Info ParU_InvPerm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const std::complex<double> *B, // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    std::complex<double> *X, // array of size nrows-by-ncols
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_inv_perm (P, s, B, nrows, ncols, X, Control)) ;
+}
@@ -43,19 +43,21 @@
 // Solve L*x=b where x and b are vectors (no scaling or permutations)
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_LSolve
+template <typename T>
+static ParU_Info paru_lsolve
 (
     // input
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
     // input/output:
-    double *x,              // n-by-1, in column-major storage;
+    T *x,                   // n-by-1, in column-major storage;
                             // holds b on input, solution x on input
     // control:
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !x)
+    if (!Sym || !Num || !x || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return (PARU_INVALID) ;
     }
@@ -94,7 +96,7 @@ ParU_Info ParU_LSolve
             PRLEVEL(PR, ("j = " LD "\n", j));
             const int64_t *Slp = Sym->lstons.Slp;
             const int64_t *Sli = Sym->lstons.Sli;
-            const double *Slx = Num->Slx;
+            const T *Slx = (const T *) Num->Slx;
             ASSERT(Sli != NULL && Slx != NULL && Slp != NULL);
             int64_t diag = Slp[j - cs1];
             PRLEVEL(PR, (" x[" LD "]=%.2lf Slx[" LD "]=%.2lf\n", j, x[j], diag,
@@ -121,7 +123,7 @@ ParU_Info ParU_LSolve
 #endif
 
     // gather scatter space for dgemm
-    double *work = PARU_MALLOC (Num->max_row_count, double);
+    T *work = PARU_MALLOC (Num->max_row_count, T);
     if (work == NULL)
     {
         PRLEVEL(1, ("ParU: out of memory lsolve\n"));
@@ -138,11 +140,12 @@ ParU_Info ParU_LSolve
         int64_t col1 = Super[f];
         int64_t col2 = Super[f + 1];
         int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
-        double *X = x + col1 + n1;
+        const T *A = (const T *) LUs[f].p;
+        T *X = x + col1 + n1;
 
         PRLEVEL(2, ("%% Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("L", "N", "U", fp, A, rowCount, X, 1, blas_ok);
+        blas_ok = paru_blas_trsv("L", "N", "U", fp, A, rowCount, X, 1)
+            && blas_ok;
         PRLEVEL(2, ("%% DTRSV is just finished\n"));
 
 #ifndef NDEBUG
@@ -171,11 +174,11 @@ ParU_Info ParU_LSolve
         {
             PRLEVEL(2, ("%% lsolve: Working on DGEMV\n%%"));
             PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", rowCount - fp, fp, &alpha, A + fp,
-                                   rowCount, x + n1 + col1, 1, &beta, work, 1,
-                                   blas_ok);
+            T alpha = 1;
+            T beta = 0;
+            blas_ok = paru_blas_gemv("N", rowCount - fp, fp, &alpha, A + fp,
+                                     rowCount, x + n1 + col1, 1, &beta, work,
+                                     1) && blas_ok;
         }
 
         // don't use parallel loop if using dgemv
@@ -190,7 +193,7 @@ ParU_Info ParU_LSolve
             //    i_prod += A[(j - col1) * rowCount + i] * x[j + n1];
             //}
 
-            double i_prod = work[i - fp];
+            T i_prod = work[i - fp];
             int64_t r = Ps[frowList[i]] + n1;
             PRLEVEL(2, ("i_prod[" LD "]=%lf  work=%lf r=" LD "\n", i, i_prod,
                         work[i - fp], r));
@@ -210,7 +213,7 @@ ParU_Info ParU_LSolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_row_count, double, work);
+    PARU_FREE(Num->max_row_count, T, work);
     return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
 }
 
@@ -218,20 +221,22 @@ ParU_Info ParU_LSolve
 // Solve L*X=B where X and B are matrices (no scaling or permutations)
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_LSolve
+template <typename T>
+static ParU_Info paru_lsolve
 (
     // input
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
     int64_t nrhs,           // # of right-hand-sides (# columns of X)
     // input/output:
-    double *X,              // X is n-by-nrhs, where A is n-by-n;
+    T *X,                   // X is n-by-nrhs, where A is n-by-n;
                             // holds B on input, solution X on input
     // control:
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !X)
+    if (!Sym || !Num || !X || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return (PARU_INVALID) ;
     }
@@ -277,7 +282,7 @@ ParU_Info ParU_LSolve
             PRLEVEL(PR, ("j = " LD "\n", j));
             const int64_t *Slp = Sym->lstons.Slp;
             const int64_t *Sli = Sym->lstons.Sli;
-            const double *Slx = Num->Slx;
+            const T *Slx = (const T *) Num->Slx;
             ASSERT(Sli != NULL && Slx != NULL && Slp != NULL);
             int64_t diag = Slp[j - cs1];
             PRLEVEL(PR, (" X[" LD "]=%.2lf Slx[" LD "]=%.2lf\n",
@@ -317,7 +322,7 @@ ParU_Info ParU_LSolve
 #endif
 
     // gather scatter space for dgemm
-    double *work = PARU_MALLOC (Num->max_row_count * nrhs, double);
+    T *work = PARU_MALLOC (Num->max_row_count * nrhs, T);
     if (work == NULL)
     {
         PRLEVEL(1, ("ParU: out of memory lsolve\n"));
@@ -334,11 +339,11 @@ ParU_Info ParU_LSolve
         int64_t col1 = Super[f];
         int64_t col2 = Super[f + 1];
         int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
+        const T *A = (const T *) LUs[f].p;
         PRLEVEL(2, ("%% mRHS Working on DTRSM f=" LD "\n", f));
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, nrhs, &alpha, A,
-            rowCount, X + n1 + col1, m, blas_ok);
+        T alpha = 1;
+        blas_ok = paru_blas_trsm("L", "L", "N", "U", fp, nrhs, &alpha, A,
+            rowCount, X + n1 + col1, m) && blas_ok;
         PRLEVEL(2, ("%% mRHS DTRSM is just finished f=" LD "\n", f));
 #ifndef NDEBUG
         PR = 2;
@@ -371,10 +376,10 @@ ParU_Info ParU_LSolve
         {
             PRLEVEL(2, ("%% mRHS lsolve: Working on DGEMM\n%%"));
             PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
-                                   A + fp, rowCount, X + n1 + col1, m, &beta,
-                                   work, rowCount - fp, blas_ok);
+            T beta = 0;
+            blas_ok = paru_blas_gemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
+                                     A + fp, rowCount, X + n1 + col1, m, &beta,
+                                     work, rowCount - fp) && blas_ok;
         }
 
         // don't use parallel loop if using dgemm
@@ -417,6 +422,72 @@ ParU_Info ParU_LSolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_row_count * nrhs, double, work);
+    PARU_FREE(Num->max_row_count * nrhs, T, work);
     return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
 }
+
+//------------------------------------------------------------------------------
+// ParU_LSolve: real and complex cases
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_LSolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output:
+    double *x,              // n-by-1, in column-major storage;
+                            // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_lsolve (Sym, Num, x, Control)) ;
+}
+
+ParU_Info ParU_LSolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output:
+    std::complex<double> *x, // n-by-1, in column-major storage;
+                            // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_lsolve (Sym, Num, x, Control)) ;
+}
+
+ParU_Info ParU_LSolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand-sides (# columns of X)
+    // input/output:
+    double *X,              // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_lsolve (Sym, Num, nrhs, X, Control)) ;
+}
+
+ParU_Info ParU_LSolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand-sides (# columns of X)
+    // input/output:
+    std::complex<double> *X, // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_lsolve (Sym, Num, nrhs, X, Control)) ;
+}
@@ -49,15 +49,16 @@
 
 // apply perm and scale x = b(P) / s
 
-ParU_Info ParU_Perm
+template <typename T>
+static ParU_Info paru_perm
 (
     // inputs
     const int64_t *P,   // permutation vector of size n
     const double *s,    // vector of size n (optional)
-    const double *b,    // vector of size n
+    const T *b,         // vector of size n
     int64_t n,          // length of P, s, B, and X
     // output
-    double *x,          // vector of size n
+    T *x,               // vector of size n
     // control
     ParU_Control Control
 )
@@ -135,16 +136,17 @@ ParU_Info ParU_Perm
 
 // apply perm and scale X = B(P,:) / s
 
-ParU_Info ParU_Perm
+template <typename T>
+static ParU_Info paru_perm
 (
     // inputs
     const int64_t *P,   // permutation vector of size nrows
     const double *s,    // vector of size nrows (optional)
-    const double *B,    // array of size nrows-by-ncols
+    const T *B,         // array of size nrows-by-ncols
     int64_t nrows,      // # of rows of X and B
     int64_t ncols,      // # of columns of X and B
     // output
-    double *X,          // array of size nrows-by-ncols
+    T *X,               // array of size nrows-by-ncols
     // control
     ParU_Control Control
 )
@@ -237,3 +239,72 @@ ParU_Info ParU_Perm
     return (PARU_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// ParU_Perm: real and complex cases
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const double *b,    // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    double *x,          // vector of size n
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_perm (P, s, b, n, x, Control)) ;
+}
+
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size n
+    const double *s,    // vector of size n (optional)
+    const std::complex<double> *b, // vector of size n
+    int64_t n,          // length of P, s, B, and X
+    // output
+    std::complex<double> *x, // vector of size n
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_perm (P, s, b, n, x, Control)) ;
+}
+
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const double *B,    // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    double *X,          // array of size nrows-by-ncols
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_perm (P, s, B, nrows, ncols, X, Control)) ;
+}
+
+ParU_Info ParU_Perm
+(
+    // inputs
+    const int64_t *P,   // permutation vector of size nrows
+    const double *s,    // vector of size nrows (optional)
+    const std::complex<double> *B, // array of size nrows-by-ncols
+    int64_t nrows,      // # of rows of X and B
+    int64_t ncols,      // # of columns of X and B
+    // output
+    std::complex<double> *X, // array of size nrows-by-ncols
+    // control
+    ParU_Control Control
+)
+{
+    return (paru_perm (P, s, B, nrows, ncols, X, Control)) ;
+}
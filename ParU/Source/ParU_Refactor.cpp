@@ -0,0 +1,619 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  ParU_Refactor //////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  Numeric refactorization of a matrix with the same pattern as the
+ *          one factorized by ParU_Factorize.  The pivot sequence, the row and
+ *          column lists of each front, and the factors in Num are reused; no
+ *          pivot search is done.  If a pivot fails the pivot tolerance, or an
+ *          entry of the new matrix has no place in the prior frontal
+ *          structure, Num is discarded and the matrix is factorized from
+ *          scratch with ParU_Factorize.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+//------------------------------------------------------------------------------
+// paru_refactor_pivots: factorize the pivotal columns of a front, in place
+//------------------------------------------------------------------------------
+
+// F is rowCount-by-fp, with the pivot rows in the first fp rows in pivot
+// order.  Returns PARU_SINGULAR if a pivot fails the tolerance test.
+
+template <typename T>
+static ParU_Info paru_refactor_pivots
+(
+    int64_t f,
+    T *F,
+    int64_t rowCount,
+    int64_t fp,
+    double tol,
+    paru_work *Work,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    int64_t panel_width = Work->panel_width;
+    int64_t m = rowCount;
+    for (int64_t j1 = 0; j1 < fp; j1 += panel_width)
+    {
+        int64_t j2 = std::min(j1 + panel_width, fp);
+        for (int64_t j = j1; j < j2; j++)
+        {
+            T *Fj = F + j * m;
+            double maxval = 0;
+            for (int64_t i = j; i < m; i++)
+            {
+                maxval = std::max(maxval, std::abs(Fj[i]));
+            }
+            T piv = Fj[j];
+            // a pivot equal to the column maximum is accepted even when tol
+            // is 1; the negated test also rejects a NaN pivot
+            if (maxval == 0 || !(std::abs(piv) >= tol * maxval))
+            {
+                PRLEVEL(1, ("%% refactor: pivot " LD " in front " LD
+                    " is too small\n", j, f));
+                return PARU_SINGULAR;
+            }
+            for (int64_t i = j + 1; i < m; i++)
+            {
+                Fj[i] /= piv;
+            }
+            if (j < j2 - 1)
+            {
+                T alpha = -1.0;
+                bool blas_ok = paru_blas_ger(m - 1 - j, j2 - 1 - j, &alpha,
+                    Fj + j + 1, 1, Fj + m + j, m, Fj + m + j + 1, m);
+                if (!blas_ok) return PARU_TOO_LARGE;
+            }
+        }
+        if (j2 < fp)
+        {
+            // update the remaining pivotal columns with this panel
+            bool blas_ok = paru_tasked_dtrsm<T>(f, j2 - j1, fp - j2, 1.0,
+                F + j1 * m + j1, m, F + j2 * m + j1, m, Work, Num);
+            if (!blas_ok) return PARU_TOO_LARGE;
+            blas_ok = paru_tasked_dgemm<T>(f, m - j2, fp - j2, j2 - j1,
+                F + j1 * m + j2, m, F + j2 * m + j1, m, 1, F + j2 * m + j2, m,
+                Work, Num);
+            if (!blas_ok) return PARU_TOO_LARGE;
+        }
+    }
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_front: assemble and factorize a single front
+//------------------------------------------------------------------------------
+
+// CBx [e] holds the contribution block of front e, from when it is
+// factorized until the last front that uses it is assembled.  Like the
+// factors in Num, it is stored as double * but holds entries of type T.
+// Returns PARU_INVALID if the entries with no place in front f do not sum to
+// zero.
+
+template <typename T>
+static ParU_Info paru_refactor_front
+(
+    int64_t f,
+    double **CBx,
+    double tol,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    ParU_Refactor_map *map = Num->refactor_map;
+    const int64_t *Super = Sym->Super;
+    const int64_t *Ps = Num->Ps;
+    int64_t fp = Super[f + 1] - Super[f];
+    int64_t rowCount = Num->frowCount[f];
+    int64_t colCount = Num->fcolCount[f];
+    T *F = (T *) Num->partial_LUs[f].p;
+    T *U = (T *) Num->partial_Us[f].p;
+    size_t mem_chunk = Work->mem_chunk;
+    int32_t nthreads = Work->nthreads;
+
+    //--------------------------------------------------------------------------
+    // assemble the entries of S
+    //--------------------------------------------------------------------------
+
+    // entries with no place in front f are summed into Z, which must be zero
+    int64_t nvr = map->Zr[f];
+    int64_t zsize = (nvr + map->Zc[f]) * fp;
+    T *Z = NULL;
+    if (zsize > 0)
+    {
+        Z = PARU_CALLOC(zsize, T);
+        if (Z == NULL)
+        {
+            return PARU_OUT_OF_MEMORY;
+        }
+    }
+
+    int64_t Fsize = rowCount * fp;
+    int64_t Usize = fp * colCount;
+    paru_memset(F, 0, Fsize * sizeof(T), mem_chunk, nthreads);
+    if (U != NULL)
+    {
+        paru_memset(U, 0, Usize * sizeof(T), mem_chunk, nthreads);
+    }
+    const T *Sx = (const T *) Num->Sx;
+    for (int64_t k = map->Sfp[f]; k < map->Sfp[f + 1]; k++)
+    {
+        int64_t o = map->Sfo[k];
+        T x = Sx[map->Sfi[k]];
+        if (o < Fsize)
+        {
+            F[o] += x;
+        }
+        else if (o < Fsize + Usize)
+        {
+            U[o - Fsize] += x;
+        }
+        else
+        {
+            Z[o - Fsize - Usize] += x;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble the contribution blocks of the descendants of f
+    //--------------------------------------------------------------------------
+
+    for (int64_t t = map->CBp[f]; t < map->CBp[f + 1]; t++)
+    {
+        int64_t e = map->CBe[t];
+        int64_t fpe = Super[e + 1] - Super[e];
+        int64_t nR = Num->frowCount[e] - fpe;
+        int64_t nC = Num->fcolCount[e];
+        const int64_t *R = Num->frowList[e] + fpe;
+        const int64_t *C = Num->fcolList[e];
+        const T *el = (const T *) CBx[e];
+        int64_t k2 = map->CBk2[t];
+        if (map->CBr[t] >= 0)
+        {
+            // columns C [k1..k2-1] are pivotal in f
+            const int64_t *Rmap = map->Rmap + map->CBr[t];
+            for (int64_t k = map->CBk1[t]; k < k2; k++)
+            {
+                int64_t j = C[k] - Super[f];
+                T *Fj = F + j * rowCount;
+                const T *elj = el + k * nR;
+                for (int64_t i = 0; i < nR; i++)
+                {
+                    int64_t loc = Rmap[i];
+                    if (loc >= 0)
+                    {
+                        Fj[loc] += elj[i];
+                    }
+                    else if (loc != -1)
+                    {
+                        Z[flip(loc) * fp + j] += elj[i];
+                    }
+                }
+            }
+        }
+        if (map->CBc[t] >= 0)
+        {
+            // some rows of the CB are pivotal in f; assemble them into U
+            const int64_t *Cmap = map->Cmap + map->CBc[t];
+            for (int64_t i = 0; i < nR; i++)
+            {
+                int64_t piv = Ps[R[i]] - Super[f];
+                if (piv < 0 || piv >= fp) continue;
+                for (int64_t k = k2; k < nC; k++)
+                {
+                    int64_t loc = Cmap[k - k2];
+                    T x = el[k * nR + i];
+                    if (loc >= 0)
+                    {
+                        U[piv + loc * fp] += x;
+                    }
+                    else
+                    {
+                        Z[(nvr + flip(loc)) * fp + piv] += x;
+                    }
+                }
+            }
+        }
+        if (map->CBlast[e] == f)
+        {
+            // the CB of e is no longer needed
+            PARU_FREE(nR * nC, T, CBx[e]);
+        }
+    }
+
+    if (Z != NULL)
+    {
+        bool fits = true;
+        for (int64_t k = 0; k < zsize && fits; k++)
+        {
+            fits = (Z[k] == T(0));
+        }
+        PARU_FREE(zsize, T, Z);
+        if (!fits)
+        {
+            PRLEVEL(1, ("%% refactor: front " LD " does not fit\n", f));
+            return PARU_INVALID;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // factorize the front
+    //--------------------------------------------------------------------------
+
+    ParU_Info info = paru_refactor_pivots<T>(f, F, rowCount, fp, tol, Work, Num);
+    if (info != PARU_SUCCESS) return info;
+
+    if (colCount == 0) return PARU_SUCCESS;
+    if (!paru_dtrsm<T>(f, F, U, fp, rowCount, colCount, Work, Num))
+    {
+        return PARU_TOO_LARGE;
+    }
+
+    // the CB of f, if any front assembles it
+    if (map->CBlast[f] >= 0)
+    {
+        int64_t nR = rowCount - fp;
+        T *el = PARU_MALLOC(nR * colCount, T);
+        if (el == NULL)
+        {
+            PRLEVEL(1, ("ParU: out of memory for the CB of front " LD "\n", f));
+            return PARU_OUT_OF_MEMORY;
+        }
+        CBx[f] = (double *) el;
+        if (!paru_dgemm<T>(f, F, U, el, fp, rowCount, colCount, Work, Num))
+        {
+            return PARU_TOO_LARGE;
+        }
+    }
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_task: refactorize the fronts of a task, then its parent
+//------------------------------------------------------------------------------
+
+template <typename T>
+static ParU_Info paru_refactor_task
+(
+    int64_t t,
+    int64_t *task_num_child,
+    double **CBx,
+    double tol,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    const int64_t *task_map = Sym->task_map;
+    for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+    {
+        ParU_Info myInfo = paru_refactor_front<T>(f, CBx, tol, Work, Sym, Num);
+        if (myInfo != PARU_SUCCESS) return myInfo;
+    }
+    int64_t daddy = Sym->task_parent[t];
+    if (daddy == -1) return PARU_SUCCESS;
+    int64_t num_rem_children;
+    #pragma omp atomic capture
+    {
+        task_num_child[daddy]--;
+        num_rem_children = task_num_child[daddy];
+    }
+    if (num_rem_children == 0)
+    {
+        // the last child to finish refactorizes its parent
+        return paru_refactor_task<T>(daddy, task_num_child, CBx, tol, Work,
+            Sym, Num);
+    }
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_numeric: refactorize all fronts
+//------------------------------------------------------------------------------
+
+template <typename T>
+static ParU_Info paru_refactor_numeric
+(
+    double **CBx,
+    double tol,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    int64_t nf = Sym->nf;
+    int32_t nthreads = Work->nthreads;
+    int64_t ntasks = Sym->ntasks;
+    const int64_t *task_depth = Sym->task_depth;
+    ParU_Info info = PARU_SUCCESS;
+
+    std::vector<int64_t> task_Q;
+    int64_t *task_num_child = PARU_MALLOC(ntasks, int64_t);
+    if (task_num_child == NULL)
+    {
+        return PARU_OUT_OF_MEMORY;
+    }
+    paru_memcpy(task_num_child, Sym->task_num_child, ntasks * sizeof(int64_t),
+                Work->mem_chunk, nthreads);
+    try
+    {
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            if (task_num_child[t] == 0) task_Q.push_back(t);
+        }
+    }
+    catch (std::bad_alloc const &)
+    {
+        // out of memory
+        PRLEVEL(1, ("ParU: Out of memory: task_Q\n"));
+        PARU_FREE(ntasks, int64_t, task_num_child);
+        return PARU_OUT_OF_MEMORY;
+    }
+    std::sort(task_Q.begin(), task_Q.end(),
+            [&task_depth](const int64_t &t1, const int64_t &t2) -> bool {
+            return task_depth[t1] > task_depth[t2];
+            });
+
+#if ! defined ( PARU_1TASK )
+    if (task_Q.size() * 2 > ((long unsigned int) nthreads))
+    {
+        PRLEVEL(1, ("Parallel refactorization\n"));
+        BLAS_set_num_threads(1);
+        PARU_OPENMP_SET_MAX_ACTIVE_LEVELS(4);
+        Work->naft = 0;
+        const int64_t size = (int64_t)task_Q.size();
+        #pragma omp parallel proc_bind(spread) num_threads(nthreads)
+        #pragma omp single nowait
+        #pragma omp task untied
+        for (int64_t i = 0; i < size; i++)
+        {
+            int64_t t = task_Q[i];
+            int64_t d = task_depth[t];
+            #pragma omp task mergeable priority(d)
+            {
+                #pragma omp atomic update
+                Work->naft++;
+
+                ParU_Info myInfo = paru_refactor_task<T>(t, task_num_child,
+                    CBx, tol, Work, Sym, Num);
+                if (myInfo != PARU_SUCCESS)
+                {
+                    #pragma omp atomic write
+                    info = myInfo;
+                }
+                #pragma omp atomic update
+                Work->naft--;
+            }
+        }
+    }
+    else
+#endif
+    {
+        PRLEVEL(1, ("Sequential refactorization\n"));
+        Work->naft = 1;
+        for (int64_t f = 0; f < nf && info == PARU_SUCCESS; f++)
+        {
+            info = paru_refactor_front<T>(f, CBx, tol, Work, Sym, Num);
+        }
+    }
+
+    PARU_FREE(ntasks, int64_t, task_num_child);
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Refactor: refactorize a sparse matrix A
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Refactor
+(
+    // input:
+    cholmod_sparse *A,  // input matrix to factorize
+    const ParU_Symbolic Sym,  // symbolic analsys from ParU_Analyze
+    // input/output:
+    ParU_Numeric *Num_handle,   // numeric factorization from ParU_Factorize
+    // control:
+    ParU_Control Control
+)
+{
+    if (!A || !Sym || !Num_handle || !(*Num_handle) ||
+        (A->xtype != CHOLMOD_REAL && A->xtype != CHOLMOD_COMPLEX) ||
+        A->dtype != CHOLMOD_DOUBLE ||
+        (int64_t) A->nrow != Sym->m || (int64_t) A->ncol != Sym->n)
+    {
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Numeric Num = *Num_handle ;
+    if (!paru_num_matches_sym(Sym, Num))
+    {
+        // Num was not computed from this Sym
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Info info ;
+    PARU_DEFINE_PRLEVEL;
+#ifndef NTIME
+    double my_start_time = PARU_OPENMP_GET_WTIME;
+#endif
+
+    // get Control
+    paru_work myWork ;
+    paru_work *Work = &myWork ;
+    Work->nthreads         = paru_nthreads (Control) ;
+    Work->mem_chunk        = PARU_DEFAULT_MEM_CHUNK ;
+    Work->worthwhile_dgemm = PARU_DEFAULT_DGEMM_TASKED ;
+    Work->worthwhile_dtrsm = PARU_DEFAULT_DTRSM_TASKED ;
+    Work->trivial          = PARU_DEFAULT_DGEMM_TINY ;
+    Work->panel_width      = PARU_DEFAULT_PANEL_WIDTH ;
+    Work->piv_toler        = PARU_DEFAULT_PIVOT_TOLERANCE ;
+    Work->diag_toler       = PARU_DEFAULT_DIAG_PIVOT_TOLERANCE ;
+    Work->prescale         = PARU_DEFAULT_PRESCALE ;
+    if (Control != NULL)
+    {
+        Work->mem_chunk        = Control->mem_chunk ;
+        Work->trivial          = Control->trivial ;
+        Work->worthwhile_dgemm = Control->worthwhile_dgemm ;
+        Work->worthwhile_dtrsm = Control->worthwhile_dtrsm ;
+        Work->panel_width      = Control->panel_width ;
+        Work->piv_toler        = Control->piv_toler ;
+        Work->diag_toler       = Control->diag_toler ;
+        Work->prescale         = Control->prescale ;
+    }
+    #pragma omp atomic write
+    Work->naft = 0;
+
+    // pivots in the symmetric strategy are accepted with the smaller
+    // diagonal tolerance
+    double tol = Work->piv_toler ;
+    if (Sym->strategy_used == PARU_STRATEGY_SYMMETRIC)
+    {
+        tol = std::min (tol, Work->diag_toler) ;
+    }
+
+    // the prior factorization must also have the same xtype as A, and it
+    // cannot be overwritten if its values are held in the user's blob
+    bool refactor = (Num->res == PARU_SUCCESS && Num->Ps != NULL &&
+        Num->xtype == A->xtype && !Num->shallow) ;
+    if (refactor)
+    {
+        // construct the assembly maps, the first time only
+        info = paru_refactor_map (Sym, Num) ;
+        if (info == PARU_OUT_OF_MEMORY)
+        {
+            // Num is unchanged
+            return (info) ;
+        }
+        refactor = (info == PARU_SUCCESS) ;
+    }
+    if (!refactor)
+    {
+        // the prior factorization cannot be reused
+        PRLEVEL(1, ("%% refactor: using ParU_Factorize\n"));
+        ParU_FreeNumeric (Num_handle, Control) ;
+        return (ParU_Factorize (A, Sym, Num_handle, Control)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the new values of S and the singletons
+    //--------------------------------------------------------------------------
+
+    // From here on, Num is modified and is freed if an error occurs.
+
+    bool prescaling = (Work->prescale != PARU_PRESCALE_NONE) ;
+    if (prescaling && Num->Rs == NULL)
+    {
+        Num->Rs = PARU_CALLOC (Sym->m, double) ;
+        if (Num->Rs == NULL)
+        {
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    else if (!prescaling && Num->Rs != NULL)
+    {
+        PARU_FREE (Num->sym_m, double, Num->Rs) ;
+    }
+
+    bool cmplx = (Num->xtype == CHOLMOD_COMPLEX) ;
+    int64_t xsize = paru_xsize (Num) ;
+    info = cmplx ?
+        paru_init_values<std::complex<double>> (A, Sym, Num, Work) :
+        paru_init_values<double> (A, Sym, Num, Work) ;
+
+    //--------------------------------------------------------------------------
+    // refactorize the fronts
+    //--------------------------------------------------------------------------
+
+    int64_t nf = Sym->nf ;
+    double **CBx = NULL ;
+    if (info == PARU_SUCCESS)
+    {
+        CBx = PARU_CALLOC (nf, double *) ;
+        if (CBx == NULL)
+        {
+            info = PARU_OUT_OF_MEMORY ;
+        }
+        else
+        {
+            info = cmplx ?
+                paru_refactor_numeric<std::complex<double>> (CBx, tol, Work,
+                    Sym, Num) :
+                paru_refactor_numeric<double> (CBx, tol, Work, Sym, Num) ;
+            // free any contribution blocks left after an error
+            const int64_t *Super = Sym->Super ;
+            for (int64_t e = 0; e < nf; e++)
+            {
+                if (CBx[e] != NULL)
+                {
+                    int64_t fp = Super[e + 1] - Super[e] ;
+                    int64_t nR = Num->frowCount[e] - fp ;
+                    PARU_FREE (xsize * nR * Num->fcolCount[e], double,
+                        CBx[e]) ;
+                }
+            }
+            PARU_FREE (nf, double *, CBx) ;
+        }
+    }
+
+    if (info == PARU_SINGULAR || info == PARU_INVALID)
+    {
+        // a pivot is too small, or the matrix has entries that do not fit in
+        // the prior frontal structure; do a full factorization with pivoting
+        PRLEVEL(1, ("%% refactor failed (%d): using ParU_Factorize\n", info));
+        ParU_FreeNumeric (Num_handle, Control) ;
+        return (ParU_Factorize (A, Sym, Num_handle, Control)) ;
+    }
+    else if (info != PARU_SUCCESS)
+    {
+        ParU_FreeNumeric (Num_handle, Control) ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the statistics that depend on the values
+    //--------------------------------------------------------------------------
+
+    double min_udiag = 1, max_udiag = -1;  // not to fail for nf ==0
+    if (nf > 0)
+    {
+        ParU_Factors *LUs = Num->partial_LUs;
+        const int64_t *Super = Sym->Super;
+        max_udiag = min_udiag = paru_entry_abs(LUs[0].p, 0, xsize);
+        for (int64_t f = 0; f < nf; f++)
+        {
+            int64_t rowCount = Num->frowCount[f];
+            int64_t fp = Super[f + 1] - Super[f];
+            double *X = LUs[f].p;
+            for (int64_t i = 0; i < fp; i++)
+            {
+                double udiag = paru_entry_abs(X, rowCount * i + i, xsize);
+                min_udiag = std::min(min_udiag, udiag);
+                max_udiag = std::max(max_udiag, udiag);
+            }
+        }
+    }
+    PRLEVEL(1, ("max_udiag=%e min_udiag=%e rcond=%e\n", max_udiag, min_udiag,
+                min_udiag / max_udiag));
+    Num->min_udiag = min_udiag;
+    Num->max_udiag = max_udiag;
+    Num->rcond = min_udiag / max_udiag;
+    Num->res = PARU_SUCCESS;
+#ifndef NTIME
+    double time = PARU_OPENMP_GET_WTIME;
+    time -= my_start_time;
+    PRLEVEL(1, ("refactorization time took is %lf\n", time));
+#endif
+    return (Num->res) ;
+}
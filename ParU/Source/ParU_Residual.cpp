@@ -25,12 +25,13 @@
 // ParU_Residual: compute residual b-A*x for vectors b and x
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_Residual
+template <typename T>
+static ParU_Info paru_residual
 (
     // inputs:
     cholmod_sparse *A,  // an n-by-n sparse matrix
-    double *x,          // vector of size n
-    double *b,          // vector of size n
+    T *x,               // vector of size n
+    T *b,               // vector of size n
     // output:
     double &resid,      // residual: norm1(b-A*x) / (norm1(A) * norm1 (x))
     double &anorm,      // 1-norm of A
@@ -40,7 +41,7 @@ ParU_Info ParU_Residual
 )
 {
     if (!A || !x || !b ||
-        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE)
+        A->xtype != paru_xtype<T>() || A->dtype != CHOLMOD_DOUBLE)
     {
         return (PARU_INVALID) ;
     }
@@ -66,13 +67,13 @@ ParU_Info ParU_Residual
     }
     PRLEVEL(PR, (" \n"));
 #endif
-    double *ax_b = PARU_MALLOC (m, double);
+    T *ax_b = PARU_MALLOC (m, T);
     if (ax_b == NULL)
     {
         PRLEVEL(1, ("ParU: memory problem inside residual\n"));
         return PARU_OUT_OF_MEMORY;
     }
-    paru_memcpy(ax_b, b, m * sizeof(double), mem_chunk, nthreads) ;
+    paru_memcpy(ax_b, b, m * sizeof(T), mem_chunk, nthreads) ;
 
 #ifndef NDEBUG
     PRLEVEL(1, ("%% after copying x is:\n%%"));
@@ -91,7 +92,7 @@ ParU_Info ParU_Residual
     //resid =  paru_vec_1norm(ax_b, m)/ (anorm* paru_vec_1norm(b, m));
     resid = paru_vec_1norm(ax_b, m) ;
     xnorm = paru_vec_1norm (x, m) ;
-    PARU_FREE(m, double, ax_b);
+    PARU_FREE(m, T, ax_b);
     return PARU_SUCCESS;
 }
 
@@ -106,12 +107,13 @@ ParU_Info ParU_Residual
  *
  * */
 
-ParU_Info ParU_Residual
+template <typename T>
+static ParU_Info paru_residual
 (
     // inputs:
     cholmod_sparse *A,  // an n-by-n sparse matrix
-    double *X,          // array of size n-by-nrhs
-    double *B,          // array of size n-by-nrhs
+    T *X,               // array of size n-by-nrhs
+    T *B,               // array of size n-by-nrhs
     int64_t nrhs,
     // output:
     double &resid,      // residual: norm1(B-A*X) / (norm1(A) * norm1 (X))
@@ -122,7 +124,7 @@ ParU_Info ParU_Residual
 )
 {
     if (!A || !X || !B ||
-        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE)
+        A->xtype != paru_xtype<T>() || A->dtype != CHOLMOD_DOUBLE)
     {
         return (PARU_INVALID) ;
     }
@@ -154,13 +156,13 @@ ParU_Info ParU_Residual
     }
 
 #endif
-    double *AX_B = PARU_MALLOC (m * nrhs, double);
+    T *AX_B = PARU_MALLOC (m * nrhs, T);
     if (AX_B == NULL)
     {
         PRLEVEL(1, ("ParU: memory problem inside mRHS residual\n"));
         return PARU_OUT_OF_MEMORY;
     }
-    paru_memcpy(AX_B, B, m * nrhs * sizeof(double), mem_chunk, nthreads) ;
+    paru_memcpy(AX_B, B, m * nrhs * sizeof(T), mem_chunk, nthreads) ;
 
 #ifndef NDEBUG
     PRLEVEL(1, ("%% mRHS after copying X is:\n%%"));
@@ -187,7 +189,80 @@ ParU_Info ParU_Residual
         PRLEVEL(1, ("%% res=%lf\n", res));
         resid = std::max(resid, res);
     }
-    PARU_FREE(m*nrhs, double, AX_B);
+    PARU_FREE(m*nrhs, T, AX_B);
     return PARU_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ParU_Residual: real and complex cases
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    double *x,          // vector of size n
+    double *b,          // vector of size n
+    // output:
+    double &resid,      // residual: norm1(b-A*x) / (norm1(A) * norm1 (x))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of x
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_residual (A, x, b, resid, anorm, xnorm, Control)) ;
+}
+
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    std::complex<double> *x, // vector of size n
+    std::complex<double> *b, // vector of size n
+    // output:
+    double &resid,      // residual: norm1(b-A*x) / (norm1(A) * norm1 (x))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of x
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_residual (A, x, b, resid, anorm, xnorm, Control)) ;
+}
+
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    double *X,          // array of size n-by-nrhs
+    double *B,          // array of size n-by-nrhs
+    int64_t nrhs,
+    // output:
+    double &resid,      // residual: norm1(B-A*X) / (norm1(A) * norm1 (X))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of X
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_residual (A, X, B, nrhs, resid, anorm, xnorm, Control)) ;
+}
+
+ParU_Info ParU_Residual
+(
+    // inputs:
+    cholmod_sparse *A,  // an n-by-n sparse matrix
+    std::complex<double> *X, // array of size n-by-nrhs
+    std::complex<double> *B, // array of size n-by-nrhs
+    int64_t nrhs,
+    // output:
+    double &resid,      // residual: norm1(B-A*X) / (norm1(A) * norm1 (X))
+    double &anorm,      // 1-norm of A
+    double &xnorm,      // 1-norm of X
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_residual (A, X, B, nrhs, resid, anorm, xnorm, Control)) ;
+}
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////// ParU_Serialize.cpp //////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  Serialize the Symbolic and Numeric objects into flat blobs.
+ *
+ *  The blob can be written to a file or sent to another process, and read back
+ *  with ParU_Deserialize_Symbolic and ParU_Deserialize_Numeric.  See
+ *  ParU_Blob_header in paru_internal.hpp for the layout.
+ *
+ * @author Aznaveh
+ *
+ */
+
+#include "paru_internal.hpp"
+
+//------------------------------------------------------------------------------
+// serialize an array of n entries, or just count its size if blob is NULL
+//------------------------------------------------------------------------------
+
+#define SERIALIZE(X, type, n)                                               \
+{                                                                           \
+    int64_t count = ((X) == NULL) ? (-1) : (n) ;                            \
+    if (blob != NULL)                                                       \
+    {                                                                       \
+        memcpy (blob + offset, &count, sizeof (int64_t)) ;                  \
+        if (count > 0)                                                      \
+        {                                                                   \
+            memcpy (blob + offset + sizeof (int64_t), X,                    \
+                count * sizeof (type)) ;                                    \
+        }                                                                   \
+    }                                                                       \
+    offset += sizeof (int64_t) ;                                            \
+    if (count > 0)                                                          \
+    {                                                                       \
+        offset += count * sizeof (type) ;                                   \
+    }                                                                       \
+}
+
+// a single int64_t scalar
+#define SERIALIZE_SCALAR(x)                                                 \
+{                                                                           \
+    int64_t scalar = (x) ;                                                  \
+    if (blob != NULL)                                                       \
+    {                                                                       \
+        memcpy (blob + offset, &scalar, sizeof (int64_t)) ;                 \
+    }                                                                       \
+    offset += sizeof (int64_t) ;                                            \
+}
+
+// the blob header and a copy of the Sym or Num struct
+#define SERIALIZE_HEADER(object, objtype, blobtag)                          \
+{                                                                           \
+    if (blob != NULL)                                                       \
+    {                                                                       \
+        ParU_Blob_header header ;                                           \
+        memset (&header, 0, sizeof (ParU_Blob_header)) ;                    \
+        header.blobsize = blobsize ;                                        \
+        header.tag = blobtag ;                                              \
+        header.blob_version = PARU_BLOB_VERSION ;                           \
+        header.version [0] = PARU_VERSION_MAJOR ;                           \
+        header.version [1] = PARU_VERSION_MINOR ;                           \
+        header.version [2] = PARU_VERSION_UPDATE ;                          \
+        header.sizeof_struct = sizeof (objtype) ;                           \
+        header.sizeof_int64 = sizeof (int64_t) ;                            \
+        header.sizeof_double = sizeof (double) ;                            \
+        header.sizeof_void_star = sizeof (void *) ;                         \
+        memcpy (blob, &header, sizeof (ParU_Blob_header)) ;                 \
+        memcpy (blob + sizeof (ParU_Blob_header), object, sizeof (objtype)) ;\
+    }                                                                       \
+    offset = sizeof (ParU_Blob_header) + sizeof (objtype) ;                 \
+}
+
+//------------------------------------------------------------------------------
+// paru_serialize_symbolic: write Sym into the blob, or find its size
+//------------------------------------------------------------------------------
+
+// If blob is NULL, only the required size of the blob is computed.
+
+static int64_t paru_serialize_symbolic
+(
+    // output:
+    int8_t *blob,
+    // input:
+    int64_t blobsize,
+    const ParU_Symbolic Sym
+)
+{
+    int64_t m = Sym->m;
+    int64_t n = Sym->n;
+    int64_t n1 = Sym->n1;
+    int64_t nf = Sym->nf;
+    int64_t ms = m - n1;
+    int64_t ntasks = Sym->ntasks;
+    int64_t offset = 0 ;
+
+    SERIALIZE_HEADER (Sym, ParU_Symbolic_struct, PARU_BLOB_SYMBOLIC) ;
+
+    SERIALIZE (Sym->Sp, int64_t, m + 1 - n1) ;
+    SERIALIZE (Sym->Sj, int64_t, Sym->snz) ;
+    SERIALIZE (Sym->ustons.Sup, int64_t, Sym->cs1 + 1) ;
+    SERIALIZE (Sym->ustons.Suj, int64_t, Sym->ustons.nnz) ;
+    SERIALIZE (Sym->lstons.Slp, int64_t, Sym->rs1 + 1) ;
+    SERIALIZE (Sym->lstons.Sli, int64_t, Sym->lstons.nnz) ;
+    SERIALIZE (Sym->Qfill, int64_t, n) ;
+    SERIALIZE (Sym->Pinit, int64_t, m) ;
+    SERIALIZE (Sym->Pinv, int64_t, m) ;
+    SERIALIZE (Sym->Diag_map, int64_t, n) ;
+    SERIALIZE (Sym->Sleft, int64_t, n + 2 - n1) ;
+    SERIALIZE (Sym->Parent, int64_t, nf + 1) ;
+    SERIALIZE (Sym->Child, int64_t, nf + 1) ;
+    SERIALIZE (Sym->Childp, int64_t, nf + 2) ;
+    SERIALIZE (Sym->Depth, int64_t, nf) ;
+    SERIALIZE (Sym->aParent, int64_t, ms + nf) ;
+    SERIALIZE (Sym->aChild, int64_t, ms + nf + 1) ;
+    SERIALIZE (Sym->aChildp, int64_t, ms + nf + 2) ;
+    SERIALIZE (Sym->first, int64_t, nf + 1) ;
+    SERIALIZE (Sym->Fm, int64_t, nf + 1) ;
+    SERIALIZE (Sym->Cm, int64_t, nf + 1) ;
+    SERIALIZE (Sym->Super, int64_t, nf + 1) ;
+    SERIALIZE (Sym->row2atree, int64_t, ms) ;
+    SERIALIZE (Sym->super2atree, int64_t, nf) ;
+    SERIALIZE (Sym->front_flop_bound, double, nf + 1) ;
+    SERIALIZE (Sym->stree_flop_bound, double, nf + 1) ;
+    SERIALIZE (Sym->task_map, int64_t, ntasks + 1) ;
+    SERIALIZE (Sym->task_parent, int64_t, ntasks) ;
+    SERIALIZE (Sym->task_num_child, int64_t, ntasks) ;
+    SERIALIZE (Sym->task_depth, int64_t, ntasks) ;
+
+    return (offset) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_serialize_numeric: write Num into the blob, or find its size
+//------------------------------------------------------------------------------
+
+// If blob is NULL, only the required size of the blob is computed.
+
+static int64_t paru_serialize_numeric
+(
+    // output:
+    int8_t *blob,
+    // input:
+    int64_t blobsize,
+    const ParU_Numeric Num
+)
+{
+    int64_t nf = Num->nf;
+    int64_t m = Num->sym_m;
+    int64_t xsize = paru_xsize(Num) ;   // # of doubles per entry
+    int64_t offset = 0 ;
+
+    SERIALIZE_HEADER (Num, ParU_Numeric_struct, PARU_BLOB_NUMERIC) ;
+
+    SERIALIZE (Num->Rs, double, m) ;
+    SERIALIZE (Num->Ps, int64_t, m) ;
+    SERIALIZE (Num->Pfin, int64_t, m) ;
+    SERIALIZE (Num->Sx, double, xsize * Num->snz) ;
+    SERIALIZE (Num->Sux, double, xsize * Num->sunz) ;
+    SERIALIZE (Num->Slx, double, xsize * Num->slnz) ;
+    SERIALIZE (Num->frowCount, int64_t, nf) ;
+    SERIALIZE (Num->fcolCount, int64_t, nf) ;
+
+    // the row and column lists of each front
+    SERIALIZE_SCALAR ((Num->frowList == NULL) ? (-1) : nf) ;
+    SERIALIZE_SCALAR ((Num->fcolList == NULL) ? (-1) : nf) ;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        if (Num->frowList)
+        {
+            SERIALIZE (Num->frowList[f], int64_t, Num->frowCount[f]) ;
+        }
+        if (Num->fcolList)
+        {
+            SERIALIZE (Num->fcolList[f], int64_t, Num->fcolCount[f]) ;
+        }
+    }
+
+    // the factors of each front
+    ParU_Factors *LUs = Num->partial_LUs;
+    ParU_Factors *Us = Num->partial_Us;
+    SERIALIZE_SCALAR ((LUs == NULL) ? (-1) : nf) ;
+    SERIALIZE_SCALAR ((Us == NULL) ? (-1) : nf) ;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        if (LUs)
+        {
+            SERIALIZE_SCALAR (LUs[f].m) ;
+            SERIALIZE_SCALAR (LUs[f].n) ;
+            SERIALIZE (LUs[f].p, double, xsize * LUs[f].m * LUs[f].n) ;
+        }
+        if (Us)
+        {
+            SERIALIZE_SCALAR (Us[f].m) ;
+            SERIALIZE_SCALAR (Us[f].n) ;
+            SERIALIZE (Us[f].p, double, xsize * Us[f].m * Us[f].n) ;
+        }
+    }
+
+    return (offset) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize_Symbolic_Size: size of the blob for a Symbolic object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize_Symbolic_Size
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // output:
+    int64_t *blobsize,          // required size of the blob, in bytes
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Sym || !blobsize)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*blobsize) = paru_serialize_symbolic (NULL, 0, Sym) ;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize_Symbolic: serialize a Symbolic object into a blob
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize_Symbolic
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // output:
+    int8_t *blob,               // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,           // size of the blob, in bytes
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Sym || !blob)
+    {
+        return (PARU_INVALID) ;
+    }
+    int64_t required = paru_serialize_symbolic (NULL, 0, Sym) ;
+    if (blobsize < required)
+    {
+        // blob is too small
+        return (PARU_INVALID) ;
+    }
+    paru_serialize_symbolic (blob, required, Sym) ;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize_Numeric_Size: size of the blob for a Numeric object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize_Numeric_Size
+(
+    // input:
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // output:
+    int64_t *blobsize,          // required size of the blob, in bytes
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Num || !blobsize)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*blobsize) = paru_serialize_numeric (NULL, 0, Num) ;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize_Numeric: serialize a Numeric object into a blob
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize_Numeric
+(
+    // input:
+    const ParU_Numeric Num,     // numeric factorization from ParU_Factorize
+    // output:
+    int8_t *blob,               // user-allocated blob of size blobsize
+    // input:
+    int64_t blobsize,           // size of the blob, in bytes
+    // control:
+    ParU_Control Control
+)
+{
+    if (!Num || !blob)
+    {
+        return (PARU_INVALID) ;
+    }
+    int64_t required = paru_serialize_numeric (NULL, 0, Num) ;
+    if (blobsize < required)
+    {
+        // blob is too small
+        return (PARU_INVALID) ;
+    }
+    paru_serialize_numeric (blob, required, Num) ;
+    return (PARU_SUCCESS) ;
+}
@@ -16,42 +16,25 @@
 #include "paru_internal.hpp"
 
 //------------------------------------------------------------------------------
-// ParU_Solve: x = A\x
-//------------------------------------------------------------------------------
-
-ParU_Info ParU_Solve
-(
-    // input:
-    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
-    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
-    // input/output:
-    double *x,              // vector of size n-by-1; right-hand on input,
-                            // solution on output
-    // control:
-    ParU_Control Control
-)
-{
-    return (ParU_Solve (Sym, Num, x, x, Control)) ;
-}
-
-//------------------------------------------------------------------------------
-// ParU_Solve: x = A\b
+// paru_solve: x = A\b, for real or complex b and x
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_Solve
+template <typename T>
+static ParU_Info paru_solve
 (
     // input:
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
-    double *b,              // vector of size n-by-1
+    T *b,                   // vector of size n-by-1
     // output
-    double *x,              // vector of size n-by-1
+    T *x,                   // vector of size n-by-1
     // control:
     ParU_Control Control
 )
 {
 
-    if (!Sym || !Num || !b || !x)
+    if (!Sym || !Num || !b || !x || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return PARU_INVALID;
     }
@@ -67,7 +50,7 @@ ParU_Info ParU_Solve
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
 
-    double *t = PARU_MALLOC (m, double);
+    T *t = PARU_MALLOC (m, T);
     if (t == NULL)
     {
         PRLEVEL(1, ("ParU: memory problem inside solve\n"));
@@ -85,7 +68,7 @@ ParU_Info ParU_Solve
     if (info != PARU_SUCCESS)
     {
         PRLEVEL(1, ("%% Problems in lsolve\n"));
-        PARU_FREE(m, int64_t, t);
+        PARU_FREE(m, T, t);
         return info;
     }
     PRLEVEL(1, ("%% usolve\n"));
@@ -93,14 +76,14 @@ ParU_Info ParU_Solve
     if (info != PARU_SUCCESS)
     {
         PRLEVEL(1, ("%% Problems in usolve\n"));
-        PARU_FREE(m, int64_t, t);
+        PARU_FREE(m, T, t);
         return info;
     }
 
     const int64_t *Q = Sym->Qfill ;
     ParU_InvPerm (Q, NULL, t, m, x, Control);  // x(q) = t
 
-    PARU_FREE(m, int64_t, t);
+    PARU_FREE(m, T, t);
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
     time -= start_time;
@@ -118,7 +101,7 @@ ParU_Info ParU_Solve
 }
 
 //------------------------------------------------------------------------------
-// ParU_Solve: X = A\X
+// paru_solve: X = A\B, for real or complex B and X
 //------------------------------------------------------------------------------
 
 /*!  @brief  solve AX = B
@@ -128,43 +111,23 @@ ParU_Info ParU_Solve
  * @author Aznaveh
  * */
 
-#include "paru_internal.hpp"
-
-ParU_Info ParU_Solve
+template <typename T>
+static ParU_Info paru_solve
 (
     // input
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
     int64_t nrhs,           // # of right-hand sides
-    // input/output:
-    double *X,              // X is n-by-nrhs, where A is n-by-n;
-                            // holds B on input, solution X on input
-    // control:
-    ParU_Control Control
-)
-{
-    return (ParU_Solve (Sym, Num, nrhs, X, X, Control)) ;
-}
-
-//------------------------------------------------------------------------------
-// ParU_Solve: X = A\B
-//------------------------------------------------------------------------------
-
-ParU_Info ParU_Solve
-(
-    // input
-    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
-    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
-    int64_t nrhs,           // # of right-hand sides
-    double *B,              // n-by-nrhs, in column-major storage
+    T *B,                   // n-by-nrhs, in column-major storage
     // output:
-    double *X,              // n-by-nrhs, in column-major storage
+    T *X,                   // n-by-nrhs, in column-major storage
     // control:
     ParU_Control Control
 )
 {
 
-    if (!Sym || !Num || !B || !X)
+    if (!Sym || !Num || !B || !X || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return PARU_INVALID;
     }
@@ -176,51 +139,51 @@ ParU_Info ParU_Solve
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
-    double *T = PARU_MALLOC (m * nrhs, double);
-    if (T == NULL)
+    T *W = PARU_MALLOC (m * nrhs, T);
+    if (W == NULL)
     {
         PRLEVEL(1, ("ParU: memory problem inside Solve\n"));
         return PARU_OUT_OF_MEMORY;
     }
 
-    // T = permuted and scaled version of B
+    // W = permuted and scaled version of B
     const int64_t *P = Num->Pfin ;
     const double *R = Num->Rs ;
-    ParU_Perm (P, R, B, m, nrhs, T, Control);
+    ParU_Perm (P, R, B, m, nrhs, W, Control);
 
-    // T = L\T
+    // W = L\W
     ParU_Info info;
     PRLEVEL(1, ("%%mRHS lsolve\n"));
-    info = ParU_LSolve(Sym, Num, nrhs, T, Control);
+    info = ParU_LSolve(Sym, Num, nrhs, W, Control);
     if (info != PARU_SUCCESS)
     {
         PRLEVEL(1, ("%% Problems in mRHS lsolve\n"));
-        PARU_FREE(m * nrhs, int64_t, T);
+        PARU_FREE(m * nrhs, T, W);
         return info;
     }
 
-    // T = U\T
+    // W = U\W
     PRLEVEL(1, ("%%mRHS usolve\n"));
-    info = ParU_USolve(Sym, Num, nrhs, T, Control);
+    info = ParU_USolve(Sym, Num, nrhs, W, Control);
     if (info != PARU_SUCCESS)
     {
         PRLEVEL(1, ("%% Problems in mRHS usolve\n"));
-        PARU_FREE(m * nrhs, int64_t, T);
+        PARU_FREE(m * nrhs, T, W);
         return info;
     }
 
     const int64_t *Q = Sym->Qfill ;
-    ParU_InvPerm (Q, NULL, T, m, nrhs, X, Control);  // X(q) = T
+    ParU_InvPerm (Q, NULL, W, m, nrhs, X, Control);  // X(q) = W
 
     // to solve A'x=b instead (future work):
     // permute t = b (p):
-    // ParU_Perm (Sym->Qfill, NULL, B, m, nrhs, T, Control);
-    // solve T = U'\T
-    // solve T = L'\T
+    // ParU_Perm (Sym->Qfill, NULL, B, m, nrhs, W, Control);
+    // solve W = U'\W
+    // solve W = L'\W
     // x (q) = t and then x = x/s:
-    // ParU_InvPerm (Num->Pfin, Num->Rs, T, m, nrhs, X, Control);
+    // ParU_InvPerm (Num->Pfin, Num->Rs, W, m, nrhs, X, Control);
 
-    PARU_FREE(m * nrhs, int64_t, T);
+    PARU_FREE(m * nrhs, T, W);
 
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
@@ -230,3 +193,159 @@ ParU_Info ParU_Solve
     return PARU_SUCCESS;
 }
 
+
+//------------------------------------------------------------------------------
+// ParU_Solve: x = A\x
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output:
+    double *x,              // vector of size n-by-1; right-hand on input,
+                            // solution on output
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, x, x, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: x = A\b
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    double *b,              // vector of size n-by-1
+    // output
+    double *x,              // vector of size n-by-1
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, b, x, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: X = A\X
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand sides
+    // input/output:
+    double *X,              // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, nrhs, X, X, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: X = A\B
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand sides
+    double *B,              // n-by-nrhs, in column-major storage
+    // output:
+    double *X,              // n-by-nrhs, in column-major storage
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, nrhs, B, X, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: x = A\x (complex)
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output:
+    std::complex<double> *x, // vector of size n-by-1; right-hand on input,
+                            // solution on output
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, x, x, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: x = A\b (complex)
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    std::complex<double> *b, // vector of size n-by-1
+    // output
+    std::complex<double> *x, // vector of size n-by-1
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, b, x, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: X = A\X (complex)
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand sides
+    // input/output:
+    std::complex<double> *X, // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, nrhs, X, X, Control)) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Solve: X = A\B (complex)
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Solve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand sides
+    std::complex<double> *B, // n-by-nrhs, in column-major storage
+    // output:
+    std::complex<double> *X, // n-by-nrhs, in column-major storage
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_solve (Sym, Num, nrhs, B, X, Control)) ;
+}
@@ -43,19 +43,21 @@
 // ParU_USolve: solve U*x=b for vectors X and B (no scaling or permutations)
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_USolve
+template <typename T>
+static ParU_Info paru_usolve
 (
     // input
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
     // input/output
-    double *x,              // n-by-1, in column-major storage;
+    T *x,                   // n-by-1, in column-major storage;
                             // holds b on input, solution x on input
     // control:
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !x)
+    if (!Sym || !Num || !x || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return PARU_INVALID ;
     }
@@ -78,7 +80,7 @@ ParU_Info ParU_USolve
     const ParU_Factors *Us = Num->partial_Us;
     const int64_t *Super = Sym->Super;
 
-    double *work = PARU_MALLOC (Num->max_col_count, double);
+    T *work = PARU_MALLOC (Num->max_col_count, T);
     if (work == NULL)
     {
         PRLEVEL(1, ("ParU: out of memory usolve\n"));
@@ -98,20 +100,20 @@ ParU_Info ParU_USolve
         // performed on Us
         // I am not calling BLAS_DGEMV while the column permutation is different
 
-        double *A2 = Us[f].p;
+        const T *A2 = (const T *) Us[f].p;
         if (A2 != NULL)
         {
             PRLEVEL(2, ("%% usolve: Working on DGEMV\n%%"));
 
-            double *xg = &work[0] + fp;         // size Xg is colCount
+            T *xg = &work[0] + fp;              // size Xg is colCount
             for (int64_t j = 0; j < colCount; j++)  // gathering x in Xg
             {
                 xg[j] = x[fcolList[j] + n1];
             }
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", fp, colCount, &alpha, A2, fp, xg, 1,
-                                   &beta, work, 1, blas_ok);
+            T alpha = 1;
+            T beta = 0;
+            blas_ok = paru_blas_gemv("N", fp, colCount, &alpha, A2, fp, xg, 1,
+                                     &beta, work, 1) && blas_ok;
 
             for (int64_t i = 0; i < fp; i++)  // scattering the back in to x
             {
@@ -137,10 +139,10 @@ ParU_Info ParU_USolve
 
         int64_t rowCount = Num->frowCount[f];
 
-        double *A1 = LUs[f].p;
+        const T *A1 = (const T *) LUs[f].p;
         PRLEVEL(2, ("%% USolve: Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("U", "N", "N", fp, A1, rowCount, x + col1 + n1,
-                               1, blas_ok);
+        blas_ok = paru_blas_trsv("U", "N", "N", fp, A1, rowCount,
+                                 x + col1 + n1, 1) && blas_ok;
         PRLEVEL(2, ("%% DTRSV is just finished\n"));
     }
 
@@ -162,7 +164,7 @@ ParU_Info ParU_USolve
             PRLEVEL(PR, ("i = " LD "\n", i));
             const int64_t *Sup = Sym->ustons.Sup;
             const int64_t *Suj = Sym->ustons.Suj;
-            const double *Sux = Num->Sux;
+            const T *Sux = (const T *) Num->Sux;
             ASSERT(Suj != NULL && Sux != NULL && Sup != NULL);
             PRLEVEL(PR, (" Before computation x[" LD "]=%.2lf \n", i, x[i]))
             for (int64_t p = Sup[i] + 1; p < Sup[i + 1]; p++)
@@ -193,7 +195,7 @@ ParU_Info ParU_USolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_col_count, double, work);
+    PARU_FREE(Num->max_col_count, T, work);
     return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
 }
 
@@ -201,20 +203,22 @@ ParU_Info ParU_USolve
 // ParU_USolve: solve U*X=B for matrices X and B (no scaling or permutations)
 //------------------------------------------------------------------------------
 
-ParU_Info ParU_USolve
+template <typename T>
+static ParU_Info paru_usolve
 (
     // input
     const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
     ParU_Numeric Num,       // numeric factorization from ParU_Factorize
     int64_t nrhs,           // # of right-hand-sides (# columns of X)
     // input/output:
-    double *X,              // X is n-by-nrhs, where A is n-by-n;
+    T *X,                   // X is n-by-nrhs, where A is n-by-n;
                             // holds B on input, solution X on input
     // control:
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !X)
+    if (!Sym || !Num || !X || Num->xtype != paru_xtype<T>() ||
+        !paru_num_matches_sym(Sym, Num))
     {
         return PARU_INVALID ;
     }
@@ -250,7 +254,7 @@ ParU_Info ParU_USolve
     const ParU_Factors *Us = Num->partial_Us;
     const int64_t *Super = Sym->Super;
 
-    double *work = PARU_MALLOC (Num->max_col_count * nrhs, double);
+    T *work = PARU_MALLOC (Num->max_col_count * nrhs, T);
     if (work == NULL)
     {
         PRLEVEL(1, ("ParU: out of memory USolve\n"));
@@ -269,11 +273,11 @@ ParU_Info ParU_USolve
         // do dgemm
         // performed on Us
 
-        double *A2 = Us[f].p;
+        const T *A2 = (const T *) Us[f].p;
         if (A2 != NULL)
         {
             PRLEVEL(2, ("%% mRHS usolve: Working on DGEMM f=" LD "\n%%", f));
-            double *Xg = &work[0] + fp * nrhs;     // size Xg is colCount x nrhs
+            T *Xg = &work[0] + fp * nrhs;          // size Xg is colCount x nrhs
             for (int64_t j = 0; j < colCount; j++)  // gathering X in Xg
             {
                 for (int64_t l = 0; l < nrhs; l++)
@@ -282,10 +286,11 @@ ParU_Info ParU_USolve
                 }
             }
 
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", fp, nrhs, colCount, &alpha, A2, fp,
-                                   Xg, colCount, &beta, work, fp, blas_ok);
+            T alpha = 1;
+            T beta = 0;
+            blas_ok = paru_blas_gemm("N", "N", fp, nrhs, colCount, &alpha, A2,
+                                     fp, Xg, colCount, &beta, work, fp)
+                      && blas_ok;
 
             for (int64_t i = 0; i < fp; i++)  // scattering the back in to X
             {
@@ -320,10 +325,10 @@ ParU_Info ParU_USolve
         int64_t rowCount = Num->frowCount[f];
 
         PRLEVEL(2, ("%% mRHS USolve: Working on DTRSM\n"));
-        double *A1 = LUs[f].p;
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "U", "N", "N", fp, nrhs, &alpha, A1, rowCount,
-                               X + n1 + col1, m, blas_ok);
+        const T *A1 = (const T *) LUs[f].p;
+        T alpha = 1;
+        blas_ok = paru_blas_trsm("L", "U", "N", "N", fp, nrhs, &alpha, A1,
+                                 rowCount, X + n1 + col1, m) && blas_ok;
         PRLEVEL(2, ("%% mRHS DTRSM is just finished\n"));
     }
 
@@ -336,7 +341,7 @@ ParU_Info ParU_USolve
             PRLEVEL(PR, ("i = " LD "\n", i));
             const int64_t *Sup = Sym->ustons.Sup;
             const int64_t *Suj = Sym->ustons.Suj;
-            const double *Sux = Num->Sux;
+            const T *Sux = (const T *) Num->Sux;
             ASSERT(Suj != NULL && Sux != NULL && Sup != NULL);
             for (int64_t p = Sup[i] + 1; p < Sup[i + 1]; p++)
             {
@@ -374,6 +379,72 @@ ParU_Info ParU_USolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_col_count * nrhs, double, work);
+    PARU_FREE(Num->max_col_count * nrhs, T, work);
     return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
 }
+
+//------------------------------------------------------------------------------
+// ParU_USolve: real and complex cases
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_USolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output
+    double *x,              // n-by-1, in column-major storage;
+                            // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_usolve (Sym, Num, x, Control)) ;
+}
+
+ParU_Info ParU_USolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    // input/output
+    std::complex<double> *x, // n-by-1, in column-major storage;
+                            // holds b on input, solution x on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_usolve (Sym, Num, x, Control)) ;
+}
+
+ParU_Info ParU_USolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand-sides (# columns of X)
+    // input/output:
+    double *X,              // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_usolve (Sym, Num, nrhs, X, Control)) ;
+}
+
+ParU_Info ParU_USolve
+(
+    // input
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    ParU_Numeric Num,       // numeric factorization from ParU_Factorize
+    int64_t nrhs,           // # of right-hand-sides (# columns of X)
+    // input/output:
+    std::complex<double> *X, // X is n-by-nrhs, where A is n-by-n;
+                            // holds B on input, solution X on input
+    // control:
+    ParU_Control Control
+)
+{
+    return (paru_usolve (Sym, Num, nrhs, X, Control)) ;
+}
@@ -17,6 +17,7 @@
 // paru_assemble_all: assemble an entire element e into the current front f
 //------------------------------------------------------------------------------
 
+template <typename T>
 void paru_assemble_all
 (
     int64_t e,
@@ -78,12 +79,12 @@ void paru_assemble_all
     // int64_t *el_rowIndex = rowIndex_pointer (el);
     int64_t *el_rowIndex = (int64_t *)(el + 1) + nEl;
 
-    // double *el_Num = numeric_pointer (el);
-    double *el_Num = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *el_Num = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
     // current elemnt numerical pointer
-    // double *el_Num = numeric_pointer (curEl);
-    double *curEl_Num =
-        (double *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
+    // T *el_Num = numeric_pointer (curEl);
+    T *curEl_Num =
+        (T *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
 
     int64_t *isRowInFront = Work->rowSize;
 
@@ -100,14 +101,14 @@ void paru_assemble_all
     if (el->ncolsleft == 1)
     {
         PRLEVEL(PR, ("%% 1 col left\n %%"));
-        double *sC = el_Num + mEl * el->lac;  // source column pointer
+        T *sC = el_Num + mEl * el->lac;  // source column pointer
 #ifndef NDEBUG
         int64_t colInd = el_colIndex[el->lac];
         PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
         ASSERT(colInd >= 0);
 #endif
         int64_t fcolind = colRelIndex[el->lac];
-        double *dC = curEl_Num + fcolind * curEl->nrows;
+        T *dC = curEl_Num + fcolind * curEl->nrows;
         int64_t nrowsSeen = el->nrowsleft;
         for (int64_t i = 0; i < mEl; i++)
         {
@@ -168,13 +169,13 @@ void paru_assemble_all
             for (int64_t j = el->lac; j < nEl; j++)
             {
                 PRLEVEL(1, ("%% j =" LD " \n", j));
-                double *sC = el_Num + mEl * j;  // source column pointer
+                T *sC = el_Num + mEl * j;  // source column pointer
                 int64_t colInd = el_colIndex[j];
                 PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
                 if (colInd < 0) continue;
                 int64_t fcolind = colRelIndex[j];
 
-                double *dC = curEl_Num + fcolind * curEl->nrows;
+                T *dC = curEl_Num + fcolind * curEl->nrows;
                 for (int64_t iii = 0; iii < el->nrowsleft; iii++)
                 {
                     int64_t i = tempRow[iii];
@@ -208,14 +209,14 @@ void paru_assemble_all
             // for (int64_t j = el->lac; j < nEl; j++)
             //{
             //    PRLEVEL(1, ("%% j =" LD " \n", j));
-            //    double *sC = el_Num + mEl * j;  // source column pointer
+            //    T *sC = el_Num + mEl * j;  // source column pointer
             //    int64_t colInd = el_colIndex[j];
             //    PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
             //    if (colInd < 0) continue;
 
             //    int64_t fcolind = colRelIndex[j];
 
-            //    double *dC = curEl_Num + fcolind * curEl->nrows;
+            //    T *dC = curEl_Num + fcolind * curEl->nrows;
 
             //    #pragma omp task
             //    for (int64_t iii = 0; iii < el->nrowsleft; iii++)
@@ -264,7 +265,7 @@ void paru_assemble_all
                 for (int64_t j = c1; j < c2; j++)
                 {
                     PRLEVEL(1, ("%% j =" LD " t=" LD "\n", j, t));
-                    double *sC = el_Num + mEl * j;  // source column pointer
+                    T *sC = el_Num + mEl * j;  // source column pointer
                     int64_t colInd = el_colIndex[j];
                     PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
                     if (colInd < 0) continue;
@@ -273,7 +274,7 @@ void paru_assemble_all
                                 PARU_OPENMP_GET_THREAD_NUM));
                     int64_t fcolind = colRelIndex[j];
 
-                    double *dC = curEl_Num + fcolind * curEl->nrows;
+                    T *dC = curEl_Num + fcolind * curEl->nrows;
 
                     for (int64_t iii = 0; iii < el->nrowsleft; iii++)
                     {
@@ -320,6 +321,7 @@ void paru_assemble_all
 // column that is not in current front it gets a toll for each column doesn't
 // fit
 
+template <typename T>
 void paru_assemble_cols
 (
     int64_t e,
@@ -366,12 +368,12 @@ void paru_assemble_cols
     // int64_t *el_rowIndex = rowIndex_pointer (el);
     int64_t *el_rowIndex = (int64_t *)(el + 1) + nEl;
 
-    // double *el_Num = numeric_pointer (el);
-    double *el_Num = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *el_Num = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
     // current elemnt numerical pointer
-    // double *el_Num = numeric_pointer (curEl);
-    double *curEl_Num =
-        (double *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
+    // T *el_Num = numeric_pointer (curEl);
+    T *curEl_Num =
+        (T *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
 
     int64_t *isRowInFront = Work->rowSize;
 
@@ -419,11 +421,11 @@ void paru_assemble_cols
         int64_t fcolind = paru_find_hash(colInd, colHash, fcolList);
 
         PRLEVEL(1, ("%% el->lac =" LD " \n", el->lac));
-        double *sC = el_Num + mEl * el->lac;  // source column pointer
+        T *sC = el_Num + mEl * el->lac;  // source column pointer
         PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
         ASSERT(colInd >= 0);
 
-        double *dC = curEl_Num + fcolind * curEl->nrows;
+        T *dC = curEl_Num + fcolind * curEl->nrows;
 
         // pragma omp task
         for (int64_t ii = 0; ii < el->nrowsleft; ii++)
@@ -477,14 +479,14 @@ void paru_assemble_cols
         }
 
         PRLEVEL(1, ("%% j =" LD " \n", j));
-        double *sC = el_Num + mEl * j;  // source column pointer
+        T *sC = el_Num + mEl * j;  // source column pointer
         int64_t colInd = el_colIndex[j];
         PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
         if (colInd < 0) continue;
         int64_t fcolind = paru_find_hash(colInd, colHash, fcolList);
         if (fcolind == -1) continue;
         toll++;  // if found
-        double *dC = curEl_Num + fcolind * curEl->nrows;
+        T *dC = curEl_Num + fcolind * curEl->nrows;
 
         //**//pragma omp task priority(Depth[f]) if(el->nrowsleft > 1024)
         for (int64_t ii = 0; ii < el->nrowsleft; ii++)
@@ -520,6 +522,7 @@ void paru_assemble_cols
 // paru_assemble_rows:  assemble rows from element e into current front f
 //------------------------------------------------------------------------------
 
+template <typename T>
 void paru_assemble_rows
 (
     int64_t e,
@@ -561,12 +564,12 @@ void paru_assemble_rows
     // int64_t *el_rowIndex = rowIndex_pointer (curEl);
     int64_t *curEl_rowIndex = (int64_t *)(curEl + 1) + curEl->ncols;
 
-    // double *el_Num = numeric_pointer (el);
-    double *el_Num = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *el_Num = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
     // current elemnt numerical pointer
-    // double *el_Num = numeric_pointer (curEl);
-    double *curEl_Num =
-        (double *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
+    // T *el_Num = numeric_pointer (curEl);
+    T *curEl_Num =
+        (T *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
 
     int64_t *isRowInFront = Work->rowSize;
 
@@ -672,7 +675,7 @@ void paru_assemble_rows
     for (int64_t j = el->lac; j < nEl; j++)
     {
         PRLEVEL(1, ("%% j =" LD " \n", j));
-        double *sC = el_Num + mEl * j;  // source column pointer
+        T *sC = el_Num + mEl * j;  // source column pointer
         int64_t colInd = el_colIndex[j];
         PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
         if (colInd < 0) continue;
@@ -680,7 +683,7 @@ void paru_assemble_rows
         int64_t fcolind = colRelIndex[j];
 
         PRLEVEL(1, ("%% fcolind=" LD " \n", fcolind));
-        double *dC = curEl_Num + fcolind * curEl->nrows;
+        T *dC = curEl_Num + fcolind * curEl->nrows;
 
         for (int64_t i1 : tempRow)
         {
@@ -723,6 +726,7 @@ void paru_assemble_rows
 // paru_assemble_el_with0rows:  assemble rows from e into front f
 //------------------------------------------------------------------------------
 
+template <typename T>
 void paru_assemble_el_with0rows
 (
     int64_t e,
@@ -795,12 +799,12 @@ void paru_assemble_el_with0rows
     // int64_t *el_rowIndex = rowIndex_pointer (el);
     int64_t *el_rowIndex = (int64_t *)(el + 1) + nEl;
 
-    // double *el_Num = numeric_pointer (el);
-    double *el_Num = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *el_Num = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
     // current elemnt numerical pointer
-    // double *el_Num = numeric_pointer (curEl);
-    double *curEl_Num =
-        (double *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
+    // T *el_Num = numeric_pointer (curEl);
+    T *curEl_Num =
+        (T *)((int64_t *)(curEl + 1) + 2 * curEl->nrows + 2 * curEl->ncols);
 
     int64_t *isRowInFront = Work->rowSize;
 
@@ -817,14 +821,14 @@ void paru_assemble_el_with0rows
     if (el->ncolsleft == 1)
     {
         PRLEVEL(PR, ("%% 1 col left\n %%"));
-        double *sC = el_Num + mEl * el->lac;  // source column pointer
+        T *sC = el_Num + mEl * el->lac;  // source column pointer
 #ifndef NDEBUG
         int64_t colInd = el_colIndex[el->lac];
         PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
         ASSERT(colInd >= 0);
 #endif
         int64_t fcolind = colRelIndex[el->lac];
-        double *dC = curEl_Num + fcolind * curEl->nrows;
+        T *dC = curEl_Num + fcolind * curEl->nrows;
         int64_t nrows2bSeen = el->nrowsleft;
         for (int64_t i = 0; i < mEl; i++)
         {
@@ -887,13 +891,13 @@ void paru_assemble_el_with0rows
         for (int64_t j = el->lac; j < nEl; j++)
         {
             PRLEVEL(1, ("%% j =" LD " \n", j));
-            double *sC = el_Num + mEl * j;  // source column pointer
+            T *sC = el_Num + mEl * j;  // source column pointer
             int64_t colInd = el_colIndex[j];
             PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
             if (colInd < 0) continue;
             int64_t fcolind = colRelIndex[j];
 
-            double *dC = curEl_Num + fcolind * curEl->nrows;
+            T *dC = curEl_Num + fcolind * curEl->nrows;
 
             //**//pragma omp task priority(Depth[f]) if(nrows2assembl > 1024)
             for (int64_t iii = 0; iii < nrows2assembl; iii++)
@@ -935,7 +939,7 @@ void paru_assemble_el_with0rows
                 // el [rowInd, jj]
                 PRLEVEL(1, ("%% el[" LD "," LD "]=%2.5lf\n%%", rowInd, jj,
                             el_Num[mEl * jj + ii]));
-                if (el_Num[mEl * jj + ii] != 0)
+                if (el_Num[mEl * jj + ii] != T(0))
                 {
                     new_lac = jj;
                     PRLEVEL(1, ("%%Found new-lac in " LD "\n%%", jj));
@@ -1002,3 +1006,83 @@ void paru_assemble_el_with0rows
         paru_free_el(e, elementList);
     }
 }
+
+template void paru_assemble_all<double>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_all<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_cols<double>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_cols<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_rows<double>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_rows<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_el_with0rows<double>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_el_with0rows<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -16,6 +16,7 @@
 
 #include "paru_internal.hpp"
 
+template <typename T>
 void paru_assemble_row_2U
 (
     int64_t e,
@@ -39,7 +40,7 @@ void paru_assemble_row_2U
     }
 
     ParU_Factors *Us = Num->partial_Us;
-    double *uPart = Us[f].p;  // uPart
+    T *uPart = (T *) Us[f].p;  // uPart
 
     int64_t nEl = el->ncols;
     int64_t mEl = el->nrows;
@@ -53,8 +54,8 @@ void paru_assemble_row_2U
     // int64_t *colRelIndex = relColInd (paru_element *el);
     int64_t *colRelIndex = (int64_t *)(el + 1) + mEl + nEl;
 
-    // double *el_Num = numeric_pointer (el);
-    double *sM = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *sM = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
 
     int64_t ncolsSeen = el->ncolsleft;
     for (int64_t j = el->lac; j < nEl; j++)
@@ -76,3 +77,25 @@ void paru_assemble_row_2U
         }
     }
 }
+
+template void paru_assemble_row_2U<double>
+(
+    int64_t e,
+    int64_t f,
+    int64_t sR,
+    int64_t dR,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
+
+template void paru_assemble_row_2U<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    int64_t sR,
+    int64_t dR,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
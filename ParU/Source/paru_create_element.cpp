@@ -21,6 +21,8 @@
  * @author Aznaveh
  *  */
 #include "paru_internal.hpp"
+
+template <typename T>
 paru_element *paru_create_element(int64_t nrows, int64_t ncols)
 {
     DEBUGLEVEL(0);
@@ -29,7 +31,7 @@ paru_element *paru_create_element(int64_t nrows, int64_t ncols)
     paru_element *curEl;
     size_t tot_size = sizeof(paru_element) +
                       sizeof(int64_t) * (2 * (nrows + ncols)) +
-                      sizeof(double) * nrows * ncols;
+                      sizeof(T) * nrows * ncols;
 
     curEl = static_cast<paru_element*>
         #if defined ( PARU_MALLOC_DEBUG )
@@ -49,5 +51,18 @@ paru_element *paru_create_element(int64_t nrows, int64_t ncols)
     curEl->cValid = -1;
 
     curEl->lac = 0;
+    curEl->size_allocated = tot_size;
     return curEl;
 }
+
+template paru_element *paru_create_element<double>
+(
+    int64_t nrows,
+    int64_t ncols
+) ;
+
+template paru_element *paru_create_element<std::complex<double>>
+(
+    int64_t nrows,
+    int64_t ncols
+) ;
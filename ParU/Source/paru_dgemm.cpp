@@ -18,12 +18,13 @@
  */
 #include "paru_internal.hpp"
 
+template <typename T>
 bool paru_dgemm
 (
     int64_t f,
-    double *pF,
-    double *uPart,
-    double *el,
+    T *pF,
+    T *uPart,
+    T *el,
     int64_t fp,
     int64_t rowCount,
     int64_t colCount,
@@ -45,7 +46,7 @@ bool paru_dgemm
     PRLEVEL(1, ("%% nA = " LD "\n", nA));
 
 #ifndef NDEBUG
-    double *Ap = pF + fp;
+    T *Ap = pF + fp;
     PRLEVEL(1, ("%% A =\n"));
     for (int64_t i = 0; i < mA; i++)
     {
@@ -56,7 +57,7 @@ bool paru_dgemm
     }
 
     int64_t mB = nA;
-    double *Bp = uPart;
+    T *Bp = uPart;
     PRLEVEL(1, ("%% B =\n"));
     for (int64_t i = 0; i < mB; i++)
     {
@@ -65,7 +66,7 @@ bool paru_dgemm
         PRLEVEL(1, ("\n"));
     }
 
-    double *Cp = el;
+    T *Cp = el;
     PRLEVEL(1, ("%%Before DGEMM C =\n"));
     for (int64_t i = 0; i < mA; i++)
     {
@@ -105,3 +106,29 @@ bool paru_dgemm
 
     return blas_ok;
 }
+
+template bool paru_dgemm<double>
+(
+    int64_t f,
+    double *pF,
+    double *uPart,
+    double *el,
+    int64_t fp,
+    int64_t rowCount,
+    int64_t colCount,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
+
+template bool paru_dgemm<std::complex<double>>
+(
+    int64_t f,
+    std::complex<double> *pF,
+    std::complex<double> *uPart,
+    std::complex<double> *el,
+    int64_t fp,
+    int64_t rowCount,
+    int64_t colCount,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
@@ -28,11 +28,12 @@
  */
 #include "paru_internal.hpp"
 
+template <typename T>
 bool paru_dtrsm
 (
     int64_t f,
-    double *pF,
-    double *uPart,
+    T *pF,
+    T *uPart,
     int64_t fp,
     int64_t rowCount,
     int64_t colCount,
@@ -80,3 +81,27 @@ bool paru_dtrsm
 
     return blas_ok;
 }
+
+template bool paru_dtrsm<double>
+(
+    int64_t f,
+    double *pF,
+    double *uPart,
+    int64_t fp,
+    int64_t rowCount,
+    int64_t colCount,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
+
+template bool paru_dtrsm<std::complex<double>>
+(
+    int64_t f,
+    std::complex<double> *pF,
+    std::complex<double> *uPart,
+    int64_t fp,
+    int64_t rowCount,
+    int64_t colCount,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
@@ -18,6 +18,7 @@
 // paru_exec_tasks_seq: execute all tasks on a single thread
 //------------------------------------------------------------------------------
 
+template <typename T>
 ParU_Info paru_exec_tasks_seq
 (
     int64_t t,
@@ -47,7 +48,7 @@ ParU_Info paru_exec_tasks_seq
     for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
     {
         PRLEVEL(2, ("Seq: calling " LD "\n", f));
-        myInfo = paru_front(f, Work, Sym, Num);
+        myInfo = paru_front<T>(f, Work, Sym, Num);
         if (myInfo != PARU_SUCCESS)
         {
             return myInfo;
@@ -78,16 +79,16 @@ ParU_Info paru_exec_tasks_seq
             {
                 PRLEVEL(
                     1, ("%%Seq task " LD " executing its parent " LD "\n", t, daddy));
-                return myInfo = paru_exec_tasks_seq(daddy, task_num_child, Work,
-                                                    Sym, Num);
+                return myInfo = paru_exec_tasks_seq<T>(daddy, task_num_child,
+                                                       Work, Sym, Num);
             }
         }
         else  // I was the only spoiled kid in the family;
         {
             PRLEVEL(1, ("%% Seq task " LD " only child executing its parent " LD "\n",
                         t, daddy));
-            return myInfo = paru_exec_tasks_seq(daddy, task_num_child, Work,
-                        Sym, Num);
+            return myInfo = paru_exec_tasks_seq<T>(daddy, task_num_child,
+                        Work, Sym, Num);
         }
     }
     return myInfo;
@@ -97,6 +98,7 @@ ParU_Info paru_exec_tasks_seq
 // paru_exec_tasks: execute all tasks in parallel
 //------------------------------------------------------------------------------
 
+template <typename T>
 ParU_Info paru_exec_tasks
 (
     int64_t t,
@@ -125,7 +127,7 @@ ParU_Info paru_exec_tasks
 #endif
     for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
     {
-        myInfo = paru_front(f, Work, Sym, Num);
+        myInfo = paru_front<T>(f, Work, Sym, Num);
         if (myInfo != PARU_SUCCESS) return myInfo;
     }
     int64_t num_rem_children;
@@ -168,7 +170,7 @@ ParU_Info paru_exec_tasks
                 }
                 else
                 {
-                    return myInfo = paru_exec_tasks(daddy, task_num_child,
+                    return myInfo = paru_exec_tasks<T>(daddy, task_num_child,
                          chain_task, Work, Sym, Num);
                 }
             }
@@ -190,7 +192,7 @@ ParU_Info paru_exec_tasks
             }
             else
             {
-                return myInfo = paru_exec_tasks(daddy, task_num_child,
+                return myInfo = paru_exec_tasks<T>(daddy, task_num_child,
                     chain_task, Work, Sym, Num);
             }
         }
@@ -198,3 +200,40 @@ ParU_Info paru_exec_tasks
     return myInfo;
 }
 
+template ParU_Info paru_exec_tasks_seq<double>
+(
+    int64_t t,
+    int64_t *task_num_child,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_exec_tasks_seq<std::complex<double>>
+(
+    int64_t t,
+    int64_t *task_num_child,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_exec_tasks<double>
+(
+    int64_t t,
+    int64_t *task_num_child,
+    int64_t &chain_task,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_exec_tasks<std::complex<double>>
+(
+    int64_t t,
+    int64_t *task_num_child,
+    int64_t &chain_task,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -19,6 +19,7 @@
 
 #include "paru_internal.hpp"
 
+template <typename T>
 ParU_Info paru_front
 (
     int64_t f,  // front need to be assembled
@@ -134,7 +135,7 @@ ParU_Info paru_front
         // importiant for Exit point
         PRLEVEL(1, ("%% Next: work on pivotal column assembly\n"));
         ParU_Info res_pivotal;
-        res_pivotal = paru_pivotal(pivotal_elements, panel_row, zero_piv_rows,
+        res_pivotal = paru_pivotal<T>(pivotal_elements, panel_row, zero_piv_rows,
                                    f, hi, Work, Sym, Num);
         if (res_pivotal == PARU_OUT_OF_MEMORY)
         {
@@ -162,7 +163,7 @@ ParU_Info paru_front
 #endif
 
         ParU_Factors *LUs = Num->partial_LUs;
-        double *pivotalFront = LUs[f].p;
+        T *pivotalFront = (T *) LUs[f].p;
         LUs[f].m = rowCount;
         LUs[f].n = fp;
 
@@ -194,7 +195,7 @@ ParU_Info paru_front
         int64_t start_fac = Work->time_stamp[f];
         PRLEVEL(1, ("%% start_fac= " LD "\n", start_fac));
 
-        ParU_Info ffs_blas_ok = paru_factorize_full_summed(
+        ParU_Info ffs_blas_ok = paru_factorize_full_summed<T>(
             f, start_fac, panel_row, stl_colSet, pivotal_elements, Work, Sym,
             Num);
         if (ffs_blas_ok != PARU_SUCCESS) return ffs_blas_ok; //failed blas
@@ -350,7 +351,7 @@ ParU_Info paru_front
         /**** 5 ** assemble U part         Row by Row                      ****/
 
         // consider a parallel calloc
-        double *uPart = PARU_CALLOC (fp * colCount, double) ;
+        T *uPart = PARU_CALLOC (fp * colCount, T) ;
         if (uPart == NULL)
         {
             PRLEVEL(1, ("ParU: out of memory when tried to"
@@ -374,7 +375,7 @@ ParU_Info paru_front
         Us[f].n = colCount;
         Num->fcolCount[f] = colCount;
         ASSERT(Us[f].p == NULL);
-        Us[f].p = uPart;
+        Us[f].p = (double *) uPart;
 
         paru_tupleList *RowList = Work->RowList;
 
@@ -419,7 +420,7 @@ ParU_Info paru_front
                 PRLEVEL(1, ("%% element= " LD "  nEl =" LD " \n", e, nEl));
 
                 //**//pragma omp task priority(Depth[f]) if(mEl > 1024)
-                paru_assemble_row_2U(e, f, curRowIndex, curFsRowIndex, colHash,
+                paru_assemble_row_2U<T>(e, f, curRowIndex, curFsRowIndex, colHash,
                                      Work, Num);
                 //**//pragma omp taskwait
 
@@ -496,7 +497,7 @@ ParU_Info paru_front
         {
             // allocating an un-initialized part of memory
             curEl = elementList[eli] =
-                paru_create_element(rowCount - fp, colCount);
+                paru_create_element<T>(rowCount - fp, colCount);
 
             // While insided the DGEMM BETA == 0
             if (curEl == NULL)
@@ -548,9 +549,9 @@ ParU_Info paru_front
                         el_rowIndex[locIndx]));
         }
 
-        // double *el_numbers = numeric_pointer (curEl);
-        double *el_numbers =
-            (double *)((int64_t *)(curEl + 1) + 2 * colCount + 2 * (rowCount - fp));
+        // T *el_numbers = numeric_pointer<T> (curEl);
+        T *el_numbers =
+            (T *)((int64_t *)(curEl + 1) + 2 * colCount + 2 * (rowCount - fp));
 
         int64_t dgemm_blas_ok = paru_dgemm(f, pivotalFront, uPart, el_numbers,
             fp, rowCount, colCount, Work, Num);
@@ -584,7 +585,7 @@ ParU_Info paru_front
 
         PRLEVEL(-1, ("\n%%||||  Start Finalize " LD " ||||\n", f));
         ParU_Info res_prior;
-        res_prior = paru_prior_assemble(f, start_fac, pivotal_elements, colHash,
+        res_prior = paru_prior_assemble<T>(f, start_fac, pivotal_elements, colHash,
                                         hi, Work, Sym, Num);
         if (res_prior != PARU_SUCCESS) return res_prior;
         PRLEVEL(-1, ("\n%%||||  Finish Finalize " LD " ||||\n", f));
@@ -626,3 +627,19 @@ ParU_Info paru_front
     }
     return PARU_SUCCESS;
 }
+
+template ParU_Info paru_front<double>
+(
+    int64_t f,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_front<std::complex<double>>
+(
+    int64_t f,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
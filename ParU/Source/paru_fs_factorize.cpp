@@ -18,9 +18,10 @@
 // paru_swap_rows: swap pivot rows
 //------------------------------------------------------------------------------
 
+template <typename T>
 void paru_swap_rows
 (
-    double *F,              // swap rows r1 and r2 of front f
+    T *F,                   // swap rows r1 and r2 of front f
     int64_t *frowList,      // global id's of the rows of this fron
     int64_t m,              // F is m-by-n
     int64_t n,
@@ -42,6 +43,7 @@ void paru_swap_rows
 // paru_panel_factorize: factorize a single panel
 //------------------------------------------------------------------------------
 
+template <typename T>
 bool paru_panel_factorize
 (
     int64_t f,
@@ -81,7 +83,7 @@ bool paru_panel_factorize
 
     int64_t *frowList = Num->frowList[f];
     ParU_Factors *LUs = Num->partial_LUs;
-    double *F = LUs[f].p;
+    T *F = (T *) LUs[f].p;
 
 #ifndef NDEBUG  // Printing the panel
     int64_t num_col_panel = j2 - j1;
@@ -111,7 +113,7 @@ bool paru_panel_factorize
         // Initializing maximum element in the column
         int64_t row_max = j;
 
-        double maxval = F[j * m + row_max];
+        T maxval = F[j * m + row_max];
 
 #ifndef NDEBUG
         int64_t row_deg_max = row_degree_bound[frowList[row_max]];
@@ -120,7 +122,7 @@ bool paru_panel_factorize
 #endif
 
         int64_t row_diag = (Diag_map) ? Diag_map[col1 + j + n1] - n1 : -1;
-        double diag_val = maxval;  // initialization
+        T diag_val = maxval;  // initialization
         int64_t diag_found = (frowList[j] == row_diag ? j : -1) ;
         PRLEVEL(1, ("%%curCol=" LD " row_diag=" LD "\n", j + col1 + n1, row_diag));
         PRLEVEL(1, ("%%##j=" LD " value= %2.4lf\n", j, F[j * m + j]));
@@ -130,7 +132,7 @@ bool paru_panel_factorize
             // find max
             PRLEVEL(1, ("%%i=" LD " value= %2.4lf", i, F[j * m + i]));
             PRLEVEL(1, (" deg = " LD " \n", row_degree_bound[frowList[i]]));
-            if (fabs(maxval) < fabs(F[j * m + i]))
+            if (std::abs(maxval) < std::abs(F[j * m + i]))
             {
                 row_max = i;
                 maxval = F[j * m + i];
@@ -150,7 +152,7 @@ bool paru_panel_factorize
 
         PRLEVEL(1, ("%% max value= %2.4lf\n", maxval));
 
-        if (maxval == 0)
+        if (maxval == T(0))
         {
             PRLEVEL(1, ("%% NO pivot found in " LD "\n", n1 + col1 + j));
 #pragma omp atomic write
@@ -158,7 +160,7 @@ bool paru_panel_factorize
             continue;
         }
         // initialzing pivot as max numeric value
-        double piv = maxval;
+        T piv = maxval;
         int64_t row_piv = row_max;
         int64_t chose_diag = 0;
 
@@ -166,7 +168,7 @@ bool paru_panel_factorize
         {
             if (diag_found != -1)
             {
-                if (fabs(diag_toler * maxval) < fabs(diag_val))
+                if (std::abs(diag_toler * maxval) < std::abs(diag_val))
                 {
                     piv = diag_val;
                     row_piv = diag_found;
@@ -204,8 +206,8 @@ bool paru_panel_factorize
 
             for (int64_t i = j; i < row_end; i++)
             {
-                double value = F[j * m + i];
-                if (fabs(piv_toler * maxval) < fabs(value) &&
+                T value = F[j * m + i];
+                if (std::abs(piv_toler * maxval) < std::abs(value) &&
                     row_degree_bound[frowList[i]] < row_deg_sp)
                 {
                     // numerically acceptalbe and sparser
@@ -296,10 +298,10 @@ bool paru_panel_factorize
 
         if (j < j2 - 1)
         {
-            double *X = F + j * m + j + 1;
-            double alpha = -1.0;
-            double *Y = F + j * m + j + m;
-            double *A = F + j * m + j + m + 1;
+            T *X = F + j * m + j + 1;
+            T alpha = -1.0;
+            T *Y = F + j * m + j + m;
+            T *A = F + j * m + j + m + 1;
 
 #ifndef NDEBUG  // Printing dger input
             int64_t M = (int64_t)row_end - 1 - j;
@@ -318,9 +320,8 @@ bool paru_panel_factorize
             PRLEVEL(PR, ("\n"));
 
 #endif
-            bool blas_ok = true ;
-            SUITESPARSE_BLAS_dger(row_end - 1 - j, j2 - 1 - j, &alpha, X, 1, Y,
-                                  m, A, m, blas_ok);
+            bool blas_ok = paru_blas_ger(row_end - 1 - j, j2 - 1 - j, &alpha,
+                                         X, 1, Y, m, A, m);
             if (!blas_ok) return (false);
 #ifdef COUNT_FLOPS
 #pragma omp atomic update
@@ -351,6 +352,7 @@ bool paru_panel_factorize
 // paru_factorize_full_summed: factorize a frontal matrix
 //------------------------------------------------------------------------------
 
+template <typename T>
 ParU_Info paru_factorize_full_summed
 (
     int64_t f,
@@ -377,7 +379,7 @@ ParU_Info paru_factorize_full_summed
 
     ParU_Factors *LUs = Num->partial_LUs;
     int64_t rowCount = Num->frowCount[f];
-    double *F = LUs[f].p;
+    T *F = (T *) LUs[f].p;
 
     int64_t num_panels =
         (fp % panel_width == 0) ? fp / panel_width : fp / panel_width + 1;
@@ -402,7 +404,7 @@ ParU_Info paru_factorize_full_summed
         int64_t j1 = panel_num * panel_width;
         int64_t j2 = (panel_num + 1) * panel_width;
         // factorize current panel
-        bool blas_ok = paru_panel_factorize(f, rowCount, fp,
+        bool blas_ok = paru_panel_factorize<T>(f, rowCount, fp,
             panel_num, row_end, Work, Sym, Num);
         if (!blas_ok) return (PARU_TOO_LARGE);
         // int64_t naft; //number of active frontal tasks
@@ -455,9 +457,9 @@ ParU_Info paru_factorize_full_summed
                 int64_t M = (int64_t)panel_width;
                 int64_t N = (int64_t)fp - j2;
                 double alpha = 1.0;
-                double *A = F + j1 * rowCount + j1;
+                T *A = F + j1 * rowCount + j1;
                 int64_t lda = (int64_t)rowCount;
-                double *B = F + j2 * rowCount + j1;
+                T *B = F + j2 * rowCount + j1;
                 int64_t ldb = (int64_t)rowCount;
 #ifndef NDEBUG
                 int64_t PR = 1;
@@ -527,12 +529,12 @@ ParU_Info paru_factorize_full_summed
             int64_t N = (int64_t)fp - j2;
             int64_t K = (int64_t)panel_width;
             // alpha = -1;
-            double *A = F + j1 * rowCount + j2;
+            T *A = F + j1 * rowCount + j2;
             int64_t lda = (int64_t)rowCount;
-            double *B = F + j2 * rowCount + j1;
+            T *B = F + j2 * rowCount + j1;
             int64_t ldb = (int64_t)rowCount;
             // double beta = 1;  // keep current values
-            double *C = F + j2 * rowCount + j2;
+            T *C = F + j2 * rowCount + j2;
             int64_t ldc = (int64_t)rowCount;
 #ifndef NDEBUG
             int64_t PR = 1;
@@ -572,3 +574,27 @@ ParU_Info paru_factorize_full_summed
     }
     return PARU_SUCCESS;
 }
+
+template ParU_Info paru_factorize_full_summed<double>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &panel_row,
+    std::set<int64_t> &stl_colSet,
+    std::vector<int64_t> &pivotal_elements,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_factorize_full_summed<std::complex<double>>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &panel_row,
+    std::set<int64_t> &stl_colSet,
+    std::vector<int64_t> &pivotal_elements,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -35,6 +35,7 @@
  */
 #include "paru_internal.hpp"
 
+template <typename T>
 void paru_full_summed
 (
     int64_t e,
@@ -76,10 +77,10 @@ void paru_full_summed
 
     ParU_Factors *LUs = Num->partial_LUs;
     int64_t rowCount = LUs[f].m;
-    double *pivotalFront = LUs[f].p;
+    T *pivotalFront = (T *) LUs[f].p;
 
-    // double *el_Num = numeric_pointer (el);
-    double *el_Num = (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+    // T *el_Num = numeric_pointer (el);
+    T *el_Num = (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
 
 #ifndef NDEBUG  // print the element which is going to be assembled from
     PR = 2;
@@ -96,14 +97,14 @@ void paru_full_summed
     {
         // No need for a temp space for active rows; no reuse
         PRLEVEL(PR, ("%% 1 col left\n %%"));
-        double *sC = el_Num + mEl * el->lac;  // source column pointer
+        T *sC = el_Num + mEl * el->lac;  // source column pointer
         int64_t fcolInd = el_colIndex[el->lac] - col1;
 #ifndef NDEBUG
         int64_t colInd = el_colIndex[el->lac];
         PRLEVEL(1, ("%% colInd =" LD " \n", fcolInd));
         ASSERT(colInd >= 0);
 #endif
-        double *dC = pivotalFront + fcolInd * rowCount;
+        T *dC = pivotalFront + fcolInd * rowCount;
         int64_t nrows2bSeen = el->nrowsleft;
         for (int64_t i = 0; i < mEl; i++)
         {
@@ -160,7 +161,7 @@ void paru_full_summed
         {
             // j already defined out of this scope while it is needed
             PRLEVEL(1, ("%% j =" LD " \n", j));
-            double *sC = el_Num + mEl * j;  // source column pointer
+            T *sC = el_Num + mEl * j;  // source column pointer
             int64_t colInd = el_colIndex[j];
             PRLEVEL(1, ("%% colInd =" LD " \n", colInd));
             if (colInd >= col2) break;
@@ -168,7 +169,7 @@ void paru_full_summed
 
             int64_t fcolInd = colInd - col1;
 
-            double *dC = pivotalFront + fcolInd * rowCount;
+            T *dC = pivotalFront + fcolInd * rowCount;
 
             //#pragma omp task priority(Depth[f]) if(nrows2assembl > 1024)
             for (int64_t iii = 0; iii < nrows2assembl; iii++)
@@ -231,3 +232,21 @@ void paru_full_summed
     }
 #endif
 }
+
+template void paru_full_summed<double>
+(
+    int64_t e,
+    int64_t f,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template void paru_full_summed<std::complex<double>>
+(
+    int64_t e,
+    int64_t f,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -6,18 +6,20 @@
 // All Rights Reserved.
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-/*! @brief  computing y = alpha * A*x+y
+/*! @brief  computing y = alpha * A*x+y, where A, x, and y are all real or
+ *  all complex
  *
  *  @author Aznaveh
  */
 
 #include "paru_internal.hpp"
 
+template <typename T>
 void paru_gaxpy
 (
     cholmod_sparse *A,
-    const double *x,
-    double *y,
+    const T *x,
+    T *y,
     double alpha
 )
 {
@@ -25,7 +27,7 @@ void paru_gaxpy
 
     int64_t *Ap = static_cast<int64_t*>(A->p);
     int64_t *Ai = static_cast<int64_t*>(A->i);
-    double *Ax = static_cast<double*>(A->x);
+    T *Ax = static_cast<T*>(A->x);
     int64_t n = A->ncol;
     for (int64_t j = 0; j < n; j++)
     {
@@ -46,3 +48,18 @@ void paru_gaxpy
 #endif
 }
 
+template void paru_gaxpy<double>
+(
+    cholmod_sparse *A,
+    const double *x,
+    double *y,
+    double alpha
+) ;
+
+template void paru_gaxpy<std::complex<double>>
+(
+    cholmod_sparse *A,
+    const std::complex<double> *x,
+    std::complex<double> *y,
+    double alpha
+) ;
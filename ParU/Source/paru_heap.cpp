@@ -19,6 +19,7 @@
 
 // check if e can be assembeld into f
 
+template <typename T>
 void paru_check_prior_element
 (
     int64_t e,
@@ -38,14 +39,14 @@ void paru_check_prior_element
     if (elRow[e] == 0 && el->rValid > start_fac)
     {
         // all the rows are inside he current front; maybe assemble some cols
-        paru_assemble_cols(e, f, colHash, Work, Sym, Num);
+        paru_assemble_cols<T>(e, f, colHash, Work, Sym, Num);
         return;
     }
 
     if (el->rValid == start_fac || el->cValid == Work->time_stamp[f])
     {
         // all the cols are inside he current front; maybe assemble some rows
-        paru_assemble_rows(e, f, colHash, Work, Sym, Num);
+        paru_assemble_rows<T>(e, f, colHash, Work, Sym, Num);
     }
 }
 
@@ -53,6 +54,7 @@ void paru_check_prior_element
 // paru_make_heap
 //------------------------------------------------------------------------------
 
+template <typename T>
 ParU_Info paru_make_heap
 (
     int64_t f,
@@ -119,8 +121,8 @@ ParU_Info paru_make_heap
                 {
                     if (elementList[e] != NULL)
                     {
-                        paru_check_prior_element(e, f, start_fac, colHash, Work,
-                                                 Sym, Num);
+                        paru_check_prior_element<T>(e, f, start_fac, colHash,
+                                                    Work, Sym, Num);
                         if (elementList[e] != NULL)
                         {
                             curHeap->push_back(e);
@@ -166,8 +168,8 @@ ParU_Info paru_make_heap
                 {
                     if (elementList[e] != NULL)
                     {
-                        paru_check_prior_element(e, f, start_fac, colHash, Work,
-                                                 Sym, Num);
+                        paru_check_prior_element<T>(e, f, start_fac, colHash,
+                                                    Work, Sym, Num);
                         if (elementList[e] != NULL) curHeap->push_back(e);
                     }
                 }
@@ -395,3 +397,27 @@ ParU_Info paru_make_heap_empty_el
 #endif
     return PARU_SUCCESS;
 }
+
+template ParU_Info paru_make_heap<double>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &pivotal_elements,
+    heaps_info &hi,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_make_heap<std::complex<double>>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &pivotal_elements,
+    heaps_info &hi,
+    std::vector<int64_t> &colHash,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
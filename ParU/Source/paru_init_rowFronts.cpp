@@ -20,13 +20,7 @@
 
 #include "paru_internal.hpp"
 
-#define FREE_WORK                           \
-{                                           \
-    PARU_FREE (m + 1, int64_t, cSp);        \
-    PARU_FREE (cs1 + 1, int64_t, cSup);     \
-    PARU_FREE (rs1 + 1, int64_t, cSlp);     \
-}
-
+template <typename T>
 ParU_Info paru_init_rowFronts
 (
     // input/output:
@@ -43,13 +37,6 @@ ParU_Info paru_init_rowFronts
     size_t mem_chunk = Work->mem_chunk ;
     int32_t prescale = Work->prescale ;
 
-    // workspace:
-    int64_t *cSp = NULL;    // copy of Sp, temporary for making Sx
-    int64_t *cSup = NULL;   // copy of Sup temporary for making Sux
-    int64_t *cSlp = NULL;   // copyf of Slp temporary, for making Slx
-    int64_t cs1 = 0 ;
-    int64_t rs1 = 0 ;
-
     DEBUGLEVEL(0);
     PARU_DEFINE_PRLEVEL;
 
@@ -83,6 +70,7 @@ ParU_Info paru_init_rowFronts
 
     int64_t m, nf;
     Num->sym_m = Sym->m;
+    Num->xtype = A->xtype;
     m = Num->m = Sym->m - Sym->n1;
     nf = Num->nf = Sym->nf;
     Num->res = PARU_SUCCESS;
@@ -134,7 +122,6 @@ ParU_Info paru_init_rowFronts
             elementList == NULL)
         {
             // out of memory
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
 
@@ -145,7 +132,6 @@ ParU_Info paru_init_rowFronts
             if (Diag_map == NULL || inv_Diag_map == NULL)
             {
                 // out of memory
-                FREE_WORK ;
                 return (PARU_OUT_OF_MEMORY) ;
             }
 #ifndef NDEBUG
@@ -159,42 +145,34 @@ ParU_Info paru_init_rowFronts
     }
 
     int64_t snz = Num->snz = Sym->snz;
-    double *Sx = NULL;
-    Sx = Num->Sx = PARU_MALLOC (snz, double);
-    cSp = PARU_MALLOC (m + 1, int64_t);
+    T *Sx = PARU_MALLOC (snz, T);
+    Num->Sx = (double *) Sx;
     if (Num->Sx == NULL)
     {
-        FREE_WORK ;
         return (PARU_OUT_OF_MEMORY) ;
     }
 
-    cs1 = Sym->cs1;
-    rs1 = Sym->rs1;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
     if (cs1 > 0)
     {
         Num->sunz = Sym->ustons.nnz;
-        Num->Sux = PARU_MALLOC (Num->sunz, double);
-        cSup = PARU_MALLOC (cs1 + 1, int64_t);
-        if (cSup == NULL || Num->Sux == NULL)
+        Num->Sux = (double *) PARU_MALLOC (Num->sunz, T);
+        if (Num->Sux == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Sux = Num->Sux ;
 
     if (rs1 > 0)
     {
         Num->slnz = Sym->lstons.nnz;
-        Num->Slx = PARU_MALLOC (Num->slnz, double);
-        cSlp = PARU_MALLOC (rs1 + 1, int64_t);
-        if (cSlp == NULL || Num->Slx == NULL)
+        Num->Slx = (double *) PARU_MALLOC (Num->slnz, T);
+        if (Num->Slx == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Slx = Num->Slx ;
 
     bool prescaling = (prescale != PARU_PRESCALE_NONE) ;
     if (prescaling)
@@ -203,11 +181,9 @@ ParU_Info paru_init_rowFronts
         Num->Rs = PARU_CALLOC (Sym->m, double);
         if (Num->Rs == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Rs = Num->Rs ;
 
     // Initializations
     if (nf != 0)
@@ -232,178 +208,15 @@ ParU_Info paru_init_rowFronts
     }
 
     //////////////////Initializing numerics Sx, Sux and Slx //////////////////{
-    int64_t *Ap = static_cast<int64_t*>(A->p);
-    int64_t *Ai = static_cast<int64_t*>(A->i);
-    double *Ax = static_cast<double*>(A->x);
-    const int64_t *Sp = Sym->Sp;
-    const int64_t *Slp = (rs1 > 0) ? Sym->lstons.Slp : NULL ;
-    const int64_t *Sup = (cs1 > 0) ? Sym->ustons.Sup : NULL ;
-    paru_memcpy(cSp, Sp, (m + 1) * sizeof(int64_t), mem_chunk, nthreads) ;
-    if (cs1 > 0)
-    {
-        paru_memcpy(cSup, Sup, (cs1 + 1) * sizeof(int64_t),
-                mem_chunk, nthreads) ;
-    }
-    if (rs1 > 0)
-    {
-        paru_memcpy(cSlp, Slp, (rs1 + 1) * sizeof(int64_t),
-                mem_chunk, nthreads) ;
-    }
-#ifndef NDEBUG
-    PR = 1;
-    PRLEVEL(PR, ("Init Sup and Slp in the middle\n"));
-    if (cs1 > 0)
-    {
-        PRLEVEL(PR, ("(" LD ") Sup =", Num->sunz));
-        for (int64_t k = 0; k <= cs1; k++)
-        {
-            PRLEVEL(PR, ("" LD " ", Sup[k]));
-            PRLEVEL(PR + 2, ("c" LD " ", cSup[k]));
-            if (Sup[k] != cSup[k])
-                PRLEVEL(PR, ("Sup[" LD "] =" LD ", cSup=" LD "", k, Sup[k], cSup[k]));
-            ASSERT(Sup[k] == cSup[k]);
-        }
-        PRLEVEL(PR, ("\n"));
-    }
-    if (rs1 > 0)
-    {
-        PRLEVEL(PR, ("(" LD ") Slp =", Num->slnz));
-        for (int64_t k = 0; k <= rs1; k++)
-        {
-            PRLEVEL(PR, ("" LD " ", Slp[k]));
-            PRLEVEL(PR + 2, ("o" LD " ", cSlp[k]));
-            if (Slp[k] != cSlp[k])
-                PRLEVEL(PR,
-                        ("\nSup[" LD "] =" LD ", cSup=" LD "\n", k, Slp[k], cSlp[k]));
-            ASSERT(Slp[k] == cSlp[k]);
-        }
-        PRLEVEL(PR, ("\n"));
-    }
-#endif
-
-    int64_t n1 = Sym->n1;
-
-    const int64_t *Qinit = Sym->Qfill;
-    const int64_t *Pinv = Sym->Pinv;
-#ifndef NDEBUG
-    PR = 1;
-    PRLEVEL(PR, ("Init Pinv =\n"));
-    for (int64_t i = 0; i < m; i++) PRLEVEL(PR, ("" LD " ", Pinv[i]));
-    PRLEVEL(PR, ("\n"));
-#endif
-
-    // compute the scale factors
-    if (prescale == PARU_PRESCALE_MAX)
-    {
-        // this is the ParU default
-        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
-        {
-            int64_t oldcol = Qinit[newcol];
-            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-            {
-                int64_t oldrow = Ai[p];
-                Rs[oldrow] = std::max(Rs[oldrow], fabs(Ax[p]));
-            }
-        }
-    }
-    else if (prescale == PARU_PRESCALE_SUM)
-    {
-        // this is the UMFPACK default
-        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
-        {
-            int64_t oldcol = Qinit[newcol];
-            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-            {
-                int64_t oldrow = Ai[p];
-                Rs[oldrow] += fabs(Ax[p]);
-            }
-        }
-    }
-
-    PRLEVEL(PR, ("%% Rs:\n["));
-    if (prescaling)
-    {
-        // making sure that every row has at most one element more than zero
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(PR, ("%lf ", Rs[k]));
-            if (Rs[k] <= 0)
-            {
-                PRLEVEL(1, ("ParU: Matrix is singular, row " LD
-                    " is zero\n", k));
-                Num->res = PARU_SINGULAR;
-                return PARU_SINGULAR;
-            }
-        }
-    }
-    PRLEVEL(PR, ("]\n"));
-
-    for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+    ParU_Info info ;
+    info = paru_init_values<T> (A, Sym, Num, Work) ;
+    if (info != PARU_SUCCESS)
     {
-        int64_t oldcol = Qinit[newcol];
-        for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-        {
-            int64_t oldrow = Ai[p];
-            int64_t newrow = Pinv[oldrow];
-            int64_t srow = newrow - n1;
-            int64_t scol = newcol - n1;
-            if (srow >= 0 && scol >= 0)
-            {
-                // it is inside S otherwise it is part of singleton
-                Sx[cSp[srow]++] =
-                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-            }
-            else if (srow < 0 && scol >= 0)
-            {
-                // inside the U singletons
-                PRLEVEL(PR, ("Usingleton newcol = " LD " newrow=" LD "\n",
-                    newcol, newrow));
-                // let the diagonal entries be first
-                Sux[++cSup[newrow]] =
-                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-            }
-            else
-            {
-                if (newrow < cs1)
-                {
-                    // inside U singletons CSR
-                    // PRLEVEL(PR, ("Inside U singletons\n"));
-                    if (newcol == newrow)
-                    {
-                        // diagonal entry
-                        Sux[Sup[newrow]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                    else
-                    {
-                        Sux[++cSup[newrow]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                }
-                else
-                {
-                    // inside L singletons CSC
-                    // PRLEVEL(PR, ("Inside L singletons\n"));
-                    if (newcol == newrow)
-                    {
-                        // diagonal entry
-                        Slx[Slp[newcol - cs1]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                    else
-                    {
-                        Slx[++cSlp[newcol - cs1]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                }
-            }
-        }
+        // out of memory, or the matrix is singular
+        return (info) ;
     }
+    //////////////////Initializing numerics Sx, Sux and Slx //////////////////}
 
-    FREE_WORK;
-
-        //////////////////Initializing numerics Sx, Sux and Slx
-        /////////////////////}
 #ifdef COUNT_FLOPS
     // flop count init
     Work->flp_cnt_dgemm = 0.0;
@@ -415,6 +228,7 @@ ParU_Info paru_init_rowFronts
     // RowList, ColList and elementList are place holders
     // pointers to pointers that are allocated
 
+    const int64_t *Sp = Sym->Sp;
     int64_t *Sj = Sym->Sj;
 
     /// ------------------------------------------------------------------------
@@ -494,7 +308,7 @@ ParU_Info paru_init_rowFronts
         row_degree_bound[row] = ncols;  // Initialzing row degree
 
         paru_element *curEl = elementList[e] =
-            paru_create_element(nrows, ncols);
+            paru_create_element<T>(nrows, ncols);
         if (curEl == NULL)
         {
             // out of memory
@@ -545,7 +359,7 @@ ParU_Info paru_init_rowFronts
                     {
                         // Allocating elements
                         int64_t *el_colrowIndex = colIndex_pointer(curEl);
-                        double *el_colrowNum = numeric_pointer(curEl);
+                        T *el_colrowNum = numeric_pointer<T>(curEl);
 
                         int64_t j = 0;  // Index inside an element
                         for (int64_t p = Sp[row]; p < Sp[row + 1]; p++)
@@ -573,7 +387,6 @@ ParU_Info paru_init_rowFronts
     // return result
     //--------------------------------------------------------------------------
 
-    ParU_Info info ;
     if (out_of_memory > 0)
     {
         info = PARU_OUT_OF_MEMORY;
@@ -591,3 +404,19 @@ ParU_Info paru_init_rowFronts
 
     return (info) ;
 }
+
+template ParU_Info paru_init_rowFronts<double>
+(
+    paru_work *Work,
+    ParU_Numeric *Num_handle,
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym
+) ;
+
+template ParU_Info paru_init_rowFronts<std::complex<double>>
+(
+    paru_work *Work,
+    ParU_Numeric *Num_handle,
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym
+) ;
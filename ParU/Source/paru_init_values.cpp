@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  paru_init_values  //////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*!  @brief  Computes the row scale factors Rs (if prescaling is enabled) and
+ *          the numerical values of S and of the singletons (Sx, Sux, and Slx)
+ *          from the input matrix A.  Num->Sx, Num->Sux, Num->Slx, and Num->Rs
+ *          must already be allocated.  Used by both ParU_Factorize and
+ *          ParU_Refactor.  T is double if A is real, or std::complex<double>
+ *          if A is complex; Rs is real in both cases.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+#define FREE_WORK                           \
+{                                           \
+    PARU_FREE (m + 1, int64_t, cSp);        \
+    PARU_FREE (cs1 + 1, int64_t, cSup);     \
+    PARU_FREE (rs1 + 1, int64_t, cSlp);     \
+}
+
+template <typename T>
+ParU_Info paru_init_values
+(
+    // input:
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,    // symbolic analysis
+    // input/output:
+    ParU_Numeric Num,
+    // workspace and control:
+    paru_work *Work
+)
+{
+
+    DEBUGLEVEL(0);
+    PARU_DEFINE_PRLEVEL;
+
+    // get Control
+    int32_t nthreads = Work->nthreads ;
+    size_t mem_chunk = Work->mem_chunk ;
+    int32_t prescale = Work->prescale ;
+
+    int64_t m = Num->m;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+    T *Sx = (T *) Num->Sx ;
+    T *Sux = (T *) Num->Sux ;
+    T *Slx = (T *) Num->Slx ;
+    double *Rs = Num->Rs ;
+    bool prescaling = (prescale != PARU_PRESCALE_NONE) ;
+    ASSERT (!prescaling || Rs != NULL) ;
+
+    // workspace:
+    int64_t *cSp = NULL;    // copy of Sp, temporary for making Sx
+    int64_t *cSup = NULL;   // copy of Sup temporary for making Sux
+    int64_t *cSlp = NULL;   // copyf of Slp temporary, for making Slx
+
+    cSp = PARU_MALLOC (m + 1, int64_t);
+    if (cs1 > 0)
+    {
+        cSup = PARU_MALLOC (cs1 + 1, int64_t);
+    }
+    if (rs1 > 0)
+    {
+        cSlp = PARU_MALLOC (rs1 + 1, int64_t);
+    }
+    if (cSp == NULL || (cs1 > 0 && cSup == NULL) || (rs1 > 0 && cSlp == NULL))
+    {
+        FREE_WORK ;
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+
+    //////////////////Initializing numerics Sx, Sux and Slx //////////////////{
+    int64_t *Ap = static_cast<int64_t*>(A->p);
+    int64_t *Ai = static_cast<int64_t*>(A->i);
+    T *Ax = static_cast<T*>(A->x);
+    const int64_t *Sp = Sym->Sp;
+    const int64_t *Slp = (rs1 > 0) ? Sym->lstons.Slp : NULL ;
+    const int64_t *Sup = (cs1 > 0) ? Sym->ustons.Sup : NULL ;
+    paru_memcpy(cSp, Sp, (m + 1) * sizeof(int64_t), mem_chunk, nthreads) ;
+    if (cs1 > 0)
+    {
+        paru_memcpy(cSup, Sup, (cs1 + 1) * sizeof(int64_t),
+                mem_chunk, nthreads) ;
+    }
+    if (rs1 > 0)
+    {
+        paru_memcpy(cSlp, Slp, (rs1 + 1) * sizeof(int64_t),
+                mem_chunk, nthreads) ;
+    }
+#ifndef NDEBUG
+    PR = 1;
+    PRLEVEL(PR, ("Init Sup and Slp in the middle\n"));
+    if (cs1 > 0)
+    {
+        PRLEVEL(PR, ("(" LD ") Sup =", Num->sunz));
+        for (int64_t k = 0; k <= cs1; k++)
+        {
+            PRLEVEL(PR, ("" LD " ", Sup[k]));
+            PRLEVEL(PR + 2, ("c" LD " ", cSup[k]));
+            if (Sup[k] != cSup[k])
+                PRLEVEL(PR, ("Sup[" LD "] =" LD ", cSup=" LD "", k, Sup[k], cSup[k]));
+            ASSERT(Sup[k] == cSup[k]);
+        }
+        PRLEVEL(PR, ("\n"));
+    }
+    if (rs1 > 0)
+    {
+        PRLEVEL(PR, ("(" LD ") Slp =", Num->slnz));
+        for (int64_t k = 0; k <= rs1; k++)
+        {
+            PRLEVEL(PR, ("" LD " ", Slp[k]));
+            PRLEVEL(PR + 2, ("o" LD " ", cSlp[k]));
+            if (Slp[k] != cSlp[k])
+                PRLEVEL(PR,
+                        ("\nSup[" LD "] =" LD ", cSup=" LD "\n", k, Slp[k], cSlp[k]));
+            ASSERT(Slp[k] == cSlp[k]);
+        }
+        PRLEVEL(PR, ("\n"));
+    }
+#endif
+
+    int64_t n1 = Sym->n1;
+
+    const int64_t *Qinit = Sym->Qfill;
+    const int64_t *Pinv = Sym->Pinv;
+#ifndef NDEBUG
+    PR = 1;
+    PRLEVEL(PR, ("Init Pinv =\n"));
+    for (int64_t i = 0; i < m; i++) PRLEVEL(PR, ("" LD " ", Pinv[i]));
+    PRLEVEL(PR, ("\n"));
+#endif
+
+    // compute the scale factors
+    if (prescaling)
+    {
+        // Rs may hold the scale factors of a prior factorization
+        paru_memset(Rs, 0, Sym->m * sizeof(double), mem_chunk, nthreads) ;
+    }
+    if (prescale == PARU_PRESCALE_MAX)
+    {
+        // this is the ParU default
+        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+        {
+            int64_t oldcol = Qinit[newcol];
+            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+            {
+                int64_t oldrow = Ai[p];
+                Rs[oldrow] = std::max(Rs[oldrow], std::abs(Ax[p]));
+            }
+        }
+    }
+    else if (prescale == PARU_PRESCALE_SUM)
+    {
+        // this is the UMFPACK default
+        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+        {
+            int64_t oldcol = Qinit[newcol];
+            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+            {
+                int64_t oldrow = Ai[p];
+                Rs[oldrow] += std::abs(Ax[p]);
+            }
+        }
+    }
+
+    PRLEVEL(PR, ("%% Rs:\n["));
+    if (prescaling)
+    {
+        // making sure that every row has at most one element more than zero
+        for (int64_t k = 0; k < m; k++)
+        {
+            PRLEVEL(PR, ("%lf ", Rs[k]));
+            if (Rs[k] <= 0)
+            {
+                PRLEVEL(1, ("ParU: Matrix is singular, row " LD
+                    " is zero\n", k));
+                Num->res = PARU_SINGULAR;
+                FREE_WORK ;
+                return PARU_SINGULAR;
+            }
+        }
+    }
+    PRLEVEL(PR, ("]\n"));
+
+    for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+    {
+        int64_t oldcol = Qinit[newcol];
+        for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+        {
+            int64_t oldrow = Ai[p];
+            int64_t newrow = Pinv[oldrow];
+            int64_t srow = newrow - n1;
+            int64_t scol = newcol - n1;
+            if (srow >= 0 && scol >= 0)
+            {
+                // it is inside S otherwise it is part of singleton
+                Sx[cSp[srow]++] =
+                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+            }
+            else if (srow < 0 && scol >= 0)
+            {
+                // inside the U singletons
+                PRLEVEL(PR, ("Usingleton newcol = " LD " newrow=" LD "\n",
+                    newcol, newrow));
+                // let the diagonal entries be first
+                Sux[++cSup[newrow]] =
+                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+            }
+            else
+            {
+                if (newrow < cs1)
+                {
+                    // inside U singletons CSR
+                    // PRLEVEL(PR, ("Inside U singletons\n"));
+                    if (newcol == newrow)
+                    {
+                        // diagonal entry
+                        Sux[Sup[newrow]] =
+                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+                    }
+                    else
+                    {
+                        Sux[++cSup[newrow]] =
+                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+                    }
+                }
+                else
+                {
+                    // inside L singletons CSC
+                    // PRLEVEL(PR, ("Inside L singletons\n"));
+                    if (newcol == newrow)
+                    {
+                        // diagonal entry
+                        Slx[Slp[newcol - cs1]] =
+                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+                    }
+                    else
+                    {
+                        Slx[++cSlp[newcol - cs1]] =
+                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+                    }
+                }
+            }
+        }
+    }
+
+    FREE_WORK;
+    //////////////////Initializing numerics Sx, Sux and Slx //////////////////}
+    return (PARU_SUCCESS) ;
+}
+
+template ParU_Info paru_init_values<double>
+(
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    paru_work *Work
+) ;
+
+template ParU_Info paru_init_values<std::complex<double>>
+(
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    paru_work *Work
+) ;
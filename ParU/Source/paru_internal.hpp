@@ -14,6 +14,7 @@
 //
 
 #include <cinttypes>
+#include <complex>
 #define SUITESPARSE_BLAS_DEFINITIONS
 #include "ParU.h"
 #include "paru_omp.hpp"
@@ -186,6 +187,10 @@ struct ParU_Symbolic_struct
     int64_t *task_parent;  // tree data structure for tasks
     int64_t *task_num_child;  // number of children of each task
     int64_t *task_depth;      // max depth of each task
+
+    // true if the arrays above are held in a blob owned by the user, from
+    // ParU_Deserialize_Symbolic with copy false; only Sym itself is freed
+    bool shallow ;
 } ;
 
 // =============================================================================
@@ -195,12 +200,17 @@ struct ParU_Symbolic_struct
 // a system. The factors are saved as a seried of dense matrices. User can check
 // the ParU_Info to see if the factorization is successful. sizes of
 // ParU_Numeric is size of S matrix in Symbolic analysis.
+//
+// The numerical values (Sx, Sux, Slx, and the factors in partial_LUs and
+// partial_Us) are held as double if xtype is CHOLMOD_REAL, or as
+// std::complex<double> if xtype is CHOLMOD_COMPLEX.  In the latter case,
+// each entry takes two doubles.  Rs is always real.
 
 struct ParU_Factors
 {
     // dense factorized part pointer
     int64_t m, n;   //  mxn dense matrix
-    double *p;  //  point to factorized parts
+    double *p;  //  point to factorized parts (real or complex)
 };
 
 struct ParU_Numeric_struct
@@ -209,6 +219,7 @@ struct ParU_Numeric_struct
     int64_t sym_m;  // number of rows of original matrix; a copy of Sym->m
 
     int64_t nf;      // number of fronts copy of Sym->nf
+    int xtype;       // CHOLMOD_REAL or CHOLMOD_COMPLEX, the xtype of A
     double *Rs;  // the array for row scaling based on original matrix
                  // size = m
 
@@ -245,6 +256,111 @@ struct ParU_Numeric_struct
     int64_t nnzU;       //nnz of U
     double sfc; //simple flop count
     ParU_Info res;  // returning value of numeric phase
+
+    // assembly maps for ParU_Refactor; NULL until ParU_Refactor is first
+    // called with this Numeric object
+    struct ParU_Refactor_map *refactor_map;
+
+    // true if the numerical values, permutations, and row/column lists are
+    // held in a blob owned by the user, from ParU_Deserialize_Numeric with
+    // copy false.  Only the arrays of size nf of pointers (frowList,
+    // fcolList, partial_Us, and partial_LUs) and Num itself are then owned
+    // by Num.  A shallow Num cannot be refactorized in place.
+    bool shallow ;
+} ;
+
+// =============================================================================
+// ParU_Refactor_map: reusing the frontal structure for a new matrix
+// =============================================================================
+// ParU_Refactor recomputes the factors of a matrix with the same pattern as
+// the one factorized by ParU_Factorize, keeping the pivot sequence and the
+// row and column lists of each front.  The maps below tell it where each
+// original entry of S and each entry of a contribution block (CB) go.
+//
+// ParU_Factorize leaves a row out of a front if its entries in the pivotal
+// columns sum to zero, so some entries may have no place in the front they
+// are assembled into.  Those are summed into a workspace Z of size
+// (Zr [f] + Zc [f]) * fp for front f, which must be all zero once the front
+// is assembled: Zr [f] missing rows (of fp entries each, in the pivotal
+// columns) come first, then Zc [f] missing columns (of fp entries each, in
+// the pivotal rows).
+//
+// The entries of S are grouped by the front they are assembled into:
+// Sfi [Sfp [f] ... Sfp [f+1]-1] are their positions in Sx, and Sfo holds
+// their positions in front f, in the space [LUs[f].p, Us[f].p, Z].
+//
+// The CB of front e is rows frowList[e][fp ... rowCount-1] by columns
+// fcolList[e][0 ... colCount-1].  Its entries are pulled by the ancestors f of
+// e that hold one of its rows or columns as pivotal.  The (e,f) pairs pulled
+// by front f are CBp [f] ... CBp [f+1]-1.  For pair k:
+//
+//  columns fcolList[e][CBk1 [k] ... CBk2 [k]-1] are pivotal in f; if CBr [k]
+//      >= 0, row i of the CB goes to row Rmap [CBr [k] + i] of LUs[f].p, or
+//      is skipped if -1 (it has been assembled by an earlier front), or to
+//      the missing row flip (Rmap [CBr [k] + i]) of Z.
+//
+//  if CBc [k] >= 0, some rows of the CB are pivotal in f; the remaining
+//      columns fcolList[e][CBk2 [k] ... colCount-1] go to column
+//      Cmap [CBc [k] + j - CBk2 [k]] of Us[f].p, or if negative, to the
+//      missing column flip (Cmap [...]) of Z.
+//
+// CBlast [e] is the last front that pulls from the CB of e (-1 if none), so
+// the CB can be freed once that front is assembled.
+
+struct ParU_Refactor_map
+{
+    int64_t nf ;        // number of fronts, copy of Sym->nf
+    int64_t snz ;       // nnz in S, copy of Sym->snz
+    int64_t *Sfp ;      // size nf+1
+    int64_t *Sfi ;      // size snz
+    int64_t *Sfo ;      // size snz
+    int64_t *Zr ;       // size nf, # of missing rows in each front
+    int64_t *Zc ;       // size nf, # of missing columns in each front
+
+    int64_t npairs ;    // number of (e,f) pairs, CBp [nf]
+    int64_t *CBp ;      // size nf+1
+    int64_t *CBe ;      // size npairs, front e of each pair
+    int64_t *CBk1 ;     // size npairs
+    int64_t *CBk2 ;     // size npairs
+    int64_t *CBr ;      // size npairs, offset into Rmap, or -1
+    int64_t *CBc ;      // size npairs, offset into Cmap, or -1
+    int64_t rsize ;     // size of Rmap
+    int64_t *Rmap ;
+    int64_t csize ;     // size of Cmap
+    int64_t *Cmap ;
+    int64_t *CBlast ;   // size nf
+} ;
+
+// =============================================================================
+// ParU_Blob_header: serialized Symbolic and Numeric objects
+// =============================================================================
+// ParU_Serialize_Symbolic and ParU_Serialize_Numeric write a flat blob: this
+// header, a copy of the Sym or Num struct (its pointers are not used when the
+// blob is read back), and then each array as an int64_t count (-1 if the array
+// is NULL) followed by its entries.  Every entry is an int64_t or a double (a
+// complex entry is two doubles), so each array starts at a multiple of 8 bytes
+// from the start of the blob.  If the blob itself is 8-byte aligned (as it is
+// from malloc or mmap), ParU_Deserialize_* can leave the arrays in place.
+//
+// PARU_BLOB_VERSION is changed whenever the layout of the blob changes.  The
+// sizes of the structs guard against blobs written by a different ParU, or on
+// another platform.
+
+#define PARU_BLOB_VERSION 1
+#define PARU_BLOB_SYMBOLIC 0x53755061   // tag of a Symbolic blob
+#define PARU_BLOB_NUMERIC  0x4E755061   // tag of a Numeric blob
+
+struct ParU_Blob_header
+{
+    int64_t blobsize ;          // size of the whole blob, in bytes
+    int32_t tag ;               // PARU_BLOB_SYMBOLIC or PARU_BLOB_NUMERIC
+    int32_t blob_version ;      // PARU_BLOB_VERSION
+    int32_t version [3] ;       // ParU version that wrote the blob
+    int32_t sizeof_struct ;     // sizeof (ParU_Symbolic/Numeric_struct)
+    int32_t sizeof_int64 ;
+    int32_t sizeof_double ;
+    int32_t sizeof_void_star ;  // 32-bit vs 64-bit platforms
+    int32_t unused ;            // future expansion; zero
 } ;
 
 // =============================================================================
@@ -532,6 +648,143 @@ static int print_level = -1;
 
 #endif
 
+//------------------------------------------------------------------------------
+// BLAS for real and complex entries
+//------------------------------------------------------------------------------
+
+// The numerical kernels are templates on the type of the entries, T, which is
+// double or std::complex<double>.  These overloads call the d* or z* BLAS
+// accordingly, and return false if the problem is too large for the BLAS
+// integer.
+
+inline bool paru_blas_gemm
+(
+    const char *transa, const char *transb, int64_t m, int64_t n, int64_t k,
+    const double *alpha, const double *A, int64_t lda, const double *B,
+    int64_t ldb, const double *beta, double *C, int64_t ldc
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_dgemm (transa, transb, m, n, k, alpha, A, lda, B, ldb,
+        beta, C, ldc, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_gemm
+(
+    const char *transa, const char *transb, int64_t m, int64_t n, int64_t k,
+    const std::complex<double> *alpha, const std::complex<double> *A,
+    int64_t lda, const std::complex<double> *B, int64_t ldb,
+    const std::complex<double> *beta, std::complex<double> *C, int64_t ldc
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_zgemm (transa, transb, m, n, k, alpha, A, lda, B, ldb,
+        beta, C, ldc, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_trsm
+(
+    const char *side, const char *uplo, const char *transa, const char *diag,
+    int64_t m, int64_t n, const double *alpha, const double *A, int64_t lda,
+    double *B, int64_t ldb
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_dtrsm (side, uplo, transa, diag, m, n, alpha, A, lda, B,
+        ldb, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_trsm
+(
+    const char *side, const char *uplo, const char *transa, const char *diag,
+    int64_t m, int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *A, int64_t lda, std::complex<double> *B,
+    int64_t ldb
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_ztrsm (side, uplo, transa, diag, m, n, alpha, A, lda, B,
+        ldb, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_gemv
+(
+    const char *trans, int64_t m, int64_t n, const double *alpha,
+    const double *A, int64_t lda, const double *X, int64_t incx,
+    const double *beta, double *Y, int64_t incy
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_dgemv (trans, m, n, alpha, A, lda, X, incx, beta, Y,
+        incy, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_gemv
+(
+    const char *trans, int64_t m, int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *A, int64_t lda, const std::complex<double> *X,
+    int64_t incx, const std::complex<double> *beta, std::complex<double> *Y,
+    int64_t incy
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_zgemv (trans, m, n, alpha, A, lda, X, incx, beta, Y,
+        incy, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_trsv
+(
+    const char *uplo, const char *trans, const char *diag, int64_t n,
+    const double *A, int64_t lda, double *X, int64_t incx
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_dtrsv (uplo, trans, diag, n, A, lda, X, incx, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_trsv
+(
+    const char *uplo, const char *trans, const char *diag, int64_t n,
+    const std::complex<double> *A, int64_t lda, std::complex<double> *X,
+    int64_t incx
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_ztrsv (uplo, trans, diag, n, A, lda, X, incx, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_ger
+(
+    int64_t m, int64_t n, const double *alpha, const double *X, int64_t incx,
+    const double *Y, int64_t incy, double *A, int64_t lda
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_dger (m, n, alpha, X, incx, Y, incy, A, lda, ok) ;
+    return (ok) ;
+}
+
+inline bool paru_blas_ger
+(
+    int64_t m, int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *X, int64_t incx,
+    const std::complex<double> *Y, int64_t incy, std::complex<double> *A,
+    int64_t lda
+)
+{
+    bool ok = true ;
+    SUITESPARSE_BLAS_zgeru (m, n, alpha, X, incx, Y, incy, A, lda, ok) ;
+    return (ok) ;
+}
+
 // To be able to use set
 #include <algorithm>
 #include <set>
@@ -602,7 +855,7 @@ struct paru_element
     //   current front
     //   relRowInd [0..nrows-1],    relative indices of this element for
     //   current front
-    //   double ncols*nrows; numeric values
+    //   double or std::complex<double> ncols*nrows; numeric values
 };
 
 struct paru_work
@@ -697,10 +950,59 @@ inline int64_t *relRowInd(paru_element *curEl)
     return (int64_t *)(curEl + 1) + 2 * curEl->ncols + curEl->nrows;
 }
 
-inline double *numeric_pointer(paru_element *curEl)
+template <typename T = double>
+inline T *numeric_pointer(paru_element *curEl)
 {
-    return (double *)((int64_t *)(curEl + 1) + 2 * curEl->ncols +
-                      2 * curEl->nrows);
+    return (T *)((int64_t *)(curEl + 1) + 2 * curEl->ncols +
+                 2 * curEl->nrows);
+}
+
+// number of doubles in each numerical entry of Num: 1 if real, 2 if complex
+inline int64_t paru_xsize(ParU_Numeric Num)
+{
+    return ((Num->xtype == CHOLMOD_COMPLEX) ? 2 : 1) ;
+}
+
+// magnitude of the kth entry of X, which is real (xsize 1) or complex (xsize 2)
+inline double paru_entry_abs(const double *X, int64_t k, int64_t xsize)
+{
+    return ((xsize == 2) ? std::abs(((const std::complex<double> *) X)[k])
+                         : fabs(X[k])) ;
+}
+
+// the xtype of Num (CHOLMOD_REAL or CHOLMOD_COMPLEX) for entries of type T
+template <typename T> inline int paru_xtype ( ) ;
+template <> inline int paru_xtype<double> ( )
+{
+    return (CHOLMOD_REAL) ;
+}
+template <> inline int paru_xtype<std::complex<double>> ( )
+{
+    return (CHOLMOD_COMPLEX) ;
+}
+
+// true if Num is a factorization from Sym: its sizes match Sym, and the factors
+// of each front have as many pivots as the front has columns.  This is
+// checked by the methods that use both, since a Numeric object can be
+// deserialized separately from its Symbolic object.
+inline bool paru_num_matches_sym(const ParU_Symbolic Sym, const ParU_Numeric Num)
+{
+    if (Num->sym_m != Sym->m || Num->m != Sym->m - Sym->n1 ||
+        Num->nf != Sym->nf || Num->snz != Sym->snz ||
+        (Sym->cs1 > 0 && Num->sunz != Sym->ustons.nnz) ||
+        (Sym->rs1 > 0 && Num->slnz != Sym->lstons.nnz))
+    {
+        return (false) ;
+    }
+    const int64_t *Super = Sym->Super;
+    for (int64_t f = 0; f < Sym->nf; f++)
+    {
+        if (Num->partial_LUs[f].n != Super[f + 1] - Super[f])
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
 }
 
 inline int64_t flip(int64_t colInd)
@@ -843,6 +1145,7 @@ ParU_Info paru_umfpack_info (int status) ;
 /* add tuple functions defintions */
 ParU_Info paru_add_rowTuple(paru_tupleList *RowList, int64_t row, paru_tuple T);
 
+template <typename T>
 ParU_Info paru_factorize_full_summed
 (
     int64_t f,
@@ -855,6 +1158,7 @@ ParU_Info paru_factorize_full_summed
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 ParU_Info paru_exec_tasks
 (
     int64_t t,
@@ -865,6 +1169,7 @@ ParU_Info paru_exec_tasks
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 ParU_Info paru_exec_tasks_seq
 (
     int64_t t,
@@ -874,8 +1179,10 @@ ParU_Info paru_exec_tasks_seq
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 paru_element *paru_create_element(int64_t nrows, int64_t ncols);
 
+template <typename T>
 void paru_assemble_row_2U
 (
     int64_t e,
@@ -887,11 +1194,12 @@ void paru_assemble_row_2U
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 bool paru_dtrsm
 (
     int64_t f,
-    double *pF,
-    double *uPart,
+    T *pF,
+    T *uPart,
     int64_t fp,
     int64_t rowCount,
     int64_t colCount,
@@ -899,12 +1207,13 @@ bool paru_dtrsm
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 bool paru_dgemm
 (
     int64_t f,
-    double *pF,
-    double *uPart,
-    double *el,
+    T *pF,
+    T *uPart,
+    T *el,
     int64_t fp,
     int64_t rowCount,
     int64_t colCount,
@@ -952,6 +1261,7 @@ int64_t paru_cumsum
 int64_t paru_bin_srch_col(int64_t *srt_lst, int64_t l, int64_t r, int64_t num);
 int64_t paru_bin_srch(int64_t *srt_lst, int64_t l, int64_t r, int64_t num);
 
+template <typename T>
 ParU_Info paru_init_rowFronts
 (
     // input/output:
@@ -962,6 +1272,30 @@ ParU_Info paru_init_rowFronts
     ParU_Symbolic Sym       // symbolic analysis
 ) ;
 
+template <typename T>
+ParU_Info paru_init_values
+(
+    // input:
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,
+    // input/output:
+    ParU_Numeric Num,
+    // workspace and control:
+    paru_work *Work
+) ;
+
+ParU_Info paru_refactor_map
+(
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+void paru_free_refactor_map
+(
+    ParU_Refactor_map **map_handle
+) ;
+
+template <typename T>
 ParU_Info paru_front
 (
     int64_t f,  // front need to be assembled
@@ -970,6 +1304,7 @@ ParU_Info paru_front
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 ParU_Info paru_pivotal
 (
     std::vector<int64_t> &pivotal_elements,
@@ -985,6 +1320,7 @@ ParU_Info paru_pivotal
 int paru_intersection(int64_t e, paru_element **elementList,
                       std::set<int64_t> &stl_colSet);
 
+template <typename T>
 ParU_Info paru_prior_assemble
 (
     int64_t f,
@@ -997,6 +1333,7 @@ ParU_Info paru_prior_assemble
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_assemble_all
 (
     int64_t e,
@@ -1007,6 +1344,7 @@ void paru_assemble_all
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_assemble_cols
 (
     int64_t e,
@@ -1017,6 +1355,7 @@ void paru_assemble_cols
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_assemble_rows
 (
     int64_t e,
@@ -1027,6 +1366,7 @@ void paru_assemble_rows
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_assemble_el_with0rows
 (
     int64_t e,
@@ -1037,6 +1377,7 @@ void paru_assemble_el_with0rows
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_full_summed
 (
     int64_t e,
@@ -1047,6 +1388,7 @@ void paru_full_summed
 ) ;
 
 // heap related
+template <typename T>
 ParU_Info paru_make_heap
 (
     int64_t f,
@@ -1081,46 +1423,51 @@ ParU_Info paru_finalize_perm
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 void paru_gaxpy
 (
     cholmod_sparse *A,
-    const double *x,
-    double *y,
+    const T *x,
+    T *y,
     double alpha
 ) ;
 
 double paru_spm_1norm(cholmod_sparse *A);
-double paru_vec_1norm(const double *x, int64_t n);
-double paru_matrix_1norm(const double *x, int64_t m, int64_t n);
+template <typename T>
+double paru_vec_1norm(const T *x, int64_t n);
+template <typename T>
+double paru_matrix_1norm(const T *x, int64_t m, int64_t n);
 
 void paru_diag_update(int64_t pivcol, int64_t pivrow, paru_work *Work);
 
+template <typename T>
 bool paru_tasked_dgemm
 (
     int64_t f,
     int64_t M,
     int64_t N,
     int64_t K,
-    double *A,
+    T *A,
     int64_t lda,
-    double *B,
+    T *B,
     int64_t ldb,
     double beta,
-    double *C,
+    T *C,
     int64_t ldc,
     paru_work *Work,
     ParU_Numeric Num
 ) ;
 
+template <typename T>
 bool paru_tasked_dtrsm
 (
     int64_t f,
     int64_t m,
     int64_t n,
     double alpha,
-    double *a,
+    T *a,
     int64_t lda,
-    double *b,
+    T *b,
     int64_t ldb,
     paru_work *Work,
     ParU_Numeric Num
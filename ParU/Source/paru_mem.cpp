@@ -652,10 +652,8 @@ void paru_free_el(int64_t e, paru_element **elementList)
     paru_element *el = elementList[e];
     if (el == NULL) return;
 
-    int64_t nrows = el->nrows, ncols = el->ncols;
-    size_t tot_size = sizeof(paru_element) +
-                      sizeof(int64_t) * (2 * (nrows + ncols)) +
-                      sizeof(double) * nrows * ncols;
+    // real or complex element, as allocated by paru_create_element
+    size_t tot_size = el->size_allocated;
 
     #if defined ( PARU_MALLOC_DEBUG )
     paru_free_debug (1, tot_size, elementList [e], __FILE__, __LINE__) ;
@@ -7,7 +7,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 /*! @brief  computing norms: 1-norm for vectors and sparse matrix
- *  and matrix
+ *  and matrix, with real or complex entries
  *  @author Aznaveh
  */
 #include <algorithm>
@@ -22,6 +22,7 @@ double paru_spm_1norm(cholmod_sparse *A)
     int64_t n = A->ncol;
     int64_t *Ap = static_cast<int64_t*>(A->p);
     double *Ax = static_cast<double*>(A->x);
+    int64_t xsize = (A->xtype == CHOLMOD_COMPLEX) ? 2 : 1;
 
     double norm = 0;
     for (int64_t j = 0; j < n; j++)
@@ -29,8 +30,7 @@ double paru_spm_1norm(cholmod_sparse *A)
         double s = 0;
         for (int64_t p = Ap[j]; p < Ap[j + 1]; p++)
         {
-            PRLEVEL(3, ("Ax[" LD "] = %.2lf\n", p, Ax[p]));
-            s += fabs(Ax[p]);
+            s += paru_entry_abs(Ax, p, xsize);
         }
         PRLEVEL(2, ("s = %le\n", s));
         norm = std::max(norm, s);
@@ -39,21 +39,23 @@ double paru_spm_1norm(cholmod_sparse *A)
     return (norm);
 }
 
-double paru_vec_1norm(const double *x, int64_t n)
+template <typename T>
+double paru_vec_1norm(const T *x, int64_t n)
 {
     DEBUGLEVEL(0);
     double norm = 0.0;
     for (int64_t i = 0; i < n; i++)
     {
-        PRLEVEL(1, ("so far norm = %lf + %lf\n", norm, fabs(x[i])));
-        norm += fabs(x[i]);
+        PRLEVEL(1, ("so far norm = %lf + %lf\n", norm, std::abs(x[i])));
+        norm += std::abs(x[i]);
     }
     PRLEVEL(1, ("vec 1norm = %.8lf\n", norm));
     return (norm);
 }
 
 // 1-norm of an m-by-n dense matrix
-double paru_matrix_1norm(const double *x, int64_t m, int64_t n)
+template <typename T>
+double paru_matrix_1norm(const T *x, int64_t m, int64_t n)
 {
     DEBUGLEVEL(0);
     double norm = 0.0;
@@ -65,3 +67,11 @@ double paru_matrix_1norm(const double *x, int64_t m, int64_t n)
     PRLEVEL(1, ("matrix 1norm = %.8lf\n", norm));
     return (norm);
 }
+
+template double paru_vec_1norm<double>(const double *x, int64_t n);
+template double paru_vec_1norm<std::complex<double>>
+    (const std::complex<double> *x, int64_t n);
+template double paru_matrix_1norm<double>(const double *x, int64_t m,
+    int64_t n);
+template double paru_matrix_1norm<std::complex<double>>
+    (const std::complex<double> *x, int64_t m, int64_t n);
@@ -17,6 +17,7 @@
  */
 #include "paru_internal.hpp"
 
+template <typename T>
 ParU_Info paru_pivotal
 (
     std::vector<int64_t> &pivotal_elements,
@@ -224,9 +225,9 @@ ParU_Info paru_pivotal
                         continue;
                     if (el_colIndex[cEl] >= col2) break;
 
-                    // double *el_Num = numeric_pointer (el);
-                    double *el_Num =
-                        (double *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
+                    // T *el_Num = numeric_pointer<T> (el);
+                    T *el_Num =
+                        (T *)((int64_t *)(el + 1) + 2 * nEl + 2 * mEl);
                     if (el_Num[cEl * mEl + rEl] != 0.0)
                     {
                         nz_found = true;
@@ -378,7 +379,7 @@ ParU_Info paru_pivotal
     }
 
     Num->frowList[f] = frowList ;
-    double *pivotalFront = PARU_CALLOC (rowCount * fp, double);
+    T *pivotalFront = PARU_CALLOC (rowCount * fp, T);
 
     if (pivotalFront == NULL)
     {
@@ -405,7 +406,7 @@ ParU_Info paru_pivotal
     LUs[f].m = rowCount;
     LUs[f].n = fp;
     ASSERT(LUs[f].p == NULL);
-    LUs[f].p = pivotalFront;
+    LUs[f].p = (double *) pivotalFront;
 
     /***************  assembling the pivotal part of the front ****************/
     /*
@@ -432,7 +433,7 @@ ParU_Info paru_pivotal
     int64_t ii = 0;  // using for resizing pivotal_elements
     for (int64_t e : pivotal_elements)
     {
-        paru_full_summed(e, f, Work, Sym, Num);
+        paru_full_summed<T>(e, f, Work, Sym, Num);
         if (elementList[e] != NULL)
         {
             // keeping the element
@@ -544,3 +545,27 @@ ParU_Info paru_pivotal
     PRLEVEL(1, ("%% rowMarkp[" LD "] =" LD "\n", eli, rowMarkp[eli]));
     return PARU_SUCCESS;
 }
+
+template ParU_Info paru_pivotal<double>
+(
+    std::vector<int64_t> &pivotal_elements,
+    std::vector<int64_t> &panel_row,
+    int64_t &zero_piv_rows,
+    int64_t f,
+    heaps_info &hi,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_pivotal<std::complex<double>>
+(
+    std::vector<int64_t> &pivotal_elements,
+    std::vector<int64_t> &panel_row,
+    int64_t &zero_piv_rows,
+    int64_t f,
+    heaps_info &hi,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -13,6 +13,7 @@
 
 #include "paru_internal.hpp"
 
+template <typename T>
 ParU_Info paru_prior_assemble
 (
     int64_t f,
@@ -75,7 +76,7 @@ ParU_Info paru_prior_assemble
                 PRLEVEL(PR, ("%% size " LD " x " LD "\n",
                     el->nrows, el->ncols));
                 #endif
-                paru_assemble_all(e, f, colHash, Work, Sym, Num);
+                paru_assemble_all<T>(e, f, colHash, Work, Sym, Num);
                 #ifndef NDEBUG
                 PRLEVEL(PR, ("%%assembling " LD " in " LD " done\n",
                     e, el_ind));
@@ -86,7 +87,7 @@ ParU_Info paru_prior_assemble
             #ifndef NDEBUG
             PRLEVEL(PR, ("%%assembling " LD " in " LD "\n", e, el_ind));
             #endif
-            paru_assemble_cols(e, f, colHash, Work, Sym, Num);
+            paru_assemble_cols<T>(e, f, colHash, Work, Sym, Num);
             #ifndef NDEBUG
             PRLEVEL(PR, ("%%partial col assembly" LD " in " LD " done\n",
                 e, el_ind));
@@ -113,7 +114,7 @@ ParU_Info paru_prior_assemble
             //          ooooooxxxxx
             //
             {
-                paru_assemble_el_with0rows(e, f, colHash, Work, Sym, Num);
+                paru_assemble_el_with0rows<T>(e, f, colHash, Work, Sym, Num);
                 if (elementList[e] == NULL) continue;
                 #ifndef NDEBUG
                 PRLEVEL(PR, ("%%assembling " LD " in " LD " done\n",
@@ -137,8 +138,8 @@ ParU_Info paru_prior_assemble
      * ******/
     PRLEVEL(1, ("%% Next: work on the heap \n"));
     ParU_Info res_make_heap;
-    res_make_heap = paru_make_heap(f, start_fac, pivotal_elements, hi, colHash,
-                                   Work, Sym, Num);
+    res_make_heap = paru_make_heap<T>(f, start_fac, pivotal_elements, hi,
+                                      colHash, Work, Sym, Num);
     if (res_make_heap != PARU_SUCCESS) return res_make_heap;
     PRLEVEL(1, ("%% Done: work on the heap \n"));
 
@@ -189,3 +190,27 @@ ParU_Info paru_prior_assemble
 #endif
     return PARU_SUCCESS;
 }
+
+template ParU_Info paru_prior_assemble<double>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &pivotal_elements,
+    std::vector<int64_t> &colHash,
+    heaps_info &hi,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+template ParU_Info paru_prior_assemble<std::complex<double>>
+(
+    int64_t f,
+    int64_t start_fac,
+    std::vector<int64_t> &pivotal_elements,
+    std::vector<int64_t> &colHash,
+    heaps_info &hi,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
@@ -0,0 +1,478 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  paru_refactor_map  /////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  Construct the assembly maps used by ParU_Refactor, from the
+ *          frontal structure found by ParU_Factorize.  See the description
+ *          of ParU_Refactor_map in paru_internal.hpp.
+ *
+ *          Returns PARU_SUCCESS if the maps are constructed,
+ *          PARU_OUT_OF_MEMORY, or PARU_INVALID if the frontal structure
+ *          cannot be reused (ParU_Refactor then falls back to
+ *          ParU_Factorize).
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+//------------------------------------------------------------------------------
+// paru_free_refactor_map
+//------------------------------------------------------------------------------
+
+void paru_free_refactor_map
+(
+    ParU_Refactor_map **map_handle
+)
+{
+    if (map_handle == NULL || *map_handle == NULL)
+    {
+        // nothing to do
+        return;
+    }
+    ParU_Refactor_map *map = *map_handle;
+    int64_t nf = map->nf;
+    int64_t snz = map->snz;
+    int64_t npairs = map->npairs;
+    PARU_FREE(snz, int64_t, map->Sfi);
+    PARU_FREE(snz, int64_t, map->Sfo);
+    PARU_FREE(nf + 1, int64_t, map->Sfp);
+    PARU_FREE(nf, int64_t, map->Zr);
+    PARU_FREE(nf, int64_t, map->Zc);
+    PARU_FREE(nf + 1, int64_t, map->CBp);
+    PARU_FREE(npairs, int64_t, map->CBe);
+    PARU_FREE(npairs, int64_t, map->CBk1);
+    PARU_FREE(npairs, int64_t, map->CBk2);
+    PARU_FREE(npairs, int64_t, map->CBr);
+    PARU_FREE(npairs, int64_t, map->CBc);
+    PARU_FREE(map->rsize, int64_t, map->Rmap);
+    PARU_FREE(map->csize, int64_t, map->Cmap);
+    PARU_FREE(nf, int64_t, map->CBlast);
+    PARU_FREE(1, ParU_Refactor_map, map);
+    (*map_handle) = NULL;
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_map
+//------------------------------------------------------------------------------
+
+#define FREE_WORK                                   \
+{                                                   \
+    PARU_FREE (n, int64_t, colfront);               \
+    PARU_FREE (m, int64_t, rowLoc);                 \
+    PARU_FREE (n, int64_t, colLoc);                 \
+    PARU_FREE (nf, int64_t, Mark);                  \
+    PARU_FREE (snz, int64_t, Srow);                 \
+}
+
+#define FREE_ALL_AND_RETURN(info)                   \
+{                                                   \
+    FREE_WORK ;                                     \
+    paru_free_refactor_map (&map) ;                 \
+    return (info) ;                                 \
+}
+
+ParU_Info paru_refactor_map
+(
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+
+    int64_t m = Num->m;
+    int64_t n = Sym->n - Sym->n1;
+    int64_t nf = Sym->nf;
+    int64_t snz = Sym->snz;
+    const int64_t *Super = Sym->Super;
+    const int64_t *first = Sym->first;
+    const int64_t *Sp = Sym->Sp;
+    const int64_t *Sj = Sym->Sj;
+    const int64_t *Ps = Num->Ps;
+    int64_t *frowCount = Num->frowCount;
+    int64_t *fcolCount = Num->fcolCount;
+    int64_t **frowList = Num->frowList;
+    int64_t **fcolList = Num->fcolList;
+
+    if (Num->refactor_map != NULL)
+    {
+        // already computed
+        return (PARU_SUCCESS);
+    }
+
+    // workspace:
+    int64_t *colfront = NULL;   // colfront [c]: front where col c is pivotal
+    int64_t *rowLoc = NULL;     // position of a row in the current front
+    int64_t *colLoc = NULL;     // position of a col in the current front
+    int64_t *Mark = NULL;       // size nf
+    int64_t *Srow = NULL;       // row index of each entry in S
+
+    ParU_Refactor_map *map = PARU_CALLOC(1, ParU_Refactor_map);
+    if (map == NULL)
+    {
+        return (PARU_OUT_OF_MEMORY);
+    }
+    map->nf = nf;
+    map->snz = snz;
+
+    colfront = PARU_MALLOC(n, int64_t);
+    rowLoc = PARU_MALLOC(m, int64_t);
+    colLoc = PARU_MALLOC(n, int64_t);
+    Mark = PARU_MALLOC(nf, int64_t);
+    Srow = PARU_MALLOC(snz, int64_t);
+    map->Sfp = PARU_CALLOC(nf + 1, int64_t);
+    map->CBp = PARU_CALLOC(nf + 1, int64_t);
+    map->CBlast = PARU_MALLOC(nf, int64_t);
+    map->Zr = PARU_MALLOC(nf, int64_t);
+    map->Zc = PARU_MALLOC(nf, int64_t);
+    if (colfront == NULL || rowLoc == NULL || colLoc == NULL || Mark == NULL ||
+        Srow == NULL || map->Sfp == NULL || map->CBp == NULL ||
+        map->CBlast == NULL || map->Zr == NULL || map->Zc == NULL)
+    {
+        FREE_ALL_AND_RETURN(PARU_OUT_OF_MEMORY);
+    }
+
+    for (int64_t f = 0; f < nf; f++)
+    {
+        for (int64_t c = Super[f]; c < Super[f + 1]; c++)
+        {
+            colfront[c] = f;
+        }
+    }
+    for (int64_t i = 0; i < m; i++) rowLoc[i] = -1;
+    for (int64_t j = 0; j < n; j++) colLoc[j] = -1;
+    for (int64_t f = 0; f < nf; f++) Mark[f] = -1;
+
+    // rf(r): front where row r is pivotal
+    #define ROWFRONT(r) (colfront[Ps[r]])
+
+    //--------------------------------------------------------------------------
+    // entries of S: count the entries assembled into each front
+    //--------------------------------------------------------------------------
+
+    int64_t *Sfp = map->Sfp;
+    for (int64_t r = 0; r < m; r++)
+    {
+        int64_t rf = ROWFRONT(r);
+        for (int64_t p = Sp[r]; p < Sp[r + 1]; p++)
+        {
+            Srow[p] = r;
+            int64_t g = std::min(rf, colfront[Sj[p]]);
+            Sfp[g + 1]++;
+        }
+    }
+    paru_cumsum(nf + 1, Sfp, PARU_DEFAULT_MEM_CHUNK, 1);
+    map->Sfi = PARU_MALLOC(snz, int64_t);
+    map->Sfo = PARU_MALLOC(snz, int64_t);
+    if (map->Sfi == NULL || map->Sfo == NULL)
+    {
+        FREE_ALL_AND_RETURN(PARU_OUT_OF_MEMORY);
+    }
+    int64_t *Sfi = map->Sfi;
+    int64_t *Sfo = map->Sfo;
+    {
+        // Mark is used as a temporary copy of Sfp
+        for (int64_t f = 0; f < nf; f++) Mark[f] = Sfp[f];
+        for (int64_t p = 0; p < snz; p++)
+        {
+            int64_t g = std::min(ROWFRONT(Srow[p]), colfront[Sj[p]]);
+            Sfi[Mark[g]++] = p;
+        }
+        for (int64_t f = 0; f < nf; f++) Mark[f] = -1;
+    }
+
+    //--------------------------------------------------------------------------
+    // contribution blocks: find the fronts that assemble each CB
+    //--------------------------------------------------------------------------
+
+    // The CB of front e is assembled into the fronts g that hold one of its
+    // columns as pivotal (if the CB has a row pivotal in g or later), and
+    // into the fronts g that hold one of its rows as pivotal (if the CB has a
+    // column pivotal after g).  Each g must be an ancestor of e.
+
+    std::vector<int64_t> Pe, Pg, Pk1, Pk2, Pr, Pc;
+    int64_t rsize = 0, csize = 0;
+    int64_t *CBlast = map->CBlast;
+    try
+    {
+        std::vector<int64_t> D;
+        for (int64_t e = 0; e < nf; e++)
+        {
+            CBlast[e] = -1;
+            int64_t fp = Super[e + 1] - Super[e];
+            int64_t nR = frowCount[e] - fp;
+            int64_t nC = fcolCount[e];
+            if (nR <= 0 || nC <= 0) continue;
+            const int64_t *R = frowList[e] + fp;
+            const int64_t *C = fcolList[e];
+
+            int64_t maxR = -1;
+            for (int64_t i = 0; i < nR; i++)
+            {
+                maxR = std::max(maxR, ROWFRONT(R[i]));
+            }
+            int64_t maxC = colfront[C[nC - 1]];
+
+            // Mark [g] == e if g is in D, the set of fronts assembling the CB
+            D.clear();
+            for (int64_t k = 0; k < nC; k++)
+            {
+                int64_t g = colfront[C[k]];
+                if (g <= maxR && Mark[g] != e)
+                {
+                    Mark[g] = e;
+                    D.push_back(g);
+                }
+            }
+            for (int64_t i = 0; i < nR; i++)
+            {
+                int64_t g = ROWFRONT(R[i]);
+                if (g < maxC && Mark[g] != e)
+                {
+                    Mark[g] = e;
+                    D.push_back(g);
+                }
+            }
+            std::sort(D.begin(), D.end());
+
+            int64_t k1 = 0;
+            for (int64_t g : D)
+            {
+                if (g <= e || first[g] > e)
+                {
+                    // g is not an ancestor of e
+                    PRLEVEL(1, ("ParU: front " LD " is not an ancestor of "
+                        LD "\n", g, e));
+                    FREE_ALL_AND_RETURN(PARU_INVALID);
+                }
+                // columns C [k1..k2-1] are pivotal in g
+                while (k1 < nC && colfront[C[k1]] < g) k1++;
+                int64_t k2 = k1;
+                while (k2 < nC && colfront[C[k2]] == g) k2++;
+                bool hasrows = false;
+                if (k2 < nC)
+                {
+                    for (int64_t i = 0; i < nR && !hasrows; i++)
+                    {
+                        hasrows = (ROWFRONT(R[i]) == g);
+                    }
+                }
+                Pe.push_back(e);
+                Pg.push_back(g);
+                Pk1.push_back(k1);
+                Pk2.push_back(k2);
+                if (k2 > k1)
+                {
+                    Pr.push_back(rsize);
+                    rsize += nR;
+                }
+                else
+                {
+                    Pr.push_back(-1);
+                }
+                if (hasrows)
+                {
+                    Pc.push_back(csize);
+                    csize += nC - k2;
+                }
+                else
+                {
+                    Pc.push_back(-1);
+                }
+                CBlast[e] = g;
+            }
+        }
+    }
+    catch (std::bad_alloc const &)
+    {
+        // out of memory
+        PRLEVEL(1, ("ParU: Out of memory: refactor map\n"));
+        FREE_ALL_AND_RETURN(PARU_OUT_OF_MEMORY);
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the (e,g) pairs by g
+    //--------------------------------------------------------------------------
+
+    int64_t npairs = (int64_t)Pe.size();
+    map->npairs = npairs;
+    map->CBe = PARU_MALLOC(npairs, int64_t);
+    map->CBk1 = PARU_MALLOC(npairs, int64_t);
+    map->CBk2 = PARU_MALLOC(npairs, int64_t);
+    map->CBr = PARU_MALLOC(npairs, int64_t);
+    map->CBc = PARU_MALLOC(npairs, int64_t);
+    map->rsize = rsize;
+    map->Rmap = PARU_MALLOC(rsize, int64_t);
+    map->csize = csize;
+    map->Cmap = PARU_MALLOC(csize, int64_t);
+    if (map->CBe == NULL || map->CBk1 == NULL || map->CBk2 == NULL ||
+        map->CBr == NULL || map->CBc == NULL || map->Rmap == NULL ||
+        map->Cmap == NULL)
+    {
+        FREE_ALL_AND_RETURN(PARU_OUT_OF_MEMORY);
+    }
+    int64_t *CBp = map->CBp;
+    for (int64_t k = 0; k < npairs; k++) CBp[Pg[k] + 1]++;
+    paru_cumsum(nf + 1, CBp, PARU_DEFAULT_MEM_CHUNK, 1);
+    for (int64_t f = 0; f < nf; f++) Mark[f] = CBp[f];
+    for (int64_t k = 0; k < npairs; k++)
+    {
+        // the pairs of each g remain in increasing order of e
+        int64_t t = Mark[Pg[k]]++;
+        map->CBe[t] = Pe[k];
+        map->CBk1[t] = Pk1[k];
+        map->CBk2[t] = Pk2[k];
+        map->CBr[t] = Pr[k];
+        map->CBc[t] = Pc[k];
+    }
+
+    //--------------------------------------------------------------------------
+    // find the position of each entry of S and each CB in each front
+    //--------------------------------------------------------------------------
+
+    try
+    {
+        std::vector<int64_t> vrows, vcols;
+        for (int64_t g = 0; g < nf; g++)
+        {
+            int64_t rowCount = frowCount[g];
+            int64_t colCount = fcolCount[g];
+            int64_t fp = Super[g + 1] - Super[g];
+            for (int64_t i = 0; i < rowCount; i++) rowLoc[frowList[g][i]] = i;
+            for (int64_t k = 0; k < colCount; k++) colLoc[fcolList[g][k]] = k;
+
+            // find the rows and columns missing from front g: rowLoc [r] and
+            // colLoc [c] become flip of their position in Z
+            vrows.clear();
+            vcols.clear();
+            for (int64_t k = Sfp[g]; k < Sfp[g + 1]; k++)
+            {
+                int64_t p = Sfi[k];
+                int64_t r = Srow[p];
+                int64_t c = Sj[p];
+                if (colfront[c] == g && rowLoc[r] == -1)
+                {
+                    rowLoc[r] = flip((int64_t)vrows.size());
+                    vrows.push_back(r);
+                }
+                else if (colfront[c] != g && colLoc[c] == -1)
+                {
+                    colLoc[c] = flip((int64_t)vcols.size());
+                    vcols.push_back(c);
+                }
+            }
+            for (int64_t t = CBp[g]; t < CBp[g + 1]; t++)
+            {
+                int64_t e = map->CBe[t];
+                int64_t fpe = Super[e + 1] - Super[e];
+                int64_t nR = frowCount[e] - fpe;
+                int64_t nC = fcolCount[e];
+                const int64_t *R = frowList[e] + fpe;
+                const int64_t *C = fcolList[e];
+                if (map->CBr[t] >= 0)
+                {
+                    for (int64_t i = 0; i < nR; i++)
+                    {
+                        int64_t r = R[i];
+                        if (ROWFRONT(r) >= g && rowLoc[r] == -1)
+                        {
+                            rowLoc[r] = flip((int64_t)vrows.size());
+                            vrows.push_back(r);
+                        }
+                    }
+                }
+                if (map->CBc[t] >= 0)
+                {
+                    for (int64_t k = map->CBk2[t]; k < nC; k++)
+                    {
+                        int64_t c = C[k];
+                        if (colLoc[c] == -1)
+                        {
+                            colLoc[c] = flip((int64_t)vcols.size());
+                            vcols.push_back(c);
+                        }
+                    }
+                }
+            }
+            int64_t nvr = (int64_t)vrows.size();
+            map->Zr[g] = nvr;
+            map->Zc[g] = (int64_t)vcols.size();
+
+            // entries of S, in the space [LUs[g].p, Us[g].p, Z]
+            int64_t Zbase = rowCount * fp + fp * colCount;
+            for (int64_t k = Sfp[g]; k < Sfp[g + 1]; k++)
+            {
+                int64_t p = Sfi[k];
+                int64_t r = Srow[p];
+                int64_t c = Sj[p];
+                if (colfront[c] == g)
+                {
+                    // entry goes into the pivotal columns of front g
+                    int64_t j = c - Super[g];
+                    int64_t i = rowLoc[r];
+                    Sfo[k] = (i >= 0) ? (i + j * rowCount) :
+                             (Zbase + flip(i) * fp + j);
+                }
+                else
+                {
+                    // row r is pivotal in g; entry goes into the U part
+                    int64_t i = Ps[r] - Super[g];
+                    int64_t j = colLoc[c];
+                    Sfo[k] = (j >= 0) ? (rowCount * fp + i + j * fp) :
+                             (Zbase + (nvr + flip(j)) * fp + i);
+                }
+            }
+
+            // contribution blocks pulled by g
+            for (int64_t t = CBp[g]; t < CBp[g + 1]; t++)
+            {
+                int64_t e = map->CBe[t];
+                int64_t fpe = Super[e + 1] - Super[e];
+                int64_t nR = frowCount[e] - fpe;
+                int64_t nC = fcolCount[e];
+                const int64_t *R = frowList[e] + fpe;
+                const int64_t *C = fcolList[e];
+                if (map->CBr[t] >= 0)
+                {
+                    int64_t *Rmap = map->Rmap + map->CBr[t];
+                    for (int64_t i = 0; i < nR; i++)
+                    {
+                        int64_t r = R[i];
+                        Rmap[i] = (ROWFRONT(r) < g) ? -1 : rowLoc[r];
+                    }
+                }
+                if (map->CBc[t] >= 0)
+                {
+                    int64_t *Cmap = map->Cmap + map->CBc[t];
+                    int64_t k2 = map->CBk2[t];
+                    for (int64_t k = k2; k < nC; k++)
+                    {
+                        Cmap[k - k2] = colLoc[C[k]];
+                    }
+                }
+            }
+
+            for (int64_t i = 0; i < rowCount; i++) rowLoc[frowList[g][i]] = -1;
+            for (int64_t k = 0; k < colCount; k++) colLoc[fcolList[g][k]] = -1;
+            for (int64_t r : vrows) rowLoc[r] = -1;
+            for (int64_t c : vcols) colLoc[c] = -1;
+        }
+    }
+    catch (std::bad_alloc const &)
+    {
+        // out of memory
+        PRLEVEL(1, ("ParU: Out of memory: refactor map\n"));
+        FREE_ALL_AND_RETURN(PARU_OUT_OF_MEMORY);
+    }
+
+    #undef ROWFRONT
+
+    FREE_WORK;
+    Num->refactor_map = map;
+    return (PARU_SUCCESS);
+}
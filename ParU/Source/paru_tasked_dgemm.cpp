@@ -7,6 +7,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 /*! @brief      a wrapper around BLAS_DGEMM for tasked base dgemmed
+ *              (BLAS_ZGEMM if the entries are complex)
  *
  *
  * @author Aznaveh
@@ -14,18 +15,19 @@
 
 #include "paru_internal.hpp"
 
+template <typename T>
 bool paru_tasked_dgemm
 (
     int64_t f,
     int64_t M,
     int64_t N,
     int64_t K,
-    double *A,
+    T *A,
     int64_t lda,
-    double *B,
+    T *B,
     int64_t ldb,
     double beta,
-    double *C,
+    T *C,
     int64_t ldc,
     paru_work *Work,
     ParU_Numeric Num
@@ -39,7 +41,8 @@ bool paru_tasked_dgemm
 
     DEBUGLEVEL(0);
     // alpha is always -1  in my DGEMMs
-    double alpha = -1;
+    T alpha = -1;
+    T beta_t = beta;
     int64_t naft;
 
     bool blas_ok = true ;
@@ -101,8 +104,8 @@ bool paru_tasked_dgemm
                 "\n", M, N, f));
         }
 #endif
-        SUITESPARSE_BLAS_dgemm("N", "N", M, N, K, &alpha, A, lda, B, ldb, &beta,
-                               C, ldc, blas_ok);
+        blas_ok = paru_blas_gemm("N", "N", M, N, K, &alpha, A, lda, B, ldb,
+                                 &beta_t, C, ldc);
 
     }
     else
@@ -128,8 +131,8 @@ bool paru_tasked_dgemm
                 LD " [[%d]]\n", M, N, f, my_share));
             // using my share of threads
             mkl_set_num_threads_local(my_share);
-            SUITESPARSE_BLAS_dgemm("N", "N", M, N, K, &alpha, A, lda, B, ldb,
-                &beta, C, ldc, blas_ok);
+            blas_ok = paru_blas_gemm("N", "N", M, N, K, &alpha, A, lda, B, ldb,
+                &beta_t, C, ldc);
             mkl_set_num_threads_local(0);
 
         }
@@ -174,13 +177,11 @@ bool paru_tasked_dgemm
                             " in " LD "\n", I, J, m, n, f));
                         #pragma omp task
                         {
-                            bool my_blas_ok = true ;
-                            SUITESPARSE_BLAS_dgemm(
+                            bool my_blas_ok = paru_blas_gemm(
                                 "N", "N", m, n, K, &alpha, A + (I * len_row),
                                 lda,
-                                B + (J * len_col * ldb), ldb, &beta,
-                                C + (J * ldc * len_col + I * len_row), ldc,
-                                my_blas_ok);
+                                B + (J * len_col * ldb), ldb, &beta_t,
+                                C + (J * ldc * len_col + I * len_row), ldc);
                             if (!my_blas_ok)
                             {
                                 #pragma omp atomic write
@@ -207,3 +208,37 @@ bool paru_tasked_dgemm
 #endif
     return (blas_ok) ;
 }
+
+template bool paru_tasked_dgemm<double>
+(
+    int64_t f,
+    int64_t M,
+    int64_t N,
+    int64_t K,
+    double *A,
+    int64_t lda,
+    double *B,
+    int64_t ldb,
+    double beta,
+    double *C,
+    int64_t ldc,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
+
+template bool paru_tasked_dgemm<std::complex<double>>
+(
+    int64_t f,
+    int64_t M,
+    int64_t N,
+    int64_t K,
+    std::complex<double> *A,
+    int64_t lda,
+    std::complex<double> *B,
+    int64_t ldb,
+    double beta,
+    std::complex<double> *C,
+    int64_t ldc,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
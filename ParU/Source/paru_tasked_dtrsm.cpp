@@ -14,15 +14,16 @@
 
 #include "paru_internal.hpp"
 
+template <typename T>
 bool paru_tasked_dtrsm
 (
     int64_t f,
     int64_t m,
     int64_t n,
     double alpha,
-    double *a,
+    T *a,
     int64_t lda,
-    double *b,
+    T *b,
     int64_t ldb,
     paru_work *Work,
     ParU_Numeric Num
@@ -35,6 +36,7 @@ bool paru_tasked_dtrsm
 
     DEBUGLEVEL(0);
     int64_t naft;
+    T alpha_t = alpha;
 
     bool blas_ok = true ;
 #ifdef PARU_COVERAGE
@@ -57,8 +59,8 @@ bool paru_tasked_dtrsm
         if (naft == 1)
             PRLEVEL(1, ("%% All threads for trsm(" LD "x" LD ") in " LD "\n", m, n, f));
 #endif
-        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", m, n, &alpha, a, lda, b, ldb,
-                               blas_ok);
+        blas_ok = paru_blas_trsm("L", "L", "N", "U", m, n, &alpha_t, a, lda,
+                                 b, ldb);
     }
     else
     {
@@ -68,8 +70,8 @@ bool paru_tasked_dtrsm
         PRLEVEL(1, ("%% MKL local threads for trsm(" LD "x" LD ") in " LD " [[%d]]\n", m,
                     n, f, my_share));
         mkl_set_num_threads_local(my_share);
-        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", m, n, &alpha, a, lda, b, ldb,
-                               blas_ok);
+        blas_ok = paru_blas_trsm("L", "L", "N", "U", m, n, &alpha_t, a, lda,
+                                 b, ldb);
 
         mkl_set_num_threads_local(0);
 #else
@@ -86,10 +88,9 @@ bool paru_tasked_dtrsm
                 PRLEVEL(1, ("%%  n_b= " LD "\n", n_b));
                 #pragma omp task
                 {
-                    bool my_blas_ok = true ;
-                    SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", m, n_b, &alpha,
-                                           a, lda, (b + J * len_bloc * ldb),
-                                           ldb, my_blas_ok);
+                    bool my_blas_ok = paru_blas_trsm("L", "L", "N", "U", m,
+                                           n_b, &alpha_t, a, lda,
+                                           (b + J * len_bloc * ldb), ldb);
                     if (!my_blas_ok)
                     {
                         #pragma omp atomic write
@@ -107,3 +108,31 @@ bool paru_tasked_dtrsm
 #endif
     return blas_ok;
 }
+
+template bool paru_tasked_dtrsm<double>
+(
+    int64_t f,
+    int64_t m,
+    int64_t n,
+    double alpha,
+    double *a,
+    int64_t lda,
+    double *b,
+    int64_t ldb,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
+
+template bool paru_tasked_dtrsm<std::complex<double>>
+(
+    int64_t f,
+    int64_t m,
+    int64_t n,
+    double alpha,
+    std::complex<double> *a,
+    int64_t lda,
+    std::complex<double> *b,
+    int64_t ldb,
+    paru_work *Work,
+    ParU_Numeric Num
+) ;
@@ -0,0 +1,198 @@
+// ==========================================================================  /
+// =======================  paru_complex_test.cpp  ==========================  /
+// ==========================================================================  /
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * @brief    coverage test of complex matrices.  A real input matrix is
+ *           converted to a complex one with the same pattern.
+ *
+ * @author Aznaveh
+ * */
+#include <math.h>
+
+#include "paru_cov.hpp"
+
+#define TEST_FREE_ALL                                   \
+{                                                       \
+    ParU_FreeNumeric(&Num, Control);                    \
+    ParU_FreeSymbolic(&Sym, Control);                   \
+    ParU_FreeControl(&Control);                         \
+    cholmod_l_free_sparse(&A, cc);                      \
+    cholmod_l_finish(cc);                               \
+    if (B  != NULL) { free(B);  B  = NULL; }            \
+    if (X  != NULL) { free(X);  X  = NULL; }            \
+    if (b  != NULL) { free(b);  b  = NULL; }            \
+    if (xx != NULL) { free(xx); xx = NULL; }            \
+    if (xr != NULL) { free(xr); xr = NULL; }            \
+}
+
+int main(int argc, char **argv)
+{
+    cholmod_common Common, *cc;
+    cholmod_sparse *A;
+    ParU_Symbolic Sym = NULL;
+    ParU_Numeric Num = NULL ;
+    ParU_Control Control = NULL ;
+    std::complex<double> *b = NULL, *B = NULL, *X = NULL, *xx = NULL ;
+    double *xr = NULL ;
+    double resid = 0, anorm = 0, xnorm = 0 ;
+    ParU_Info info;
+
+    // default log10 of expected residual.  +1 means failure is expected
+    double expected_log10_resid = -12 ;
+    if (argc > 1)
+    {
+        expected_log10_resid = (double) atoi (argv [1]) ;
+    }
+
+    //~~~~~~~~~Reading the input matrix and test if the format is OK~~~~~~~~~~~~
+    // start CHOLMOD
+    cc = &Common;
+    int mtype = -1 ;
+    cholmod_l_start(cc);
+
+    info = ParU_InitControl (&Control) ;
+    TEST_ASSERT (info == PARU_SUCCESS) ;
+    ParU_Set (PARU_CONTROL_MEM_CHUNK, 1024, Control) ;
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 4, Control) ;
+
+    // read in the sparse matrix A
+    A = (cholmod_sparse *)cholmod_l_read_matrix(stdin, 1, &mtype, cc);
+    TEST_ASSERT (A != NULL && mtype == CHOLMOD_SPARSE) ;
+    int64_t n = A->nrow ;
+
+    if (A->xtype != CHOLMOD_COMPLEX)
+    {
+        // make A complex, with the same pattern: A = A + 1i*(A.*D)
+        int ok = cholmod_l_sparse_xtype (CHOLMOD_COMPLEX + CHOLMOD_DOUBLE, A,
+            cc) ;
+        TEST_ASSERT (ok) ;
+        double *Ax = static_cast<double *>(A->x) ;
+        int64_t anz = cholmod_l_nnz (A, cc) ;
+        for (int64_t p = 0 ; p < anz ; p++)
+        {
+            Ax [2*p+1] = Ax [2*p] * ((double) (p % 5) - 2) / 4 ;
+        }
+    }
+    TEST_ASSERT (A->xtype == CHOLMOD_COMPLEX) ;
+
+    //~~~~~~~~~~~~~~~~~~~Starting computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Analyze(A, &Sym, Control);
+    if (info != PARU_SUCCESS)
+    {
+        TEST_ASSERT (expected_log10_resid == 102) ;
+        TEST_PASSES ;
+    }
+
+    info = ParU_Factorize(A, Sym, &Num, Control);
+    if (info != PARU_SUCCESS)
+    {
+        // matrix is singular
+        TEST_ASSERT (expected_log10_resid == 104) ;
+        TEST_ASSERT_INFO (info == PARU_SINGULAR, info) ;
+        printf ("matrix is numerically singular (expected result)\n") ;
+        TEST_PASSES ;
+    }
+
+    double rcond = -1 ;
+    info = ParU_Get (Sym, Num, PARU_GET_RCOND_ESTIMATE, &rcond, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (rcond >= 0) ;
+
+    //~~~~~~~~~~~~~~~~~~~Single right-hand side~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    b = (std::complex<double> *) malloc (n * sizeof (std::complex<double>)) ;
+    xx = (std::complex<double> *) malloc (n * sizeof (std::complex<double>)) ;
+    xr = (double *) malloc (n * sizeof (double)) ;
+    TEST_ASSERT (b != NULL && xx != NULL && xr != NULL) ;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        b [i] = std::complex<double> (i + 1, (double) (i % 3) - 1) ;
+        xr [i] = i + 1 ;
+    }
+
+    // a complex factorization cannot be used with real vectors
+    info = ParU_Solve(Sym, Num, xr, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_LSolve(Sym, Num, xr, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_USolve(Sym, Num, xr, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Residual(A, xr, xr, resid, anorm, xnorm, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Solve(Sym, Num, b, xx, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    info = ParU_Residual(A, xx, b, resid, anorm, xnorm, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("Complex residual is |%.2e|, anorm is %.2e, xnorm is %.2e "
+            "and rcond is %.2e.\n", resid, anorm, xnorm, rcond);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    // refactorize, reusing the pivot sequence and frontal structure
+    info = ParU_Refactor(A, Sym, &Num, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    // x = A\x, in place
+    for (int64_t i = 0; i < n; ++i)
+    {
+        xx [i] = b [i] ;
+    }
+    info = ParU_Solve(Sym, Num, xx, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    info = ParU_Residual(A, xx, b, resid, anorm, xnorm, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("Complex refactor residual is |%.2e|\n", resid);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    //~~~~~~~~~~~~~~~~~~~Multiple right-hand sides~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    const int64_t nrhs = 4 ;
+    B = (std::complex<double> *)
+        malloc (n * nrhs * sizeof (std::complex<double>)) ;
+    X = (std::complex<double> *)
+        malloc (n * nrhs * sizeof (std::complex<double>)) ;
+    TEST_ASSERT (B != NULL && X != NULL) ;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        for (int64_t j = 0; j < nrhs; ++j)
+        {
+            B [j * n + i] = std::complex<double> (i + j + 1, j - i) ;
+        }
+    }
+
+    info = ParU_Solve(Sym, Num, nrhs, xr, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Solve(Sym, Num, nrhs, B, X, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    info = ParU_Residual(A, X, B, nrhs, resid, anorm, xnorm, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("Complex mRhs residual is |%.2e|\n", resid);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    // solve again, overwriting B with solution X
+    info = ParU_Solve(Sym, Num, nrhs, B, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    double err = 0 ;
+    for (int64_t i = 0 ; i < n*nrhs ; i++)
+    {
+        err += std::abs (B [i] - X [i]) ;
+    }
+    err = err / xnorm ;
+    TEST_ASSERT (err < 1e-10) ;
+
+    //~~~~~~~~~~~~~~~~~~~End computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    TEST_PASSES ;
+}
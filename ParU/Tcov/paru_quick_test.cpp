@@ -326,7 +326,7 @@ int main(int argc, char **argv)
     info = ParU_LSolve(Sym, NULL, b, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
-    info = ParU_LSolve(Sym, Num, NULL, Control);
+    info = ParU_LSolve(Sym, Num, (double *) NULL, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
     info = ParU_USolve(NULL, Num, b, Control);
@@ -335,7 +335,7 @@ int main(int argc, char **argv)
     info = ParU_USolve(Sym, NULL, b, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
-    info = ParU_USolve(Sym, Num, NULL, Control);
+    info = ParU_USolve(Sym, Num, (double *) NULL, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
     info = ParU_Perm (NULL, R, b, n, xx, Control);
@@ -393,7 +393,7 @@ int main(int argc, char **argv)
     info = ParU_Solve(Sym, NULL, b, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
-    info = ParU_Solve(Sym, Num, NULL, Control);
+    info = ParU_Solve(Sym, Num, (double *) NULL, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
     info = ParU_Solve(Sym, Num, b, xx, Control);
@@ -423,6 +423,74 @@ int main(int argc, char **argv)
             "and rcond is %.2e.\n", resid, anorm, xnorm, rcond);
     TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
 
+    // refactorize, reusing the pivot sequence and frontal structure
+    info = ParU_Refactor(nullptr, Sym, &Num, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactor(A, nullptr, &Num, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactor(A, Sym, nullptr, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactor(A, Sym, &Num, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    // refactorize again, with the assembly maps already in place
+    info = ParU_Refactor(A, Sym, &Num, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    // the assembly maps are kept only if ParU_Refactor did not fall back to
+    // ParU_Factorize
+    TEST_ASSERT (Num->refactor_map != NULL) ;
+
+    // with a pivot tolerance of 1, each pivot is the largest entry in its
+    // column, and refactorizing the same matrix must accept it.  A small
+    // dense matrix is used, so that the factorization and the refactorization
+    // compute the pivot columns with the same roundoff.
+    {
+        cholmod_sparse *D = cholmod_l_allocate_sparse (4, 4, 16, true, true,
+            0, CHOLMOD_REAL, cc) ;
+        TEST_ASSERT (D != NULL) ;
+        int64_t *Dp = (int64_t *) D->p ;
+        int64_t *Di = (int64_t *) D->i ;
+        double *Dx = (double *) D->x ;
+        const double Dval [16] = { 2, 8, 1, 3,   7, 1, 3, 1,
+                                   1, 2, 9, 4,   3, 1, 2, 6 } ;
+        for (int64_t k = 0 ; k < 16 ; k++)
+        {
+            Di [k] = k % 4 ;
+            Dx [k] = Dval [k] ;
+        }
+        for (int64_t j = 0 ; j <= 4 ; j++) Dp [j] = 4 * j ;
+        ParU_Symbolic DSym = NULL ;
+        ParU_Numeric DNum = NULL ;
+        ParU_Set (PARU_CONTROL_PIVOT_TOLERANCE, 1.0, Control) ;
+        ParU_Set (PARU_CONTROL_DIAG_PIVOT_TOLERANCE, 1.0, Control) ;
+        info = ParU_Analyze (D, &DSym, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Factorize (D, DSym, &DNum, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Refactor (D, DSym, &DNum, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (DNum->refactor_map != NULL) ;
+        ParU_Set (PARU_CONTROL_PIVOT_TOLERANCE,
+            PARU_DEFAULT_PIVOT_TOLERANCE, Control) ;
+        ParU_Set (PARU_CONTROL_DIAG_PIVOT_TOLERANCE,
+            PARU_DEFAULT_DIAG_PIVOT_TOLERANCE, Control) ;
+        ParU_FreeNumeric (&DNum, Control) ;
+        ParU_FreeSymbolic (&DSym, Control) ;
+        cholmod_l_free_sparse (&D, cc) ;
+    }
+
+    info = ParU_Solve(Sym, Num, b, xx, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    info = ParU_Residual(A, xx, b, resid, anorm, xnorm, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("Refactor residual is |%.2e|\n", resid);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
     for (int64_t i = 0; i < n; ++i)
     {
         b[i] = i + 1;
@@ -457,7 +525,7 @@ int main(int argc, char **argv)
     info = ParU_LSolve(Sym, NULL, nrhs, X, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
-    info = ParU_LSolve(Sym, Num, nrhs, NULL, Control);
+    info = ParU_LSolve(Sym, Num, nrhs, (double *) NULL, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
     info = ParU_USolve(NULL, Num, nrhs, X, Control);
@@ -466,7 +534,7 @@ int main(int argc, char **argv)
     info = ParU_USolve(Sym, NULL, nrhs, X, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
-    info = ParU_USolve(Sym, Num, nrhs, NULL, Control);
+    info = ParU_USolve(Sym, Num, nrhs, (double *) NULL, Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
 
     info = ParU_Perm (NULL, R, B, n, nrhs, X, Control);
@@ -0,0 +1,455 @@
+// ==========================================================================  /
+// =======================  paru_serialize_test.cpp  ========================  /
+// ==========================================================================  /
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * @brief    test the serialization of the Symbolic and Numeric objects.  The
+ *           solution from the deserialized objects must match the original
+ *           solution exactly.
+ *
+ * @author Aznaveh
+ * */
+#include <math.h>
+
+#include "paru_cov.hpp"
+
+#define TEST_FREE_ALL                                   \
+{                                                       \
+    ParU_FreeNumeric(&Num, Control);                    \
+    ParU_FreeSymbolic(&Sym, Control);                   \
+    ParU_FreeNumeric(&Num2, Control);                   \
+    ParU_FreeSymbolic(&Sym2, Control);                  \
+    ParU_C_FreeNumeric(&Num_C, Control_C);              \
+    ParU_C_FreeNumeric(&Num_C2, Control_C);             \
+    ParU_C_FreeSymbolic(&Sym_C, Control_C);             \
+    ParU_C_FreeControl(&Control_C);                     \
+    ParU_FreeControl(&Control);                         \
+    cholmod_l_free_sparse(&A, cc);                      \
+    cholmod_l_finish(cc);                               \
+    if (b  != NULL) { free(b);  b  = NULL; }            \
+    if (x1 != NULL) { free(x1); x1 = NULL; }            \
+    if (x2 != NULL) { free(x2); x2 = NULL; }            \
+    if (sblob != NULL) { free(sblob); sblob = NULL; }   \
+    if (nblob != NULL) { free(nblob); nblob = NULL; }   \
+}
+
+int main(int argc, char **argv)
+{
+    cholmod_common Common, *cc;
+    cholmod_sparse *A = NULL;
+    ParU_Symbolic Sym = NULL, Sym2 = NULL ;
+    ParU_Numeric Num = NULL, Num2 = NULL ;
+    ParU_Control Control = NULL ;
+    ParU_C_Symbolic Sym_C = NULL ;
+    ParU_C_Numeric Num_C = NULL, Num_C2 = NULL ;
+    ParU_C_Control Control_C = NULL ;
+    double *b = NULL, *x1 = NULL, *x2 = NULL ;
+    int8_t *sblob = NULL, *nblob = NULL ;
+    int64_t ssize = 0, nsize = 0 ;
+    ParU_Info info;
+
+    // default log10 of expected residual.  +1 means failure is expected
+    double expected_log10_resid = -12 ;
+    if (argc > 1)
+    {
+        expected_log10_resid = (double) atoi (argv [1]) ;
+    }
+
+    //~~~~~~~~~Reading the input matrix and test if the format is OK~~~~~~~~~~~~
+    // start CHOLMOD
+    cc = &Common;
+    int mtype = -1 ;
+    cholmod_l_start(cc);
+
+    info = ParU_InitControl (&Control) ;
+    TEST_ASSERT (info == PARU_SUCCESS) ;
+
+    // read in the sparse matrix A
+    A = (cholmod_sparse *)cholmod_l_read_matrix(stdin, 1, &mtype, cc);
+    TEST_ASSERT (A != NULL && mtype == CHOLMOD_SPARSE) ;
+    int64_t n = A->nrow ;
+
+    //~~~~~~~~~~~~~~~~~~~Starting computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Analyze(A, &Sym, Control);
+    if (info != PARU_SUCCESS)
+    {
+        TEST_ASSERT (expected_log10_resid == 102) ;
+        TEST_PASSES ;
+    }
+
+    info = ParU_Factorize(A, Sym, &Num, Control);
+    if (info != PARU_SUCCESS)
+    {
+        // matrix is singular
+        TEST_ASSERT (expected_log10_resid == 104) ;
+        TEST_ASSERT_INFO (info == PARU_SINGULAR, info) ;
+        printf ("matrix is numerically singular (expected result)\n") ;
+        TEST_PASSES ;
+    }
+
+    int xsize = (A->xtype == CHOLMOD_COMPLEX) ? 2 : 1 ;
+    b  = (double *) calloc (xsize * n, sizeof (double)) ;
+    x1 = (double *) calloc (xsize * n, sizeof (double)) ;
+    x2 = (double *) calloc (xsize * n, sizeof (double)) ;
+    TEST_ASSERT (b != NULL && x1 != NULL && x2 != NULL) ;
+    for (int64_t i = 0; i < xsize * n; ++i)
+    {
+        b [i] = i + 1 ;
+    }
+
+    #define TRY_SOLVE(Sym,Num,x)                                            \
+    {                                                                       \
+        if (xsize == 2)                                                     \
+        {                                                                   \
+            info = ParU_Solve (Sym, Num, (std::complex<double> *) b,        \
+                (std::complex<double> *) x, Control) ;                      \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            info = ParU_Solve (Sym, Num, b, x, Control) ;                   \
+        }                                                                   \
+    }
+
+    #define SOLVE(Sym,Num,x)                                                \
+    {                                                                       \
+        TRY_SOLVE (Sym, Num, x) ;                                           \
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;                     \
+    }
+
+    #define CHECK_SAME(x)                                                   \
+    {                                                                       \
+        for (int64_t i = 0; i < xsize * n; ++i)                             \
+        {                                                                   \
+            TEST_ASSERT (x [i] == x1 [i]) ;                                 \
+        }                                                                   \
+    }
+
+    SOLVE (Sym, Num, x1) ;
+
+    //~~~~~~~~~~~~~~~~~~~Serialize the objects~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Serialize_Symbolic_Size (Sym, &ssize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Serialize_Numeric_Size (Num, &nsize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    printf ("Symbolic blob: %ld bytes, Numeric blob: %ld bytes\n",
+        ssize, nsize) ;
+    sblob = (int8_t *) malloc (ssize) ;
+    nblob = (int8_t *) malloc (nsize) ;
+    TEST_ASSERT (sblob != NULL && nblob != NULL) ;
+
+    // invalid inputs
+    info = ParU_Serialize_Symbolic_Size (NULL, &ssize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize_Numeric_Size (Num, NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize_Symbolic (Sym, sblob, ssize-1, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize_Numeric (Num, NULL, nsize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Serialize_Symbolic (Sym, sblob, ssize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Serialize_Numeric (Num, nblob, nsize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    //~~~~~~~~~~~~~~~~~~~Deserialize, with copies~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    BRUTAL_ALLOC_TEST (info,
+        ParU_Deserialize_Symbolic (sblob, ssize, true, &Sym2, Control)) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    BRUTAL_ALLOC_TEST (info,
+        ParU_Deserialize_Numeric (nblob, nsize, true, &Num2, Control)) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    SOLVE (Sym2, Num2, x2) ;
+    CHECK_SAME (x2) ;
+
+    // a deserialized object has the same size when serialized again
+    int64_t s2, n2 ;
+    info = ParU_Serialize_Symbolic_Size (Sym2, &s2, Control) ;
+    TEST_ASSERT (info == PARU_SUCCESS && s2 == ssize) ;
+    info = ParU_Serialize_Numeric_Size (Num2, &n2, Control) ;
+    TEST_ASSERT (info == PARU_SUCCESS && n2 == nsize) ;
+
+    // the copies are independent of the blobs
+    memset (sblob + sizeof (ParU_Blob_header) + sizeof (ParU_Symbolic_struct),
+        0, ssize - sizeof (ParU_Blob_header) - sizeof (ParU_Symbolic_struct)) ;
+    memset (nblob + sizeof (ParU_Blob_header) + sizeof (ParU_Numeric_struct),
+        0, nsize - sizeof (ParU_Blob_header) - sizeof (ParU_Numeric_struct)) ;
+    SOLVE (Sym2, Num2, x2) ;
+    CHECK_SAME (x2) ;
+    info = ParU_Serialize_Symbolic (Sym2, sblob, ssize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Serialize_Numeric (Num2, nblob, nsize, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    ParU_FreeNumeric(&Num2, Control);
+    ParU_FreeSymbolic(&Sym2, Control);
+
+    //~~~~~~~~~~~~~~~~~~~Deserialize, in place~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Deserialize_Symbolic (sblob, ssize, false, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Deserialize_Numeric (nblob, nsize, false, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (Sym2->shallow && Num2->shallow) ;
+    SOLVE (Sym2, Num2, x2) ;
+    CHECK_SAME (x2) ;
+
+    double rcond1, rcond2 ;
+    info = ParU_Get (Sym, Num, PARU_GET_RCOND_ESTIMATE, &rcond1, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Get (Sym2, Num2, PARU_GET_RCOND_ESTIMATE, &rcond2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (rcond1 == rcond2) ;
+
+    // a shallow Numeric object is refactorized with ParU_Factorize
+    info = ParU_Refactor (A, Sym2, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (!Num2->shallow) ;
+    SOLVE (Sym2, Num2, x2) ;
+    ParU_FreeNumeric(&Num2, Control);
+    ParU_FreeSymbolic(&Sym2, Control);
+
+    //~~~~~~~~~~~~~~~~~~~Invalid blobs~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Deserialize_Symbolic (sblob, ssize, true, NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize_Symbolic (NULL, ssize, true, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+    // wrong kind of blob
+    info = ParU_Deserialize_Symbolic (nblob, nsize, true, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+    info = ParU_Deserialize_Numeric (sblob, ssize, false, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+    // misaligned blob cannot be used in place
+    info = ParU_Deserialize_Numeric (nblob + 1, nsize - 1, false, &Num2,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+    // truncated blobs, with and without a consistent header
+    ParU_Blob_header *sheader = (ParU_Blob_header *) sblob ;
+    ParU_Blob_header *nheader = (ParU_Blob_header *) nblob ;
+    for (int64_t k = 1 ; k <= 7 ; k++)
+    {
+        int64_t size = (k * ssize) / 8 ;
+        info = ParU_Deserialize_Symbolic (sblob, size, true, &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+        sheader->blobsize = size ;
+        info = ParU_Deserialize_Symbolic (sblob, size, true, &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+        info = ParU_Deserialize_Symbolic (sblob, size, false, &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+        sheader->blobsize = ssize ;
+
+        size = (k * nsize) / 8 ;
+        info = ParU_Deserialize_Numeric (nblob, size, true, &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+        nheader->blobsize = size ;
+        info = ParU_Deserialize_Numeric (nblob, size, true, &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+        info = ParU_Deserialize_Numeric (nblob, size, false, &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+        nheader->blobsize = nsize ;
+    }
+    // blob from another version of the format
+    nheader->blob_version++ ;
+    info = ParU_Deserialize_Numeric (nblob, nsize, true, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+    nheader->blob_version-- ;
+
+    //~~~~~~~~~~~~~~~~~~~Invalid contents~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Each array in a blob is held as its count followed by its entries.
+    // blob_array (blob, offset, k) returns the offset of the kth array after
+    // the given offset, and ENTRY (blob, offset, i) is its ith entry.
+    #define ENTRY(blob,offset,i) \
+        (((int64_t *) (blob + offset + sizeof (int64_t))) [i])
+    auto blob_array = [] (const int8_t *blob, int64_t offset, int64_t k)
+    {
+        for ( ; k > 0 ; k--)
+        {
+            int64_t count ;
+            memcpy (&count, blob + offset, sizeof (int64_t)) ;
+            offset += (1 + std::max (count, (int64_t) 0)) * sizeof (int64_t) ;
+        }
+        return (offset) ;
+    } ;
+
+    // change the entry, check that the blob is rejected, and restore it
+    #define BAD_BLOB(Deserialize,blob,blobsize,Object,offset,i,x)           \
+    {                                                                       \
+        int64_t save = ENTRY (blob, offset, i) ;                            \
+        ENTRY (blob, offset, i) = (x) ;                                     \
+        info = Deserialize (blob, blobsize, true, &Object, Control) ;       \
+        TEST_ASSERT_INFO (info == PARU_INVALID && Object == NULL, info) ;   \
+        ENTRY (blob, offset, i) = save ;                                    \
+    }
+    #define BAD_SYMBOLIC(offset,i,x) \
+        BAD_BLOB (ParU_Deserialize_Symbolic, sblob, ssize, Sym2, offset, i, x)
+    #define BAD_NUMERIC(offset,i,x) \
+        BAD_BLOB (ParU_Deserialize_Numeric, nblob, nsize, Num2, offset, i, x)
+
+    // arrays of the Symbolic object, in the order they are serialized
+    int64_t nf = Sym->nf ;
+    int64_t ns = Sym->n - Sym->n1 ;
+    int64_t s0 = sizeof (ParU_Blob_header) + sizeof (ParU_Symbolic_struct) ;
+    int64_t Sj_offset = blob_array (sblob, s0, 1) ;
+    int64_t Pinit_offset = blob_array (sblob, s0, 7) ;
+    int64_t Pinv_offset = blob_array (sblob, s0, 8) ;
+    int64_t Childp_offset = blob_array (sblob, s0, 13) ;
+    int64_t Super_offset = blob_array (sblob, s0, 21) ;
+    if (n > 1)
+    {
+        // Pinit is not a permutation
+        BAD_SYMBOLIC (Pinit_offset, 0, ENTRY (sblob, Pinit_offset, 1)) ;
+        BAD_SYMBOLIC (Pinit_offset, 0, n) ;
+        // Pinv is not the inverse of Pinit
+        int64_t i = ENTRY (sblob, Pinit_offset, 0) ;
+        BAD_SYMBOLIC (Pinv_offset, i, 1) ;
+    }
+    if (Sym->snz > 0)
+    {
+        // column index out of range
+        BAD_SYMBOLIC (Sj_offset, 0, ns) ;
+    }
+    if (nf > 0)
+    {
+        // a front with no pivot columns, and Super not ending at ns
+        BAD_SYMBOLIC (Super_offset, 1, 0) ;
+        BAD_SYMBOLIC (Super_offset, nf, ns - 1) ;
+        // Childp not monotonic
+        BAD_SYMBOLIC (Childp_offset, nf + 1, -1) ;
+    }
+
+    // arrays of the Numeric object; the row and column lists of the fronts
+    // follow the first 8 arrays and two scalars
+    int64_t ms = Num->m ;
+    int64_t n0 = sizeof (ParU_Blob_header) + sizeof (ParU_Numeric_struct) ;
+    int64_t Ps_offset = blob_array (nblob, n0, 1) ;
+    int64_t Pfin_offset = blob_array (nblob, n0, 2) ;
+    int64_t frowCount_offset = blob_array (nblob, n0, 6) ;
+    int64_t frowList_offset = blob_array (nblob, n0, 8) + 2 * sizeof (int64_t) ;
+    int64_t fcolList_offset = blob_array (nblob, frowList_offset, 1) ;
+    if (n > 1)
+    {
+        // Pfin is not a permutation
+        BAD_NUMERIC (Pfin_offset, 0, ENTRY (nblob, Pfin_offset, 1)) ;
+    }
+    if (ms > 0)
+    {
+        BAD_NUMERIC (Ps_offset, 0, -1) ;
+    }
+    if (nf > 0)
+    {
+        // too many rows in the first front
+        BAD_NUMERIC (frowCount_offset, 0, Num->max_row_count + 1) ;
+        // row and column indices out of range
+        if (Num->frowCount [0] > 0)
+        {
+            BAD_NUMERIC (frowList_offset, 0, ms) ;
+        }
+        if (Num->fcolCount [0] > 0)
+        {
+            BAD_NUMERIC (fcolList_offset, 0, -1) ;
+        }
+    }
+
+    // arrays that every object has cannot be NULL
+    {
+        int64_t *Pinit = Sym->Pinit ;
+        Sym->Pinit = NULL ;
+        int64_t s3 ;
+        info = ParU_Serialize_Symbolic_Size (Sym, &s3, Control) ;
+        TEST_ASSERT (info == PARU_SUCCESS && s3 < ssize) ;
+        info = ParU_Serialize_Symbolic (Sym, sblob, s3, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        Sym->Pinit = Pinit ;
+        info = ParU_Deserialize_Symbolic (sblob, s3, true, &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Sym2 == NULL, info) ;
+        info = ParU_Serialize_Symbolic (Sym, sblob, ssize, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+        int64_t *Pfin = Num->Pfin ;
+        Num->Pfin = NULL ;
+        int64_t n3 ;
+        info = ParU_Serialize_Numeric_Size (Num, &n3, Control) ;
+        TEST_ASSERT (info == PARU_SUCCESS && n3 < nsize) ;
+        info = ParU_Serialize_Numeric (Num, nblob, n3, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        Num->Pfin = Pfin ;
+        info = ParU_Deserialize_Numeric (nblob, n3, true, &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Num2 == NULL, info) ;
+        info = ParU_Serialize_Numeric (Num, nblob, nsize, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    }
+
+    // the blobs are valid again
+    info = ParU_Deserialize_Symbolic (sblob, ssize, true, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Deserialize_Numeric (nblob, nsize, true, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    SOLVE (Sym2, Num2, x2) ;
+    CHECK_SAME (x2) ;
+
+    // a Numeric object that does not match the Symbolic object
+    Num2->sym_m++ ;
+    TRY_SOLVE (Sym2, Num2, x2) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    Num2->sym_m-- ;
+    Num2->nf++ ;
+    TRY_SOLVE (Sym2, Num2, x2) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Refactor (A, Sym2, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    if (xsize == 1)
+    {
+        info = ParU_LSolve (Sym2, Num2, x2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        info = ParU_USolve (Sym2, Num2, x2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    }
+    Num2->nf-- ;
+    if (nf > 0)
+    {
+        // the first front has the wrong number of pivots
+        Num2->partial_LUs [0].n++ ;
+        TRY_SOLVE (Sym2, Num2, x2) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        Num2->partial_LUs [0].n-- ;
+    }
+    SOLVE (Sym2, Num2, x2) ;
+    CHECK_SAME (x2) ;
+    ParU_FreeNumeric(&Num2, Control);
+    ParU_FreeSymbolic(&Sym2, Control);
+
+    //~~~~~~~~~~~~~~~~~~~C interface~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    if (xsize == 1)
+    {
+        info = ParU_C_InitControl (&Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_C_Deserialize_Symbolic (sblob, ssize, false, &Sym_C,
+            Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_C_Deserialize_Numeric (nblob, nsize, true, &Num_C,
+            Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_C_Solve_Axb (Sym_C, Num_C, b, x2, Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        CHECK_SAME (x2) ;
+        info = ParU_C_Serialize_Symbolic_Size (Sym_C, &s2, Control_C) ;
+        TEST_ASSERT (info == PARU_SUCCESS && s2 == ssize) ;
+        info = ParU_C_Serialize_Numeric_Size (Num_C, &n2, Control_C) ;
+        TEST_ASSERT (info == PARU_SUCCESS && n2 == nsize) ;
+        info = ParU_C_Serialize_Numeric (Num_C, nblob, nsize, Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_C_Serialize_Symbolic (NULL, sblob, ssize, Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        info = ParU_C_Deserialize_Numeric (sblob, ssize, true, &Num_C2,
+            Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID && Num_C2 == NULL, info) ;
+        info = ParU_C_Deserialize_Symbolic (sblob, ssize, true, NULL,
+            Control_C) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    }
+
+    //~~~~~~~~~~~~~~~~~~~End computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    TEST_PASSES ;
+}
@@ -79,8 +79,8 @@
 #endif
 
 #if !defined (CHOLMOD__VERSION) || \
-    (CHOLMOD__VERSION < SUITESPARSE__VERCODE(5,3,0))
-#error "SPQR 4.3.4 requires CHOLMOD 5.3.0 or later"
+    (CHOLMOD__VERSION < SUITESPARSE__VERCODE(6,0,0))
+#error "SPQR 4.3.4 requires CHOLMOD 6.0.0 or later"
 #endif
 
 #endif
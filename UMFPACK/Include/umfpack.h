@@ -29,7 +29,7 @@
 /* size of Info and Control arrays */
 /* -------------------------------------------------------------------------- */
 
-/* These might be larger in future versions, since there are only 3 unused
+/* These might be larger in future versions, since there are only 2 unused
  * entries in Info, and no unused entries in Control. */
 
 #define UMFPACK_INFO 90
@@ -74,23 +74,23 @@
  * below.
  */
 
-#define UMFPACK_DATE "Sept 23, 2024"
+#define UMFPACK_DATE "Oct 18, 2026"
 #define UMFPACK_MAIN_VERSION   6
-#define UMFPACK_SUB_VERSION    3
-#define UMFPACK_SUBSUB_VERSION 5
+#define UMFPACK_SUB_VERSION    4
+#define UMFPACK_SUBSUB_VERSION 0
 
 #define UMFPACK_VER_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define UMFPACK_VER UMFPACK_VER_CODE(6,3)
+#define UMFPACK_VER UMFPACK_VER_CODE(6,4)
 
-#define UMFPACK__VERSION SUITESPARSE__VERCODE(6,3,5)
+#define UMFPACK__VERSION SUITESPARSE__VERCODE(6,4,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,0))
-#error "UMFPACK 6.3.5 requires SuiteSparse_config 7.8.0 or later"
+#error "UMFPACK 6.4.0 requires SuiteSparse_config 7.8.0 or later"
 #endif
 
 #if !defined (AMD__VERSION) || \
     (AMD__VERSION < SUITESPARSE__VERCODE(3,3,3))
-#error "UMFPACK 6.3.5 requires AMD 3.3.3 or later"
+#error "UMFPACK 6.4.0 requires AMD 3.3.3 or later"
 #endif
 
 // user code should not directly use GB_STR or GB_XSTR
@@ -213,7 +213,10 @@
 #define UMFPACK_SOLVE_TIME 85       /* solve time (seconds) */
 #define UMFPACK_SOLVE_WALLTIME 86   /* solve time (wall clock, seconds) */
 
-/* Info [87, 88, 89] unused */
+/* computed in UMFPACK_refactor: */
+#define UMFPACK_REFACTOR_FALLBACK 87 /* 1 if UMFPACK_numeric was used */
+
+/* Info [88, 89] unused */
 
 /* Unused parts of Info may be used in future versions of UMFPACK. */
 
@@ -640,6 +643,15 @@ Arguments:
                 rows.  In that case, A'A is very costly to form.  In this case,
                 COLAMD is used instead of METIS.
 
+            If UMFPACK is compiled with OpenMP and more than one thread is
+            available (see omp_get_max_threads), UMFPACK_ORDERING_BEST computes
+            the candidate orderings (AMD or COLAMD, METIS, and NESDIS) and
+            their symbolic analyses in parallel, each on its own thread with
+            its own workspace.  This takes up to 3 times the memory of the
+            sequential analysis.  The selected ordering is the same as in the
+            sequential case: the one with the fewest nonzeros in the Cholesky
+            factor, with ties going to the first candidate.
+
         Control [UMFPACK_SINGLETONS]: If false (0), then singletons are
             not removed prior to factorization.  Default: true (1).
 
@@ -1480,6 +1492,179 @@ Arguments:
         Future versions might modify different parts of Info.
 */
 
+//------------------------------------------------------------------------------
+// umfpack_refactor
+//------------------------------------------------------------------------------
+
+int umfpack_di_refactor
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_dl_refactor
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zi_refactor
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zl_refactor
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Symbolic, *Numeric ;
+    int32_t *Ap, *Ai ;
+    double *Ax, Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    int status = umfpack_di_refactor (Ap, Ai, Ax, Symbolic, &Numeric, Control,
+        Info) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Symbolic, *Numeric ;
+    int64_t *Ap, *Ai ;
+    double *Ax, Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    int status = umfpack_dl_refactor (Ap, Ai, Ax, Symbolic, &Numeric, Control,
+        Info) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Symbolic, *Numeric ;
+    int32_t *Ap, *Ai ;
+    double *Ax, *Az, Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    int status = umfpack_zi_refactor (Ap, Ai, Ax, Az, Symbolic, &Numeric,
+        Control, Info) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Symbolic, *Numeric ;
+    int64_t *Ap, *Ai ;
+    double *Ax, *Az, Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    int status = umfpack_zl_refactor (Ap, Ai, Ax, Az, Symbolic, &Numeric,
+        Control, Info) ;
+
+packed complex Syntax:
+
+    Same as above, except that Az is NULL.
+
+Purpose:
+
+    Refactorizes a matrix A that has the same nonzero pattern as a matrix
+    previously factorized by umfpack_*_numeric, such as the sequence of
+    Jacobian matrices in a Newton iteration.  The row and column permutations
+    and the nonzero pattern of L and U held in the Numeric object are reused,
+    and only their numerical values (and the row scale factors) are
+    recomputed, in place.  No pivot search, frontal matrix assembly, or
+    memory management is performed, so this is typically much faster than
+    umfpack_*_numeric.
+
+    The refactorization replays the prior pivot sequence.  It is abandoned if
+    the new matrix A, or its LU factors, has a nonzero entry outside the
+    pattern of the prior LU factors (this can occur if an entry was dropped,
+    or was exactly zero, in the prior factorization), or if a pivot fails
+    the threshold partial pivoting test that umfpack_*_numeric used to
+    select it, with the pivot tolerances held in the Numeric object.  In
+    this case, the old Numeric object is freed and replaced with a new one
+    computed by umfpack_*_numeric, as if umfpack_*_numeric (Ap, Ai, Ax,
+    Symbolic, Numeric, Control, Info) had been called.  The fast path is only
+    attempted for square nonsingular matrices; otherwise umfpack_*_numeric is
+    always used.
+
+Returns:
+
+    The status code is returned.  See Info [UMFPACK_STATUS], below.
+
+Arguments:
+
+    Int Ap [n_col+1] ;          Input argument, not modified.
+    Int Ai [nz] ;               Input argument, not modified.
+    double Ax [nz] ;            Input argument, not modified.
+                                Size 2*nz for packed complex case.
+    double Az [nz] ;            Input argument, not modified, for complex
+                                versions.
+
+        The input matrix A, as described in umfpack_*_numeric.  Its nonzero
+        pattern must be the same as the matrix given to umfpack_*_numeric
+        when Numeric was computed, and the row indices in each column must
+        be sorted and free of duplicates.
+
+    void *Symbolic ;            Input argument, not modified.
+
+        The Symbolic object used by umfpack_*_numeric to compute Numeric.
+
+    void **Numeric ;            Input/output argument.
+
+        On input, *Numeric must be a valid Numeric object computed by
+        umfpack_*_numeric (or umfpack_*_refactor) for a matrix with the same
+        pattern as A.  It may not be a read-only view created by
+        umfpack_*_deserialize_numeric_view.  On output, *Numeric holds the
+        factorization of A.  If the refactorization falls back to
+        umfpack_*_numeric, the old object is freed, and *Numeric is replaced
+        by the new one (or by (void *) NULL if umfpack_*_numeric fails).
+        If UMFPACK_ERROR_out_of_memory is returned before the refactorization
+        starts, the old object is not modified.
+
+    double Control [UMFPACK_CONTROL] ;  Input argument, not modified.
+
+        Control parameters for umfpack_*_numeric, used only if the
+        refactorization falls back to a full factorization.  The
+        refactorization itself uses the pivot tolerances and scaling option
+        that were used to compute the Numeric object.
+
+    double Info [UMFPACK_INFO] ;        Output argument.
+
+        The same entries are returned as for umfpack_*_numeric.  The
+        following entry is also returned:
+
+        Info [UMFPACK_REFACTOR_FALLBACK]: 0 if the prior pivot sequence was
+            reused, or 1 if umfpack_*_numeric was used to refactorize A.
+
+        Info [UMFPACK_STATUS] is UMFPACK_OK, UMFPACK_WARNING_singular_matrix,
+        or one of the error codes returned by umfpack_*_numeric.  In addition,
+        UMFPACK_ERROR_invalid_Numeric_object is returned if *Numeric is not
+        valid, is a read-only view, or does not match the dimensions of the
+        Symbolic object.
+
+        The numeric statistics that umfpack_*_numeric reports for its
+        frontal matrices and memory usage (Info [UMFPACK_VARIABLE_PEAK],
+        Info [UMFPACK_MAX_FRONT_SIZE], and so on) describe the prior
+        factorization if the refactorization is successful.
+*/
+
 //------------------------------------------------------------------------------
 // umfpack_solve
 //------------------------------------------------------------------------------
@@ -2470,6 +2655,179 @@ Arguments:
         umfpack_zl_wsolve       4*n             10*n
 */
 
+//------------------------------------------------------------------------------
+// umfpack_msolve
+//------------------------------------------------------------------------------
+
+int umfpack_di_msolve
+(
+    int sys,
+    int32_t nrhs,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ],
+    double X [ ],
+    const double B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_dl_msolve
+(
+    int sys,
+    int64_t nrhs,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ],
+    double X [ ],
+    const double B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zi_msolve
+(
+    int sys,
+    int32_t nrhs,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    double Xx [ ],       double Xz [ ],
+    const double Bx [ ], const double Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zl_msolve
+(
+    int sys,
+    int64_t nrhs,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    double Xx [ ],       double Xz [ ],
+    const double Bx [ ], const double Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai, nrhs ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_di_msolve (sys, nrhs, Ap, Ai, Ax, X, B, Numeric,
+        Control, Info) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai, nrhs ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_dl_msolve (sys, nrhs, Ap, Ai, Ax, X, B, Numeric,
+        Control, Info) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai, nrhs ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az,
+        Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_zi_msolve (sys, nrhs, Ap, Ai, Ax, Az, Xx, Xz,
+        Bx, Bz, Numeric, Control, Info) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai, nrhs ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az,
+        Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_zl_msolve (sys, nrhs, Ap, Ai, Ax, Az, Xx, Xz,
+        Bx, Bz, Numeric, Control, Info) ;
+
+packed complex Syntax:
+
+    Same as above, except Az, Xz, and Bz are NULL.
+
+Purpose:
+
+    Given LU factors computed by umfpack_*_numeric (PAQ=LU) and an n-by-nrhs
+    dense right-hand-side B, solve AX=B, A'X=B, or A.'X=B for the n-by-nrhs
+    solution X.  The result is the same as calling umfpack_*_solve for each
+    column of B, but the right-hand-sides are solved together in blocks of
+    16 columns, so that each entry of L and U is loaded from memory once per
+    block rather than once per column.  Iterative refinement is optionally
+    performed, for each column independently.  If UMFPACK is compiled with
+    OpenMP, the blocks of columns are solved in parallel, using up to
+    omp_get_max_threads threads.
+
+Returns:
+
+    The status code is returned.  See Info [UMFPACK_STATUS], below.
+
+Arguments:
+
+    Int sys ;           Input argument, not modified.
+
+        Defines which system to solve: UMFPACK_A, UMFPACK_At, or UMFPACK_Aat,
+        as described in umfpack_*_solve.  Any other value returns
+        UMFPACK_ERROR_invalid_system.
+
+    Int nrhs ;          Input argument, not modified.
+
+        The number of columns of B and X.  If zero, nothing is solved.
+
+    Int Ap [n+1] ;      Input argument, not modified.
+    Int Ai [nz] ;       Input argument, not modified.
+    double Ax [nz] ;    Input argument, not modified.
+                        Size 2*nz in packed complex case.
+    double Az [nz] ;    Input argument, not modified, for complex versions.
+
+        The matrix A, as for umfpack_*_solve.  Only required if iterative
+        refinement is performed.
+
+    double X [n*nrhs] ; Output argument.
+    double B [n*nrhs] ; Input argument, not modified.
+
+        B and X are dense n-by-nrhs matrices held in column-major order, with
+        leading dimension n: B [i+k*n] is entry (i,k) of B.  For the complex
+        versions, Xx, Xz, Bx, and Bz are also n-by-nrhs with leading
+        dimension n.  In the packed complex case, Xz and Bz are NULL, and
+        Xx and Bx hold 2*n*nrhs entries, with the real and imaginary parts of
+        each entry interleaved.
+
+    void *Numeric ;                     Input argument, not modified.
+    double Control [UMFPACK_CONTROL] ;  Input argument, not modified.
+
+        Only Control [UMFPACK_IRSTEP] is used.
+        If Control is NULL, the defaults are used.
+
+    double Info [UMFPACK_INFO] ;        Output argument.
+
+        The same as umfpack_*_solve.  Info [UMFPACK_IR_TAKEN],
+        [UMFPACK_IR_ATTEMPTED], [UMFPACK_OMEGA1], and [UMFPACK_OMEGA2] are
+        the largest values over all columns of B, and
+        Info [UMFPACK_SOLVE_FLOPS] is the total for all columns.
+
+        The workspace allocated by umfpack_*_msolve is of size about
+        t*(c*n*sizeof(double) + n*sizeof(Int)), where t is the number of
+        threads used, c is 67 (real) or 131 (complex) with iterative
+        refinement, and 32 (real) or 64 (complex) without.
+*/
+
 //==============================================================================
 //==== Matrix manipulation routines ============================================
 //==============================================================================
@@ -4416,6 +4774,128 @@ Arguments:
         Size of the blob, in bytes.
 */
 
+//------------------------------------------------------------------------------
+// umfpack_deserialize_numeric_view
+//------------------------------------------------------------------------------
+
+int umfpack_di_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object viewing the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_dl_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object viewing the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_zi_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object viewing the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_zl_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object viewing the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_di_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_dl_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zi_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zl_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+Purpose:
+
+    Constructs a read-only Numeric object from the serialized "blob", without
+    copying the LU factors.  Only the small header of the Numeric object is
+    allocated; all of its arrays point directly into the blob.  The blob may
+    be held in read-only memory (a file mapped with mmap and PROT_READ, for
+    example), and a single blob can be shared by many processes, each with its
+    own Numeric view of it.
+
+    The blob is not modified, and it must not be modified or free'd until
+    the Numeric view has been free'd by umfpack_*_free_numeric (which frees
+    only the header of the view, not the blob).
+
+    The view can be used by any UMFPACK routine that takes a Numeric object
+    as an input argument that is not modified (umfpack_*_solve,
+    umfpack_*_wsolve, umfpack_*_msolve, umfpack_*_get_lunz,
+    umfpack_*_get_numeric, umfpack_*_get_determinant, umfpack_*_scale,
+    umfpack_*_report_numeric, umfpack_*_save_numeric,
+    umfpack_*_serialize_numeric, and umfpack_*_copy_numeric).  None of these
+    allocate or copy any part of the LU factors of the view.  A view cannot
+    be refactorized; use umfpack_*_copy_numeric or
+    umfpack_*_deserialize_numeric to obtain a Numeric object that owns its
+    arrays.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_argument_missing if blob or Numeric are NULL.
+    UMFPACK_ERROR_invalid_Numeric_object if Numeric is not valid.
+    UMFPACK_ERROR_invalid_blob if blob is too small, or if the blob is not
+        aligned on a multiple of sizeof (double) bytes.
+    UMFPACK_ERROR_out_of_memory if not enough memory is available.
+
+Arguments:
+
+    void **Numeric ;        Input argument, not modified.
+
+        On input, the contents of this variable are not defined.  On output,
+        this variable holds a (void *) pointer to the Numeric view (if
+        successful), or (void *) NULL if a failure occurred.
+
+    int8_t *blob ;          Input argument, not modified.
+
+        An array of size blobsize containing a blob created by
+        umfpack_*_serialize_numeric.  It must be aligned on a multiple of
+        sizeof (double) bytes, which is always the case for memory obtained
+        from malloc or mmap.
+
+    int64_t blobsize ;      Input argument, not modified.
+
+        Size of the blob, in bytes.
+*/
+
 //------------------------------------------------------------------------------
 // umfpack_save_symbolic
 //------------------------------------------------------------------------------
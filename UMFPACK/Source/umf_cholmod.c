@@ -14,6 +14,10 @@
  *
  * This function can be passed to umfpack_*_fsymbolic as the
  * user_ordering function pointer.
+ *
+ * With UMFPACK_ORDERING_BEST and more than one OpenMP thread (as given by
+ * omp_get_max_threads), the candidate orderings are computed and analyzed in
+ * parallel.  See analyze_best below.
  */
 
 #include "umf_internal.h"
@@ -41,6 +45,161 @@
 #define CHOLMOD_print_common      cholmod_l_print_common
 #endif
 
+#ifndef NCHOLMOD
+
+/* -------------------------------------------------------------------------- */
+/* get_ordering: copy the ordering from L and compute its statistics */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE void get_ordering
+(
+    cholmod_factor *L,      /* symbolic factor from cholmod_analyze */
+    Int ncol,
+    Int Perm [ ],           /* output permutation, size ncol */
+    Int *params,            /* params [2]: ordering used */
+    double user_info [3]
+)
+{
+    double dmax, flops, c, lnz ;
+    Int *P, *ColCount ;
+    Int k ;
+
+    /* determine the ordering used */
+    switch (L->ordering)
+    {
+
+        case CHOLMOD_AMD:
+        case CHOLMOD_COLAMD:
+            params [2] = UMFPACK_ORDERING_AMD ;
+            break ;
+
+        case CHOLMOD_METIS:
+        case CHOLMOD_NESDIS:
+            params [2] = UMFPACK_ORDERING_METIS ;
+            break ;
+
+        case CHOLMOD_GIVEN:
+        case CHOLMOD_NATURAL:
+        default:
+            params [2] = UMFPACK_ORDERING_NONE ;
+            break ;
+    }
+
+    /* copy the permutation from L to the output and compute statistics */
+    P = L->Perm ;
+    ColCount = L->ColCount ;
+    dmax = 1 ;
+    lnz = 0 ;
+    flops = 0 ;
+    for (k = 0 ; k < ncol ; k++)
+    {
+        Perm [k] = P [k] ;
+        c = ColCount [k] ;
+        if (c > dmax) dmax = c ;
+        lnz += c ;
+        flops += c*c ;
+    }
+    user_info [0] = dmax ;
+    user_info [1] = lnz ;
+    user_info [2] = flops ;
+}
+
+/* -------------------------------------------------------------------------- */
+/* analyze_best: try the candidates of UMFPACK_ORDERING_BEST in parallel */
+/* -------------------------------------------------------------------------- */
+
+/* Each candidate ordering is computed and analyzed on its own thread, by
+ * cholmod_analyze with its own cholmod_common object and workspace.  S is not
+ * modified.  The candidate with the smallest nnz(L) is selected, and ties go
+ * to the lower-numbered candidate.  This is the same choice cholmod_analyze
+ * makes when it tries the candidates one after the other, so the result does
+ * not depend on the number of threads or on which thread finishes first.
+ * A METIS or NESDIS candidate that fell back to AMD is discarded, since the
+ * sequential analysis would not have used that fallback.  The statistics of
+ * each candidate are returned in cm.  Returns FALSE if all candidates failed.
+ */
+
+#if defined ( _OPENMP )
+
+#define NBEST 3
+
+PRIVATE int analyze_best
+(
+    cholmod_sparse *S,      /* matrix to order, not modified */
+    Int symmetric,
+    Int nthreads,
+    Int ncol,
+    Int Perm [ ],           /* output permutation, size ncol */
+    Int *params,            /* params [2]: ordering used */
+    double user_info [3],
+    cholmod_common *cm      /* statistics of each candidate */
+)
+{
+    cholmod_common Cm [NBEST] ;
+    cholmod_factor *Lbest [NBEST] ;
+    int Ordering [NBEST], t, best ;
+
+    Ordering [0] = symmetric ? CHOLMOD_AMD : CHOLMOD_COLAMD ;
+    Ordering [1] = CHOLMOD_METIS ;
+    Ordering [2] = CHOLMOD_NESDIS ;
+
+    for (t = 0 ; t < NBEST ; t++)
+    {
+        CHOLMOD_start (&Cm [t]) ;
+        Cm [t].supernodal = CHOLMOD_SIMPLICIAL ;
+        Cm [t].print = 0 ;
+        Cm [t].nmethods = 1 ;
+        Cm [t].method [0].ordering = Ordering [t] ;
+        Cm [t].postorder = TRUE ;
+        Lbest [t] = NULL ;
+    }
+
+    /* order and analyze S or S*S' with each candidate */
+    nthreads = MIN (nthreads, NBEST) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (t = 0 ; t < NBEST ; t++)
+    {
+        Lbest [t] = CHOLMOD_analyze (S, &Cm [t]) ;
+    }
+
+    /* select the best candidate */
+    best = EMPTY ;
+    for (t = 0 ; t < NBEST ; t++)
+    {
+        cm->method [t].ordering = Ordering [t] ;
+        cm->method [t].fl  = EMPTY ;
+        cm->method [t].lnz = EMPTY ;
+        if (Lbest [t] == NULL || Lbest [t]->ordering != Ordering [t])
+        {
+            continue ;
+        }
+        cm->method [t].fl  = Cm [t].fl ;
+        cm->method [t].lnz = Cm [t].lnz ;
+        if (best == EMPTY || Cm [t].lnz < Cm [best].lnz)
+        {
+            best = t ;
+        }
+    }
+    cm->nmethods = NBEST ;
+    cm->selected = best ;
+    if (best != EMPTY)
+    {
+        cm->fl  = Cm [best].fl ;
+        cm->lnz = Cm [best].lnz ;
+        get_ordering (Lbest [best], ncol, Perm, params, user_info) ;
+    }
+
+    for (t = 0 ; t < NBEST ; t++)
+    {
+        CHOLMOD_free_factor (&Lbest [t], &Cm [t]) ;
+        CHOLMOD_finish (&Cm [t]) ;
+    }
+    return (best != EMPTY) ;
+}
+
+#endif
+#endif
+
 int UMF_cholmod
 (
     /* inputs */
@@ -67,12 +226,11 @@ int UMF_cholmod
     ordering_option = params [0] ;
 
 #ifndef NCHOLMOD
-    double dmax, flops, c, lnz ;
     cholmod_sparse Amatrix, *A, *AT, *S ;
     cholmod_factor *L ;
     cholmod_common cm ;
-    Int *P, *ColCount ;
-    Int k, print_level ;
+    Int print_level ;
+    int ok ;
 
     print_level = params [1] - 1 ;
     params [2] = -1 ;
@@ -184,53 +342,32 @@ int UMF_cholmod
     }
 
     /* order and analyze S or S*S' */
-    L = CHOLMOD_analyze (S, &cm) ;
-    CHOLMOD_free_sparse (&AT, &cm) ;
-    if (L == NULL)
+    ok = FALSE ;
+#if defined ( _OPENMP )
+    Int nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    if (ordering_option == UMFPACK_ORDERING_BEST && nthreads > 1)
     {
-        return (FALSE) ;
+        /* try each candidate ordering on its own thread */
+        ok = analyze_best (S, symmetric, nthreads, ncol, Perm, params,
+            user_info, &cm) ;
     }
-
-    /* determine the ordering used */
-    switch (L->ordering)
+#endif
+    if (!ok)
     {
-
-        case CHOLMOD_AMD:
-        case CHOLMOD_COLAMD:
-            params [2] = UMFPACK_ORDERING_AMD ;
-            break ;
-
-        case CHOLMOD_METIS:
-        case CHOLMOD_NESDIS:
-            params [2] = UMFPACK_ORDERING_METIS ;
-            break ;
-
-        case CHOLMOD_GIVEN:
-        case CHOLMOD_NATURAL:
-        default:
-            params [2] = UMFPACK_ORDERING_NONE ;
-            break ;
+        L = CHOLMOD_analyze (S, &cm) ;
+        if (L != NULL)
+        {
+            get_ordering (L, ncol, Perm, params, user_info) ;
+            CHOLMOD_free_factor (&L, &cm) ;
+            ok = TRUE ;
+        }
     }
-
-    /* copy the permutation from L to the output and compute statistics */
-    P = L->Perm ;
-    ColCount = L->ColCount ;
-    dmax = 1 ;
-    lnz = 0 ;
-    flops = 0 ;
-    for (k = 0 ; k < ncol ; k++)
+    CHOLMOD_free_sparse (&AT, &cm) ;
+    if (!ok)
     {
-        Perm [k] = P [k] ;
-        c = ColCount [k] ;
-        if (c > dmax) dmax = c ;
-        lnz += c ;
-        flops += c*c ;
+        return (FALSE) ;
     }
-    user_info [0] = dmax ;
-    user_info [1] = lnz ;
-    user_info [2] = flops ;
 
-    CHOLMOD_free_factor (&L, &cm) ;
     if (print_level > 0) 
     {
         CHOLMOD_print_common ("for UMFPACK", &cm) ;
@@ -433,6 +433,9 @@ void AMD_debug_init ( char *s ) ;
 /* largest BLAS block size permitted */
 #define MAXNB 64
 
+/* number of right-hand-sides solved together by UMFPACK_msolve */
+#define UMF_MSOLVE_NB 16
+
 /* if abs (y) < RECIPROCAL_TOLERANCE, then compute x/y.  Otherwise x*(1/y).
  * Ignored if NRECIPROCAL is defined */
 #define RECIPROCAL_TOLERANCE 1e-12
@@ -538,6 +541,10 @@ typedef struct	/* NumericType */
 
     Int valid ;		/* set to NUMERIC_VALID, for validity check */
 
+    Int is_view ;	/* TRUE if the arrays below point into a blob owned */
+			/* by the caller (see UMFPACK_deserialize_numeric_view) */
+			/* and must not be free'd or modified */
+
     /* Memory space for A and LU factors */
     Unit
 	*Memory ;	/* working memory for A and LU factors */
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mlsolve: solve LX=B for multiple right-hand-sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*  Solves LX = B, where L is the lower triangular factor of a matrix and B
+ *  has nrhs columns.  B is overwritten with the solution X.  X is stored by
+ *  row: X [i*nrhs + r] is entry (i,r), so that each entry of L is loaded once
+ *  and applied to all nrhs right-hand-sides in the innermost loop.  Unlike
+ *  UMF_lsolve, zero entries of X are not skipped.
+ *  Returns the floating point operation count */
+
+#include "umf_internal.h"
+#include "umf_mlsolve.h"
+
+double UMF_mlsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],		/* B on input, solution X on output, n-by-nrhs */
+    Int nrhs,			/* number of right-hand-sides, >= 1 */
+    Int Pattern [ ]		/* a work array of size n */
+)
+{
+    Entry lik ;
+    Entry *xp, *Lval, *xk, *xi ;
+    Int k, deg, *ip, j, r, row, *Lpos, *Lilen, *Lip, llen, lp, newLchain,
+	pos, npiv, n1, *Li ;
+
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric->n_row != Numeric->n_col) return (0.) ;
+    npiv = Numeric->npiv ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    n1 = Numeric->n1 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* singletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n1 ; k++)
+    {
+	DEBUG4 (("Singleton k "ID"\n", k)) ;
+	deg = Lilen [k] ;
+	if (deg > 0)
+	{
+	    xk = X + k*nrhs ;
+	    lp = Lip [k] ;
+	    Li = (Int *) (Numeric->Memory + lp) ;
+	    lp += UNITS (Int, deg) ;
+	    Lval = (Entry *) (Numeric->Memory + lp) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		/* X [Li [j], :] -= X [k, :] * Lval [j] ; */
+		xi = X + Li [j] * nrhs ;
+		lik = Lval [j] ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+		    MULT_SUB (xi [r], xk [r], lik) ;
+		}
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* rest of L */
+    /* ---------------------------------------------------------------------- */
+
+    deg = 0 ;
+
+    for (k = n1 ; k < npiv ; k++)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* make column of L in Pattern [0..deg-1] */
+	/* ------------------------------------------------------------------ */
+
+	lp = Lip [k] ;
+	newLchain = (lp < 0) ;
+	if (newLchain)
+	{
+	    lp = -lp ;
+	    deg = 0 ;
+	}
+
+	/* remove pivot row */
+	pos = Lpos [k] ;
+	if (pos != EMPTY)
+	{
+	    ASSERT (!newLchain) ;
+	    ASSERT (deg > 0) ;
+	    ASSERT (pos >= 0 && pos < deg) ;
+	    ASSERT (Pattern [pos] == k) ;
+	    Pattern [pos] = Pattern [--deg] ;
+	}
+
+	/* concatenate the pattern */
+	ip = (Int *) (Numeric->Memory + lp) ;
+	llen = Lilen [k] ;
+	for (j = 0 ; j < llen ; j++)
+	{
+	    row = *ip++ ;
+	    ASSERT (row > k) ;
+	    Pattern [deg++] = row ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* use column k of L */
+	/* ------------------------------------------------------------------ */
+
+	xk = X + k*nrhs ;
+	xp = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	for (j = 0 ; j < deg ; j++)
+	{
+	    /* X [Pattern [j], :] -= X [k, :] * (*xp) ; */
+	    xi = X + Pattern [j] * nrhs ;
+	    lik = *xp++ ;
+	    for (r = 0 ; r < nrhs ; r++)
+	    {
+		MULT_SUB (xi [r], xk [r], lik) ;
+	    }
+	}
+    }
+
+    return (MULTSUB_FLOPS * ((double) Numeric->lnz) * ((double) nrhs)) ;
+}
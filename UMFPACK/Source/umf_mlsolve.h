@@ -0,0 +1,16 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mlsolve.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+double UMF_mlsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int nrhs,
+    Int Pattern [ ]
+) ;
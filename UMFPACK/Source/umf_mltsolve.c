@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mltsolve: solve L'X=B for multiple right-hand-sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*  Solves L'X = B or L.'X=B, where L is the lower triangular factor of a */
+/*  matrix and B has nrhs columns.  B is overwritten with the solution X. */
+/*  X is stored by row: X [i*nrhs + r] is entry (i,r).  See umf_mlsolve.c. */
+/*  Returns the floating point operation count */
+
+#include "umf_internal.h"
+#include "umf_mltsolve.h"
+
+double
+#ifdef CONJUGATE_SOLVE
+UMF_mlhsolve			/* solve L'X=B  (complex conjugate transpose) */
+#else
+UMF_mltsolve			/* solve L.'X=B (array transpose) */
+#endif
+(
+    NumericType *Numeric,
+    Entry X [ ],		/* B on input, solution X on output, n-by-nrhs */
+    Int nrhs,			/* number of right-hand-sides, >= 1 */
+    Int Pattern [ ]		/* a work array of size n */
+)
+{
+    Entry lik ;
+    Entry *xp, *Lval, *xk, *xi ;
+    Int k, deg, *ip, j, r, row, *Lpos, *Lilen, kstart, kend, *Lip, llen,
+	lp, pos, npiv, n1, *Li ;
+
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric->n_row != Numeric->n_col) return (0.) ;
+    npiv = Numeric->npiv ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    kstart = npiv ;
+    n1 = Numeric->n1 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* non-singletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (kend = npiv-1 ; kend >= n1 ; kend = kstart-1)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* find the start of this Lchain */
+	/* ------------------------------------------------------------------ */
+
+	kstart = kend ;
+	while (kstart >= 0 && Lip [kstart] > 0)
+	{
+	    kstart-- ;
+	}
+
+	/* the Lchain goes from kstart to kend */
+
+	/* ------------------------------------------------------------------ */
+	/* scan the whole chain to find the pattern of the last column of L */
+	/* ------------------------------------------------------------------ */
+
+	deg = 0 ;
+	for (k = kstart ; k <= kend ; k++)
+	{
+	    ASSERT (k >= 0 && k < npiv) ;
+
+	    /* remove pivot row */
+	    pos = Lpos [k] ;
+	    if (pos != EMPTY)
+	    {
+		ASSERT (k != kstart) ;
+		ASSERT (deg > 0) ;
+		ASSERT (pos >= 0 && pos < deg) ;
+		ASSERT (Pattern [pos] == k) ;
+		Pattern [pos] = Pattern [--deg] ;
+	    }
+
+	    /* concatenate the pattern */
+	    lp = Lip [k] ;
+	    if (k == kstart)
+	    {
+		lp = -lp ;
+	    }
+	    ASSERT (lp > 0) ;
+	    ip = (Int *) (Numeric->Memory + lp) ;
+	    llen = Lilen [k] ;
+	    for (j = 0 ; j < llen ; j++)
+	    {
+		row = *ip++ ;
+		ASSERT (row > k) ;
+		Pattern [deg++] = row ;
+	    }
+	}
+	/* Pattern [0..deg-1] is now the pattern of column kend */
+
+	/* ------------------------------------------------------------------ */
+	/* solve using this chain, in reverse order */
+	/* ------------------------------------------------------------------ */
+
+	for (k = kend ; k >= kstart ; k--)
+	{
+
+	    /* -------------------------------------------------------------- */
+	    /* use column k of L */
+	    /* -------------------------------------------------------------- */
+
+	    ASSERT (k >= 0 && k < npiv) ;
+	    lp = Lip [k] ;
+	    if (k == kstart)
+	    {
+		lp = -lp ;
+	    }
+	    ASSERT (lp > 0) ;
+	    llen = Lilen [k] ;
+	    xp = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	    xk = X + k*nrhs ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		xi = X + Pattern [j] * nrhs ;
+		lik = *xp++ ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+#ifdef CONJUGATE_SOLVE
+		    /* X [k, :] -= X [Pattern [j], :] * conjugate (*xp) ; */
+		    MULT_SUB_CONJ (xk [r], xi [r], lik) ;
+#else
+		    /* X [k, :] -= X [Pattern [j], :] * (*xp) ; */
+		    MULT_SUB (xk [r], xi [r], lik) ;
+#endif
+		}
+	    }
+
+	    /* -------------------------------------------------------------- */
+	    /* construct column k-1 of L */
+	    /* -------------------------------------------------------------- */
+
+	    /* un-concatenate the pattern */
+	    deg -= llen ;
+
+	    /* add pivot row */
+	    pos = Lpos [k] ;
+	    if (pos != EMPTY)
+	    {
+		ASSERT (k != kstart) ;
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* singletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Lilen [k] ;
+	if (deg > 0)
+	{
+	    xk = X + k*nrhs ;
+	    lp = Lip [k] ;
+	    Li = (Int *) (Numeric->Memory + lp) ;
+	    lp += UNITS (Int, deg) ;
+	    Lval = (Entry *) (Numeric->Memory + lp) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		xi = X + Li [j] * nrhs ;
+		lik = Lval [j] ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+#ifdef CONJUGATE_SOLVE
+		    /* X [k, :] -= X [Li [j], :] * conjugate (Lval [j]) ; */
+		    MULT_SUB_CONJ (xk [r], xi [r], lik) ;
+#else
+		    /* X [k, :] -= X [Li [j], :] * Lval [j] ; */
+		    MULT_SUB (xk [r], xi [r], lik) ;
+#endif
+		}
+	    }
+	}
+    }
+
+    return (MULTSUB_FLOPS * ((double) Numeric->lnz) * ((double) nrhs)) ;
+}
@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mltsolve.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+double UMF_mltsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int nrhs,
+    Int Pattern [ ]
+) ;
+
+double UMF_mlhsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int nrhs,
+    Int Pattern [ ]
+) ;
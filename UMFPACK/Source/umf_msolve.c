@@ -0,0 +1,705 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_msolve: solve a linear system with multiple rhs
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Not user-callable.  Solves AX=B, A'X=B, or A.'X=B for columns k1 to k2-1
+    of the n-by-nrhs dense matrix B, using the numerical factorization
+    computed by UMFPACK_numeric.  At most UMF_MSOLVE_NB columns are solved at
+    a time.  No workspace is dynamically allocated.
+
+    This is the same method as UMF_solve, except that the right-hand-sides
+    are held in a single workspace W, stored by row, so that the multi-vector
+    kernels UMF_mlsolve, UMF_musolve, UMF_mltsolve, and UMF_mutsolve traverse
+    the LU factors just once for all of them.  Iterative refinement is
+    applied to each column independently, with the sparse backward error
+    method of Arioli, Demmel, and Duff.  A column drops out of the block once
+    its refinement is done, and the corrections for the remaining columns are
+    again computed together.
+
+    Info [UMFPACK_IR_TAKEN], [UMFPACK_IR_ATTEMPTED], [UMFPACK_OMEGA1], and
+    [UMFPACK_OMEGA2] are the largest values over all the columns.
+
+    Returns UMFPACK_OK if successful, UMFPACK_WARNING_singular_matrix if A is
+    singular, UMFPACK_ERROR_argument_missing if required arguments are
+    missing, or UMFPACK_ERROR_invalid_system if sys is not UMFPACK_A,
+    UMFPACK_At, or UMFPACK_Aat.
+*/
+
+#include "umf_internal.h"
+#include "umf_msolve.h"
+#include "umf_mlsolve.h"
+#include "umf_musolve.h"
+#include "umf_mltsolve.h"
+#include "umf_mutsolve.h"
+
+/* X [p] = c, where X is real, or complex in split or packed form */
+#ifdef COMPLEX
+#define PUT_ENTRY(c,s1,s2,p,split) \
+{ \
+    if (split) \
+    { \
+	(s1) [p] = REAL_COMPONENT (c) ; \
+	(s2) [p] = IMAG_COMPONENT (c) ; \
+    } \
+    else \
+    { \
+	((Entry *) (s1)) [p] = (c) ; \
+    } \
+}
+#else
+#define PUT_ENTRY(c,s1,s2,p,split) { (s1) [p] = (c) ; }
+#endif
+
+/* c = c * Rs [i] or c / Rs [i], for an Entry c */
+#ifndef NRECIPROCAL
+#define SCALE_ROW(c,i) \
+{ \
+    if (do_recip) \
+    { \
+	SCALE (c, Rs [i]) ; \
+    } \
+    else \
+    { \
+	SCALE_DIV (c, Rs [i]) ; \
+    } \
+}
+#else
+#define SCALE_ROW(c,i) { SCALE_DIV (c, Rs [i]) ; }
+#endif
+
+PRIVATE Int do_mstep
+(
+    double omega [3],
+    Int step,
+    const double B2 [ ],
+    Entry X [ ],
+    const Entry W [ ],
+    const double Y [ ],
+    const double Z2 [ ],
+    Entry S [ ],
+    Int n,
+    Int *taken
+) ;
+
+/* ========================================================================== */
+/* === UMF_msolve =========================================================== */
+/* ========================================================================== */
+
+Int UMF_msolve
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+    double Xx [ ],		/* n-by-nrhs, leading dimension n */
+    const double Bx [ ],	/* n-by-nrhs, leading dimension n */
+#ifdef COMPLEX
+    const double Az [ ],
+    double Xz [ ],
+    const double Bz [ ],
+#endif
+    Int k1,			/* solve for columns k1 to k2-1 of B */
+    Int k2,
+    NumericType *Numeric,
+    Int irstep,
+    double Info [UMFPACK_INFO],
+    Int Pattern [ ],		/* size n */
+    double SolveWork [ ]	/* with nb = k2-k1 and c = 1 (real) or 2 */
+				/* (complex), size 4*c*nb*n + 3*n if irstep>0, */
+				/* and 2*c*nb*n otherwise. */
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    Entry t, xj, aij, axx, wi ;
+    Entry *W, *X, *S, *R, *Xk, *Rk ;
+    double omega [UMF_MSOLVE_NB][3], d, yi, z2i, flops, *Y, *Z2, *B2, *Rs ;
+    Int cols [UMF_MSOLVE_NB], taken [UMF_MSOLVE_NB], attempted [UMF_MSOLVE_NB],
+	active [UMF_MSOLVE_NB] ;
+    Int *Rperm, *Cperm, *Pin, *Pout, i, n, p, p2, j, k, a, nb, na, nz, step,
+	status, do_scale ;
+#ifdef COMPLEX
+    Int Asplit = SPLIT (Az) ;
+    Int Xsplit = SPLIT (Xz) ;
+    Int Bsplit = SPLIT (Bz) ;
+#endif
+#ifndef NRECIPROCAL
+    Int do_recip = Numeric->do_recip ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* initializations */
+    /* ---------------------------------------------------------------------- */
+
+    ASSERT (Numeric && Xx && Bx && Pattern && SolveWork && Info) ;
+    ASSERT (Numeric->n_row == Numeric->n_col) ;
+    ASSERT (k1 >= 0 && k1 < k2 && k2 - k1 <= UMF_MSOLVE_NB) ;
+
+    n = Numeric->n_row ;
+    nb = k2 - k1 ;
+    nz = 0 ;
+    flops = 0 ;
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    Rs = Numeric->Rs ;		/* row scale factors */
+    do_scale = (Rs != (double *) NULL) ;
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+    Info [UMFPACK_IR_TAKEN] = 0 ;
+    Info [UMFPACK_IR_ATTEMPTED] = 0 ;
+
+    if (sys != UMFPACK_A && sys != UMFPACK_At && sys != UMFPACK_Aat)
+    {
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+
+    if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	DEBUGm4 (("Note, matrix is singular in umf_msolve\n")) ;
+	status = UMFPACK_WARNING_singular_matrix ;
+	irstep = 0 ;
+    }
+    else
+    {
+	status = UMFPACK_OK ;
+    }
+    irstep = MAX (0, irstep) ;
+
+    /* P (R b) for A x = b, and Q' b for A' x = b and A.' x = b */
+    Pin  = (sys == UMFPACK_A) ? Rperm : Cperm ;
+    Pout = (sys == UMFPACK_A) ? Cperm : Rperm ;
+
+    W = (Entry *) SolveWork ;		/* Entry W [0..nb*n-1], by row */
+    X = W + nb*n ;			/* Entry X [0..nb*n-1], by column */
+    S = (Entry *) NULL ;		/* unused if no iterative refinement */
+    R = (Entry *) NULL ;
+    Y = (double *) NULL ;
+    Z2 = (double *) NULL ;
+    B2 = (double *) NULL ;
+
+    if (irstep > 0)
+    {
+	if (!Ap || !Ai || !Ax)
+	{
+	    return (UMFPACK_ERROR_argument_missing) ;
+	}
+	S = X + nb*n ;			/* Entry S [0..nb*n-1], by column */
+	R = S + nb*n ;			/* Entry R [0..nb*n-1], by column */
+	Y = (double *) (R + nb*n) ;	/* double Y [0..n-1] */
+	Z2 = Y + n ;			/* double Z2 [0..n-1] */
+	B2 = Z2 + n ;			/* double B2 [0..n-1] */
+    }
+
+    for (k = 0 ; k < nb ; k++)
+    {
+	active [k] = TRUE ;
+	taken [k] = 0 ;
+	attempted [k] = 0 ;
+	omega [k][0] = 0. ;
+	omega [k][1] = 0. ;
+	omega [k][2] = 0. ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* using iterative refinement:  compute Y */
+    /* ---------------------------------------------------------------------- */
+
+    if (irstep > 0)
+    {
+	nz = Ap [n] ;
+	Info [UMFPACK_NZ] = nz ;
+	flops += (ABS_FLOPS + 1) * nz ;
+
+	if (sys == UMFPACK_A)
+	{
+	    /* A is stored by column */
+	    /* Y (i) = ||R A_i||, 1-norm of row i of R A */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		Y [i] = 0. ;
+	    }
+	    for (p = 0 ; p < nz ; p++)
+	    {
+		ASSIGN (aij, Ax, Az, p, Asplit) ;
+		ABS (d, aij) ;
+		Y [Ai [p]] += d ;
+	    }
+	    if (do_scale)
+	    {
+#ifndef NRECIPROCAL
+		if (do_recip)
+		{
+		    for (i = 0 ; i < n ; i++)
+		    {
+			Y [i] *= Rs [i] ;
+		    }
+		}
+		else
+#endif
+		{
+		    for (i = 0 ; i < n ; i++)
+		    {
+			Y [i] /= Rs [i] ;
+		    }
+		}
+		flops += n ;
+	    }
+	}
+	else
+	{
+	    /* A' and A.' are stored by row */
+	    /* Y (i) = ||(A' R)_i||, 1-norm of row i of A' R */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		yi = 0. ;
+		p2 = Ap [i+1] ;
+		for (p = Ap [i] ; p < p2 ; p++)
+		{
+		    /* note that abs (aij) is the same as abs (conj (aij)) */
+		    ASSIGN (aij, Ax, Az, p, Asplit) ;
+		    ABS (d, aij) ;
+		    if (do_scale)
+		    {
+#ifndef NRECIPROCAL
+			if (do_recip)
+			{
+			    d *= Rs [Ai [p]] ;
+			}
+			else
+#endif
+			{
+			    d /= Rs [Ai [p]] ;
+			}
+		    }
+		    yi += d ;
+		}
+		Y [i] = yi ;
+	    }
+	    if (do_scale)
+	    {
+		flops += nz ;
+	    }
+	}
+    }
+
+    for (step = 0 ; step <= irstep ; step++)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* Solve A x = b (step 0): */
+	/*  x = Q (U \ (L \ (P R b))) */
+	/* or A' x = b: */
+	/*  x = R P' (L' \ (U' \ (Q' b))) */
+	/* and then perform iterative refinement (step > 0), with b replaced */
+	/* by the residual of each column that has not yet converged. */
+	/* ------------------------------------------------------------------ */
+
+	na = 0 ;
+	for (k = 0 ; k < nb ; k++)
+	{
+	    if (active [k])
+	    {
+		cols [na++] = k ;
+	    }
+	}
+	if (na == 0)
+	{
+	    /* iterative refinement is done for all columns */
+	    break ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* gather the active right-hand-sides into W, stored by row */
+	/* ------------------------------------------------------------------ */
+
+	for (a = 0 ; a < na ; a++)
+	{
+	    k = cols [a] ;
+	    if (step == 0)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    /* W [i,a] = B [Pin [i], k1+k], and scale if Ax=b */
+		    ASSIGN (t, Bx, Bz, Pin [i] + (k1+k)*n, Bsplit) ;
+		    if (sys == UMFPACK_A && do_scale)
+		    {
+			SCALE_ROW (t, Pin [i]) ;
+		    }
+		    W [i*na + a] = t ;
+		}
+	    }
+	    else
+	    {
+		/* the residual R is already scaled for Ax=b */
+		Rk = R + k*n ;
+		for (i = 0 ; i < n ; i++)
+		{
+		    W [i*na + a] = Rk [Pin [i]] ;
+		}
+	    }
+	}
+	if (sys == UMFPACK_A && do_scale && step == 0)
+	{
+	    flops += SCALE_FLOPS * n * na ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* solve with all active right-hand-sides at once */
+	/* ------------------------------------------------------------------ */
+
+	if (sys == UMFPACK_A)
+	{
+	    flops += UMF_mlsolve (Numeric, W, na, Pattern) ;
+	    flops += UMF_musolve (Numeric, W, na, Pattern) ;
+	}
+	else if (sys == UMFPACK_At)
+	{
+	    flops += UMF_muhsolve (Numeric, W, na, Pattern) ;
+	    flops += UMF_mlhsolve (Numeric, W, na, Pattern) ;
+	}
+	else
+	{
+	    flops += UMF_mutsolve (Numeric, W, na, Pattern) ;
+	    flops += UMF_mltsolve (Numeric, W, na, Pattern) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* scatter W into X, or add the correction to X */
+	/* ------------------------------------------------------------------ */
+
+	for (a = 0 ; a < na ; a++)
+	{
+	    k = cols [a] ;
+	    Xk = X + k*n ;
+	    for (i = 0 ; i < n ; i++)
+	    {
+		t = W [i*na + a] ;
+		if (sys != UMFPACK_A && do_scale)
+		{
+		    SCALE_ROW (t, Pout [i]) ;
+		}
+		if (step == 0)
+		{
+		    Xk [Pout [i]] = t ;
+		}
+		else
+		{
+		    ASSEMBLE (Xk [Pout [i]], t) ;
+		}
+	    }
+	}
+	if (sys != UMFPACK_A && do_scale)
+	{
+	    flops += SCALE_FLOPS * n * na ;
+	}
+	if (step > 0)
+	{
+	    flops += ASSEMBLE_FLOPS * n * na ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* sparse backward error estimate, for each active column */
+	/* ------------------------------------------------------------------ */
+
+	if (irstep == 0)
+	{
+	    continue ;
+	}
+
+	for (a = 0 ; a < na ; a++)
+	{
+	    k = cols [a] ;
+	    Xk = X + k*n ;
+	    Rk = R + k*n ;
+
+	    /* B2 = abs (B) */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		ASSIGN (t, Bx, Bz, i + (k1+k)*n, Bsplit) ;
+		ABS (B2 [i], t) ;
+	    }
+	    flops += ABS_FLOPS * n ;
+
+	    if (sys == UMFPACK_A)
+	    {
+
+		/* ---------------------------------------------------------- */
+		/* A is stored by column */
+		/* Rk (i) = R (b - A x)_i, residual */
+		/* Z2 (i) = R (|A||x|)_i */
+		/* ---------------------------------------------------------- */
+
+		for (i = 0 ; i < n ; i++)
+		{
+		    ASSIGN (Rk [i], Bx, Bz, i + (k1+k)*n, Bsplit) ;
+		    Z2 [i] = 0. ;
+		}
+		for (j = 0 ; j < n ; j++)
+		{
+		    xj = Xk [j] ;
+		    p2 = Ap [j+1] ;
+		    for (p = Ap [j] ; p < p2 ; p++)
+		    {
+			i = Ai [p] ;
+			ASSIGN (aij, Ax, Az, p, Asplit) ;
+			MULT (axx, aij, xj) ;
+			DECREMENT (Rk [i], axx) ;
+			ABS (d, axx) ;
+			Z2 [i] += d ;
+		    }
+		}
+
+		/* scale Rk, Z2, and B2 */
+		if (do_scale)
+		{
+		    for (i = 0 ; i < n ; i++)
+		    {
+			SCALE_ROW (Rk [i], i) ;
+		    }
+#ifndef NRECIPROCAL
+		    if (do_recip)
+		    {
+			for (i = 0 ; i < n ; i++)
+			{
+			    Z2 [i] *= Rs [i] ;
+			    B2 [i] *= Rs [i] ;
+			}
+		    }
+		    else
+#endif
+		    {
+			for (i = 0 ; i < n ; i++)
+			{
+			    Z2 [i] /= Rs [i] ;
+			    B2 [i] /= Rs [i] ;
+			}
+		    }
+		    flops += (SCALE_FLOPS + 2) * n ;
+		}
+
+	    }
+	    else
+	    {
+
+		/* ---------------------------------------------------------- */
+		/* A' and A.' are stored by row */
+		/* Rk (i) = (b - A' x)_i, residual */
+		/* Z2 (i) = (|A'||x|)_i */
+		/* ---------------------------------------------------------- */
+
+		for (i = 0 ; i < n ; i++)
+		{
+		    ASSIGN (wi, Bx, Bz, i + (k1+k)*n, Bsplit) ;
+		    z2i = 0. ;
+		    p2 = Ap [i+1] ;
+		    for (p = Ap [i] ; p < p2 ; p++)
+		    {
+			ASSIGN (aij, Ax, Az, p, Asplit) ;
+			if (sys == UMFPACK_At)
+			{
+			    /* axx = conjugate (Ax [p]) * X [Ai [p]] ; */
+			    MULT_CONJ (axx, Xk [Ai [p]], aij) ;
+			}
+			else
+			{
+			    /* axx = Ax [p] * X [Ai [p]] ; */
+			    MULT (axx, aij, Xk [Ai [p]]) ;
+			}
+			DECREMENT (wi, axx) ;
+			ABS (d, axx) ;
+			z2i += d ;
+		    }
+		    Rk [i] = wi ;
+		    Z2 [i] = z2i ;
+		}
+
+	    }
+
+	    flops += (MULT_FLOPS + DECREMENT_FLOPS + ABS_FLOPS + 1) * nz ;
+	    flops += (2*ABS_FLOPS + 5) * n ;
+	    attempted [k] = step ;
+	    if (do_mstep (omega [k], step, B2, Xk, Rk, Y, Z2, S + k*n, n,
+		&taken [k]))
+	    {
+		/* iterative refinement is done for this column */
+		active [k] = FALSE ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* copy the solution back, and collect the statistics */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < nb ; k++)
+    {
+	Xk = X + k*n ;
+	for (i = 0 ; i < n ; i++)
+	{
+	    PUT_ENTRY (Xk [i], Xx, Xz, i + (k1+k)*n, Xsplit) ;
+	}
+    }
+
+    if (irstep > 0)
+    {
+	Info [UMFPACK_OMEGA1] = 0 ;
+	Info [UMFPACK_OMEGA2] = 0 ;
+	for (k = 0 ; k < nb ; k++)
+	{
+	    Info [UMFPACK_IR_TAKEN] = MAX (Info [UMFPACK_IR_TAKEN], taken [k]) ;
+	    Info [UMFPACK_IR_ATTEMPTED] =
+		MAX (Info [UMFPACK_IR_ATTEMPTED], attempted [k]) ;
+	    for (i = 1 ; i <= 2 ; i++)
+	    {
+		/* propagate NaN's, which mark a failed column */
+		d = Info [UMFPACK_OMEGA1 + i - 1] ;
+		if (SCALAR_IS_NAN (omega [k][i]) || omega [k][i] > d)
+		{
+		    Info [UMFPACK_OMEGA1 + i - 1] = omega [k][i] ;
+		}
+	    }
+	}
+    }
+
+    Info [UMFPACK_SOLVE_FLOPS] = flops ;
+    return (status) ;
+}
+
+
+/* ========================================================================== */
+/* === do_mstep ============================================================= */
+/* ========================================================================== */
+
+/* Perform one step of iterative refinement for a single column, as do_step
+ * in umf_solve.c.  Returns TRUE if iterative refinement is done.  omega is
+ * the backward error of the solution X on output, and *taken is the number
+ * of refinement steps that X reflects. */
+
+PRIVATE Int do_mstep
+(
+    double omega [3],
+    Int step,			/* which step of iterative refinement to do */
+    const double B2 [ ],	/* abs (B) */
+    Entry X [ ],
+    const Entry W [ ],		/* residual */
+    const double Y [ ],
+    const double Z2 [ ],
+    Entry S [ ],		/* last solution, to reinstate if better */
+    Int n,
+    Int *taken
+)
+{
+    double last_omega [3], tau, nctau, d1, wd1, d2, wd2, xi, yix, wi, xnorm ;
+    Int i ;
+
+    nctau = 1000 * n * DBL_EPSILON ;
+
+    /* ---------------------------------------------------------------------- */
+    /* save the last iteration in case we need to reinstate it */
+    /* ---------------------------------------------------------------------- */
+
+    last_omega [0] = omega [0] ;
+    last_omega [1] = omega [1] ;
+    last_omega [2] = omega [2] ;
+
+    /* ---------------------------------------------------------------------- */
+    /* compute sparse backward errors: omega [1] and omega [2] */
+    /* ---------------------------------------------------------------------- */
+
+    /* xnorm = ||x|| maxnorm */
+    xnorm = 0.0 ;
+    for (i = 0 ; i < n ; i++)
+    {
+	ABS (xi, X [i]) ;
+	if (SCALAR_IS_NAN (xi))
+	{
+	    xnorm = xi ;
+	    break ;
+	}
+	xnorm = MAX (xnorm, xi) ;
+    }
+
+    omega [1] = 0. ;
+    omega [2] = 0. ;
+    for (i = 0 ; i < n ; i++)
+    {
+	yix = Y [i] * xnorm ;
+	tau = (yix + B2 [i]) * nctau ;
+	d1 = Z2 [i] + B2 [i] ;
+	ABS (wi, W [i]) ;
+	if (SCALAR_IS_NAN (d1))
+	{
+	    omega [1] = d1 ;
+	    omega [2] = d1 ;
+	    break ;
+	}
+	if (SCALAR_IS_NAN (tau))
+	{
+	    omega [1] = tau ;
+	    omega [2] = tau ;
+	    break ;
+	}
+	if (d1 > tau)
+	{
+	    wd1 = wi / d1 ;
+	    omega [1] = MAX (omega [1], wd1) ;
+	}
+	else if (tau > 0.0)
+	{
+	    d2 = Z2 [i] + yix ;
+	    wd2 = wi / d2 ;
+	    omega [2] = MAX (omega [2], wd2) ;
+	}
+    }
+
+    omega [0] = omega [1] + omega [2] ;
+    *taken = step ;
+
+    /* ---------------------------------------------------------------------- */
+    /* stop the iterations if the backward error is small, or NaN */
+    /* ---------------------------------------------------------------------- */
+
+    if (SCALAR_IS_NAN (omega [0]) || omega [0] < DBL_EPSILON)
+    {
+	return (TRUE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* stop if insufficient decrease in omega */
+    /* ---------------------------------------------------------------------- */
+
+    if (step > 0 && omega [0] > last_omega [0] / 2)
+    {
+	if (omega [0] > last_omega [0])
+	{
+	    /* last iteration better than this one, reinstate it */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		X [i] = S [i] ;
+	    }
+	    omega [0] = last_omega [0] ;
+	    omega [1] = last_omega [1] ;
+	    omega [2] = last_omega [2] ;
+	}
+	*taken = step - 1 ;
+	return (TRUE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* save current solution in case we need to reinstate */
+    /* ---------------------------------------------------------------------- */
+
+    for (i = 0 ; i < n ; i++)
+    {
+	S [i] = X [i] ;
+    }
+    return (FALSE) ;
+}
@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_musolve: solve UX=B for multiple right-hand-sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*  Solves UX = B, where U is the upper triangular factor of a matrix and B
+ *  has nrhs columns.  B is overwritten with the solution X.  X is stored by
+ *  row: X [i*nrhs + r] is entry (i,r).  See umf_mlsolve.c.
+ *  Returns the floating point operation count */
+
+#include "umf_internal.h"
+#include "umf_musolve.h"
+
+double UMF_musolve
+(
+    NumericType *Numeric,
+    Entry X [ ],		/* B on input, solution X on output, n-by-nrhs */
+    Int nrhs,			/* number of right-hand-sides, >= 1 */
+    Int Pattern [ ]		/* a work array of size n */
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    Entry ukj, dk ;
+    Entry *xp, *D, *Uval, *xk, *xj ;
+    Int k, deg, j, r, *ip, col, *Upos, *Uilen, pos,
+	*Uip, n, ulen, up, newUchain, npiv, n1, *Ui ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get parameters */
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric->n_row != Numeric->n_col) return (0.) ;
+    n = Numeric->n_row ;
+    npiv = Numeric->npiv ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    D = Numeric->D ;
+    n1 = Numeric->n1 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* singular case */
+    /* ---------------------------------------------------------------------- */
+
+#ifndef NO_DIVIDE_BY_ZERO
+    /* handle the singular part of D, up to just before the last pivot */
+    for (k = n-1 ; k >= npiv ; k--)
+    {
+	/* This is an *** intentional *** divide-by-zero, to get Inf or Nan,
+	 * as appropriate.  It is not a bug. */
+	ASSERT (IS_ZERO (D [k])) ;
+	xk = X + k*nrhs ;
+	dk = D [k] ;
+	for (r = 0 ; r < nrhs ; r++)
+	{
+	    DIV (xk [r], xk [r], dk) ;
+	}
+    }
+#else
+    /* Do not divide by zero */
+#endif
+
+    deg = Numeric->ulen ;
+    if (deg > 0)
+    {
+	/* :: make last pivot row of U (singular matrices only) :: */
+	for (j = 0 ; j < deg ; j++)
+	{
+	    Pattern [j] = Numeric->Upattern [j] ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* nonsingletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = npiv-1 ; k >= n1 ; k--)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* use row k of U */
+	/* ------------------------------------------------------------------ */
+
+	up = Uip [k] ;
+	ulen = Uilen [k] ;
+	newUchain = (up < 0) ;
+	if (newUchain)
+	{
+	    up = -up ;
+	    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+	}
+	else
+	{
+	    xp = (Entry *) (Numeric->Memory + up) ;
+	}
+
+	xk = X + k*nrhs ;
+	for (j = 0 ; j < deg ; j++)
+	{
+	    /* X [k, :] -= X [Pattern [j], :] * (*xp) ; */
+	    xj = X + Pattern [j] * nrhs ;
+	    ukj = *xp++ ;
+	    for (r = 0 ; r < nrhs ; r++)
+	    {
+		MULT_SUB (xk [r], xj [r], ukj) ;
+	    }
+	}
+
+	dk = D [k] ;
+#ifdef NO_DIVIDE_BY_ZERO
+	/* Do not divide by zero */
+	if (IS_NONZERO (dk))
+#endif
+	{
+	    /* Go ahead and divide by zero if D [k] is zero */
+	    for (r = 0 ; r < nrhs ; r++)
+	    {
+		DIV (xk [r], xk [r], dk) ;
+	    }
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* make row k-1 of U in Pattern [0..deg-1] */
+	/* ------------------------------------------------------------------ */
+
+	if (k == n1) break ;
+
+	if (newUchain)
+	{
+	    /* next row is a new Uchain */
+	    deg = ulen ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		col = *ip++ ;
+		ASSERT (k <= col) ;
+		Pattern [j] = col ;
+	    }
+	}
+	else
+	{
+	    deg -= ulen ;
+	    ASSERT (deg >= 0) ;
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* singletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Uilen [k] ;
+	xk = X + k*nrhs ;
+	if (deg > 0)
+	{
+	    up = Uip [k] ;
+	    Ui = (Int *) (Numeric->Memory + up) ;
+	    up += UNITS (Int, deg) ;
+	    Uval = (Entry *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		/* X [k, :] -= X [Ui [j], :] * Uval [j] ; */
+		ASSERT (Ui [j] >= 0 && Ui [j] < n) ;
+		xj = X + Ui [j] * nrhs ;
+		ukj = Uval [j] ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+		    MULT_SUB (xk [r], xj [r], ukj) ;
+		}
+	    }
+	}
+
+	dk = D [k] ;
+#ifdef NO_DIVIDE_BY_ZERO
+	/* Do not divide by zero */
+	if (IS_NONZERO (dk))
+#endif
+	{
+	    /* Go ahead and divide by zero if D [k] is zero */
+	    for (r = 0 ; r < nrhs ; r++)
+	    {
+		DIV (xk [r], xk [r], dk) ;
+	    }
+	}
+    }
+
+    return ((DIV_FLOPS * ((double) n) + MULTSUB_FLOPS * ((double) Numeric->unz))
+	* ((double) nrhs)) ;
+}
@@ -0,0 +1,285 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mutsolve: solve U'X=B for multiple right-hand-sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*  Solves U'X = B or U.'X=B, where U is the upper triangular factor of a */
+/*  matrix and B has nrhs columns.  B is overwritten with the solution X. */
+/*  X is stored by row: X [i*nrhs + r] is entry (i,r).  See umf_mlsolve.c. */
+/*  Returns the floating point operation count */
+
+#include "umf_internal.h"
+#include "umf_mutsolve.h"
+
+double
+#ifdef CONJUGATE_SOLVE
+UMF_muhsolve			/* solve U'X=B  (complex conjugate transpose) */
+#else
+UMF_mutsolve			/* solve U.'X=B (array transpose) */
+#endif
+(
+    NumericType *Numeric,
+    Entry X [ ],		/* B on input, solution X on output, n-by-nrhs */
+    Int nrhs,			/* number of right-hand-sides, >= 1 */
+    Int Pattern [ ]		/* a work array of size n */
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    Entry ukj, dk ;
+    Entry *xp, *D, *Uval, *xk, *xj ;
+    Int k, deg, j, r, *ip, col, *Upos, *Uilen, kstart, kend, up,
+	*Uip, n, uhead, ulen, pos, npiv, n1, *Ui ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get parameters */
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric->n_row != Numeric->n_col) return (0.) ;
+    n = Numeric->n_row ;
+    npiv = Numeric->npiv ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    D = Numeric->D ;
+    kend = 0 ;
+    n1 = Numeric->n1 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* singletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n1 ; k++)
+    {
+	xk = X + k*nrhs ;
+	dk = D [k] ;
+#ifdef NO_DIVIDE_BY_ZERO
+	/* Do not divide by zero */
+	if (IS_NONZERO (dk))
+#endif
+	{
+	    /* Go ahead and divide by zero if D [k] is zero. */
+	    for (r = 0 ; r < nrhs ; r++)
+	    {
+#ifdef CONJUGATE_SOLVE
+		/* X [k, :] = X [k, :] / conjugate (D [k]) ; */
+		DIV_CONJ (xk [r], xk [r], dk) ;
+#else
+		/* X [k, :] = X [k, :] / D [k] ; */
+		DIV (xk [r], xk [r], dk) ;
+#endif
+	    }
+	}
+
+	deg = Uilen [k] ;
+	if (deg > 0)
+	{
+	    up = Uip [k] ;
+	    Ui = (Int *) (Numeric->Memory + up) ;
+	    up += UNITS (Int, deg) ;
+	    Uval = (Entry *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		xj = X + Ui [j] * nrhs ;
+		ukj = Uval [j] ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+#ifdef CONJUGATE_SOLVE
+		    /* X [Ui [j], :] -= X [k, :] * conjugate (Uval [j]) ; */
+		    MULT_SUB_CONJ (xj [r], xk [r], ukj) ;
+#else
+		    /* X [Ui [j], :] -= X [k, :] * Uval [j] ; */
+		    MULT_SUB (xj [r], xk [r], ukj) ;
+#endif
+		}
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* nonsingletons */
+    /* ---------------------------------------------------------------------- */
+
+    for (kstart = n1 ; kstart < npiv ; kstart = kend + 1)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* find the end of this Uchain */
+	/* ------------------------------------------------------------------ */
+
+	kend = kstart ;
+	while (kend < npiv && Uip [kend+1] > 0)
+	{
+	    kend++ ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* start with last row in Uchain of U in Pattern [0..deg-1] */
+	/* ------------------------------------------------------------------ */
+
+	k = kend+1 ;
+	if (k == npiv)
+	{
+	    deg = Numeric->ulen ;
+	    if (deg > 0)
+	    {
+		/* :: make last pivot row of U (singular matrices only) :: */
+		for (j = 0 ; j < deg ; j++)
+		{
+		    Pattern [j] = Numeric->Upattern [j] ;
+		}
+	    }
+	}
+	else
+	{
+	    ASSERT (k >= 0 && k < npiv) ;
+	    up = -Uip [k] ;
+	    ASSERT (up > 0) ;
+	    deg = Uilen [k] ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		col = *ip++ ;
+		ASSERT (k <= col) ;
+		Pattern [j] = col ;
+	    }
+	}
+
+	/* empty the stack at the bottom of Pattern */
+	uhead = n ;
+
+	for (k = kend ; k > kstart ; k--)
+	{
+	    /* make row k-1 of U in Pattern [0..deg-1] */
+	    ASSERT (k >= 0 && k < npiv) ;
+	    ulen = Uilen [k] ;
+	    /* delete, and push on the stack */
+	    for (j = 0 ; j < ulen ; j++)
+	    {
+		ASSERT (uhead >= deg) ;
+		Pattern [--uhead] = Pattern [--deg] ;
+	    }
+	    ASSERT (deg >= 0) ;
+
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+
+	/* Pattern [0..deg-1] is now the pattern of the first row in Uchain */
+
+	/* ------------------------------------------------------------------ */
+	/* solve using this Uchain, in reverse order */
+	/* ------------------------------------------------------------------ */
+
+	for (k = kstart ; k <= kend ; k++)
+	{
+
+	    /* -------------------------------------------------------------- */
+	    /* construct row k */
+	    /* -------------------------------------------------------------- */
+
+	    ASSERT (k >= 0 && k < npiv) ;
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* remove the pivot column */
+		ASSERT (k > kstart) ;
+		ASSERT (pos >= 0 && pos < deg) ;
+		ASSERT (Pattern [pos] == k) ;
+		Pattern [pos] = Pattern [--deg] ;
+	    }
+
+	    up = Uip [k] ;
+	    ulen = Uilen [k] ;
+	    if (k > kstart)
+	    {
+		/* concatenate the deleted pattern; pop from the stack */
+		for (j = 0 ; j < ulen ; j++)
+		{
+		    ASSERT (deg <= uhead && uhead < n) ;
+		    Pattern [deg++] = Pattern [uhead++] ;
+		}
+		ASSERT (deg >= 0) ;
+	    }
+
+	    /* -------------------------------------------------------------- */
+	    /* use row k of U */
+	    /* -------------------------------------------------------------- */
+
+	    xk = X + k*nrhs ;
+	    dk = D [k] ;
+#ifdef NO_DIVIDE_BY_ZERO
+	    /* Do not divide by zero */
+	    if (IS_NONZERO (dk))
+#endif
+	    {
+		/* Go ahead and divide by zero if D [k] is zero. */
+		for (r = 0 ; r < nrhs ; r++)
+		{
+#ifdef CONJUGATE_SOLVE
+		    DIV_CONJ (xk [r], xk [r], dk) ;
+#else
+		    DIV (xk [r], xk [r], dk) ;
+#endif
+		}
+	    }
+
+	    if (k == kstart)
+	    {
+		up = -up ;
+		xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+	    }
+	    else
+	    {
+		xp = (Entry *) (Numeric->Memory + up) ;
+	    }
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		xj = X + Pattern [j] * nrhs ;
+		ukj = *xp++ ;
+		for (r = 0 ; r < nrhs ; r++)
+		{
+#ifdef CONJUGATE_SOLVE
+		    /* X [Pattern [j], :] -= X [k, :] * conjugate (*xp) ; */
+		    MULT_SUB_CONJ (xj [r], xk [r], ukj) ;
+#else
+		    /* X [Pattern [j], :] -= X [k, :] * (*xp) ; */
+		    MULT_SUB (xj [r], xk [r], ukj) ;
+#endif
+		}
+	    }
+	}
+	ASSERT (uhead == n) ;
+    }
+
+#ifndef NO_DIVIDE_BY_ZERO
+    for (k = npiv ; k < n ; k++)
+    {
+	/* This is an *** intentional *** divide-by-zero, to get Inf or Nan,
+	 * as appropriate.  It is not a bug. */
+	ASSERT (IS_ZERO (D [k])) ;
+	/* For conjugate solve, D [k] == conjugate (D [k]), in this case */
+	xk = X + k*nrhs ;
+	dk = D [k] ;
+	for (r = 0 ; r < nrhs ; r++)
+	{
+	    DIV (xk [r], xk [r], dk) ;
+	}
+    }
+#endif
+
+    return ((DIV_FLOPS * ((double) n) + MULTSUB_FLOPS * ((double) Numeric->unz))
+	* ((double) nrhs)) ;
+}
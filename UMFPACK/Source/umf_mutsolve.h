@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_mutsolve.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+double UMF_mutsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int nrhs,
+    Int Pattern [ ]
+) ;
+
+double UMF_muhsolve
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int nrhs,
+    Int Pattern [ ]
+) ;
@@ -452,6 +452,13 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfdi_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfdi_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfdi_mem_init_memoryspace
+#define UMF_mlsolve		 umfdi_mlsolve
+#define UMF_mltsolve		 umfdi_mltsolve
+#define UMF_mlhsolve		 umfdi_mlhsolve
+#define UMF_msolve		 umfdi_msolve
+#define UMF_musolve		 umfdi_musolve
+#define UMF_mutsolve		 umfdi_mutsolve
+#define UMF_muhsolve		 umfdi_muhsolve
 #define UMF_realloc		 umf_i_realloc
 #define UMF_report_perm		 umf_i_report_perm
 #define UMF_report_vector	 umfdi_report_vector
@@ -487,6 +494,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_di_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_di_get_determinant
 #define UMFPACK_numeric		 umfpack_di_numeric
+#define UMFPACK_refactor	 umfpack_di_refactor
 #define UMFPACK_qsymbolic	 umfpack_di_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_di_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_di_paru_symbolic
@@ -510,6 +518,7 @@ typedef struct
 #define UMFPACK_transpose	 umfpack_di_transpose
 #define UMFPACK_triplet_to_col	 umfpack_di_triplet_to_col
 #define UMFPACK_wsolve		 umfpack_di_wsolve
+#define UMFPACK_msolve		 umfpack_di_msolve
 
 // added in v6.1.0
 #define UMFPACK_serialize_symbolic      umfpack_di_serialize_symbolic
@@ -517,6 +526,7 @@ typedef struct
 #define UMFPACK_serialize_symbolic_size umfpack_di_serialize_symbolic_size
 #define UMFPACK_serialize_numeric       umfpack_di_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_di_deserialize_numeric
+#define UMFPACK_deserialize_numeric_view umfpack_di_deserialize_numeric_view
 #define UMFPACK_serialize_numeric_size  umfpack_di_serialize_numeric_size
 #define UMFPACK_copy_symbolic	        umfpack_di_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_di_copy_numeric
@@ -580,6 +590,13 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfdl_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfdl_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfdl_mem_init_memoryspace
+#define UMF_mlsolve		 umfdl_mlsolve
+#define UMF_mltsolve		 umfdl_mltsolve
+#define UMF_mlhsolve		 umfdl_mlhsolve
+#define UMF_msolve		 umfdl_msolve
+#define UMF_musolve		 umfdl_musolve
+#define UMF_mutsolve		 umfdl_mutsolve
+#define UMF_muhsolve		 umfdl_muhsolve
 #define UMF_realloc		 umf_l_realloc
 #define UMF_report_perm		 umf_l_report_perm
 #define UMF_report_vector	 umfdl_report_vector
@@ -615,6 +632,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_dl_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_dl_get_determinant
 #define UMFPACK_numeric		 umfpack_dl_numeric
+#define UMFPACK_refactor	 umfpack_dl_refactor
 #define UMFPACK_qsymbolic	 umfpack_dl_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_dl_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_dl_paru_symbolic
@@ -638,6 +656,7 @@ typedef struct
 #define UMFPACK_transpose	 umfpack_dl_transpose
 #define UMFPACK_triplet_to_col	 umfpack_dl_triplet_to_col
 #define UMFPACK_wsolve		 umfpack_dl_wsolve
+#define UMFPACK_msolve		 umfpack_dl_msolve
 
 // added in v6.1.0
 #define UMFPACK_serialize_symbolic      umfpack_dl_serialize_symbolic
@@ -645,6 +664,7 @@ typedef struct
 #define UMFPACK_serialize_symbolic_size umfpack_dl_serialize_symbolic_size
 #define UMFPACK_serialize_numeric       umfpack_dl_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_dl_deserialize_numeric
+#define UMFPACK_deserialize_numeric_view umfpack_dl_deserialize_numeric_view
 #define UMFPACK_serialize_numeric_size  umfpack_dl_serialize_numeric_size
 #define UMFPACK_copy_symbolic	        umfpack_dl_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_dl_copy_numeric
@@ -708,6 +728,13 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfzi_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfzi_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfzi_mem_init_memoryspace
+#define UMF_mlsolve		 umfzi_mlsolve
+#define UMF_mltsolve		 umfzi_mltsolve
+#define UMF_mlhsolve		 umfzi_mlhsolve
+#define UMF_msolve		 umfzi_msolve
+#define UMF_musolve		 umfzi_musolve
+#define UMF_mutsolve		 umfzi_mutsolve
+#define UMF_muhsolve		 umfzi_muhsolve
 #define UMF_realloc		 umf_i_realloc
 #define UMF_report_perm		 umf_i_report_perm
 #define UMF_report_vector	 umfzi_report_vector
@@ -743,6 +770,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_zi_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_zi_get_determinant
 #define UMFPACK_numeric		 umfpack_zi_numeric
+#define UMFPACK_refactor	 umfpack_zi_refactor
 #define UMFPACK_qsymbolic	 umfpack_zi_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_zi_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_zi_paru_symbolic
@@ -766,6 +794,7 @@ typedef struct
 #define UMFPACK_transpose	 umfpack_zi_transpose
 #define UMFPACK_triplet_to_col	 umfpack_zi_triplet_to_col
 #define UMFPACK_wsolve		 umfpack_zi_wsolve
+#define UMFPACK_msolve		 umfpack_zi_msolve
 
 // added in v6.1.0
 #define UMFPACK_serialize_symbolic      umfpack_zi_serialize_symbolic
@@ -773,6 +802,7 @@ typedef struct
 #define UMFPACK_serialize_symbolic_size umfpack_zi_serialize_symbolic_size
 #define UMFPACK_serialize_numeric       umfpack_zi_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_zi_deserialize_numeric
+#define UMFPACK_deserialize_numeric_view umfpack_zi_deserialize_numeric_view
 #define UMFPACK_serialize_numeric_size  umfpack_zi_serialize_numeric_size
 #define UMFPACK_copy_symbolic	        umfpack_zi_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_zi_copy_numeric
@@ -836,6 +866,13 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfzl_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfzl_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfzl_mem_init_memoryspace
+#define UMF_mlsolve		 umfzl_mlsolve
+#define UMF_mltsolve		 umfzl_mltsolve
+#define UMF_mlhsolve		 umfzl_mlhsolve
+#define UMF_msolve		 umfzl_msolve
+#define UMF_musolve		 umfzl_musolve
+#define UMF_mutsolve		 umfzl_mutsolve
+#define UMF_muhsolve		 umfzl_muhsolve
 #define UMF_realloc		 umf_l_realloc
 #define UMF_report_perm		 umf_l_report_perm
 #define UMF_report_vector	 umfzl_report_vector
@@ -871,6 +908,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_zl_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_zl_get_determinant
 #define UMFPACK_numeric		 umfpack_zl_numeric
+#define UMFPACK_refactor	 umfpack_zl_refactor
 #define UMFPACK_qsymbolic	 umfpack_zl_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_zl_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_zl_paru_symbolic
@@ -894,6 +932,7 @@ typedef struct
 #define UMFPACK_transpose	 umfpack_zl_transpose
 #define UMFPACK_triplet_to_col	 umfpack_zl_triplet_to_col
 #define UMFPACK_wsolve		 umfpack_zl_wsolve
+#define UMFPACK_msolve		 umfpack_zl_msolve
 
 // added in v6.1.0
 #define UMFPACK_serialize_symbolic      umfpack_zl_serialize_symbolic
@@ -901,6 +940,7 @@ typedef struct
 #define UMFPACK_serialize_symbolic_size umfpack_zl_serialize_symbolic_size
 #define UMFPACK_serialize_numeric       umfpack_zl_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_zl_deserialize_numeric
+#define UMFPACK_deserialize_numeric_view umfpack_zl_deserialize_numeric_view
 #define UMFPACK_serialize_numeric_size  umfpack_zl_serialize_numeric_size
 #define UMFPACK_copy_symbolic	        umfpack_zl_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_zl_copy_numeric
@@ -80,6 +80,7 @@ int UMFPACK_copy_numeric
     Numeric->Rs       = (double *) NULL ;
     Numeric->Memory   = (Unit *) NULL ;
     Numeric->Upattern = (Int *) NULL ;
+    Numeric->is_view  = FALSE ;
 
     // umfpack_free_numeric can now be safely called if an error occurs
 
@@ -9,7 +9,9 @@
 
 /*
     User-callable.  Loads a Numeric object from a serialized blob created by
-    umfpack_*_serialize_numeric.
+    umfpack_*_serialize_numeric.  UMFPACK_deserialize_numeric copies the blob
+    into a new Numeric object.  UMFPACK_deserialize_numeric_view allocates
+    only the NumericType header, and its arrays point into the blob itself.
     Initial contribution by Will Kimmerer (MIT); revised by Tim Davis.
 */
 
@@ -18,17 +20,36 @@
 #include "umf_malloc.h"
 #include "umf_free.h"
 
-// get a component of the Numeric object from the blob
-#define DESERIALIZE(object,type,n)                          \
-{                                                           \
-    object = (type *) UMF_malloc (n, sizeof (type)) ;       \
-    if (object == (type *) NULL)                            \
-    {                                                       \
-	UMFPACK_free_numeric ((void **) &Numeric) ;         \
-	return (UMFPACK_ERROR_out_of_memory) ;              \
-    }                                                       \
-    memcpy (object, blob + offset, (n) * sizeof (type)) ;   \
-    offset += (n) * sizeof (type) ;                         \
+// get a component of the Numeric object from the blob.  A view uses the
+// component in place, which requires it to be aligned in memory.
+#define DESERIALIZE(object,type,n)                                  \
+{                                                                   \
+    if (offset + (int64_t) ((n) * sizeof (type)) > blobsize)        \
+    {                                                               \
+	UMFPACK_free_numeric ((void **) &Numeric) ;                 \
+	return (UMFPACK_ERROR_invalid_blob) ;                       \
+    }                                                               \
+    if (view)                                                       \
+    {                                                               \
+	if (((uintptr_t) (blob + offset))                           \
+	    % MIN (sizeof (type), sizeof (double)) != 0)            \
+	{                                                           \
+	    UMFPACK_free_numeric ((void **) &Numeric) ;             \
+	    return (UMFPACK_ERROR_invalid_blob) ;                   \
+	}                                                           \
+	object = (type *) (blob + offset) ;                         \
+    }                                                               \
+    else                                                            \
+    {                                                               \
+	object = (type *) UMF_malloc (n, sizeof (type)) ;           \
+	if (object == (type *) NULL)                                \
+	{                                                           \
+	    UMFPACK_free_numeric ((void **) &Numeric) ;             \
+	    return (UMFPACK_ERROR_out_of_memory) ;                  \
+	}                                                           \
+	memcpy (object, blob + offset, (n) * sizeof (type)) ;       \
+    }                                                               \
+    offset += (n) * sizeof (type) ;                                 \
 }
 
 // get a single scalar from the blob
@@ -42,14 +63,15 @@
     offset += sizeof (type) ;                               \
 
 //==============================================================================
-//==== UMFPACK_deserialize_numeric =============================================
+//==== deserialize_numeric =====================================================
 //==============================================================================
 
-int UMFPACK_deserialize_numeric
+PRIVATE int deserialize_numeric
 (
     void **NumericHandle,   // output: Numeric object created from the blob
     int8_t *blob,           // input: serialized blob, not modified
-    int64_t blobsize        // size of the blob in bytes
+    int64_t blobsize,       // size of the blob in bytes
+    Int view                // if TRUE, the Numeric object is a view of blob
 )
 {
 
@@ -123,6 +145,7 @@ int UMFPACK_deserialize_numeric
     Numeric->Rs       = (double *) NULL ;
     Numeric->Memory   = (Unit *) NULL ;
     Numeric->Upattern = (Int *) NULL ;
+    Numeric->is_view  = view ;
 
     // UMFPACK_free_numeric can now be safely called if an error occurs
 
@@ -132,6 +155,11 @@ int UMFPACK_deserialize_numeric
 
     Int n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
     DESERIALIZE (Numeric->D,     Entry, n_inner+1) ;
+    if (Numeric->scale != UMFPACK_SCALE_NONE)
+    {
+	DESERIALIZE (Numeric->Rs, double, Numeric->n_row) ;
+    }
+    DESERIALIZE (Numeric->Memory, Unit, Numeric->size) ;
     DESERIALIZE (Numeric->Rperm, Int,   Numeric->n_row+1) ;
     DESERIALIZE (Numeric->Cperm, Int,   Numeric->n_col+1) ;
     DESERIALIZE (Numeric->Lpos,  Int,   Numeric->npiv+1) ;
@@ -140,15 +168,10 @@ int UMFPACK_deserialize_numeric
     DESERIALIZE (Numeric->Upos,  Int,   Numeric->npiv+1) ;
     DESERIALIZE (Numeric->Uilen, Int,   Numeric->npiv+1) ;
     DESERIALIZE (Numeric->Uip,   Int,   Numeric->npiv+1) ;
-    if (Numeric->scale != UMFPACK_SCALE_NONE)
-    {
-	DESERIALIZE (Numeric->Rs, double, Numeric->n_row) ;
-    }
     if (Numeric->ulen > 0)
     {
 	DESERIALIZE (Numeric->Upattern, Int, Numeric->ulen+1) ;
     }
-    DESERIALIZE (Numeric->Memory, Unit, Numeric->size) ;
 
     // make sure the Numeric object is valid
     ASSERT (UMF_valid_numeric (Numeric)) ;
@@ -158,3 +181,31 @@ int UMFPACK_deserialize_numeric
     return (UMFPACK_OK) ;
 }
 
+
+//==============================================================================
+//==== UMFPACK_deserialize_numeric =============================================
+//==============================================================================
+
+int UMFPACK_deserialize_numeric
+(
+    void **NumericHandle,   // output: Numeric object created from the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+)
+{
+    return (deserialize_numeric (NumericHandle, blob, blobsize, FALSE)) ;
+}
+
+//==============================================================================
+//==== UMFPACK_deserialize_numeric_view ========================================
+//==============================================================================
+
+int UMFPACK_deserialize_numeric_view
+(
+    void **NumericHandle,   // output: Numeric object viewing the blob
+    int8_t *blob,           // input: serialized blob, not modified
+    int64_t blobsize        // size of the blob in bytes
+)
+{
+    return (deserialize_numeric (NumericHandle, blob, blobsize, TRUE)) ;
+}
@@ -31,6 +31,14 @@ void UMFPACK_free_numeric
 	return ;
     }
 
+    if (Numeric->is_view)
+    {
+	/* the arrays are owned by the blob; free only the header */
+	(void) UMF_free ((void *) Numeric) ;
+	*NumericHandle = (void *) NULL ;
+	return ;
+    }
+
     /* these 9 objects always exist */
     (void) UMF_free ((void *) Numeric->D) ;
     (void) UMF_free ((void *) Numeric->Rperm) ;
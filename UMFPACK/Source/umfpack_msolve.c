@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umfpack_msolve: solve a linear system with multiple rhs
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    User-callable.  Solves a linear system with nrhs right-hand-sides using
+    the numerical factorization computed by UMFPACK_numeric.  See umfpack.h
+    for more details.
+
+    The columns of B are solved in blocks of UMF_MSOLVE_NB columns by
+    UMF_msolve.  If UMFPACK is compiled with OpenMP, the blocks are solved in
+    parallel, using up to omp_get_max_threads threads.
+
+    Dynamic memory usage:  UMFPACK_msolve calls UMF_malloc twice, for
+    workspace of size t*(c*n*sizeof(double) + n*sizeof(Int)), where t is the
+    number of threads used.  With nb = UMF_MSOLVE_NB, c is 4*nb+3 (real) or
+    8*nb+3 (complex) if iterative refinement is requested and A is not
+    singular, and 2*nb (real) or 4*nb (complex) otherwise.  On return, all of
+    this workspace is free'd via UMF_free.
+*/
+
+#include "umf_internal.h"
+#include "umf_valid_numeric.h"
+#include "umf_msolve.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+int UMFPACK_msolve
+(
+    int sys,
+    Int nrhs,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    double Xx [ ],
+#ifdef COMPLEX
+    double Xz [ ],
+#endif
+    const double Bx [ ],
+#ifdef COMPLEX
+    const double Bz [ ],
+#endif
+    void *NumericHandle,
+    const double Control [UMFPACK_CONTROL],
+    double User_Info [UMFPACK_INFO]
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    double Info2 [UMFPACK_INFO], stats [2] ;
+    double *Info, *W, *TInfo ;
+    NumericType *Numeric ;
+    Int n, i, irstep, status, nblocks, nthreads, block, *Pattern, wsize ;
+#ifndef NDEBUG
+    Int init_count ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* get the amount of time used by the process so far */
+    /* ---------------------------------------------------------------------- */
+
+    umfpack_tic (stats) ;
+
+#ifndef NDEBUG
+    init_count = UMF_malloc_count ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* get parameters */
+    /* ---------------------------------------------------------------------- */
+
+    irstep = GET_CONTROL (UMFPACK_IRSTEP, UMFPACK_DEFAULT_IRSTEP) ;
+    nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+
+    if (User_Info != (double *) NULL)
+    {
+	/* return Info in user's array */
+	Info = User_Info ;
+	/* clear the parts of Info that are set by UMFPACK_msolve */
+	for (i = UMFPACK_IR_TAKEN ; i <= UMFPACK_SOLVE_TIME ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+    else
+    {
+	/* no Info array passed - use local one instead */
+	Info = Info2 ;
+	for (i = 0 ; i < UMFPACK_INFO ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+
+    Info [UMFPACK_STATUS] = UMFPACK_OK ;
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+
+    Numeric = (NumericType *) NumericHandle ;
+    if (!UMF_valid_numeric (Numeric))
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_Numeric_object ;
+	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    Info [UMFPACK_NROW] = Numeric->n_row ;
+    Info [UMFPACK_NCOL] = Numeric->n_col ;
+
+    if (Numeric->n_row != Numeric->n_col
+	|| (sys != UMFPACK_A && sys != UMFPACK_At && sys != UMFPACK_Aat))
+    {
+	/* only square systems, and Ax=b, A'x=b, or A.'x=b, can be handled */
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_system ;
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+    n = Numeric->n_row ;
+    if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	/* turn off iterative refinement if A is singular */
+	/* or if U has NaN's on the diagonal. */
+	status = UMFPACK_WARNING_singular_matrix ;
+	irstep = 0 ;
+    }
+    else
+    {
+	status = UMFPACK_OK ;
+    }
+    irstep = MAX (0, irstep) ;
+
+    if (!Xx || !Bx)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_argument_missing ;
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+    if (irstep > 0 && (!Ap || !Ai || !Ax))
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_argument_missing ;
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    if (nrhs < 0)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_n_nonpositive ;
+	return (UMFPACK_ERROR_n_nonpositive) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the workspace */
+    /* ---------------------------------------------------------------------- */
+
+    nblocks = (nrhs + UMF_MSOLVE_NB - 1) / UMF_MSOLVE_NB ;
+    nthreads = MAX (1, MIN (nthreads, nblocks)) ;
+
+#ifdef COMPLEX
+    wsize = (irstep > 0) ? (8*UMF_MSOLVE_NB + 3) : (4*UMF_MSOLVE_NB) ;
+#else
+    wsize = (irstep > 0) ? (4*UMF_MSOLVE_NB + 3) : (2*UMF_MSOLVE_NB) ;
+#endif
+    wsize *= n ;
+
+    Pattern = (Int *) UMF_malloc (nthreads * n, sizeof (Int)) ;
+    W = (double *) UMF_malloc (nthreads * wsize + nblocks * 6,
+	sizeof (double)) ;
+    if (!W || !Pattern)
+    {
+	DEBUGm4 (("out of memory: solve work\n")) ;
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
+	(void) UMF_free ((void *) W) ;
+	(void) UMF_free ((void *) Pattern) ;
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+
+    /* TInfo [6*block ...] holds the status and statistics of each block */
+    TInfo = W + nthreads * wsize ;
+
+    /* ---------------------------------------------------------------------- */
+    /* solve each block of right-hand-sides */
+    /* ---------------------------------------------------------------------- */
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (block = 0 ; block < nblocks ; block++)
+    {
+	double BInfo [UMFPACK_INFO] ;
+	double *T = TInfo + 6*block ;
+	Int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+	Int k1 = block * UMF_MSOLVE_NB ;
+	Int k2 = MIN (nrhs, k1 + UMF_MSOLVE_NB) ;
+	T [0] = UMF_msolve (sys, Ap, Ai, Ax, Xx, Bx,
+#ifdef COMPLEX
+	    Az, Xz, Bz,
+#endif
+	    k1, k2, Numeric, irstep, BInfo, Pattern + tid*n, W + tid*wsize) ;
+	T [1] = BInfo [UMFPACK_SOLVE_FLOPS] ;
+	T [2] = BInfo [UMFPACK_IR_TAKEN] ;
+	T [3] = BInfo [UMFPACK_IR_ATTEMPTED] ;
+	T [4] = BInfo [UMFPACK_OMEGA1] ;
+	T [5] = BInfo [UMFPACK_OMEGA2] ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* collect the statistics */
+    /* ---------------------------------------------------------------------- */
+
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+    Info [UMFPACK_IR_TAKEN] = 0 ;
+    Info [UMFPACK_IR_ATTEMPTED] = 0 ;
+    if (irstep > 0)
+    {
+	Info [UMFPACK_NZ] = Ap [n] ;
+	Info [UMFPACK_OMEGA1] = 0 ;
+	Info [UMFPACK_OMEGA2] = 0 ;
+    }
+    for (block = 0 ; block < nblocks ; block++)
+    {
+	double *T = TInfo + 6*block ;
+	if (T [0] < UMFPACK_OK)
+	{
+	    status = (Int) T [0] ;
+	}
+	Info [UMFPACK_SOLVE_FLOPS] += T [1] ;
+	Info [UMFPACK_IR_TAKEN] = MAX (Info [UMFPACK_IR_TAKEN], T [2]) ;
+	Info [UMFPACK_IR_ATTEMPTED] = MAX (Info [UMFPACK_IR_ATTEMPTED], T [3]);
+	if (irstep > 0)
+	{
+	    for (i = 0 ; i < 2 ; i++)
+	    {
+		/* propagate NaN's */
+		if (SCALAR_IS_NAN (T [4+i])
+		    || T [4+i] > Info [UMFPACK_OMEGA1 + i])
+		{
+		    Info [UMFPACK_OMEGA1 + i] = T [4+i] ;
+		}
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* free the workspace */
+    /* ---------------------------------------------------------------------- */
+
+    (void) UMF_free ((void *) W) ;
+    (void) UMF_free ((void *) Pattern) ;
+    ASSERT (UMF_malloc_count == init_count) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the time used by UMFPACK_msolve */
+    /* ---------------------------------------------------------------------- */
+
+    Info [UMFPACK_STATUS] = status ;
+    if (status >= 0)
+    {
+	umfpack_toc (stats) ;
+	Info [UMFPACK_SOLVE_WALLTIME] = stats [0] ;
+	Info [UMFPACK_SOLVE_TIME] = stats [1] ;
+    }
+
+    return (status) ;
+}
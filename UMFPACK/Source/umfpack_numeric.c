@@ -556,6 +556,7 @@ PRIVATE Int numeric_alloc
 	return (FALSE) ;	/* out of memory */
     }
     Numeric->valid = 0 ;
+    Numeric->is_view = FALSE ;
     *NumericHandle = Numeric ;
 
     /* 9 allocations:  accounted for in UMF_set_stats (num_On_size1),
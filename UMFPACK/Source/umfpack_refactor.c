@@ -0,0 +1,917 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umfpack_refactor: numeric refactorization, same pattern
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    User-callable.  Refactorizes a matrix A with the same nonzero pattern as
+    the matrix held in an existing Numeric object, reusing its row and column
+    permutations and the pattern of its LU factors.  See umfpack.h for a
+    description.
+
+    The numerical values of L, U, and the row scale factors are recomputed in
+    place, in the existing Numeric->Memory, with a left-looking sparse LU
+    factorization that replays the pivot sequence found by UMFPACK_numeric.
+    No pivot search, frontal matrix assembly, or garbage collection is done.
+    If A, or the fill-in of its factorization, has a nonzero entry outside
+    the pattern of the prior LU factors, or if a pivot fails the threshold
+    partial pivoting test, the old Numeric object is freed and replaced by a
+    new one computed by UMFPACK_numeric.
+
+    Dynamic memory usage:  UMFPACK_refactor calls UMF_malloc 11 times, for
+    workspace of size 6*n+2 integers, n Entry's, and n pointers, plus
+    space for the pattern of L (lnz integers) and U (unz integers and unz
+    pointers), where lnz and unz are the number of entries in L and U held in
+    the Numeric object.  On return, all of this workspace is free'd via
+    UMF_free.  UMFPACK_numeric is called if the refactorization fails.
+*/
+
+#include "umf_internal.h"
+#include "umf_valid_numeric.h"
+#include "umf_valid_symbolic.h"
+#include "umf_set_stats.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+#ifndef NDEBUG
+PRIVATE Int init_count ;
+#endif
+
+PRIVATE Int get_L_pattern
+(
+    NumericType *Numeric,
+    Int Lp [ ],
+    Int Li [ ],
+    Entry *Lval [ ],
+    Int Pattern [ ]
+) ;
+
+PRIVATE Int get_U_pattern
+(
+    NumericType *Numeric,
+    Int Up [ ],
+    Int Ui [ ],
+    Entry *Uval [ ],
+    Int Pattern [ ],
+    Int Wi [ ]
+) ;
+
+PRIVATE Int refactor
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    NumericType *Numeric,
+    double tol,
+    const Int Lp [ ],
+    const Int Li [ ],
+    Entry *Lval [ ],
+    const Int Up [ ],
+    const Int Ui [ ],
+    Entry *Uval [ ],
+    Int Rinv [ ],
+    Int Mark [ ],
+    Entry X [ ]
+) ;
+
+/* ========================================================================== */
+/* === UMFPACK_refactor ===================================================== */
+/* ========================================================================== */
+
+int UMFPACK_refactor
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    void *SymbolicHandle,
+    void **NumericHandle,
+    const double Control [UMFPACK_CONTROL],
+    double User_Info [UMFPACK_INFO]
+)
+{
+
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    double Info2 [UMFPACK_INFO], stats [2], tol ;
+    double *Info ;
+    NumericType *Numeric ;
+    SymbolicType *Symbolic ;
+    Entry *X, **Lval, **Uval ;
+    Int n, i, status, ok, lnz, unz, *Lp, *Li, *Up, *Ui, *Rinv, *Mark,
+	*Pattern, *Wi ;
+    void *NewNumeric ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the amount of time used by the process so far */
+    /* ---------------------------------------------------------------------- */
+
+    umfpack_tic (stats) ;
+
+#ifndef NDEBUG
+    init_count = UMF_malloc_count ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* initialize and check inputs */
+    /* ---------------------------------------------------------------------- */
+
+    if (User_Info != (double *) NULL)
+    {
+	/* return Info in user's array */
+	Info = User_Info ;
+	/* clear the parts of Info that are set by UMFPACK_refactor */
+	for (i = UMFPACK_NUMERIC_SIZE ; i <= UMFPACK_MAX_FRONT_NCOLS ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+	for (i = UMFPACK_NUMERIC_DEFRAG ; i < UMFPACK_IR_TAKEN ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+	Info [UMFPACK_REFACTOR_FALLBACK] = EMPTY ;
+    }
+    else
+    {
+	/* no Info array passed - use local one instead */
+	Info = Info2 ;
+	for (i = 0 ; i < UMFPACK_INFO ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+
+    Symbolic = (SymbolicType *) SymbolicHandle ;
+    if (!UMF_valid_symbolic (Symbolic))
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_Symbolic_object ;
+	return (UMFPACK_ERROR_invalid_Symbolic_object) ;
+    }
+
+    Info [UMFPACK_STATUS] = UMFPACK_OK ;
+    Info [UMFPACK_NROW] = Symbolic->n_row ;
+    Info [UMFPACK_NCOL] = Symbolic->n_col ;
+    Info [UMFPACK_SIZE_OF_UNIT] = (double) (sizeof (Unit)) ;
+
+    if (!Ap || !Ai || !Ax || !NumericHandle)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_argument_missing ;
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    Info [UMFPACK_NZ] = Ap [Symbolic->n_col] ;
+
+    /* a view of a serialized blob cannot be modified */
+    Numeric = (NumericType *) (*NumericHandle) ;
+    if (!UMF_valid_numeric (Numeric) || Numeric->is_view
+	|| Numeric->n_row != Symbolic->n_row
+	|| Numeric->n_col != Symbolic->n_col)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_Numeric_object ;
+	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* refactorize in place, if possible */
+    /* ---------------------------------------------------------------------- */
+
+    /* The fast path is limited to square nonsingular matrices.  The pivots
+     * must satisfy the same threshold test used by UMFPACK_numeric to select
+     * them.  With the symmetric strategy, a diagonal pivot only needs to
+     * satisfy the smaller of the two tolerances. */
+
+    n = Numeric->n_row ;
+    ok = (Numeric->n_col == n && Numeric->npiv == n && Numeric->nnzpiv == n
+	&& Numeric->ulen == 0 && AMD_valid (n, n, Ap, Ai) == AMD_OK) ;
+    tol = Numeric->relpt ;
+    if (Symbolic->prefer_diagonal)
+    {
+	tol = MIN (tol, Numeric->relpt2) ;
+    }
+
+    if (ok)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* allocate workspace and get the column forms of L and U */
+	/* ------------------------------------------------------------------ */
+
+	Pattern = (Int *) UMF_malloc (n, sizeof (Int)) ;
+	Wi = (Int *) UMF_malloc (n, sizeof (Int)) ;
+	Rinv = (Int *) UMF_malloc (n, sizeof (Int)) ;
+	Mark = (Int *) UMF_malloc (n, sizeof (Int)) ;
+	X = (Entry *) UMF_malloc (n, sizeof (Entry)) ;
+	Lp = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+	Up = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+	Lval = (Entry **) UMF_malloc (n, sizeof (Entry *)) ;
+	Li = (Int *) NULL ;
+	Ui = (Int *) NULL ;
+	Uval = (Entry **) NULL ;
+
+	if (Pattern && Wi && Rinv && Mark && X && Lp && Up && Lval)
+	{
+	    lnz = get_L_pattern (Numeric, Lp, (Int *) NULL, Lval, Pattern) ;
+	    unz = get_U_pattern (Numeric, Up, (Int *) NULL, Uval, Pattern, Wi);
+	    Li = (Int *) UMF_malloc (lnz + 1, sizeof (Int)) ;
+	    Ui = (Int *) UMF_malloc (unz + 1, sizeof (Int)) ;
+	    Uval = (Entry **) UMF_malloc (unz + 1, sizeof (Entry *)) ;
+	}
+
+	if (!Li || !Ui || !Uval)
+	{
+	    DEBUGm4 (("out of memory: refactor\n")) ;
+	    (void) UMF_free ((void *) Pattern) ;
+	    (void) UMF_free ((void *) Wi) ;
+	    (void) UMF_free ((void *) Rinv) ;
+	    (void) UMF_free ((void *) Mark) ;
+	    (void) UMF_free ((void *) X) ;
+	    (void) UMF_free ((void *) Lp) ;
+	    (void) UMF_free ((void *) Up) ;
+	    (void) UMF_free ((void *) Lval) ;
+	    (void) UMF_free ((void *) Li) ;
+	    (void) UMF_free ((void *) Ui) ;
+	    (void) UMF_free ((void *) Uval) ;
+	    ASSERT (UMF_malloc_count == init_count) ;
+	    Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
+	    return (UMFPACK_ERROR_out_of_memory) ;
+	}
+
+	(void) get_L_pattern (Numeric, Lp, Li, Lval, Pattern) ;
+	(void) get_U_pattern (Numeric, Up, Ui, Uval, Pattern, Wi) ;
+
+	/* ------------------------------------------------------------------ */
+	/* refactorize, and free the workspace */
+	/* ------------------------------------------------------------------ */
+
+	ok = refactor (Ap, Ai, Ax,
+#ifdef COMPLEX
+	    Az,
+#endif
+	    Numeric, tol, Lp, Li, Lval, Up, Ui, Uval, Rinv, Mark, X) ;
+
+	(void) UMF_free ((void *) Pattern) ;
+	(void) UMF_free ((void *) Wi) ;
+	(void) UMF_free ((void *) Rinv) ;
+	(void) UMF_free ((void *) Mark) ;
+	(void) UMF_free ((void *) X) ;
+	(void) UMF_free ((void *) Lp) ;
+	(void) UMF_free ((void *) Up) ;
+	(void) UMF_free ((void *) Lval) ;
+	(void) UMF_free ((void *) Li) ;
+	(void) UMF_free ((void *) Ui) ;
+	(void) UMF_free ((void *) Uval) ;
+	ASSERT (UMF_malloc_count == init_count) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* fall back to a full numerical factorization, if needed */
+    /* ---------------------------------------------------------------------- */
+
+    if (!ok)
+    {
+	DEBUGm4 (("refactor failed, calling numeric\n")) ;
+	status = UMFPACK_numeric (Ap, Ai, Ax,
+#ifdef COMPLEX
+	    Az,
+#endif
+	    Symbolic, &NewNumeric, Control, Info) ;
+	UMFPACK_free_numeric (NumericHandle) ;
+	*NumericHandle = NewNumeric ;
+	Info [UMFPACK_REFACTOR_FALLBACK] = 1 ;
+	return (status) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* report the results */
+    /* ---------------------------------------------------------------------- */
+
+    UMF_set_stats (
+	Info,
+	Symbolic,
+	(double) Numeric->max_usage,	/* peak Numeric->Memory of the */
+					/* prior factorization */
+	(double) Numeric->size,		/* final Numeric->Memory */
+	Numeric->flops,			/* actual "true flops" */
+	(double) Numeric->lnz + n,	/* actual nz in L */
+	(double) Numeric->unz + Numeric->nnzpiv,	/* actual nz in U */
+	(double) Numeric->maxfrsize,	/* largest front size */
+	(double) Numeric->ulen,		/* Numeric->Upattern size */
+	(double) Numeric->npiv,		/* # pivots */
+	(double) Numeric->maxnrows,	/* largest #rows in front */
+	(double) Numeric->maxncols,	/* largest #cols in front */
+	Numeric->scale != UMFPACK_SCALE_NONE,
+	Symbolic->prefer_diagonal,
+	ACTUAL) ;
+
+    Info [UMFPACK_FORCED_UPDATES] = 0 ;
+    Info [UMFPACK_VARIABLE_INIT] = Numeric->init_usage ;
+    Info [UMFPACK_ALLOC_INIT_USED] = Numeric->alloc_init ;
+    Info [UMFPACK_NUMERIC_DEFRAG] = Numeric->ngarbage ;
+    Info [UMFPACK_NUMERIC_REALLOC] = Numeric->nrealloc ;
+    Info [UMFPACK_NUMERIC_COSTLY_REALLOC] = Numeric->ncostly ;
+    Info [UMFPACK_COMPRESSED_PATTERN] = Numeric->isize ;
+    Info [UMFPACK_LU_ENTRIES] = Numeric->nLentries + Numeric->nUentries +
+	    Numeric->npiv ;
+    Info [UMFPACK_UDIAG_NZ] = Numeric->nnzpiv ;
+    Info [UMFPACK_RSMIN] = Numeric->rsmin ;
+    Info [UMFPACK_RSMAX] = Numeric->rsmax ;
+    Info [UMFPACK_WAS_SCALED] = Numeric->scale ;
+    Info [UMFPACK_ALL_LNZ] = Numeric->all_lnz + n ;
+    Info [UMFPACK_ALL_UNZ] = Numeric->all_unz + Numeric->nnzpiv ;
+    Info [UMFPACK_NZDROPPED] =
+	  (Numeric->all_lnz - Numeric->lnz)
+	+ (Numeric->all_unz - Numeric->unz) ;
+    Info [UMFPACK_UMIN]  = Numeric->min_udiag ;
+    Info [UMFPACK_UMAX]  = Numeric->max_udiag ;
+    Info [UMFPACK_RCOND] = Numeric->rcond ;
+    Info [UMFPACK_REFACTOR_FALLBACK] = 0 ;
+
+    status = UMFPACK_OK ;
+    if (SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	/* U has an Inf on its diagonal */
+	status = UMFPACK_WARNING_singular_matrix ;
+    }
+    Info [UMFPACK_STATUS] = status ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the time used by UMFPACK_refactor */
+    /* ---------------------------------------------------------------------- */
+
+    umfpack_toc (stats) ;
+    Info [UMFPACK_NUMERIC_WALLTIME] = stats [0] ;
+    Info [UMFPACK_NUMERIC_TIME] = stats [1] ;
+
+    return (status) ;
+}
+
+
+/* ========================================================================== */
+/* === get_L_pattern ======================================================== */
+/* ========================================================================== */
+
+/* Unpacks the pattern of L into column form.  See get_L in
+ * umfpack_get_numeric.c for a description of how L is stored.  The row indices
+ * of column k of L are placed in Li [Lp [k] ... Lp [k+1]-1], and Lval [k]
+ * points to the numerical values of column k in Numeric->Memory, in the same
+ * order.  If Li is NULL, only Lp is computed, and the number of entries in L
+ * is returned. */
+
+PRIVATE Int get_L_pattern
+(
+    NumericType *Numeric,
+    Int Lp [ ],		/* of size npiv+1 */
+    Int Li [ ],		/* of size lnz, or NULL */
+    Entry *Lval [ ],	/* of size npiv */
+    Int Pattern [ ]	/* workspace of size n_row */
+)
+{
+    Int deg, *ip, j, k, lp, llen, pos, npiv, n1, *Lpos, *Lilen, *Lip, lnz ;
+
+    npiv = Numeric->npiv ;
+    n1 = Numeric->n1 ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    deg = 0 ;
+    lnz = 0 ;
+
+    /* singletons */
+    for (k = 0 ; k < n1 ; k++)
+    {
+	llen = Lilen [k] ;
+	if (Li == (Int *) NULL)
+	{
+	    Lp [k] = lnz ;
+	}
+	Lval [k] = (Entry *) NULL ;
+	if (llen == 0)
+	{
+	    continue ;
+	}
+	lp = Lip [k] ;
+	ip = (Int *) (Numeric->Memory + lp) ;
+	if (Li != (Int *) NULL)
+	{
+	    for (j = 0 ; j < llen ; j++)
+	    {
+		Li [Lp [k] + j] = ip [j] ;
+	    }
+	}
+	Lval [k] = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	lnz += llen ;
+    }
+
+    /* non-singletons */
+    for (k = n1 ; k < npiv ; k++)
+    {
+	/* make column of L in Pattern [0..deg-1] */
+	lp = Lip [k] ;
+	if (lp < 0)
+	{
+	    /* start of a new Lchain */
+	    lp = -lp ;
+	    deg = 0 ;
+	}
+	pos = Lpos [k] ;
+	if (pos != EMPTY)
+	{
+	    /* remove pivot row */
+	    ASSERT (pos >= 0 && pos < deg) ;
+	    ASSERT (Pattern [pos] == k) ;
+	    Pattern [pos] = Pattern [--deg] ;
+	}
+	ip = (Int *) (Numeric->Memory + lp) ;
+	llen = Lilen [k] ;
+	for (j = 0 ; j < llen ; j++)
+	{
+	    Pattern [deg++] = *ip++ ;
+	}
+	if (Li == (Int *) NULL)
+	{
+	    Lp [k] = lnz ;
+	}
+	else
+	{
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Li [Lp [k] + j] = Pattern [j] ;
+	    }
+	}
+	Lval [k] = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	lnz += deg ;
+    }
+
+    if (Li == (Int *) NULL)
+    {
+	Lp [npiv] = lnz ;
+    }
+    return (lnz) ;
+}
+
+
+/* ========================================================================== */
+/* === get_U_pattern ======================================================== */
+/* ========================================================================== */
+
+/* Transposes the pattern of U into column form.  See get_U in
+ * umfpack_get_numeric.c for a description of how U is stored.  The row indices
+ * of column k of U (excluding the diagonal) are placed in ascending order in
+ * Ui [Up [k] ... Up [k+1]-1], and Uval [p] points to the numerical value of
+ * the entry Ui [p] in Numeric->Memory.  If Ui is NULL, only Up is computed,
+ * and the number of entries in U is returned. */
+
+PRIVATE Int get_U_pattern
+(
+    NumericType *Numeric,
+    Int Up [ ],		/* of size n_col+1 */
+    Int Ui [ ],		/* of size unz, or NULL */
+    Entry *Uval [ ],	/* of size unz, or NULL */
+    Int Pattern [ ],	/* workspace of size n_col */
+    Int Wi [ ]		/* workspace of size n_col */
+)
+{
+    Entry *xp ;
+    Int deg, j, *ip, col, *Upos, *Uilen, *Uip, n_col, ulen, unz, p, k, up,
+	pos, npiv, n1, newUchain ;
+
+    n_col = Numeric->n_col ;
+    n1 = Numeric->n1 ;
+    npiv = Numeric->npiv ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+
+    if (Ui == (Int *) NULL)
+    {
+	for (col = 0 ; col < n_col ; col++)
+	{
+	    Wi [col] = 0 ;
+	}
+    }
+    else
+    {
+	for (col = 0 ; col < n_col ; col++)
+	{
+	    Wi [col] = Up [col+1] ;
+	}
+    }
+
+    /* the last row of U is empty, since the matrix is nonsingular */
+    ASSERT (Numeric->ulen == 0) ;
+    deg = 0 ;
+
+    /* non-singletons, in reverse order, so each column of U is sorted */
+    for (k = npiv-1 ; k >= n1 ; k--)
+    {
+	/* use row k of U */
+	up = Uip [k] ;
+	ulen = Uilen [k] ;
+	newUchain = (up < 0) ;
+	if (newUchain)
+	{
+	    up = -up ;
+	    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+	}
+	else
+	{
+	    xp = (Entry *) (Numeric->Memory + up) ;
+	}
+	for (j = deg-1 ; j >= 0 ; j--)
+	{
+	    col = Pattern [j] ;
+	    if (Ui == (Int *) NULL)
+	    {
+		Wi [col]++ ;
+	    }
+	    else
+	    {
+		p = --(Wi [col]) ;
+		Ui [p] = k ;
+		Uval [p] = xp + j ;
+	    }
+	}
+
+	/* make row k-1 of U in Pattern [0..deg-1] */
+	if (newUchain)
+	{
+	    /* next row is a new Uchain */
+	    deg = ulen ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Pattern [j] = *ip++ ;
+	    }
+	}
+	else
+	{
+	    deg -= ulen ;
+	    ASSERT (deg >= 0) ;
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* singletons */
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Uilen [k] ;
+	if (deg == 0)
+	{
+	    continue ;
+	}
+	up = Uip [k] ;
+	ip = (Int *) (Numeric->Memory + up) ;
+	xp = (Entry *) (Numeric->Memory + up + UNITS (Int, deg)) ;
+	for (j = 0 ; j < deg ; j++)
+	{
+	    col = ip [j] ;
+	    if (Ui == (Int *) NULL)
+	    {
+		Wi [col]++ ;
+	    }
+	    else
+	    {
+		p = --(Wi [col]) ;
+		Ui [p] = k ;
+		Uval [p] = xp + j ;
+	    }
+	}
+    }
+
+    /* create the column pointers */
+    if (Ui == (Int *) NULL)
+    {
+	unz = 0 ;
+	for (col = 0 ; col < n_col ; col++)
+	{
+	    Up [col] = unz ;
+	    unz += Wi [col] ;
+	}
+	Up [n_col] = unz ;
+    }
+    return (Up [n_col]) ;
+}
+
+
+/* ========================================================================== */
+/* === refactor ============================================================= */
+/* ========================================================================== */
+
+/* Recomputes the row scale factors and the numerical values of L and U in
+ * place, in the pivot order held in Numeric.  Column k of P*R*A*Q is computed
+ * by a sparse triangular solve with columns 0 to k-1 of L, using the known
+ * pattern of column k of L and U.  Returns TRUE if successful, or FALSE if a
+ * nonzero lies outside the pattern of L+U, or if a pivot is zero, NaN, or
+ * fails the threshold test.  The Numeric object is left in an undefined state
+ * if FALSE is returned. */
+
+PRIVATE Int refactor
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    NumericType *Numeric,
+    double tol,
+    const Int Lp [ ],
+    const Int Li [ ],
+    Entry *Lval [ ],
+    const Int Up [ ],
+    const Int Ui [ ],
+    Entry *Uval [ ],
+    Int Rinv [ ],
+    Int Mark [ ],
+    Entry X [ ]
+)
+{
+    Entry aij, ujk, pivot, *Lx, *D ;
+    double *Rs, rs, s, maxlk, flops, d, min_udiag, max_udiag ;
+    Int n, k, p, q, i, j, row, col, lnz, unz, ldeg, do_recip,
+	*Rperm, *Cperm ;
+#ifdef COMPLEX
+    Int split = SPLIT (Az) ;
+#endif
+
+    n = Numeric->n_row ;
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    Rs = Numeric->Rs ;
+    D = Numeric->D ;
+
+    /* ---------------------------------------------------------------------- */
+    /* recompute the scale factors, as done by UMF_kernel_init */
+    /* ---------------------------------------------------------------------- */
+
+    do_recip = FALSE ;
+    if (Rs != (double *) NULL)
+    {
+	Int do_max = (Numeric->scale == UMFPACK_SCALE_MAX) ;
+	for (row = 0 ; row < n ; row++)
+	{
+	    Rs [row] = 0.0 ;
+	}
+	for (col = 0 ; col < n ; col++)
+	{
+	    for (p = Ap [col] ; p < Ap [col+1] ; p++)
+	    {
+		row = Ai [p] ;
+		ASSIGN (aij, Ax, Az, p, split) ;
+		APPROX_ABS (s, aij) ;
+		rs = Rs [row] ;
+		if (!SCALAR_IS_NAN (rs))
+		{
+		    if (SCALAR_IS_NAN (s))
+		    {
+			Rs [row] = s ;
+		    }
+		    else if (do_max)
+		    {
+			Rs [row] = MAX (rs, s) ;
+		    }
+		    else
+		    {
+			Rs [row] += s ;
+		    }
+		}
+	    }
+	}
+	for (row = 0 ; row < n ; row++)
+	{
+	    rs = Rs [row] ;
+	    if (SCALAR_IS_ZERO (rs) || SCALAR_IS_NAN (rs))
+	    {
+		/* don't scale a completely zero row, or one with NaN's */
+		Rs [row] = 1.0 ;
+	    }
+	}
+	Numeric->rsmin = Rs [0] ;
+	Numeric->rsmax = Rs [0] ;
+	for (row = 0 ; row < n ; row++)
+	{
+	    Numeric->rsmin = MIN (Numeric->rsmin, Rs [row]) ;
+	    Numeric->rsmax = MAX (Numeric->rsmax, Rs [row]) ;
+	}
+#ifndef NRECIPROCAL
+	/* multiply by the reciprocal if Rs is not too small */
+	do_recip = (Numeric->rsmin >= RECIPROCAL_TOLERANCE) ;
+	if (do_recip)
+	{
+	    for (row = 0 ; row < n ; row++)
+	    {
+		Rs [row] = 1.0 / Rs [row] ;
+	    }
+	}
+#endif
+    }
+    Numeric->do_recip = do_recip ;
+
+    /* ---------------------------------------------------------------------- */
+    /* initializations */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+	Rinv [Rperm [k]] = k ;
+	Mark [k] = EMPTY ;
+    }
+    flops = 0 ;
+    lnz = 0 ;
+    unz = 0 ;
+    min_udiag = 0 ;
+    max_udiag = 0 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize each column of P*R*A*Q */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* clear X in the pattern of column k of L+U */
+	/* ------------------------------------------------------------------ */
+
+	for (p = Up [k] ; p < Up [k+1] ; p++)
+	{
+	    i = Ui [p] ;
+	    Mark [i] = k ;
+	    CLEAR (X [i]) ;
+	}
+	Mark [k] = k ;
+	CLEAR (X [k]) ;
+	for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	{
+	    i = Li [p] ;
+	    Mark [i] = k ;
+	    CLEAR (X [i]) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* scatter the scaled column Q (k) of A into X */
+	/* ------------------------------------------------------------------ */
+
+	col = Cperm [k] ;
+	for (p = Ap [col] ; p < Ap [col+1] ; p++)
+	{
+	    row = Ai [p] ;
+	    i = Rinv [row] ;
+	    ASSIGN (aij, Ax, Az, p, split) ;
+	    if (Mark [i] != k)
+	    {
+		if (IS_NONZERO (aij))
+		{
+		    /* A has a nonzero outside the pattern of L+U */
+		    return (FALSE) ;
+		}
+		continue ;
+	    }
+	    if (Rs != (double *) NULL)
+	    {
+#ifndef NRECIPROCAL
+		if (do_recip)
+		{
+		    SCALE (aij, Rs [row]) ;
+		}
+		else
+#endif
+		{
+		    SCALE_DIV (aij, Rs [row]) ;
+		}
+	    }
+	    ASSEMBLE (X [i], aij) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* solve for column k of U, in ascending row order */
+	/* ------------------------------------------------------------------ */
+
+	for (p = Up [k] ; p < Up [k+1] ; p++)
+	{
+	    j = Ui [p] ;
+	    ujk = X [j] ;
+	    *(Uval [p]) = ujk ;
+	    if (IS_ZERO (ujk))
+	    {
+		continue ;
+	    }
+	    unz++ ;
+	    Lx = Lval [j] ;
+	    ldeg = Lp [j+1] - Lp [j] ;
+	    for (q = 0 ; q < ldeg ; q++)
+	    {
+		i = Li [Lp [j] + q] ;
+		if (Mark [i] != k)
+		{
+		    if (IS_NONZERO (Lx [q]))
+		    {
+			/* fill-in outside the pattern of L+U */
+			return (FALSE) ;
+		    }
+		    continue ;
+		}
+		MULT_SUB (X [i], Lx [q], ujk) ;
+	    }
+	    flops += MULTSUB_FLOPS * ldeg ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* check the pivot */
+	/* ------------------------------------------------------------------ */
+
+	pivot = X [k] ;
+	D [k] = pivot ;
+	APPROX_ABS (s, pivot) ;
+	if (SCALAR_IS_ZERO (s) || SCALAR_IS_NAN (s))
+	{
+	    /* zero or NaN pivot */
+	    return (FALSE) ;
+	}
+	maxlk = 0 ;
+	for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	{
+	    double a ;
+	    APPROX_ABS (a, X [Li [p]]) ;
+	    maxlk = MAX (maxlk, a) ;
+	}
+	if (s < tol * maxlk)
+	{
+	    /* the pivot fails the threshold partial pivoting test */
+	    return (FALSE) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* compute column k of L */
+	/* ------------------------------------------------------------------ */
+
+	Lx = Lval [k] ;
+	ldeg = Lp [k+1] - Lp [k] ;
+	for (q = 0 ; q < ldeg ; q++)
+	{
+	    i = Li [Lp [k] + q] ;
+	    if (IS_NONZERO (X [i]))
+	    {
+		DIV (Lx [q], X [i], pivot) ;
+		lnz++ ;
+	    }
+	    else
+	    {
+		CLEAR (Lx [q]) ;
+	    }
+	}
+	flops += DIV_FLOPS * ldeg ;
+
+	/* ------------------------------------------------------------------ */
+	/* find the smallest and largest entries in D */
+	/* ------------------------------------------------------------------ */
+
+	ABS (d, pivot) ;
+	if (k == 0)
+	{
+	    min_udiag = d ;
+	    max_udiag = d ;
+	}
+	else
+	{
+	    min_udiag = MIN (min_udiag, d) ;
+	    max_udiag = MAX (max_udiag, d) ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* update the statistics held in the Numeric object */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric->flops = flops ;
+    Numeric->all_lnz += lnz - Numeric->lnz ;
+    Numeric->all_unz += unz - Numeric->unz ;
+    Numeric->lnz = lnz ;
+    Numeric->unz = unz ;
+    Numeric->nnzpiv = n ;
+    Numeric->min_udiag = min_udiag ;
+    Numeric->max_udiag = max_udiag ;
+    Numeric->rcond = SCALAR_IS_ZERO (max_udiag) ? 0 : (min_udiag / max_udiag) ;
+    Numeric->ngarbage = 0 ;
+    Numeric->nrealloc = 0 ;
+    Numeric->ncostly = 0 ;
+    return (TRUE) ;
+}
@@ -138,10 +138,22 @@ int UMFPACK_serialize_numeric
     SERIALIZE_INT32 (sizeof (double)) ;
     SERIALIZE_INT32 (sizeof (void *)) ;         // 32-bit vs 64-bit OS
 
-    // write the Numeric object to the blob
+    // write the Numeric object to the blob.  The arrays of doubles (D, Rs,
+    // and Memory) are written first, and the Int arrays last, so that each
+    // array starts on a suitably aligned offset.  This allows
+    // UMFPACK_deserialize_numeric_view to use the arrays in place.
     Int n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
     SERIALIZE (Numeric,             NumericType, 1) ;
     SERIALIZE (Numeric->D,          Entry, n_inner+1) ;
+    if (Numeric->scale != UMFPACK_SCALE_NONE)
+    {
+	/* only when dense rows are present */
+	SERIALIZE (Numeric->Rs, double, Numeric->n_row) ;
+    }
+    /* It is possible that some parts of Numeric->Memory are
+       unitialized and unused; this is OK, but it can generate
+       a valgrind warning. */
+    SERIALIZE (Numeric->Memory, Unit, Numeric->size) ;
     SERIALIZE (Numeric->Rperm,      Int, Numeric->n_row+1) ;
     SERIALIZE (Numeric->Cperm,      Int, Numeric->n_col+1) ;
     SERIALIZE (Numeric->Lpos,       Int, Numeric->npiv+1) ;
@@ -150,20 +162,11 @@ int UMFPACK_serialize_numeric
     SERIALIZE (Numeric->Upos,       Int, Numeric->npiv+1) ;
     SERIALIZE (Numeric->Uilen,      Int, Numeric->npiv+1) ;
     SERIALIZE (Numeric->Uip,        Int, Numeric->npiv+1) ;
-    if (Numeric->scale != UMFPACK_SCALE_NONE)
-    {
-	/* only when dense rows are present */
-	SERIALIZE (Numeric->Rs, double, Numeric->n_row) ;
-    }
     if (Numeric->ulen > 0)
     {
 	/* only when diagonal pivoting is prefered */
 	SERIALIZE (Numeric->Upattern, Int, Numeric->ulen+1) ;
     }
-    /* It is possible that some parts of Numeric->Memory are
-       unitialized and unused; this is OK, but it can generate
-       a valgrind warning. */
-    SERIALIZE (Numeric->Memory, Unit, Numeric->size) ;
 
     return (UMFPACK_OK) ;
 }
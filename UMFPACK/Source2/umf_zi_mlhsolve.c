@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_zi_mlhsolve.c:
+// double complex int32_t version of umf_mltsolve
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#define ZINT
+#define CONJUGATE_SOLVE
+#include "umf_mltsolve.c"
+
@@ -191,6 +191,17 @@ static void error (char *s, double x)
     exit (1) ;
 }
 
+/* ========================================================================== */
+/* set_nthreads: set the # of OpenMP threads UMFPACK can use */
+/* ========================================================================== */
+
+static void set_nthreads (Int nthreads)
+{
+#if defined ( _OPENMP )
+    omp_set_num_threads ((int) nthreads) ;
+#endif
+}
+
 /* ========================================================================== */
 /* resid: compute the (possibly permuted) residual.  return maxnorm of resid */
 /* ========================================================================== */
@@ -913,6 +924,156 @@ static double do_solvers
 	maxrnorm = MAX (rnorm, maxrnorm) ;
     }
 
+    /* ---------------------------------------------------------------------- */
+    /* msolve AX=B, A'X=B, and A.'X=B, with B = [b b b] */
+    /* ---------------------------------------------------------------------- */
+
+    {
+	double *B3, *B3z, *X3, *X3z ;
+	Int k, m, sys, nthreads, msplit ;
+	Int nthreads_save = SUITESPARSE_OPENMP_MAX_THREADS ;
+#ifdef COMPLEX
+	msplit = split ;
+	m = split ? n : 2*n ;	/* # of doubles in Bx per column */
+#else
+	msplit = FALSE ;
+	m = n ;
+#endif
+	B3 = (double *) malloc (6*n * sizeof (double)) ;    /* [ */
+	X3 = (double *) calloc (6*n , sizeof (double)) ;    /* [ */
+	if (!B3 || !X3) error ("out of memory (msolve)", 0.) ;
+	B3z = (msplit) ? (B3 + 3*n) : DNULL ;
+	X3z = (msplit) ? (X3 + 3*n) : DNULL ;
+	for (k = 0 ; k < 3 ; k++)
+	{
+	    for (i = 0 ; i < m ; i++)
+	    {
+		B3 [i + k*m] = b [i] ;
+		if (msplit) B3z [i + k*n] = bz [i] ;
+	    }
+	}
+
+	status = UMFPACK_msolve (UMFPACK_L, 3, Ap, Ai, CARG(Ax,Az), CARG(X3,X3z), CARG(B3,B3z), Numeric, Control, Info) ;
+	if (status != UMFPACK_ERROR_invalid_system) error ("msolve Lx=b should have failed\n", 0.) ;
+	status = UMFPACK_msolve (UMFPACK_A, -1, Ap, Ai, CARG(Ax,Az), CARG(X3,X3z), CARG(B3,B3z), Numeric, Control, Info) ;
+	if (status != UMFPACK_ERROR_n_nonpositive) error ("msolve nrhs<0 should have failed\n", 0.) ;
+
+	for (nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+	{
+	    set_nthreads (nthreads) ;
+	    for (sys = UMFPACK_A ; sys <= UMFPACK_Aat ; sys++)
+	    {
+		if (prl >= 2) printf ("5: do msolve: sys "ID" nthreads "ID"\n", sys, nthreads) ;
+		status = UMFPACK_msolve (sys, 3, Ap, Ai, CARG(Ax,Az), CARG(X3,X3z), CARG(B3,B3z), Numeric, Control, Info) ;
+		if (status == UMFPACK_WARNING_singular_matrix)
+		{
+		    if (prl >= 2) printf ("msolve singular\n") ;
+		}
+		else if (status != UMFPACK_OK)
+		{
+		    dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		    error ("msolve failure\n", 0.) ;
+		}
+		else
+		{
+		    for (k = 0 ; k < 3 ; k++)
+		    {
+			rnorm = resid (n, Ap, Ai, Ax, Az, X3 + k*m, (msplit) ? (X3z + k*n) : DNULL, b, bz, r, rz, sys, noP, noQ, Wx) ;
+			if (prl >= 2) printf ("6: rnorm msolve is %g\n", rnorm) ;
+			if (check_tol && rnorm > TOL)
+			{
+			    dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+			    error ("msolve inaccurate %g\n", rnorm) ;
+			}
+			maxrnorm = MAX (rnorm, maxrnorm) ;
+		    }
+		}
+	    }
+	}
+	set_nthreads (nthreads_save) ;
+
+	free (X3) ;	/* ] */
+	free (B3) ;	/* ] */
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* msolve AX=B must match solve, one column at a time, bit for bit */
+    /* ---------------------------------------------------------------------- */
+
+    /* nrhs = 17 and 37 span more than one block of UMF_MSOLVE_NB columns,
+     * with a partial last block, and the columns of B differ so that each
+     * column converges in its own # of refinement steps. */
+
+    {
+	double *Bm, *Bmz, *Xm, *Xmz, *Xs, *Xsz ;
+	Int k, m, sys, nthreads, msplit, nrhs, ir, s3, s4 ;
+	Int nthreads_save = SUITESPARSE_OPENMP_MAX_THREADS ;
+#ifdef COMPLEX
+	msplit = split ;
+	m = split ? n : 2*n ;	/* # of doubles in Bx per column */
+#else
+	msplit = FALSE ;
+	m = n ;
+#endif
+	Bm = (double *) malloc (2*37*n * sizeof (double)) ;	/* [ */
+	Xm = (double *) calloc (2*37*n , sizeof (double)) ;	/* [ */
+	Xs = (double *) calloc (2*37*n , sizeof (double)) ;	/* [ */
+	if (!Bm || !Xm || !Xs) error ("out of memory (msolve)", 0.) ;
+	Bmz = (msplit) ? (Bm + 37*n) : DNULL ;
+	Xmz = (msplit) ? (Xm + 37*n) : DNULL ;
+	Xsz = (msplit) ? (Xs + 37*n) : DNULL ;
+	for (k = 0 ; k < 37 ; k++)
+	{
+	    for (i = 0 ; i < m ; i++)
+	    {
+		Bm [i + k*m] = b [i] * (k+1) + (double) ((i+k) % 5) ;
+	    }
+	    if (msplit)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    Bmz [i + k*n] = bz [i] - (double) ((i+2*k) % 3) ;
+		}
+	    }
+	}
+
+	for (nrhs = 17 ; nrhs <= 37 ; nrhs += 20)
+	{
+	    for (ir = 0 ; ir <= 2 ; ir += 2)
+	    {
+		for (nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+		{
+		    Con [UMFPACK_IRSTEP] = ir ;
+		    set_nthreads (nthreads) ;
+		    for (sys = UMFPACK_A ; sys <= UMFPACK_Aat ; sys++)
+		    {
+			if (prl >= 2) printf ("7: msolve vs solve: sys "ID" nrhs "ID" irstep "ID" nthreads "ID"\n", sys, nrhs, ir, nthreads) ;
+			s3 = UMFPACK_msolve (sys, nrhs, Ap, Ai, CARG(Ax,Az), CARG(Xm,Xmz), CARG(Bm,Bmz), Numeric, Con, Info) ;
+			s4 = UMFPACK_OK ;
+			for (k = 0 ; k < nrhs ; k++)
+			{
+			    s4 = UMFPACK_solve (sys, Ap, Ai, CARG(Ax,Az), CARG(Xs + k*m, (msplit) ? (Xsz + k*n) : DNULL), CARG(Bm + k*m, (msplit) ? (Bmz + k*n) : DNULL), Numeric, Con, Info) ;
+			}
+			if (s3 != s4) error ("msolve and solve status differ\n", 0.) ;
+			if (s3 == UMFPACK_OK &&
+			   (memcmp (Xm, Xs, nrhs*m * sizeof (double)) != 0 ||
+			   (msplit && memcmp (Xmz, Xsz, nrhs*n * sizeof (double)) != 0)))
+			{
+			    error ("msolve and solve differ\n", 0.) ;
+			}
+		    }
+		}
+	    }
+	}
+
+	Con [UMFPACK_IRSTEP] = (Control) ? Control [UMFPACK_IRSTEP] : UMFPACK_DEFAULT_IRSTEP ;
+	set_nthreads (nthreads_save) ;
+
+	free (Xs) ;	/* ] */
+	free (Xm) ;	/* ] */
+	free (Bm) ;	/* ] */
+    }
+
     if (Control) Control [UMFPACK_IRSTEP] = orig ;
 
     /* ---------------------------------------------------------------------- */
@@ -2058,6 +2219,85 @@ static double do_symnum
     UMFPACK_report_status (Control, status) ;
     UMFPACK_report_info (Control, Info) ;
 
+    /* ---------------------------------------------------------------------- */
+    /* refactorize a copy of the Numeric object */
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric)
+    {
+	void *Numeric2 = NULL ;
+	double *Ax0, *Az0, rnorm2, RInfo [UMFPACK_INFO] ;
+	int umf_fail_save [3] ;
+	Int s1, s2 ;
+
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), (void *) NULL, &Numeric2, Control, RInfo) ;
+	if (s2 != UMFPACK_ERROR_invalid_Symbolic_object) error ("refactor 1", 0.) ;
+	s2 = UMFPACK_refactor (INULL, Ai, CARG(Ax,Az), Symbolic, &Numeric2, Control, RInfo) ;
+	if (s2 != UMFPACK_ERROR_argument_missing) error ("refactor 2", 0.) ;
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Symbolic, (void **) NULL, Control, RInfo) ;
+	if (s2 != UMFPACK_ERROR_argument_missing) error ("refactor 3", 0.) ;
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Symbolic, &Numeric2, Control, RInfo) ;
+	if (s2 != UMFPACK_ERROR_invalid_Numeric_object) error ("refactor 4", 0.) ;
+
+	s2 = UMFPACK_copy_numeric (&Numeric2, Numeric) ;
+	if (s2 != UMFPACK_OK) error ("refactor copy", 0.) ;
+
+	/* out of memory: the Numeric object is unchanged, unless */
+	/* UMFPACK_numeric was used (and failed) instead */
+	umf_fail_save [0] = umf_fail ;
+	umf_fail_save [1] = umf_fail_lo ;
+	umf_fail_save [2] = umf_fail_hi ;
+	umf_fail = 1 ;
+	umf_fail_lo = 0 ;
+	umf_fail_hi = 0 ;
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Symbolic, &Numeric2, Control, RInfo) ;
+	umf_fail    = umf_fail_save [0] ;
+	umf_fail_lo = umf_fail_save [1] ;
+	umf_fail_hi = umf_fail_save [2] ;
+	if (s2 != UMFPACK_ERROR_out_of_memory) error ("refactor 5", 0.) ;
+	if (!Numeric2)
+	{
+	    s2 = UMFPACK_copy_numeric (&Numeric2, Numeric) ;
+	    if (s2 != UMFPACK_OK) error ("refactor copy", 0.) ;
+	}
+
+	/* refactorize with the same values */
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Symbolic, &Numeric2, Control, RInfo) ;
+	if (s2 != RInfo [UMFPACK_STATUS]) error ("huh", (double) __LINE__)  ;
+	if (prl >= 2) printf ("refactor: status "ID" fallback %g\n", s2, RInfo [UMFPACK_REFACTOR_FALLBACK]) ;
+	if (RInfo [UMFPACK_REFACTOR_FALLBACK] == 0)
+	{
+	    if (s2 != UMFPACK_OK && s2 != UMFPACK_WARNING_singular_matrix) error ("refactor 6", 0.) ;
+	    if (n_row != n_col || ((NumericType *) Numeric)->nnzpiv < n) error ("refactor 7", 0.) ;
+	    s1 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x,xz), CARG(b,bz), Numeric, Control, DNULL) ;
+	    rnorm = resid (n, Ap, Ai, Ax, Az, x, xz, b, bz, r, rz, UMFPACK_A, noP, noQ, Wx) ;
+	    s2 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x,xz), CARG(b,bz), Numeric2, Control, DNULL) ;
+	    rnorm2 = resid (n, Ap, Ai, Ax, Az, x, xz, b, bz, r, rz, UMFPACK_A, noP, noQ, Wx) ;
+	    if (prl >= 2) printf ("refactor: rnorm %g %g\n", rnorm, rnorm2) ;
+	    if (s1 == UMFPACK_OK && s2 == UMFPACK_OK && rnorm2 > TOL && rnorm2 > 1e3 * rnorm)
+	    {
+		dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		error ("refactor inaccurate %g\n", rnorm2) ;
+	    }
+	}
+	else if (RInfo [UMFPACK_REFACTOR_FALLBACK] != 1)
+	{
+	    error ("refactor 8", 0.) ;
+	}
+
+	/* a zero matrix fails the pivot test; UMFPACK_numeric is used instead */
+	nz = Ap [n_col] ;
+	Ax0 = (double *) calloc (2*nz+2, sizeof (double)) ;	/* [ */
+	if (!Ax0) error ("out of memory (refactor)", 0.) ;
+	Az0 = (Az) ? (Ax0 + nz + 1) : DNULL ;
+	s2 = UMFPACK_refactor (Ap, Ai, CARG(Ax0,Az0), Symbolic, &Numeric2, Control, RInfo) ;
+	if (!Numeric2 || RInfo [UMFPACK_REFACTOR_FALLBACK] != 1) error ("refactor 9", 0.) ;
+	if (nz > 0 && s2 != UMFPACK_WARNING_singular_matrix) error ("refactor 10", 0.) ;
+	free (Ax0) ;						/* ] */
+
+	UMFPACK_free_numeric (&Numeric2) ;
+    }
+
     UMFPACK_free_symbolic (&Symbolic) ;			/* ) */
 
     if (!Numeric)
@@ -2448,6 +2688,86 @@ static double do_symnum
         Numeric_copy = NULL ;
     }
 
+    //--------------------------------------------------------------------------
+    // test deserialize_numeric_view
+    //--------------------------------------------------------------------------
+
+    {
+        void *Numeric_view = NULL ;
+        int umf_fail_save = umf_fail ;
+        Int lnz2, unz2, nnrow2, nncol2, nzud2 ;
+
+        // the view allocates only the NumericType header
+        umf_fail = 1 ;
+        status = UMFPACK_deserialize_numeric_view (&Numeric_view, N_blob,
+            N_blobsize) ;
+        if (Numeric_view || status != UMFPACK_ERROR_out_of_memory)
+        {
+            error ("deserialize numeric view should have failed\n", 0.) ;
+        }
+        umf_fail = 2 ;
+        status = UMFPACK_deserialize_numeric_view (&Numeric_view, N_blob,
+            N_blobsize) ;
+        umf_fail = umf_fail_save ;
+        if (status != UMFPACK_OK || !((NumericType *) Numeric_view)->is_view)
+        {
+            error ("deserialize numeric view failed\n", 0.) ;
+        }
+
+        // the view must refer to the same factorization as Numeric
+        status = UMFPACK_get_lunz (&lnz, &unz, &nnrow, &nncol, &nzud, Numeric);
+        if (status != UMFPACK_OK) error ("view lunz", 0.) ;
+        status = UMFPACK_get_lunz (&lnz2, &unz2, &nnrow2, &nncol2, &nzud2,
+            Numeric_view) ;
+        if (status != UMFPACK_OK || lnz != lnz2 || unz != unz2
+            || nnrow != nnrow2 || nncol != nncol2 || nzud != nzud2)
+        {
+            error ("view lunz mismatch", 0.) ;
+        }
+
+        // a copy of the view owns its arrays, and serializes to the same
+        // blob, except for the pointers held in the NumericType header
+        status = UMFPACK_copy_numeric (&Numeric_copy, Numeric_view) ;
+        UMFPACK_free_numeric (&Numeric_view) ;
+        if (status != UMFPACK_OK || Numeric_view != NULL) error ("view copy",0.);
+        int8_t *N_blob2 = malloc (N_blobsize) ;
+        if (!N_blob2) error ("out of memory", 0.) ;
+        status = UMFPACK_serialize_numeric (N_blob2, N_blobsize, Numeric_copy);
+        int64_t N_arrays = sizeof (int64_t) + 10 * sizeof (int32_t)
+            + sizeof (NumericType) ;
+        if (status != UMFPACK_OK || memcmp (N_blob + N_arrays,
+            N_blob2 + N_arrays, N_blobsize - N_arrays) != 0)
+        {
+            error ("view copy mismatch", 0.) ;
+        }
+        UMFPACK_free_numeric (&Numeric_copy) ;
+
+        // error handling
+        status = UMFPACK_deserialize_numeric_view (NULL, N_blob, N_blobsize) ;
+        if (status != UMFPACK_ERROR_argument_missing) error ("view 1", 0.) ;
+        status = UMFPACK_deserialize_numeric_view (&Numeric_view, N_blob, 1) ;
+        if (Numeric_view || status != UMFPACK_ERROR_invalid_blob)
+        {
+            error ("view 2", 0.) ;
+        }
+        // a misaligned blob cannot be viewed, but it can be copied
+        free (N_blob2) ;
+        N_blob2 = malloc (N_blobsize + 1) ;
+        if (!N_blob2) error ("out of memory", 0.) ;
+        memcpy (N_blob2 + 1, N_blob, N_blobsize) ;
+        status = UMFPACK_deserialize_numeric_view (&Numeric_view, N_blob2 + 1,
+            N_blobsize) ;
+        if (Numeric_view || status != UMFPACK_ERROR_invalid_blob)
+        {
+            error ("view 3", 0.) ;
+        }
+        status = UMFPACK_deserialize_numeric (&Numeric_copy, N_blob2 + 1,
+            N_blobsize) ;
+        if (status != UMFPACK_OK) error ("view 4", 0.) ;
+        UMFPACK_free_numeric (&Numeric_copy) ;
+        free (N_blob2) ;
+    }
+
     free (N_blob) ;
 
     /* ---------------------------------------------------------------------- */
@@ -3046,6 +3366,18 @@ static double do_matrix
             maxrnorm = MAX (rnorm, maxrnorm) ;
         }
     }
+
+    /* try the candidates of the "best" ordering one after the other */
+    {
+        Int nthreads_save = SUITESPARSE_OPENMP_MAX_THREADS ;
+        set_nthreads (1) ;
+        Control [UMFPACK_ORDERING] = UMFPACK_ORDERING_BEST ;
+        printf ("with ordering method best, nthreads 1\n") ;
+        rnorm = do_many (n, n, Ap, Ai, Ax,Az, b,bz, Control, noQinit, MemControl, FALSE, FALSE, 0., 0.) ;
+        maxrnorm = MAX (rnorm, maxrnorm) ;
+        set_nthreads (nthreads_save) ;
+    }
+
     Control [UMFPACK_ORDERING] = UMFPACK_DEFAULT_ORDERING ;
     Control [UMFPACK_SINGLETONS] = UMFPACK_DEFAULT_SINGLETONS ;
     Control [UMFPACK_PRL] = psave ;